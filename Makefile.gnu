@@ -36,6 +36,11 @@ src/proto.h:
 src/parse.c src/parse.h: src/parse.par
 	unicc -o src/parse src/parse.par
 
+src/targets.h: targets/*.tlt targets/tools/mktargets.awk
+	awk -f targets/tools/mktargets.awk targets/*.tlt >$@
+
+src/build.o: src/targets.h
+
 make_install:
 	cp Makefile.gnu Makefile
 
@@ -62,6 +67,9 @@ unicc.man: unicc.t2t
 TESTPREFIX=test_
 TESTEXPR="42 * 23 + 1337"
 TESTRESULT="= 2303"
+TESTCOMMENTEXPR="42 * /* comment */ 23 + 1337"
+TESTLETEXPR="let x = 42 * 23 + 1337"
+TESTSYMBOLS="12 id (3 id)"
 
 # C
 
@@ -75,7 +83,65 @@ $(TESTPREFIX)c_ast:
 	cc -o $@ $@.c
 	echo $(TESTEXPR) | ./$@ -sl
 
-test_c: $(TESTPREFIX)c_expr $(TESTPREFIX)c_ast
+$(TESTPREFIX)c_skip:
+	./unicc -o $@ examples/expr.skip.par
+	cc -o $@ $@.c
+	test "`echo $(TESTCOMMENTEXPR) | ./$@ -sl`" = "`echo $(TESTEXPR) | ./$@ -sl`"
+
+$(TESTPREFIX)c_packed:
+	./unicc -p -o $@ examples/expr.c.par
+	cc -o $@ $@.c
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+$(TESTPREFIX)c_comb:
+	./unicc -c -o $@ examples/expr.c.par
+	cc -o $@ $@.c
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+$(TESTPREFIX)c_split:
+	./unicc -U -o $@ examples/expr.c.par
+	cc -o $@ $@_tables.c $@_actions.c $@_scanner.c $@_parser.c
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+$(TESTPREFIX)c_jobs:
+	cp examples/expr.c.par $@_expr.par
+	cp examples/expr.ast.par $@_ast.par
+	echo $@_ast.par >$@.lst
+	./unicc -j 2 $@_expr.par @$@.lst
+	cc -o $@_expr $@_expr.c
+	cc -o $@_ast $@_ast.c
+	test "`echo $(TESTEXPR) | ./$@_expr -sl`" = $(TESTRESULT)
+	echo $(TESTEXPR) | ./$@_ast -sl
+
+$(TESTPREFIX)c_shared:
+	./unicc -o $@ examples/expr.shared.par
+	cc -o $@ $@.c
+	sed '/#shared lexers/d' examples/expr.shared.par >$@_plain.par
+	./unicc -o $@_plain $@_plain.par
+	cc -o $@_plain $@_plain.c
+	test "`echo $(TESTLETEXPR) | ./$@ -sl`" = "`echo $(TESTLETEXPR) | ./$@_plain -sl`"
+
+$(TESTPREFIX)c_lineinfo:
+	./unicc -o $@ examples/expr.c.par
+	grep -q "define UNICC_LINE_INFO[[:space:]]*0" $@.h
+	cc -o $@ $@.c
+	echo "1+" | ./$@ -sl 2>&1 | grep -q "^syntax error"
+	sed 's/printf( "= %d\\n", @expr )/printf( "%d: %d\\n", pcb->line, @expr )/' \
+		examples/expr.c.par >$@_line.par
+	./unicc -o $@_line $@_line.par
+	grep -q "define UNICC_LINE_INFO[[:space:]]*1" $@_line.h
+	cc -o $@_line $@_line.c
+	echo "1+" | ./$@_line -sl 2>&1 | grep -q "^line 1, column"
+
+$(TESTPREFIX)c_symbols:
+	./unicc -o $@ examples/symbols.par
+	cc -o $@ $@.c
+	test "`echo $(TESTSYMBOLS) | ./$@ -sl`" = ok
+
+test_c: $(TESTPREFIX)c_expr $(TESTPREFIX)c_ast $(TESTPREFIX)c_skip \
+		$(TESTPREFIX)c_shared $(TESTPREFIX)c_packed $(TESTPREFIX)c_comb \
+		$(TESTPREFIX)c_split $(TESTPREFIX)c_jobs $(TESTPREFIX)c_lineinfo \
+		$(TESTPREFIX)c_symbols
 	@echo "--- $@ succeeded ---"
 	@rm $(TESTPREFIX)*
 
@@ -92,7 +158,21 @@ $(TESTPREFIX)cpp_ast:
 	g++ -o $@ $@.cpp
 	echo $(TESTEXPR) | ./$@ -sl
 
-test_cpp: $(TESTPREFIX)cpp_expr $(TESTPREFIX)cpp_ast
+$(TESTPREFIX)cpp_multi:
+	./unicc -l C,C++ -o $@ examples/expr.ast.par
+	cc -o $@_c $@.c
+	g++ -o $@ $@.cpp
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = "`echo $(TESTEXPR) | ./$@_c -sl`"
+
+$(TESTPREFIX)cpp_symbols:
+	sed 's/^%!language.*/%!language      "C++";/' examples/symbols.par \
+		>$@.par
+	./unicc -o $@ $@.par
+	g++ -o $@ $@.cpp
+	test "`echo $(TESTSYMBOLS) | ./$@ -sl`" = ok
+
+test_cpp: $(TESTPREFIX)cpp_expr $(TESTPREFIX)cpp_ast $(TESTPREFIX)cpp_multi \
+		$(TESTPREFIX)cpp_symbols
 	@echo "--- $@ succeeded ---"
 	@rm $(TESTPREFIX)*
 
@@ -108,7 +188,18 @@ $(TESTPREFIX)py_ast:
 	-python2 $@.py $(TESTEXPR)
 	python3 $@.py $(TESTEXPR)
 
-test_py: $(TESTPREFIX)py_expr $(TESTPREFIX)py_ast
+$(TESTPREFIX)py_skip:
+	./unicc -l Python -o $@ examples/expr.skip.par
+	test "`python3 $@.py $(TESTCOMMENTEXPR)`" = "`python3 $@.py $(TESTEXPR)`"
+
+$(TESTPREFIX)py_shared:
+	./unicc -l Python -o $@ examples/expr.shared.par
+	sed '/#shared lexers/d' examples/expr.shared.par >$@_plain.par
+	./unicc -l Python -o $@_plain $@_plain.par
+	test "`python3 $@.py $(TESTLETEXPR)`" = "`python3 $@_plain.py $(TESTLETEXPR)`"
+
+test_py: $(TESTPREFIX)py_expr $(TESTPREFIX)py_ast $(TESTPREFIX)py_skip \
+		$(TESTPREFIX)py_shared
 	@echo "--- $@ succeeded ---"
 	@rm $(TESTPREFIX)*
 
@@ -138,7 +229,20 @@ test_json: $(TESTPREFIX)js_expr $(TESTPREFIX)json_ast
 	@echo "--- $@ succeded ---"
 	@rm $(TESTPREFIX)*
 
+# Templates
+
+$(TESTPREFIX)tlt_conditions:
+	UNICC_TPLDIR=examples ./unicc -l Conditions -o $@_dates examples/dates.par
+	test "`cat $@_dates.txt`" = "`printf 'no-ast\nno-skip\nlexers'`"
+	UNICC_TPLDIR=examples ./unicc -l Conditions -o $@_skip \
+		examples/expr.skip.par
+	test "`cat $@_skip.txt`" = "`printf 'ast\nlexers'`"
+
+test_tlt: $(TESTPREFIX)tlt_conditions
+	@echo "--- $@ succeeded ---"
+	@rm $(TESTPREFIX)*
+
 # Test
 
-test: test_c test_cpp test_py test_js test_json
+test: test_c test_cpp test_py test_js test_json test_tlt
 	@echo "=== $+ succeeded ==="
@@ -1027,6 +1027,99 @@ static int ccl_SORTFUNC( parray* arr, void* a, void* b )
 	return ((pcrange*)b)->begin - ((pcrange*)a)->begin;
 }
 
+/* Test bit of character //ch// in the bitmap //map// */
+#define pccl_MAPTEST( map, ch ) \
+	( (map)[ (ch) / PCCL_MAP_BITS ] & ( 1U << ( (ch) % PCCL_MAP_BITS ) ) )
+
+/* Sets the bits of the range from //begin// to //end// in the bitmap of //ccl//,
+as far as they are below PCCL_MAP_MAX. */
+static void pccl_MAPRANGE( pccl* ccl, wchar_t begin, wchar_t end )
+{
+	if( end >= PCCL_MAP_MAX )
+		end = PCCL_MAP_MAX - 1;
+
+	while( begin <= end )
+	{
+		/* Fill entire words at once */
+		if( !( begin % PCCL_MAP_BITS ) && begin + PCCL_MAP_BITS - 1 <= end )
+		{
+			ccl->map[ begin / PCCL_MAP_BITS ] = ~0U;
+			begin += PCCL_MAP_BITS;
+		}
+		else
+		{
+			ccl->map[ begin / PCCL_MAP_BITS ] |=
+				1U << ( begin % PCCL_MAP_BITS );
+			begin++;
+		}
+	}
+}
+
+/* Rebuilds the bitmap of //ccl// from its ranges. */
+static void pccl_MAP( pccl* ccl )
+{
+	pcrange*	cr;
+
+	memset( ccl->map, 0, sizeof( ccl->map ) );
+
+	parray_for( &ccl->ranges, cr )
+	{
+		if( cr->begin >= PCCL_MAP_MAX )
+			break;
+
+		pccl_MAPRANGE( ccl, cr->begin, cr->end );
+	}
+}
+
+/* Checks if //ccl// is entirely represented by its bitmap. */
+static pboolean pccl_MAPPED( pccl* ccl )
+{
+	pcrange*	cr;
+
+	if( !( cr = (pcrange*)parray_last( &ccl->ranges ) ) )
+		return TRUE;
+
+	return cr->end < PCCL_MAP_MAX;
+}
+
+/* Checks if //l// and //r// can be processed by their bitmaps only. */
+static pboolean pccl_MAPCOMPAT( pccl* l, pccl* r )
+{
+	return l->min == r->min && l->max == r->max
+			&& pccl_MAPPED( l ) && pccl_MAPPED( r );
+}
+
+/* Fills the empty character-class //ccl// with the ranges of the bitmap
+//map//. The resulting ranges are already normalized. */
+static void pccl_FROMMAP( pccl* ccl, unsigned int* map )
+{
+	pcrange		cr;
+	wchar_t		ch;
+
+	for( ch = 0; ch < PCCL_MAP_MAX; ch++ )
+	{
+		/* Skip entire empty words */
+		if( !map[ ch / PCCL_MAP_BITS ] )
+		{
+			ch += PCCL_MAP_BITS - 1 - ch % PCCL_MAP_BITS;
+			continue;
+		}
+
+		if( !pccl_MAPTEST( map, ch ) )
+			continue;
+
+		cr.begin = ch;
+
+		while( ch + 1 < PCCL_MAP_MAX && pccl_MAPTEST( map, ch + 1 ) )
+			ch++;
+
+		cr.end = ch;
+		parray_push( &ccl->ranges, &cr );
+	}
+
+	memcpy( ccl->map, map, sizeof( ccl->map ) );
+}
+
 /** Constructor function to create a new character-class.
 
 //min// and //max// can either be specified as -1, so the configured default
@@ -1132,11 +1225,157 @@ pccl* pccl_dup( pccl* ccl )
 
 	/* Copy elements */
 	parray_for( &ccl->ranges, cr )
-		pccl_ADDRANGE( dup, cr->begin, cr->end );
+		parray_push( &dup->ranges, cr );
+
+	memcpy( dup->map, ccl->map, sizeof( ccl->map ) );
 
 	return dup;
 }
 
+/* Table of interned character-classes, organized in buckets by hash */
+#define PCCL_INTERN_BUCKETS		1021
+static parray*	pccl_intern_tab;
+
+/* Computes the hash value over the ranges of //ccl//. */
+static size_t pccl_HASH( pccl* ccl )
+{
+	pcrange*	cr;
+	size_t		hashval	= 5381L;
+
+	parray_for( &ccl->ranges, cr )
+	{
+		hashval += ( hashval << 7 ) + cr->begin;
+		hashval += ( hashval << 7 ) + cr->end;
+	}
+
+	return hashval;
+}
+
+/** Interns a character-class.
+
+Returns the shared instance of the character-class that is equal to //ccl//.
+If such an instance already exists, //ccl// is freed and the existing instance
+is returned, else //ccl// itself becomes the shared instance.
+
+Interned character-classes are reference-counted and must not be modified
+anymore, because they may be used at several places at once. They can be
+compared by their pointers, and are released using pccl_free() as usual.
+
+//ccl// is the pointer to the character-class to be interned. If it is already
+an interned instance, only its reference count is increased.
+
+Returns the pointer to the interned character-class.
+*/
+pccl* pccl_intern( pccl* ccl )
+{
+	parray*		bucket;
+	pccl**		icl;
+	int			i;
+
+	if( !ccl )
+	{
+		WRONGPARAM;
+		return (pccl*)NULL;
+	}
+
+	if( ccl->refs )
+	{
+		ccl->refs++;
+		return ccl;
+	}
+
+	if( !pccl_intern_tab )
+	{
+		pccl_intern_tab = (parray*)pmalloc(
+							PCCL_INTERN_BUCKETS * sizeof( parray ) );
+
+		for( i = 0; i < PCCL_INTERN_BUCKETS; i++ )
+			parray_init( &pccl_intern_tab[ i ], sizeof( pccl* ), 0 );
+	}
+
+	ccl->hash = pccl_HASH( ccl );
+	bucket = &pccl_intern_tab[ ccl->hash % PCCL_INTERN_BUCKETS ];
+
+	parray_for( bucket, icl )
+	{
+		if( (*icl)->hash == ccl->hash
+				&& (*icl)->min == ccl->min && (*icl)->max == ccl->max
+					&& !pccl_compare( *icl, ccl ) )
+		{
+			pccl_free( ccl );
+
+			(*icl)->refs++;
+			return *icl;
+		}
+	}
+
+	ccl->refs = 1;
+	parray_push( bucket, &ccl );
+
+	return ccl;
+}
+
+/** Looks up the interned instance of a character-class.
+
+In opposite to pccl_intern(), //ccl// is neither consumed nor interned itself,
+so this function can be used to test for an equal, already interned
+character-class without any allocation.
+
+//ccl// is the pointer to the character-class to be looked up.
+
+Returns the pointer to the interned character-class that is equal to //ccl//,
+or (pccl*)NULL if no such instance exists.
+*/
+pccl* pccl_interned( pccl* ccl )
+{
+	parray*		bucket;
+	pccl**		icl;
+	size_t		hash;
+
+	if( !ccl )
+	{
+		WRONGPARAM;
+		return (pccl*)NULL;
+	}
+
+	if( ccl->refs )
+		return ccl;
+
+	if( !pccl_intern_tab )
+		return (pccl*)NULL;
+
+	hash = pccl_HASH( ccl );
+	bucket = &pccl_intern_tab[ hash % PCCL_INTERN_BUCKETS ];
+
+	parray_for( bucket, icl )
+	{
+		if( (*icl)->hash == hash
+				&& (*icl)->min == ccl->min && (*icl)->max == ccl->max
+					&& !pccl_compare( *icl, ccl ) )
+			return *icl;
+	}
+
+	return (pccl*)NULL;
+}
+
+/* Removes the interned character-class //ccl// from the intern table. */
+static void pccl_UNINTERN( pccl* ccl )
+{
+	parray*		bucket;
+	pccl**		icl;
+
+	bucket = &pccl_intern_tab[ ccl->hash % PCCL_INTERN_BUCKETS ];
+
+	parray_for( bucket, icl )
+	{
+		if( *icl == ccl )
+		{
+			parray_remove( bucket, parray_offset( bucket, icl ), NULL );
+			break;
+		}
+	}
+}
+
 /* Normalizes a pre-parsed or modified character-class.
 
 Normalization means, that duplicate elements will be removed, the range pairs
@@ -1204,6 +1443,16 @@ pboolean pccl_testrange( pccl* ccl, wchar_t begin, wchar_t end )
 {
 	pcrange*	cr;
 
+	/* Latin-1 ranges can be tested on the bitmap */
+	if( end < PCCL_MAP_MAX )
+	{
+		for( ; begin <= end; begin++ )
+			if( !pccl_MAPTEST( ccl->map, begin ) )
+				return FALSE;
+
+		return TRUE;
+	}
+
 	parray_for( &ccl->ranges, cr )
 		if( begin >= cr->begin && end <= cr->end )
 			return TRUE;
@@ -1259,6 +1508,7 @@ pboolean pccl_instest( pccl* ccl, wchar_t ch )
 static pboolean pccl_ADDRANGE( pccl* ccl, wchar_t begin, wchar_t end )
 {
 	pcrange		cr;
+	pcrange*	r;
 
 	if( begin > end )
 	{
@@ -1277,15 +1527,21 @@ static pboolean pccl_ADDRANGE( pccl* ccl, wchar_t begin, wchar_t end )
 	if( cr.end > ccl->max )
 		cr.end = ccl->max;
 
-	if( pccl_testrange( ccl, cr.begin, cr.end ) )
-		/* Range already in character-class */
-		return TRUE;
+	/* The bitmap may not be up-to-date here, so check on the ranges */
+	parray_for( &ccl->ranges, r )
+		if( cr.begin >= r->begin && cr.end <= r->end )
+			/* Range already in character-class */
+			return TRUE;
 
 	if( cr.begin > ccl->max || cr.end < ccl->min )
 		/* Character-range not in the universe of character-class */
 		return FALSE;
 
-	return parray_push( &ccl->ranges, &cr ) ? TRUE : FALSE;
+	if( !parray_push( &ccl->ranges, &cr ) )
+		return FALSE;
+
+	pccl_MAPRANGE( ccl, cr.begin, cr.end );
+	return TRUE;
 }
 
 /** Integrates a character range into a character-class.
@@ -1382,6 +1638,8 @@ pboolean pccl_delrange( pccl* ccl, wchar_t begin, wchar_t end )
 	while( r );
 
 	pccl_normalize( ccl );
+	pccl_MAP( ccl );
+
 	return TRUE;
 }
 
@@ -1438,6 +1696,7 @@ pccl* pccl_negate( pccl* ccl )
 		pccl_addrange( ccl, end, ccl->max );
 
 	pccl_normalize( ccl );
+	pccl_MAP( ccl );
 
 	return ccl;
 }
@@ -1461,6 +1720,20 @@ pccl* pccl_union( pccl* ccl, pccl* add )
 		/* Incompatible character-classes */
 		return NULL;
 
+	if( pccl_MAPCOMPAT( ccl, add ) )
+	{
+		unsigned int	map	[ PCCL_MAP_MAX / PCCL_MAP_BITS ];
+		int				i;
+
+		for( i = 0; i < PCCL_MAP_MAX / PCCL_MAP_BITS; i++ )
+			map[ i ] = ccl->map[ i ] | add->map[ i ];
+
+		un = pccl_create( ccl->min, ccl->max, (char*)NULL );
+		pccl_FROMMAP( un, map );
+
+		return un;
+	}
+
 	un = pccl_dup( ccl );
 
 	parray_for( &add->ranges, r )
@@ -1493,6 +1766,20 @@ pccl* pccl_diff( pccl* ccl, pccl* rem )
 		/* Incompatible character-classes */
 		return NULL;
 
+	if( pccl_MAPPED( ccl ) )
+	{
+		unsigned int	map	[ PCCL_MAP_MAX / PCCL_MAP_BITS ];
+		int				i;
+
+		for( i = 0; i < PCCL_MAP_MAX / PCCL_MAP_BITS; i++ )
+			map[ i ] = ccl->map[ i ] & ~rem->map[ i ];
+
+		diff = pccl_create( ccl->min, ccl->max, (char*)NULL );
+		pccl_FROMMAP( diff, map );
+
+		return diff;
+	}
+
 	if( !( diff = pccl_dup( ccl ) ) )
 		return diff;
 
@@ -1514,6 +1801,10 @@ int pccl_compare( pccl* left, pccl* right )
 {
 	size_t	ret;
 
+	if( left == right )
+		/* Same or interned character-class */
+		return 0;
+
 	if( !pccl_compat( left, right ) )
 		/* Incompatible character-classes */
 		return left->max - right->max;
@@ -1522,6 +1813,11 @@ int pccl_compare( pccl* left, pccl* right )
 		/* Unequal number of range pairs */
 		return ret < 0 ? -1 : 1;
 
+	if( pccl_MAPCOMPAT( left, right )
+			&& !memcmp( left->map, right->map, sizeof( left->map ) ) )
+		/* Equal bitmaps */
+		return 0;
+
 	return parray_diff( &left->ranges, &right->ranges );
 }
 
@@ -1545,6 +1841,25 @@ pccl* pccl_intersect( pccl* ccl, pccl* within )
 		/* Incompatible character-classes */
 		return NULL;
 
+	if( ccl->min == within->min && ccl->max == within->max
+			&& ( pccl_MAPPED( ccl ) || pccl_MAPPED( within ) ) )
+	{
+		unsigned int	map	[ PCCL_MAP_MAX / PCCL_MAP_BITS ];
+		unsigned int	any	= 0;
+		int				i;
+
+		for( i = 0; i < PCCL_MAP_MAX / PCCL_MAP_BITS; i++ )
+			any |= ( map[ i ] = ccl->map[ i ] & within->map[ i ] );
+
+		if( !any )
+			return NULL;
+
+		in = pccl_create( ccl->min, ccl->max, (char*)NULL );
+		pccl_FROMMAP( in, map );
+
+		return in;
+	}
+
 	parray_for( &ccl->ranges, r )
 	{
 		parray_for( &within->ranges, s )
@@ -1840,6 +2155,7 @@ object, use pccl_free().
 void pccl_erase( pccl* ccl )
 {
 	parray_erase( &ccl->ranges );
+	memset( ccl->map, 0, sizeof( ccl->map ) );
 	ccl->str = pfree( ccl->str );
 }
 
@@ -1852,6 +2168,15 @@ pccl* pccl_free( pccl* ccl )
 	if( !ccl )
 		return (pccl*)NULL;
 
+	/* Interned character-classes are freed with their last reference */
+	if( ccl->refs )
+	{
+		if( --ccl->refs )
+			return (pccl*)NULL;
+
+		pccl_UNINTERN( ccl );
+	}
+
 	pccl_erase( ccl );
 	pfree( ccl );
 
@@ -2464,6 +2789,9 @@ static const int table_sizes[] = {
 #define	LOAD_FACTOR_HIGH	75	/* resize on 75% load factor
 										to avoid collisions */
 
+/* Minimum number of elements before a pointer set is hashed */
+#define PTRSET_HASH_MIN		8
+
 /* Calculates load factor of the map */
 static int plist_get_load_factor( plist* list )
 {
@@ -2482,7 +2810,7 @@ static int plist_hash_compare( plist* list, char* l, char* r, size_t n )
 	int		res;
 
 	if( list->flags & PLIST_MOD_PTRKEYS )
-		res = (int)( l - r );
+		res = ( l == r ) ? 0 : ( ( l < r ) ? -1 : 1 );
 	else
 	{
 		if( !n && list->flags & PLIST_MOD_WCHAR )
@@ -2611,6 +2939,9 @@ static pboolean plist_hash_insert( plist* list, plistel* e )
 					e->hashnext = he;
 					e->hashprev = he->hashprev;
 					he->hashprev = e;
+
+					if( e->hashprev )
+						e->hashprev->hashnext = e;
 				}
 
 				break;
@@ -2689,6 +3020,10 @@ void plist_init( plist* list, size_t size, short flags )
 	if( size == 0 )
 		flags |= PLIST_MOD_PTR;
 
+	/* Pointer sets are pointer lists keyed by their pointers */
+	if( flags & PLIST_MOD_PTRSET )
+		flags |= PLIST_MOD_PTR | PLIST_MOD_PTRKEYS | PLIST_MOD_KEEPKEYS;
+
 	if( flags & PLIST_MOD_PTR && size < sizeof( void* ) )
 		size = sizeof( void* );
 
@@ -2732,6 +3067,10 @@ colliding element rather than __before__.
 - **PLIST_MOD_UNIQUE** to disallow hash-table-key collisions, so elements with \
 a key that already exist in the object will be rejected.
 - **PLIST_MOD_WCHAR** to handle all key values as wide-character strings.
+- **PLIST_MOD_PTRSET** to use the plist-object as a set of pointers. The \
+pointers are used as hash-table keys, so plist_get_by_ptr() and plist_union() \
+don't need to scan the entire list. The hash-table is only built when the \
+list exceeds a few elements. This flag implies PLIST_MOD_PTR.
 -
 
 Use plist_free() to erase and release the returned list object. */
@@ -2797,6 +3136,12 @@ void plist_erase( plist* list )
 	list->hash = (plistel**)NULL;
 	list->unused = (plistel*)NULL;
 	list->count = 0;
+
+	/* Resetting hash table size */
+	list->size_index = 0;
+	list->hashsize = table_sizes[ list->size_index ];
+	list->free_hash_entries = list->hashsize;
+	list->hash_collisions = 0;
 }
 
 /** Clear content of the list //list//.
@@ -2838,8 +3183,15 @@ plistel* plist_insert( plist* list, plistel* pos, char* key, void* src )
 {
 	plistel*	e;
 
+	/* Pointer sets use the pointer as key */
+	if( list->flags & PLIST_MOD_PTRSET )
+		key = (char*)src;
+
 	/* Rebuild hash-table if necessary */
-	if( key && !list->hash && !plist_hash_rebuild( list ) )
+	if( key && !list->hash
+			&& ( !( list->flags & PLIST_MOD_PTRSET )
+				|| list->count >= PTRSET_HASH_MIN )
+			&& !plist_hash_rebuild( list ) )
 		return (plistel*)NULL;
 
 	/* Recycle existing elements? */
@@ -2910,7 +3262,8 @@ plistel* plist_insert( plist* list, plistel* pos, char* key, void* src )
 		else
 			e->key = pstrdup( key );
 
-		if( !plist_hash_insert( list, e ) )
+		/* Small pointer sets are not hashed yet */
+		if( list->hash && !plist_hash_insert( list, e ) )
 		{
 			/* Item collides! */
 			plist_remove( list, e );
@@ -2980,6 +3333,9 @@ void plist_remove( plist* list, plistel* e )
 	else
 		list->last = e->prev;
 
+	if( e->hashnext )
+		e->hashnext->hashprev = e->hashprev;
+
 	if( e->hashprev )
 		e->hashprev->hashnext = e->hashnext;
 	else if( list->hash && e->key )
@@ -3199,6 +3555,10 @@ plistel* plist_get_by_ptr( plist* list, void* ptr )
 {
 	plistel*	e;
 
+	/* Hashed pointer sets */
+	if( list->flags & PLIST_MOD_PTRSET && list->hash && ptr )
+		return plist_get_by_key( list, (char*)ptr );
+
 	for( e = plist_first( list ); e; e = plist_next( e ) )
 		if( plist_access( e ) == ptr )
 			return e;
@@ -3219,7 +3579,9 @@ size_t plist_concat( plist* dest, plist* src )
 	count = dest->count;
 
 	plist_for( src, e )
-		if( !plist_insert( dest, NULL, e->key, plist_access( e ) ) )
+		if( !plist_insert( dest, NULL,
+				( src->flags & PLIST_MOD_PTRSET ) ? (char*)NULL : e->key,
+					plist_access( e ) ) )
 			break;
 
 	return dest->count - count;
@@ -3306,6 +3668,18 @@ size_t plist_union( plist* all, plist* from )
 
 	last = plist_last( all );
 
+	/* Pointer sets can be checked by their hash-table */
+	if( all->flags & PLIST_MOD_PTRSET && from->flags & PLIST_MOD_PTR
+			&& !all->comparefn )
+	{
+		plist_for( from, p )
+			if( !plist_get_by_ptr( all, plist_access( p ) ) )
+				if( !plist_push( all, plist_access( p ) ) )
+					break;
+
+		return all->count - count;
+	}
+
 	plist_for( from, p )
 	{
 		for( q = plist_first( all ); q; q = q == last ? NULL : plist_next( q ) )
@@ -6628,9 +7002,9 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 	classes = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
 	plist_set_sortfn( classes, pregex_dfa_sort_classes );
 
-	transitions = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+	transitions = plist_create( 0, PLIST_MOD_PTRSET | PLIST_MOD_RECYCLE );
 
-	done = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+	done = plist_create( 0, PLIST_MOD_PTRSET | PLIST_MOD_RECYCLE );
 
 	sets = parray_create( sizeof( plist* ), 0 );
 
@@ -6639,7 +7013,7 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 	if( !( current = pregex_dfa_create_state( dfa ) ) )
 		RETURN( -1 );
 
-	nfa_set = plist_create( 0, PLIST_MOD_PTR );
+	nfa_set = plist_create( 0, PLIST_MOD_PTRSET );
 	plist_push( nfa_set, plist_access( plist_first( nfa->states ) ) );
 	parray_push( sets, &nfa_set );
 
@@ -6858,6 +7232,18 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 
 	parray_free( sets );
 
+	/* Intern the character-classes of all transitions */
+	plist_for( dfa->states, e )
+	{
+		current = (pregex_dfa_st*)plist_access( e );
+
+		plist_for( current->trans, f )
+		{
+			trans = (pregex_dfa_tr*)plist_access( f );
+			trans->ccl = pccl_intern( trans->ccl );
+		}
+	}
+
 	/* Set default transitions */
 	pregex_dfa_default_trans( dfa );
 
@@ -6898,8 +7284,8 @@ static pboolean pregex_dfa_equal_states(
 		tr[0] = (pregex_dfa_tr*)plist_access( e );
 		tr[1] = (pregex_dfa_tr*)plist_access( f );
 
-		/* Equal Character class selection? */
-		if( pccl_compare( tr[0]->ccl, tr[1]->ccl ) )
+		/* Equal Character class selection? Classes are interned. */
+		if( tr[0]->ccl != tr[1]->ccl )
 		{
 			MSG( "Character classes are not equal" );
 			RETURN( FALSE );
@@ -6981,7 +7367,7 @@ int pregex_dfa_minimize( pregex_dfa* dfa )
 
 		if( !f )
 		{
-			group = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+			group = plist_create( 0, PLIST_MOD_PTRSET | PLIST_MOD_RECYCLE );
 			if( !plist_push( group, dfa_st ) )
 				RETURN( -1 );
 
@@ -7044,7 +7430,7 @@ int pregex_dfa_minimize( pregex_dfa* dfa )
 					{
 						if( !( newgroup =
 								plist_create( 0,
-									PLIST_MOD_PTR | PLIST_MOD_RECYCLE ) ) )
+									PLIST_MOD_PTRSET | PLIST_MOD_RECYCLE ) ) )
 							RETURN( -1 );
 					}
 
@@ -8592,6 +8978,7 @@ pregex_nfa_st* pregex_nfa_create_state(
 			ptr->ccl = iccl;
 		}
 
+		ptr->ccl = pccl_intern( ptr->ccl );
 		VARS( "ptr->ccl", "%p", ptr->ccl );
 	}
 
@@ -9149,6 +9536,8 @@ pboolean pregex_nfa_from_string( pregex_nfa* nfa, char* str, int flags, int acc
 				RETURN( FALSE );
 		}
 
+		nfa_st->ccl = pccl_intern( nfa_st->ccl );
+
 		prev_nfa_st->next = nfa_st;
 		prev_nfa_st = nfa_st;
 	}
@@ -9885,7 +10274,7 @@ static pboolean pregex_ptn_to_NFA( pregex_nfa* nfa, pregex_ptn* pattern,
 				n_start = pregex_nfa_create_state( nfa, (char*)NULL, 0 );
 				n_end = pregex_nfa_create_state( nfa, (char*)NULL, 0 );
 
-				n_start->ccl = pccl_dup( pattern->ccl );
+				n_start->ccl = pccl_intern( pccl_dup( pattern->ccl ) );
 				n_start->next = n_end;
 				break;
 
@@ -296,6 +296,7 @@ struct Plist
 #define PLIST_MOD_KEEPKEYS	32	
 #define PLIST_MOD_UNIQUE	64	
 #define PLIST_MOD_WCHAR		128	
+#define PLIST_MOD_PTRSET	256	
 
 	size_t					size;
 	size_t					count;
@@ -339,6 +340,9 @@ struct Plist
 #define PCCL_MAX			0xFF
 #endif
 
+#define PCCL_MAP_MAX		0x100
+#define PCCL_MAP_BITS		( sizeof( unsigned int ) * 8 )
+
 typedef struct
 {
 	wchar_t			begin;		
@@ -351,6 +355,11 @@ typedef struct
 	wchar_t			max;		
 
 	parray			ranges;		
+	unsigned int	map			[ PCCL_MAP_MAX / PCCL_MAP_BITS ];
+								
+
+	size_t			hash;		
+	int				refs;		
 
 	char*			str;		
 } pccl;
@@ -576,6 +585,8 @@ pboolean pccl_compat( pccl* l, pccl* r );
 size_t pccl_size( pccl* ccl );
 size_t pccl_count( pccl* ccl );
 pccl* pccl_dup( pccl* ccl );
+pccl* pccl_intern( pccl* ccl );
+pccl* pccl_interned( pccl* ccl );
 pboolean pccl_testrange( pccl* ccl, wchar_t begin, wchar_t end );
 pboolean pccl_test( pccl* ccl, wchar_t ch );
 pboolean pccl_instest( pccl* ccl, wchar_t ch );
@@ -3,6 +3,7 @@ construct a parser program module in a specific programming language using
 a template. */
 
 #include "unicc.h"
+#include "targets.h"
 
 #define	LEN_EXT		"_len"
 #define SYMBOL_VAR	"symbol"
@@ -26,26 +27,44 @@ Returns a char*, which is the final (escaped) string.
 char* escape_for_target( GENERATOR* g, char* str, BOOLEAN clear )
 {
     int		i;
-    char*	ret;
-    char*	tmp;
+    char*	ptr;
+    char*	start;
+    OUTBUF	ob;
 
-    if( !( ret = pstrdup( str ) ) )
-        ret = pstrdup( "" );
+    outbuf_init( &ob, (FILE*)NULL );
+    outbuf_append( &ob, "", FALSE );
 
-    if( clear )
-        str = pfree( str );
-
-    for( i = 0; i < g->sequences_count; i++ )
+    /* Escape in one pass; On equal positions, the first sequence wins */
+    for( ptr = start = str; ptr && *ptr; )
     {
-        if( !( tmp = pstrrender( ret, g->for_sequences[ i ],
-                g->do_sequences[ i ], FALSE, (char*)NULL ) ) )
-            OUTOFMEM;
+        if( g->escape_first[ (unsigned char)*ptr ] )
+        {
+            for( i = 0; i < g->sequences_count; i++ )
+                if( *g->for_sequences[ i ]
+                        && !strncmp( ptr, g->for_sequences[ i ],
+                                        strlen( g->for_sequences[ i ] ) ) )
+                    break;
 
-        pfree( ret );
-        ret = tmp;
+            if( i < g->sequences_count )
+            {
+                outbuf_write( &ob, start, ptr - start );
+                outbuf_append( &ob, g->do_sequences[ i ], FALSE );
+
+                ptr = start = ptr + strlen( g->for_sequences[ i ] );
+                continue;
+            }
+        }
+
+        ptr++;
     }
 
-    return ret;
+    if( str )
+        outbuf_write( &ob, start, ptr - start );
+
+    if( clear )
+        str = pfree( str );
+
+    return ob.buf;
 }
 
 /** Constructs target language code for production reduction code blocks.
@@ -379,7 +398,7 @@ char* build_scan_action( PARSER* parser, GENERATOR* g, SYMBOL* s, char* base )
             {
                 MSG( "Buffer too small!" );
 
-                plex_free( scan_lex );
+                scan_lex = plex_free( scan_lex );
                 RETURN( (char*)NULL ); /* Not the best way to handle this */
             }
 
@@ -390,7 +409,7 @@ char* build_scan_action( PARSER* parser, GENERATOR* g, SYMBOL* s, char* base )
 
             if( !plex_define( scan_lex, rx, i + 1, 0 ) )
             {
-                plex_free( scan_lex );
+                scan_lex = plex_free( scan_lex );
                 MSG( "Something went wrong with the action lexer definition" );
                 RETURN( (char*)NULL );
             }
@@ -555,6 +574,667 @@ char* mkproduction_str( PROD* p )
     return ret;
 }
 
+/* Returns the stock target template //name// compiled into UniCC as an
+allocated string, or (char*)NULL if there is no such template. */
+static char* stock_target( char* name )
+{
+    OUTBUF	ob;
+    char**	line;
+    int		i;
+
+    for( i = 0; stock_targets[ i ].name; i++ )
+    {
+        if( strcmp( stock_targets[ i ].name, name ) != 0 )
+            continue;
+
+        outbuf_init( &ob, (FILE*)NULL );
+
+        for( line = stock_targets[ i ].lines; *line; line++ )
+            outbuf_append( &ob, *line, FALSE );
+
+        return ob.buf;
+    }
+
+    return (char*)NULL;
+}
+
+/* Appends the //count// values of //val// to //ob// as a blob of signed
+little-endian integers, in the narrowest of 1, 2 or 4 bytes fitting all
+values. //bytes// are the target's representations of all byte values.
+Returns the width of the values in bytes. */
+static int pack_values( OUTBUF* ob, GENERATOR* gen, char** bytes,
+                            int* val, int count )
+{
+    int		width	= 1;
+    int		i;
+    int		j;
+    int		n		= 0;
+
+    for( i = 0; i < count; i++ )
+    {
+        if( val[ i ] < -32768 || val[ i ] > 32767 )
+            width = 4;
+        else if( ( val[ i ] < -128 || val[ i ] > 127 ) && width < 2 )
+            width = 2;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        for( j = 0; j < width; j++, n++ )
+        {
+            if( n && !( n % BLOB_LINE ) )
+                outbuf_append( ob, gen->blob_line_sep, FALSE );
+
+            outbuf_append( ob,
+                bytes[ ( (unsigned int)val[ i ] >> ( j * 8 ) ) & 0xff ],
+                    FALSE );
+        }
+    }
+
+    return width;
+}
+
+/* Packs the parse tables and lexer tables into the blobs //blob//, and their
+value widths into //width//, both indexed by the BLOB_-defines.
+
+The layout of the blobs is fixed: Rows of two-dimensional tables are padded
+to the widest row, so //max_action//, //max_goto// and //max_dfa// are the
+widest rows of the action, goto and DFA tables, and //mask_width// is the
+width of the accept masks. //chars// is the number of DFA character ranges,
+including end markers. */
+static void pack_tables( PARSER* parser, GENERATOR* gen, OUTBUF* blob,
+                            int* width, int max_action, int max_goto,
+                                int max_dfa, int mask_width, int chars )
+{
+    char*			bytes	[ 256 ];
+    int*			val		[ BLOB_COUNT ];
+    int				count	[ BLOB_COUNT ];
+    int				states	= parray_count( parser->states );
+    int				dfas	= list_count( parser->dfas );
+    int				i;
+    int				j;
+    int				k;
+    int				c;
+    STATE*			st;
+    TABCOL*			col;
+    SYMBOL*			sym;
+    LIST*			l;
+    LIST*			m;
+    pregex_dfa*		dfa;
+    pregex_dfa_st*	dfa_st;
+    pregex_dfa_tr*	dfa_ent;
+    plistel*		e;
+    plistel*		f;
+    wchar_t			beg;
+    wchar_t			end;
+
+    count[ BLOB_ACTION_TABLE ] = states * ( max_action * 3 + 1 );
+    count[ BLOB_GOTO_TABLE ] = states * ( max_goto * 3 + 1 );
+    count[ BLOB_DEF_PROD ] = states;
+    count[ BLOB_DFA_SELECT ] = parser->p_mode == MODE_SCANNERLESS
+                                ? states : 0;
+    count[ BLOB_DFA_INDEX ] = dfas * max_dfa;
+    count[ BLOB_DFA_CHAR ] = chars * 2;
+    count[ BLOB_DFA_TRANS ] = chars;
+    count[ BLOB_DFA_ACCEPT ] = dfas * max_dfa;
+    count[ BLOB_DFA_FOLD ] = parser->folded_dfas ? dfas : 0;
+    count[ BLOB_DFA_MASK ] = parser->p_shared_dfas ? states * mask_width : 0;
+
+    for( i = 0; i < BLOB_COUNT; i++ )
+        if( !( val[ i ] = (int*)pmalloc( ( count[ i ] + 1 )
+                                            * sizeof( int ) ) ) )
+            OUTOFMEM;
+
+    /* Parser state tables */
+    i = 0;
+    parray_for( parser->states, st )
+    {
+        j = i * ( max_action * 3 + 1 );
+        val[ BLOB_ACTION_TABLE ][ j++ ] = list_count( st->actions );
+
+        LISTFOR( st->actions, m )
+        {
+            col = (TABCOL*)list_access( m );
+            val[ BLOB_ACTION_TABLE ][ j++ ] = col->symbol->id;
+            val[ BLOB_ACTION_TABLE ][ j++ ] = col->action;
+            val[ BLOB_ACTION_TABLE ][ j++ ] = col->index;
+        }
+
+        j = i * ( max_goto * 3 + 1 );
+        val[ BLOB_GOTO_TABLE ][ j++ ] = list_count( st->gotos );
+
+        LISTFOR( st->gotos, m )
+        {
+            col = (TABCOL*)list_access( m );
+            val[ BLOB_GOTO_TABLE ][ j++ ] = col->symbol->id;
+            val[ BLOB_GOTO_TABLE ][ j++ ] = col->action;
+            val[ BLOB_GOTO_TABLE ][ j++ ] = col->index;
+        }
+
+        val[ BLOB_DEF_PROD ][ i ] = st->def_prod ? st->def_prod->id : -1;
+
+        if( count[ BLOB_DFA_SELECT ] )
+            val[ BLOB_DFA_SELECT ][ i ] = list_find( parser->dfas, st->dfa );
+
+        if( count[ BLOB_DFA_MASK ] )
+        {
+            LISTFOR( st->accepts, l )
+            {
+                sym = (SYMBOL*)list_access( l );
+                val[ BLOB_DFA_MASK ][ i * mask_width + sym->id / 8 ]
+                    |= 1 << ( sym->id % 8 );
+            }
+        }
+
+        i++;
+    }
+
+    /* Lexical analyzer tables */
+    for( l = parser->dfas, i = 0, c = 0; l; l = list_next( l ), i++ )
+    {
+        dfa = (pregex_dfa*)list_access( l );
+
+        if( count[ BLOB_DFA_FOLD ] )
+            val[ BLOB_DFA_FOLD ][ i ] =
+                list_find( parser->folded_dfas, dfa ) > -1;
+
+        j = 0;
+        plist_for( dfa->states, e )
+        {
+            dfa_st = (pregex_dfa_st*)plist_access( e );
+
+            val[ BLOB_DFA_INDEX ][ i * max_dfa + j ] = c;
+            val[ BLOB_DFA_ACCEPT ][ i * max_dfa + j ] = dfa_st->accept;
+
+            plist_for( dfa_st->trans, f )
+            {
+                dfa_ent = (pregex_dfa_tr*)plist_access( f );
+
+                for( k = 0; pccl_get( &beg, &end, dfa_ent->ccl, k ); k++ )
+                {
+                    val[ BLOB_DFA_CHAR ][ c * 2 ] = (int)beg;
+                    val[ BLOB_DFA_CHAR ][ c * 2 + 1 ] = (int)end;
+                    val[ BLOB_DFA_TRANS ][ c++ ] = dfa_ent->go_to;
+                }
+            }
+
+            /* Transition end marker */
+            val[ BLOB_DFA_CHAR ][ c * 2 ] = -1;
+            val[ BLOB_DFA_CHAR ][ c * 2 + 1 ] = -1;
+            val[ BLOB_DFA_TRANS ][ c++ ] = -1;
+
+            j++;
+        }
+    }
+
+    /* Render the blobs */
+    for( i = 0; i < 256; i++ )
+        bytes[ i ] = pstrrender( gen->blob_byte,
+                        GEN_WILD_PREFIX "byte", int_to_str( i ), TRUE,
+                        GEN_WILD_PREFIX "octal",
+                            pasprintf( "%03o", i ), TRUE,
+                        GEN_WILD_PREFIX "hex",
+                            pasprintf( "%02x", i ), TRUE,
+                        (char*)NULL );
+
+    for( i = 0; i < BLOB_COUNT; i++ )
+    {
+        width[ i ] = pack_values( &blob[ i ], gen, bytes,
+                                    val[ i ], count[ i ] );
+        pfree( val[ i ] );
+    }
+
+    for( i = 0; i < 256; i++ )
+        pfree( bytes[ i ] );
+}
+
+/* Widens the value range of table //tab// in //min// and //max// to //val//;
+The tables are indexed by the BLOB_-defines. */
+static void widen_range( int* min, int* max, int tab, int val )
+{
+    if( val < min[ tab ] )
+        min[ tab ] = val;
+
+    if( val > max[ tab ] )
+        max[ tab ] = val;
+}
+
+/* Returns the first <int_type> of the target //gen// whose range covers all
+values from //min// to //max//, or the last one if none does. Targets list
+their types from the narrowest to the widest. Returns an empty string if the
+target defines no types. */
+static char* table_type( GENERATOR* gen, int min, int max )
+{
+    XML_T	type;
+    char*	name	= "";
+    char*	att_min;
+    char*	att_max;
+
+    for( type = xml_child( gen->xml, "int_type" ); type;
+            type = xml_next( type ) )
+    {
+        name = (char*)xml_txt( type );
+        att_min = (char*)xml_attr( type, "min" );
+        att_max = (char*)xml_attr( type, "max" );
+
+        if( att_min && att_max
+                && atol( att_min ) <= min && atol( att_max ) >= max )
+            break;
+    }
+
+    return name;
+}
+
+/* Renders the //count// values of //val// into //ob// using the <comb>-tag of
+the target //gen//. Returns the narrowest <int_type> holding all values. */
+static char* comb_vector( GENERATOR* gen, OUTBUF* ob, int* val, int count )
+{
+    int		min		= 0;
+    int		max		= 0;
+    int		i;
+
+    for( i = 0; i < count; i++ )
+    {
+        snippet_render( ob, gen->comb.snip_col, val[ i ] );
+
+        if( i + 1 < count )
+            outbuf_append( ob, gen->comb.col_sep, FALSE );
+
+        if( val[ i ] < min )
+            min = val[ i ];
+
+        if( val[ i ] > max )
+            max = val[ i ];
+    }
+
+    return table_type( gen, min, max );
+}
+
+/* Compresses the action table, or the goto table if //gotos// is TRUE, into
+comb vectors by row displacement, and renders them into //vec// and their
+types into //type//, both in the order base, check and next.
+
+The rows are overlaid into the check and next vectors, the densest first, at
+the lowest base offset where none of their entries collides with an entry of
+a row placed before. The entry for symbol column c of a state is then found
+at its base offset plus c, if the check vector holds the state's number
+there. The next vector holds the index of an entry multiplied by 4 plus its
+action. The vectors are padded, so that every column of every state can be
+looked up. Returns the length of the check and next vectors. */
+static int comb_table( PARSER* parser, GENERATOR* gen, BOOLEAN gotos,
+                            OUTBUF* vec, char** type )
+{
+    int		states	= parray_count( parser->states );
+    int		cols;
+    int		entries	= 0;
+    int		deepest	= 0;
+    int		size;
+    int		len;
+    int*	base;
+    int*	check;
+    int*	next;
+    int		i;
+    int		d;
+    STATE*	st;
+    TABCOL*	col;
+    LIST*	row;
+    LIST*	l;
+
+    if( gotos )
+        cols = plist_count( parser->symbols ) - parser->terminals;
+    else
+        cols = parser->terminals;
+
+    size = cols;
+
+    parray_for( parser->states, st )
+    {
+        i = list_count( gotos ? st->gotos : st->actions );
+        entries += i;
+
+        if( i > deepest )
+            deepest = i;
+    }
+
+    /* The vectors are grown on demand; Slots behind them are free */
+    len = entries + cols;
+
+    if( !( base = (int*)pmalloc( states * sizeof( int ) ) )
+            || !( check = (int*)pmalloc( len * sizeof( int ) ) )
+                || !( next = (int*)pmalloc( len * sizeof( int ) ) ) )
+        OUTOFMEM;
+
+    for( i = 0; i < len; i++ )
+    {
+        check[ i ] = -1;
+        next[ i ] = 0;
+    }
+
+    /* Empty rows are placed at 0 and never match the check vector */
+    parray_for( parser->states, st )
+        base[ st->state_id ] = 0;
+
+    /* Place the rows ordered by their number of entries */
+    for( ; deepest > 0; deepest-- )
+    {
+        parray_for( parser->states, st )
+        {
+            row = gotos ? st->gotos : st->actions;
+
+            if( list_count( row ) != deepest )
+                continue;
+
+            for( d = 0; ; d++ )
+            {
+                LISTFOR( row, l )
+                {
+                    col = (TABCOL*)list_access( l );
+
+                    i = d + col->symbol->id
+                            - ( gotos ? parser->terminals : 0 );
+
+                    if( i < len && check[ i ] > -1 )
+                        break;
+                }
+
+                if( !l )
+                    break;
+            }
+
+            if( d + cols > len )
+            {
+                i = len;
+                len = ( d + cols ) * 2;
+
+                if( !( check = (int*)prealloc( check, len * sizeof( int ) ) )
+                        || !( next = (int*)prealloc( next,
+                                                len * sizeof( int ) ) ) )
+                    OUTOFMEM;
+
+                for( ; i < len; i++ )
+                {
+                    check[ i ] = -1;
+                    next[ i ] = 0;
+                }
+            }
+
+            LISTFOR( row, l )
+            {
+                col = (TABCOL*)list_access( l );
+                i = d + col->symbol->id - ( gotos ? parser->terminals : 0 );
+
+                check[ i ] = st->state_id;
+                next[ i ] = col->index * 4 + col->action;
+            }
+
+            base[ st->state_id ] = d;
+
+            if( d + cols > size )
+                size = d + cols;
+        }
+    }
+
+    type[ 0 ] = comb_vector( gen, &vec[ 0 ], base, states );
+    type[ 1 ] = comb_vector( gen, &vec[ 1 ], check, size );
+    type[ 2 ] = comb_vector( gen, &vec[ 2 ], next, size );
+
+    pfree( base );
+    pfree( check );
+    pfree( next );
+
+    return size;
+}
+
+/* Inserts the contents of the <section>-tags of the target //gen// into //txt//
+for their placeholders @@<name>-section, so that a target can compose several
+output files from the same code. Returns an allocated string. */
+static char* insert_sections( GENERATOR* gen, char* txt )
+{
+    XML_T	section;
+    char*	name;
+    char*	content;
+    char*	wildcard;
+    char*	all;
+    char*	complete;
+
+    if( !( all = pstrdup( txt ) ) )
+        OUTOFMEM;
+
+    for( section = xml_child( gen->xml, "section" );
+            section; section = xml_next( section ) )
+    {
+        if( !( name = xml_attr( section, "name" ) ) )
+            continue;
+
+        if( !( wildcard = pasprintf( "%s%s-section",
+                                        GEN_WILD_PREFIX, name ) ) )
+            OUTOFMEM;
+
+        /* A line break behind the opening tag isn't part of the section */
+        if( *( content = xml_txt( section ) ) == '\n' )
+            content++;
+
+        if( strstr( all, wildcard ) )
+        {
+            if( !( complete = pstrrender( all,
+                                wildcard, content, FALSE,
+                                (char*)NULL ) ) )
+                OUTOFMEM;
+
+            pfree( all );
+            all = complete;
+        }
+
+        pfree( wildcard );
+    }
+
+    return all;
+}
+
+/* Expands the conditional lines of the template text //txt//. A line of the
+form "@@if feature" keeps the lines up to its matching "@@else" or "@@endif"
+line only if the feature is enabled, and "@@if !feature" only if it's not; The
+lines behind "@@else" are kept otherwise. Conditions can be nested, and the
+condition lines themselves are removed.
+
+The features are passed as pairs of a name and an int flag, terminated by
+(char*)NULL. Returns an allocated string. */
+static char* expand_conditions( PARSER* parser, char* txt, ... )
+{
+    va_list		args;
+    OUTBUF		ob;
+    char*		line;
+    char*		end;
+    char*		cond;
+    char*		name;
+    size_t		len;
+    int			depth		= 0;
+    int			off			= 0;
+    BOOLEAN		negate;
+    BOOLEAN		on;
+
+    outbuf_init( &ob, (FILE*)NULL );
+
+    for( line = txt; *line; line = end )
+    {
+        if( ( end = strchr( line, '\n' ) ) )
+            end++;
+        else
+            end = line + strlen( line );
+
+        for( cond = line; *cond == ' ' || *cond == '\t'; cond++ )
+            ;
+
+        if( strncmp( cond, GEN_WILD_PREFIX, strlen( GEN_WILD_PREFIX ) ) )
+        {
+            if( !off )
+                outbuf_write( &ob, line, end - line );
+
+            continue;
+        }
+
+        cond += strlen( GEN_WILD_PREFIX );
+
+        if( !strncmp( cond, "if ", 3 ) )
+        {
+            for( cond += 3; *cond == ' '; cond++ )
+                ;
+
+            if( ( negate = ( *cond == '!' ) ) )
+                cond++;
+
+            for( len = 0; cond[ len ]
+                    && !isspace( (unsigned char)cond[ len ] ); len++ )
+                ;
+
+            va_start( args, txt );
+
+            while( ( name = va_arg( args, char* ) ) )
+            {
+                on = va_arg( args, int ) != 0;
+
+                if( strlen( name ) == len && !strncmp( name, cond, len ) )
+                    break;
+            }
+
+            va_end( args );
+
+            if( !name )
+            {
+                if( !( cond = pstrndup( cond, len ) ) )
+                    OUTOFMEM;
+
+                print_error( parser, ERR_UNKNOWN_CONDITION, ERRSTYLE_WARNING,
+                                cond, parser->p_template );
+                pfree( cond );
+
+                on = FALSE;
+            }
+
+            /* Lines are dropped from the first failing condition on */
+            if( !off && on == negate )
+                off = depth + 1;
+
+            depth++;
+        }
+        else if( !strncmp( cond, "else", 4 )
+                    && ( !cond[ 4 ] || isspace( (unsigned char)cond[ 4 ] ) ) )
+        {
+            if( off == depth )
+                off = 0;
+            else if( !off )
+                off = depth;
+        }
+        else if( !strncmp( cond, "endif", 5 )
+                    && ( !cond[ 5 ] || isspace( (unsigned char)cond[ 5 ] ) ) )
+        {
+            if( off == depth )
+                off = 0;
+
+            if( depth )
+                depth--;
+        }
+        else if( !off )
+            outbuf_write( &ob, line, end - line );
+    }
+
+    if( !ob.buf && !( ob.buf = pstrdup( "" ) ) )
+        OUTOFMEM;
+
+    return ob.buf;
+}
+
+/* Returns TRUE if //code// accesses the member //member// of a structure,
+as in "pcb->line" or "tok.line". */
+static BOOLEAN has_member_access( char* code, char* member )
+{
+    char*	ptr;
+    char*	pre;
+    size_t	len		= strlen( member );
+
+    for( ptr = code; ptr && ( ptr = strstr( ptr, member ) ); ptr += len )
+    {
+        if( isalnum( (unsigned char)ptr[ len ] ) || ptr[ len ] == '_' )
+            continue;
+
+        for( pre = ptr; pre > code && isspace( (unsigned char)pre[ -1 ] );
+                pre-- )
+            ;
+
+        if( pre > code && ( pre[ -1 ] == '.'
+                || ( pre[ -1 ] == '>' && pre - 1 > code
+                        && pre[ -2 ] == '-' ) ) )
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Returns TRUE if //code// may read the line or column of the input. This is
+the case when it accesses a line or column member, or refers to the parser
+control block type @@prefix_pcb, which it may hand to further code. */
+static BOOLEAN refers_to_line_info( char* code )
+{
+    if( !code )
+        return FALSE;
+
+    return MAKE_BOOLEAN( has_member_access( code, "line" )
+                            || has_member_access( code, "column" )
+                            || strstr( code, GEN_WILD_PREFIX "prefix_pcb" ) );
+}
+
+/* Returns TRUE if any semantic code of //parser// refers to the line or column
+of the input, so that the generated parser must keep track of them. */
+static BOOLEAN uses_line_info( PARSER* parser )
+{
+    plistel*	e;
+    PROD*		p;
+    SYMBOL*		sym;
+
+    if( refers_to_line_info( parser->p_header )
+            || refers_to_line_info( parser->p_footer )
+            || refers_to_line_info( parser->p_pcb ) )
+        return TRUE;
+
+    plist_for( parser->productions, e )
+    {
+        p = (PROD*)plist_access( e );
+
+        if( refers_to_line_info( p->code ) )
+            return TRUE;
+    }
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( refers_to_line_info( sym->code ) )
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Returns TRUE if the files //a// and //b// both exist and have the same
+content. */
+static BOOLEAN same_content( char* a, char* b )
+{
+    char*	ca;
+    char*	cb		= (char*)NULL;
+    BOOLEAN	same	= FALSE;
+
+    if( pfiletostr( &ca, a ) )
+    {
+        if( pfiletostr( &cb, b ) )
+            same = MAKE_BOOLEAN( strcmp( ca, cb ) == 0 );
+
+        pfree( ca );
+        pfree( cb );
+    }
+
+    return same;
+}
+
 /** Loads a XML-defined code generator into an adequate GENERATOR structure.
 Pointers are only set to the values mapped to the XML-structure, so no memory
 is wasted.
@@ -562,10 +1242,13 @@ is wasted.
 //parser// is the parser information structure.
 //g// is the target generator.
 //genfile// is the path to generator file.
+//src// is the generator source already held in memory, or (char*)NULL to
+read it from //genfile//. It is freed together with the XML structure.
 
 Returns TRUE on success, FALSE on error.
 */
-BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile )
+BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile,
+                            char* src )
 {
     char*	name;
     char*	version;
@@ -605,7 +1288,7 @@ BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile )
         print_error( parser, ERR_TAG_NOT_FOUND, ERRSTYLE_WARNING, \
             (tagname), genfile );
 
-    if( !( g->xml = xml_parse_file( genfile ) ) )
+    if( !( g->xml = src ? xml_parse_alloc( src ) : xml_parse_file( genfile ) ) )
     {
         print_error( parser, ERR_NO_GENERATOR_FILE, ERRSTYLE_FATAL, genfile );
         return FALSE;
@@ -664,12 +1347,28 @@ BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile )
     GET_XML_TAB_2D( g->gotab, "gotab" )
     GET_XML_TAB_2D( g->dfa_idx, "dfa_idx" )
     GET_XML_TAB_2D( g->dfa_accept, "dfa_accept" )
+    GET_XML_TAB_1D( g->dfa_fold, "dfa_fold" )
+    GET_XML_TAB_2D( g->dfa_mask, "dfa_mask" )
 
     GET_XML_TAB_1D( g->symbols, "symbols" )
     GET_XML_TAB_1D( g->productions, "productions" )
 
     GET_XML_DEF( g->xml, g->code_localization, "code_localization" );
 
+    /* Packed tables are optional */
+    if( ( tmp = xml_child( g->xml, "blob" ) ) )
+    {
+        GET_XML_DEF( tmp, g->blob_byte, "byte" )
+        GET_XML_DEF( tmp, g->blob_line_sep, "line_sep" )
+    }
+
+    /* Comb-vector tables are optional */
+    if( ( tmp = xml_child( g->xml, "comb" ) ) )
+    {
+        GET_XML_DEF( tmp, g->comb.col, "col" )
+        GET_XML_DEF( tmp, g->comb.col_sep, "col_sep" )
+    }
+
     /* Escape sequence definitions */
     for( tmp = xml_child( g->xml, "escape-sequence" ); tmp;
             tmp = xml_next( tmp ) )
@@ -707,6 +1406,7 @@ BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile )
                 && g->do_sequences[ g->sequences_count ] ) )
                 OUTOFMEM;
 
+            g->escape_first[ (unsigned char)*att_for ] = TRUE;
             g->sequences_count++;
         }
         else
@@ -756,38 +1456,56 @@ void build_code( PARSER* parser )
     char*			basename;
     char			tlt_file			[ BUFSIZ + 1 ];
     char*			tlt_path;
+    char*			tlt_src				= (char*)NULL;
     char*			option;
     char*			complete			= (char*)NULL;
     char*			all					= (char*)NULL;
-    char*			action_table		= (char*)NULL;
-    char*			action_table_row	= (char*)NULL;
-    char*			goto_table			= (char*)NULL;
-    char*			goto_table_row		= (char*)NULL;
-    char*			def_prod			= (char*)NULL;
+    char*			blobs;
     char*			char_map			= (char*)NULL;
     char*			char_map_sym		= (char*)NULL;
-    char*			symbols				= (char*)NULL;
-    char*			productions			= (char*)NULL;
-    char*			dfa_select			= (char*)NULL;
-    char*			dfa_idx				= (char*)NULL;
-    char*			dfa_idx_row			= (char*)NULL;
-    char*			dfa_char			= (char*)NULL;
-    char*			dfa_trans			= (char*)NULL;
-    char*			dfa_accept			= (char*)NULL;
-    char*			dfa_accept_row		= (char*)NULL;
     char*			type_def			= (char*)NULL;
-    char*			actions				= (char*)NULL;
-    char*			scan_actions		= (char*)NULL;
     char*			top_value			= (char*)NULL;
     char*			goal_value			= (char*)NULL;
     char*			act					= (char*)NULL;
     char*			filename			= (char*)NULL;
+    char*			tmp_filename		= (char*)NULL;
+    char*			name;
+    char*			emit;
+    OUTBUF			action_table;
+    OUTBUF			goto_table;
+    OUTBUF			def_prod;
+    OUTBUF			symbols;
+    OUTBUF			productions;
+    OUTBUF			dfa_select;
+    OUTBUF			dfa_idx;
+    OUTBUF			dfa_char;
+    OUTBUF			dfa_trans;
+    OUTBUF			dfa_accept;
+    OUTBUF			dfa_fold;
+    OUTBUF			dfa_mask;
+    OUTBUF			actions;
+    OUTBUF			scan_actions;
+    OUTBUF			blob				[ BLOB_COUNT ];
+    int				blob_width			[ BLOB_COUNT ];
+    int				tab_min				[ BLOB_COUNT ];
+    int				tab_max				[ BLOB_COUNT ];
+    OUTBUF			comb				[ COMB_COUNT ];
+    char*			comb_type			[ COMB_COUNT ];
+    int				action_comb_size	= 0;
+    int				goto_comb_size		= 0;
+    BOOLEAN			packed				= FALSE;
+    BOOLEAN			combed				= FALSE;
+    BOOLEAN			split				= FALSE;
+    BOOLEAN			ast_construction	= FALSE;
+    OUTBUF			out;
 
     int				max_action			= 0;
     int				max_goto			= 0;
     int				max_dfa_idx			= 0;
     int				max_dfa_accept		= 0;
     int				max_symbol_name		= 0;
+    int				mask_width			= 0;
+    int				mask;
     int				column;
     int				charmap_count		= 0;
     int				row;
@@ -808,6 +1526,8 @@ void build_code( PARSER* parser )
     plistel*		f;
     LIST*			l;
     LIST*			m;
+    VTYPE**			sym_vtypes;
+    int				vtypes_count;
 
     PROC( "build_code" );
     PARMS( "parser", "%p", parser );
@@ -815,12 +1535,45 @@ void build_code( PARSER* parser )
     gen = &generator;
     memset( gen, 0, sizeof( GENERATOR ) );
 
+    outbuf_init( &action_table, (FILE*)NULL );
+    outbuf_init( &goto_table, (FILE*)NULL );
+    outbuf_init( &def_prod, (FILE*)NULL );
+    outbuf_init( &symbols, (FILE*)NULL );
+    outbuf_init( &productions, (FILE*)NULL );
+    outbuf_init( &dfa_select, (FILE*)NULL );
+    outbuf_init( &dfa_idx, (FILE*)NULL );
+    outbuf_init( &dfa_char, (FILE*)NULL );
+    outbuf_init( &dfa_trans, (FILE*)NULL );
+    outbuf_init( &dfa_accept, (FILE*)NULL );
+    outbuf_init( &dfa_fold, (FILE*)NULL );
+    outbuf_init( &dfa_mask, (FILE*)NULL );
+    outbuf_init( &actions, (FILE*)NULL );
+    outbuf_init( &scan_actions, (FILE*)NULL );
+
+    for( i = 0; i < BLOB_COUNT; i++ )
+    {
+        outbuf_init( &blob[ i ], (FILE*)NULL );
+        blob_width[ i ] = 0;
+
+        /* Tables are padded with zeros, so 0 is always in range */
+        tab_min[ i ] = tab_max[ i ] = 0;
+    }
+
+    for( i = 0; i < COMB_COUNT; i++ )
+    {
+        outbuf_init( &comb[ i ], (FILE*)NULL );
+        comb_type[ i ] = "";
+    }
+
     sprintf( tlt_file, "%s%s", parser->p_template, UNICC_TLT_EXTENSION );
     pstrlwr( tlt_file );
     VARS( "tlt_file", "%s", tlt_file );
 
+    /* Templates in the local or configured target directory override the
+        stock templates compiled into UniCC */
     if( !( tlt_path = pwhich( tlt_file, "targets" ) )
         && !( tlt_path = pwhich( tlt_file, getenv( "UNICC_TPLDIR" ) ) )
+        && !( tlt_src = stock_target( tlt_file ) )
 #ifndef _WIN32
             && !( tlt_path = pwhich( tlt_file,
 #ifdef TLTDIR
@@ -835,19 +1588,34 @@ void build_code( PARSER* parser )
         tlt_path = tlt_file;
     }
 
+    /* Stock templates are named like their file for error messages */
+    if( tlt_src )
+        tlt_path = tlt_file;
+
     VARS( "tlt_path", "%s", tlt_path );
 
     MSG( "Loading generator" );
-    if( !load_generator( parser, gen, tlt_path ) )
+    if( !load_generator( parser, gen, tlt_path, tlt_src ) )
         VOIDRET;
 
     /* Now that we have the generator, do some code generation-related
         integrity preparatories on the grammar */
 
     MSG( "Performing code generation-related integrity preparatories" );
+
+    /* The value types are restored when finished, so that further targets
+        can be built from the same grammar */
+    vtypes_count = list_count( parser->vtypes );
+
+    if( !( sym_vtypes = (VTYPE**)pmalloc( plist_count( parser->symbols )
+                                            * sizeof( VTYPE* ) ) ) )
+        OUTOFMEM;
+
+    i = 0;
     plist_for( parser->symbols, e )
     {
         sym = (SYMBOL*)plist_access( e );
+        sym_vtypes[ i++ ] = sym->vtype;
 
         if( !( sym->vtype ) )
             sym->vtype = parser->p_def_type;
@@ -896,6 +1664,135 @@ void build_code( PARSER* parser )
                                     (char*)NULL ), TRUE,
                                         (char*)NULL );
 
+    /* Width of the accept masks of shared lexers, in bytes */
+    if( parser->p_shared_dfas )
+    {
+        mask_width = 1;
+
+        parray_for( parser->states, st )
+            LISTFOR( st->accepts, l )
+                if( mask_width <= ( (SYMBOL*)list_access( l ) )->id / 8 )
+                    mask_width = ( (SYMBOL*)list_access( l ) )->id / 8 + 1;
+    }
+
+    /* Compile table snippets */
+    MSG( "Compiling table snippets" );
+
+    gen->acttab.snip_row_start = snippet_compile( gen->acttab.row_start,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->acttab.snip_row_end = snippet_compile( gen->acttab.row_end,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->acttab.snip_col = snippet_compile( gen->acttab.col,
+            GEN_WILD_PREFIX "symbol", SNIPPET_INT,
+            GEN_WILD_PREFIX "action", SNIPPET_INT,
+            GEN_WILD_PREFIX "index", SNIPPET_INT,
+            GEN_WILD_PREFIX "column", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->gotab.snip_row_start = snippet_compile( gen->gotab.row_start,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->gotab.snip_row_end = snippet_compile( gen->gotab.row_end,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->gotab.snip_col = snippet_compile( gen->gotab.col,
+            GEN_WILD_PREFIX "symbol", SNIPPET_INT,
+            GEN_WILD_PREFIX "action", SNIPPET_INT,
+            GEN_WILD_PREFIX "index", SNIPPET_INT,
+            GEN_WILD_PREFIX "column", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_select.snip_col = snippet_compile( gen->dfa_select.col,
+            GEN_WILD_PREFIX "machine", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_mask.snip_row_start = snippet_compile( gen->dfa_mask.row_start,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_mask.snip_row_end = snippet_compile( gen->dfa_mask.row_end,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_mask.snip_col = snippet_compile( gen->dfa_mask.col,
+            GEN_WILD_PREFIX "mask", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->defprod.snip_col = snippet_compile( gen->defprod.col,
+            GEN_WILD_PREFIX "state-number", SNIPPET_INT,
+            GEN_WILD_PREFIX "production-number", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_fold.snip_col = snippet_compile( gen->dfa_fold.col,
+            GEN_WILD_PREFIX "column", SNIPPET_INT,
+            GEN_WILD_PREFIX "fold", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_idx.snip_row_start = snippet_compile( gen->dfa_idx.row_start,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "row", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_idx.snip_row_end = snippet_compile( gen->dfa_idx.row_end,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "row", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_idx.snip_col = snippet_compile( gen->dfa_idx.col,
+            GEN_WILD_PREFIX "index", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_accept.snip_row_start = snippet_compile(
+            gen->dfa_accept.row_start,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "row", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_accept.snip_row_end = snippet_compile( gen->dfa_accept.row_end,
+            GEN_WILD_PREFIX "number-of-columns", SNIPPET_INT,
+            GEN_WILD_PREFIX "row", SNIPPET_INT,
+            (char*)NULL );
+    gen->dfa_accept.snip_col = snippet_compile( gen->dfa_accept.col,
+            GEN_WILD_PREFIX "accept", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_char.snip_col = snippet_compile( gen->dfa_char.col,
+            GEN_WILD_PREFIX "from", SNIPPET_INT,
+            GEN_WILD_PREFIX "to", SNIPPET_INT,
+            GEN_WILD_PREFIX "goto", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->dfa_trans.snip_col = snippet_compile( gen->dfa_trans.col,
+            GEN_WILD_PREFIX "goto", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->symbols.snip_col = snippet_compile( gen->symbols.col,
+            GEN_WILD_PREFIX "symbol-name", SNIPPET_STR,
+            GEN_WILD_PREFIX "emit", SNIPPET_STR,
+            GEN_WILD_PREFIX "symbol", SNIPPET_INT,
+            GEN_WILD_PREFIX "type", SNIPPET_INT,
+            GEN_WILD_PREFIX "datatype", SNIPPET_INT,
+            GEN_WILD_PREFIX "terminal", SNIPPET_STR,
+            GEN_WILD_PREFIX "lexem", SNIPPET_STR,
+            GEN_WILD_PREFIX "whitespace", SNIPPET_STR,
+            GEN_WILD_PREFIX "greedy", SNIPPET_STR,
+            (char*)NULL );
+
+    gen->productions.snip_col = snippet_compile( gen->productions.col,
+            GEN_WILD_PREFIX "production-number", SNIPPET_INT,
+            GEN_WILD_PREFIX "production", SNIPPET_STR,
+            GEN_WILD_PREFIX "emit", SNIPPET_STR,
+            GEN_WILD_PREFIX "length", SNIPPET_INT,
+            GEN_WILD_PREFIX "lhs", SNIPPET_INT,
+            (char*)NULL );
+
+    gen->comb.snip_col = snippet_compile( gen->comb.col,
+            GEN_WILD_PREFIX "value", SNIPPET_INT,
+            (char*)NULL );
+
     /* Build action, goto and dfa_select tables */
     MSG( "Action, Goto and DFA selection table" );
 
@@ -903,121 +1800,131 @@ void build_code( PARSER* parser )
     parray_for( parser->states, st )
     {
         /* Action table */
-        action_table_row = pstrrender( gen->acttab.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( list_count( st->actions ) ), TRUE,
-                GEN_WILD_PREFIX "state-number",
-                    int_to_str( st->state_id ), TRUE,
-                        (char*)NULL );
+        snippet_render( &action_table, gen->acttab.snip_row_start,
+                list_count( st->actions ), st->state_id );
 
         if( max_action < list_count( st->actions ) )
             max_action = list_count( st->actions );
 
+        widen_range( tab_min, tab_max, BLOB_ACTION_TABLE,
+                        list_count( st->actions ) );
+
         for( m = st->actions, column = 0; m; m = m->next, column++ )
         {
             col = (TABCOL*)(m->pptr);
 
-            action_table_row = pstrcatstr( action_table_row,
-                pstrrender( gen->acttab.col,
-                    GEN_WILD_PREFIX "symbol",
-                            int_to_str( col->symbol->id ), TRUE,
-                    GEN_WILD_PREFIX "action", int_to_str( col->action ), TRUE,
-                    GEN_WILD_PREFIX "index", int_to_str( col->index ), TRUE,
-                    GEN_WILD_PREFIX "column", int_to_str( column ), TRUE,
-                        (char*)NULL ), TRUE );
+            snippet_render( &action_table, gen->acttab.snip_col,
+                col->symbol->id, col->action, col->index, column );
+
+            widen_range( tab_min, tab_max, BLOB_ACTION_TABLE,
+                            col->symbol->id );
+            widen_range( tab_min, tab_max, BLOB_ACTION_TABLE, col->action );
+            widen_range( tab_min, tab_max, BLOB_ACTION_TABLE, col->index );
 
             if( m->next )
-                action_table_row = pstrcatstr( action_table_row,
+                outbuf_append( &action_table,
                     gen->acttab.col_sep, FALSE );
         }
 
-        action_table_row = pstrcatstr( action_table_row,
-                pstrrender( gen->acttab.row_end,
-                    GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( list_count( st->actions ) ), TRUE,
-                    GEN_WILD_PREFIX "state-number",
-                        int_to_str( st->state_id ), TRUE,
-                            (char*)NULL ), TRUE );
+        snippet_render( &action_table, gen->acttab.snip_row_end,
+                list_count( st->actions ), st->state_id );
 
         if( parray_next( parser->states, st ) )
-            action_table_row = pstrcatstr( action_table_row,
+            outbuf_append( &action_table,
                 gen->acttab.row_sep, FALSE );
 
-        action_table = pstrcatstr( action_table, action_table_row, TRUE );
-
         /* Goto table */
-        goto_table_row = pstrrender( gen->gotab.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( list_count( st->gotos ) ), TRUE,
-                GEN_WILD_PREFIX "state-number",
-                    int_to_str( st->state_id ), TRUE,
-                        (char*)NULL );
+        snippet_render( &goto_table, gen->gotab.snip_row_start,
+                list_count( st->gotos ), st->state_id );
 
         if( max_goto < list_count( st->gotos ) )
             max_goto = list_count( st->gotos );
 
+        widen_range( tab_min, tab_max, BLOB_GOTO_TABLE,
+                        list_count( st->gotos ) );
+
         for( m = st->gotos, column = 0; m; m = m->next, column++ )
         {
             col = (TABCOL*)(m->pptr);
 
-            goto_table_row = pstrcatstr( goto_table_row,
-                pstrrender( gen->gotab.col,
-                    GEN_WILD_PREFIX "symbol",
-                        int_to_str( col->symbol->id ), TRUE,
-                    GEN_WILD_PREFIX "action",
-                        int_to_str( col->action ), TRUE,
-                    GEN_WILD_PREFIX "index",
-                        int_to_str( col->index ), TRUE,
-                    GEN_WILD_PREFIX "column",
-                        int_to_str( column ), TRUE,
-                    (char*)NULL ), TRUE );
+            snippet_render( &goto_table, gen->gotab.snip_col,
+                col->symbol->id, col->action, col->index, column );
+
+            widen_range( tab_min, tab_max, BLOB_GOTO_TABLE,
+                            col->symbol->id );
+            widen_range( tab_min, tab_max, BLOB_GOTO_TABLE, col->action );
+            widen_range( tab_min, tab_max, BLOB_GOTO_TABLE, col->index );
 
             if( m->next )
-                goto_table_row = pstrcatstr( goto_table_row,
+                outbuf_append( &goto_table,
                     gen->gotab.col_sep, FALSE );
         }
 
-        goto_table_row = pstrcatstr( goto_table_row,
-                pstrrender( gen->gotab.row_end,
-                    GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( list_count( st->actions ) ), TRUE,
-                    GEN_WILD_PREFIX "state-number",
-                        int_to_str( st->state_id ), TRUE,
-                    (char*)NULL ), TRUE );
+        snippet_render( &goto_table, gen->gotab.snip_row_end,
+                list_count( st->actions ), st->state_id );
 
         if( parray_next( parser->states, st ) )
-            goto_table_row = pstrcatstr( goto_table_row,
+            outbuf_append( &goto_table,
                 gen->gotab.row_sep, FALSE );
 
-        goto_table = pstrcatstr( goto_table, goto_table_row, TRUE );
-
         /* Only in scannerless mode */
         if( parser->p_mode == MODE_SCANNERLESS )
         {
             /* dfa machine selection */
-            dfa_select = pstrcatstr( dfa_select,
-                pstrrender( gen->dfa_select.col,
-                    GEN_WILD_PREFIX "machine",
-                        int_to_str( list_find( parser->dfas, st->dfa ) ), TRUE,
-                            (char*)NULL ), TRUE );
+            snippet_render( &dfa_select, gen->dfa_select.snip_col,
+                list_find( parser->dfas, st->dfa ) );
+
+            widen_range( tab_min, tab_max, BLOB_DFA_SELECT,
+                            list_find( parser->dfas, st->dfa ) );
 
             if( parray_next( parser->states, st ) )
-                dfa_select = pstrcatstr( dfa_select,
+                outbuf_append( &dfa_select,
                                 gen->dfa_select.col_sep, FALSE );
+
+            /* Bitmask of the terminals accepted from a shared lexer */
+            if( parser->p_shared_dfas )
+            {
+                snippet_render( &dfa_mask, gen->dfa_mask.snip_row_start,
+                    mask_width, st->state_id );
+
+                for( column = 0; column < mask_width; column++ )
+                {
+                    mask = 0;
+
+                    LISTFOR( st->accepts, l )
+                    {
+                        sym = (SYMBOL*)list_access( l );
+
+                        if( sym->id / 8 == column )
+                            mask |= 1 << ( sym->id % 8 );
+                    }
+
+                    snippet_render( &dfa_mask, gen->dfa_mask.snip_col, mask );
+                    widen_range( tab_min, tab_max, BLOB_DFA_MASK, mask );
+
+                    if( column + 1 < mask_width )
+                        outbuf_append( &dfa_mask,
+                                        gen->dfa_mask.col_sep, FALSE );
+                }
+
+                snippet_render( &dfa_mask, gen->dfa_mask.snip_row_end,
+                    mask_width, st->state_id );
+
+                if( parray_next( parser->states, st ) )
+                    outbuf_append( &dfa_mask,
+                                    gen->dfa_mask.row_sep, FALSE );
+            }
         }
 
         /* Default production table */
-        def_prod = pstrcatstr( def_prod,
-                pstrrender( gen->defprod.col,
-                    GEN_WILD_PREFIX "state-number",
-                        int_to_str( st->state_id ), TRUE,
-                    GEN_WILD_PREFIX "production-number",
-                        int_to_str(
-                            ( ( st->def_prod ) ? st->def_prod->id : -1 ) ),
-                                TRUE, (char*)NULL ), TRUE );
+        snippet_render( &def_prod, gen->defprod.snip_col,
+            st->state_id, ( st->def_prod ) ? st->def_prod->id : -1 );
+
+        widen_range( tab_min, tab_max, BLOB_DEF_PROD,
+                        ( st->def_prod ) ? st->def_prod->id : -1 );
 
         if( parray_next( parser->states, st ) )
-            def_prod = pstrcatstr( def_prod, gen->defprod.col_sep, FALSE );
+            outbuf_append( &def_prod, gen->defprod.col_sep, FALSE );
 
         i++;
     }
@@ -1028,20 +1935,25 @@ void build_code( PARSER* parser )
     {
         dfa = (pregex_dfa*)list_access( l );
 
+        /* Case-folding flag, only required if any DFA is folded */
+        if( parser->folded_dfas )
+        {
+            snippet_render( &dfa_fold, gen->dfa_fold.snip_col,
+                row, list_find( parser->folded_dfas, dfa ) > -1 );
+
+            widen_range( tab_min, tab_max, BLOB_DFA_FOLD, 1 );
+
+            if( list_next( l ) )
+                outbuf_append( &dfa_fold,
+                                gen->dfa_fold.col_sep, FALSE );
+        }
+
         /* Row start */
-        dfa_idx_row = pstrrender( gen->dfa_idx.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( plist_count( dfa->states ) ), TRUE,
-                GEN_WILD_PREFIX "row",
-                    int_to_str( row ), TRUE,
-                (char*)NULL );
+        snippet_render( &dfa_idx, gen->dfa_idx.snip_row_start,
+                plist_count( dfa->states ), row );
 
-        dfa_accept_row = pstrrender( gen->dfa_accept.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( plist_count( dfa->states ) ), TRUE,
-                GEN_WILD_PREFIX "row",
-                    int_to_str( row ), TRUE,
-                (char*)NULL );
+        snippet_render( &dfa_accept, gen->dfa_accept.snip_row_start,
+                plist_count( dfa->states ), row );
 
         if( max_dfa_idx < plist_count( dfa->states ) )
             max_dfa_accept = max_dfa_idx = plist_count( dfa->states );
@@ -1052,25 +1964,21 @@ void build_code( PARSER* parser )
             dfa_st = (pregex_dfa_st*)plist_access( e );
             VARS( "dfa_st", "%p", dfa_st );
 
-            if( dfa_char && dfa_trans )
+            if( dfa_char.len && dfa_trans.len )
             {
-                dfa_char = pstrcatstr( dfa_char,
+                outbuf_append( &dfa_char,
                         gen->dfa_char.col_sep, FALSE );
-                dfa_trans = pstrcatstr( dfa_trans,
+                outbuf_append( &dfa_trans,
                         gen->dfa_trans.col_sep, FALSE );
             }
 
-            dfa_idx_row = pstrcatstr( dfa_idx_row,
-                pstrrender( gen->dfa_idx.col,
-                    GEN_WILD_PREFIX "index",
-                        int_to_str( column ), TRUE,
-                    (char*)NULL ), TRUE );
+            snippet_render( &dfa_idx, gen->dfa_idx.snip_col, column );
 
-            dfa_accept_row = pstrcatstr( dfa_accept_row,
-                pstrrender( gen->dfa_accept.col,
-                    GEN_WILD_PREFIX "accept",
-                        int_to_str( dfa_st->accept ), TRUE,
-                    (char*)NULL ), TRUE );
+            snippet_render( &dfa_accept, gen->dfa_accept.snip_col,
+                dfa_st->accept );
+
+            widen_range( tab_min, tab_max, BLOB_DFA_INDEX, column );
+            widen_range( tab_min, tab_max, BLOB_DFA_ACCEPT, dfa_st->accept );
 
             /* Iterate trough all transitions */
             MSG( "Iterating to transitions of DFA" );
@@ -1080,26 +1988,20 @@ void build_code( PARSER* parser )
 
                 for( i = 0; pccl_get( &beg, &end, dfa_ent->ccl, i ); i++ )
                 {
-                    dfa_char = pstrcatstr( dfa_char,
-                                pstrrender( gen->dfa_char.col,
-                                GEN_WILD_PREFIX "from",
-                                    int_to_str( beg ), TRUE,
-                                GEN_WILD_PREFIX "to",
-                                    int_to_str( end ), TRUE,
-                                GEN_WILD_PREFIX "goto",
-                                    int_to_str( dfa_st->accept ), TRUE,
-                                (char*)NULL ), TRUE );
+                    snippet_render( &dfa_char, gen->dfa_char.snip_col,
+                        (int)beg, (int)end, dfa_st->accept );
 
-                    dfa_trans = pstrcatstr( dfa_trans,
-                                pstrrender( gen->dfa_trans.col,
-                                    GEN_WILD_PREFIX "goto",
-                                    int_to_str( dfa_ent->go_to ), TRUE,
-                                (char*)NULL ), TRUE );
+                    snippet_render( &dfa_trans, gen->dfa_trans.snip_col,
+                        dfa_ent->go_to );
 
+                    widen_range( tab_min, tab_max, BLOB_DFA_CHAR, (int)beg );
+                    widen_range( tab_min, tab_max, BLOB_DFA_CHAR, (int)end );
+                    widen_range( tab_min, tab_max, BLOB_DFA_TRANS,
+                                    dfa_ent->go_to );
 
-                    dfa_char = pstrcatstr( dfa_char,
+                    outbuf_append( &dfa_char,
                                     gen->dfa_char.col_sep, FALSE );
-                    dfa_trans = pstrcatstr( dfa_trans,
+                    outbuf_append( &dfa_trans,
                                     gen->dfa_trans.col_sep, FALSE );
 
                     column++;
@@ -1107,58 +2009,103 @@ void build_code( PARSER* parser )
             }
 
             /* DFA transition end marker */
-            dfa_char = pstrcatstr( dfa_char,
-                    pstrrender( gen->dfa_char.col,
-                        GEN_WILD_PREFIX "from",
-                            int_to_str( -1 ), TRUE,
-                        GEN_WILD_PREFIX "to",
-                            int_to_str( -1 ), TRUE,
-                        (char*)NULL ), TRUE );
+            snippet_render( &dfa_char, gen->dfa_char.snip_col, -1, -1, -1 );
 
             /* DFA transition */
-            dfa_trans = pstrcatstr( dfa_trans,
-                    pstrrender( gen->dfa_trans.col,
-                        GEN_WILD_PREFIX "goto",
-                            int_to_str( -1 ),
-                    TRUE, (char*)NULL ), TRUE );
+            snippet_render( &dfa_trans, gen->dfa_trans.snip_col, -1 );
+
+            widen_range( tab_min, tab_max, BLOB_DFA_CHAR, -1 );
+            widen_range( tab_min, tab_max, BLOB_DFA_TRANS, -1 );
 
             column++;
 
             if( plist_next( e ) )
             {
-                dfa_idx_row = pstrcatstr( dfa_idx_row,
+                outbuf_append( &dfa_idx,
                         gen->dfa_idx.col_sep, FALSE );
-                dfa_accept_row = pstrcatstr( dfa_accept_row,
+                outbuf_append( &dfa_accept,
                         gen->dfa_accept.col_sep, FALSE );
             }
         }
 
         /* Row end */
-        dfa_idx_row = pstrcatstr( dfa_idx_row,
-                pstrrender( gen->dfa_idx.row_end,
-                    GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( plist_count( dfa->states ) ), TRUE,
-                    GEN_WILD_PREFIX "row",
-                        int_to_str( row ), TRUE,
-                    (char*)NULL ), TRUE );
+        snippet_render( &dfa_idx, gen->dfa_idx.snip_row_end,
+                plist_count( dfa->states ), row );
 
-        dfa_accept_row = pstrcatstr( dfa_accept_row,
-                pstrrender( gen->dfa_accept.row_end,
-                    GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( plist_count( dfa->states ) ), TRUE,
-                    GEN_WILD_PREFIX "row", int_to_str( row ), TRUE,
-                    (char*)NULL ), TRUE );
+        snippet_render( &dfa_accept, gen->dfa_accept.snip_row_end,
+                plist_count( dfa->states ), row );
 
         if( list_next( l ) )
         {
-            dfa_idx_row = pstrcatstr( dfa_idx_row,
+            outbuf_append( &dfa_idx,
                 gen->dfa_idx.row_sep, FALSE );
-            dfa_accept_row = pstrcatstr( dfa_accept_row,
+            outbuf_append( &dfa_accept,
                 gen->dfa_accept.row_sep, FALSE );
         }
+    }
+
+    /* Packed tables replace the tables generated above */
+    if( parser->packed_tables )
+    {
+        if( gen->blob_byte )
+        {
+            MSG( "Packing tables" );
+            pack_tables( parser, gen, blob, blob_width, max_action,
+                            max_goto, max_dfa_idx, mask_width, column );
+
+            outbuf_free( &action_table );
+            outbuf_free( &goto_table );
+            outbuf_free( &def_prod );
+            outbuf_free( &dfa_select );
+            outbuf_free( &dfa_idx );
+            outbuf_free( &dfa_char );
+            outbuf_free( &dfa_trans );
+            outbuf_free( &dfa_accept );
+            outbuf_free( &dfa_fold );
+            outbuf_free( &dfa_mask );
+
+            packed = TRUE;
+        }
+        else
+            print_error( parser, ERR_NO_PACKED_TABLES, ERRSTYLE_WARNING,
+                            parser->p_template );
+    }
+
+    /* Comb vectors replace the action and goto tables */
+    if( parser->comb_tables )
+    {
+        if( gen->comb.col )
+        {
+            MSG( "Compressing action and goto tables into comb vectors" );
+            action_comb_size = comb_table( parser, gen, FALSE,
+                                    comb + COMB_ACTION_BASE,
+                                        comb_type + COMB_ACTION_BASE );
+            goto_comb_size = comb_table( parser, gen, TRUE,
+                                    comb + COMB_GOTO_BASE,
+                                        comb_type + COMB_GOTO_BASE );
+
+            outbuf_free( &action_table );
+            outbuf_free( &goto_table );
+
+            combed = TRUE;
+        }
+        else
+            print_error( parser, ERR_NO_COMB_TABLES, ERRSTYLE_WARNING,
+                            parser->p_template );
+    }
 
-        dfa_idx = pstrcatstr( dfa_idx, dfa_idx_row, TRUE );
-        dfa_accept = pstrcatstr( dfa_accept, dfa_accept_row, TRUE );
+    /* Split translation units are files of the target marked as such */
+    if( parser->split_units )
+    {
+        for( file = xml_child( gen->xml, "file" );
+                file && !split; file = xml_next( file ) )
+            if( ( option = (char*)xml_attr( file, "split" ) )
+                    && !strcmp( option, "yes" ) )
+                split = TRUE;
+
+        if( !split )
+            print_error( parser, ERR_NO_SPLIT_UNITS, ERRSTYLE_WARNING,
+                            parser->p_template );
     }
 
     MSG( "Construct symbol information table" );
@@ -1168,34 +2115,29 @@ void build_code( PARSER* parser )
     {
         sym = (SYMBOL*)plist_access( e );
 
-        symbols = pstrcatstr( symbols, pstrrender( gen->symbols.col,
-                GEN_WILD_PREFIX "symbol-name",
-                    escape_for_target( gen, sym->name, FALSE ), TRUE,
-                GEN_WILD_PREFIX "emit",
-                    escape_for_target( gen, sym->emit, FALSE ), TRUE,
-                GEN_WILD_PREFIX "symbol",
-                    int_to_str( sym->id ), TRUE,
-                GEN_WILD_PREFIX "type",
-                    int_to_str( sym->type ), TRUE,
-                GEN_WILD_PREFIX "datatype",
-                    int_to_str( sym->vtype ? sym->vtype->id : 0 ), TRUE,
-                GEN_WILD_PREFIX "terminal",
-                    sym->type > 0 ? gen->truedef : gen->falsedef, FALSE,
-                GEN_WILD_PREFIX "lexem",
-                    sym->lexem ? gen->truedef : gen->falsedef, FALSE,
-                GEN_WILD_PREFIX "whitespace",
-                    sym->whitespace ? gen->truedef : gen->falsedef, FALSE,
-                GEN_WILD_PREFIX "greedy",
-                    sym->greedy ? gen->truedef : gen->falsedef, FALSE,
-
-                (char*)NULL ), TRUE );
+        name = escape_for_target( gen, sym->name, FALSE );
+        emit = escape_for_target( gen, sym->emit, FALSE );
+
+        if( sym->emit && *sym->emit )
+            ast_construction = TRUE;
+
+        snippet_render( &symbols, gen->symbols.snip_col,
+                name, emit, sym->id, sym->type,
+                sym->vtype ? sym->vtype->id : 0,
+                sym->type > 0 ? gen->truedef : gen->falsedef,
+                sym->lexem ? gen->truedef : gen->falsedef,
+                sym->whitespace ? gen->truedef : gen->falsedef,
+                sym->greedy ? gen->truedef : gen->falsedef );
+
+        pfree( name );
+        pfree( emit );
 
         if( max_symbol_name < (int)strlen( sym->name ) )
             max_symbol_name = (int)strlen( sym->name );
 
         if( plist_next( e ) )
         {
-            symbols = pstrcatstr( symbols,
+            outbuf_append( &symbols,
                 gen->symbols.col_sep, FALSE );
         }
     }
@@ -1275,14 +2217,14 @@ void build_code( PARSER* parser )
         if( act && *act )
         {
             /* Generate action start */
-            actions = pstrcatstr( actions, pstrrender( gen->action_start,
+            outbuf_append( &actions, pstrrender( gen->action_start,
                 GEN_WILD_PREFIX "production-number", int_to_str( p->id ), TRUE,
                     (char*)NULL ), TRUE );
 
             /* Generate code localization */
             if( gen->code_localization && p->code_at > 0 )
             {
-                actions = pstrcatstr( actions,
+                outbuf_append( &actions,
                     pstrrender( gen->code_localization,
                         GEN_WILD_PREFIX "line",
                             int_to_str( p->code_at ), TRUE,
@@ -1292,34 +2234,29 @@ void build_code( PARSER* parser )
 
             /* Generate the action code */
             act = build_action( parser, gen, p, act, is_default_code );
-            actions = pstrcatstr( actions, act, TRUE );
+            outbuf_append( &actions, act, TRUE );
 
             /* Generate the action end */
-            actions = pstrcatstr( actions, pstrrender( gen->action_end,
+            outbuf_append( &actions, pstrrender( gen->action_end,
                 GEN_WILD_PREFIX "production-number", int_to_str( p->id ), TRUE,
                     (char*)NULL ), TRUE );
         }
 
         /* Generate production information table */
-        productions = pstrcatstr( productions, pstrrender(
-            gen->productions.col,
-
-                GEN_WILD_PREFIX "production-number",
-                    int_to_str( p->id ), TRUE,
-                GEN_WILD_PREFIX "production",
-                    escape_for_target( gen, mkproduction_str( p ), TRUE ),
-                        TRUE,
-                GEN_WILD_PREFIX "emit",
-                    escape_for_target( gen, p->emit, TRUE ), TRUE,
-                GEN_WILD_PREFIX "length",
-                    int_to_str( plist_count( p->rhs ) ), TRUE,
-                GEN_WILD_PREFIX "lhs",
-                    int_to_str( p->lhs->id ), TRUE,
-
-            (char*)NULL ), TRUE );
+        name = escape_for_target( gen, mkproduction_str( p ), TRUE );
+        emit = escape_for_target( gen, p->emit, FALSE );
+
+        if( p->emit && *p->emit )
+            ast_construction = TRUE;
+
+        snippet_render( &productions, gen->productions.snip_col,
+                p->id, name, emit, plist_count( p->rhs ), p->lhs->id );
+
+        pfree( name );
+        pfree( emit );
 
         if( plist_next( e ) )
-            productions = pstrcatstr( productions,
+            outbuf_append( &productions,
                 gen->productions.col_sep, FALSE );
 
         row++;
@@ -1338,23 +2275,23 @@ void build_code( PARSER* parser )
             /* Code localization features */
             if( gen->code_localization && sym->code_at > 0 )
             {
-                scan_actions = pstrcatstr( scan_actions,
+                outbuf_append( &scan_actions,
                     pstrrender( gen->code_localization,
                         GEN_WILD_PREFIX "line",
                             int_to_str( sym->code_at ), TRUE,
                                 (char*)NULL ), TRUE );
             }
 
-            scan_actions = pstrcatstr( scan_actions,
+            outbuf_append( &scan_actions,
                 pstrrender( gen->scan_action_start,
                     GEN_WILD_PREFIX "symbol-number",
                             int_to_str( sym->id ), TRUE,
                                 (char*)NULL ), TRUE );
 
             act = build_scan_action( parser, gen, sym, act );
-            scan_actions = pstrcatstr( scan_actions, act, TRUE );
+            outbuf_append( &scan_actions, act, TRUE );
 
-            scan_actions = pstrcatstr( scan_actions,
+            outbuf_append( &scan_actions,
                 pstrrender( gen->scan_action_end,
                     GEN_WILD_PREFIX "symbol-number",
                         int_to_str( sym->id ), TRUE,
@@ -1372,6 +2309,11 @@ void build_code( PARSER* parser )
     for( file = xml_child( gen->xml, "file" );
             file; file = xml_next( file ) )
     {
+        /* Skip files only generated in the other output mode */
+        if( ( option = (char*)xml_attr( file, "split" ) )
+                && ( strcmp( option, "yes" ) == 0 ) != split )
+            continue;
+
         /* Make filename */
         if( !parser->to_stdout )
         {
@@ -1391,10 +2333,136 @@ void build_code( PARSER* parser )
                         (char*)NULL );
         }
 
+        /* Sections are inserted and conditions expanded first, then packed
+            tables, comb vectors and table types, as their placeholders
+            extend the names of the regular tables */
+        all = insert_sections( gen, xml_txt( file ) );
+        complete = expand_conditions( parser, all,
+            "packed-tables", packed,
+            "comb-tables", combed,
+            "mode", parser->p_mode == MODE_SCANNER,
+            "lexers", list_count( parser->dfas ) > 0,
+            "case-folding", list_count( parser->folded_dfas ) > 0,
+            "shared-lexers", parser->p_shared_dfas,
+            "skip-whitespace", parser->p_mode == MODE_SCANNER
+                                    || parser->skip,
+            "ast-construction", ast_construction,
+            "scanner-actions", scan_actions.buf && *scan_actions.buf,
+            "error-token", parser->error != (SYMBOL*)NULL,
+            (char*)NULL );
+
+        pfree( all );
+
+        blobs = pstrrender( complete,
+            GEN_WILD_PREFIX "packed-tables", int_to_str( packed ), TRUE,
+            GEN_WILD_PREFIX "comb-tables", int_to_str( combed ), TRUE,
+            GEN_WILD_PREFIX "action-comb-size",
+                int_to_str( action_comb_size ), TRUE,
+            GEN_WILD_PREFIX "goto-comb-size",
+                int_to_str( goto_comb_size ), TRUE,
+            GEN_WILD_PREFIX "action-base-type",
+                comb_type[ COMB_ACTION_BASE ], FALSE,
+            GEN_WILD_PREFIX "action-check-type",
+                comb_type[ COMB_ACTION_CHECK ], FALSE,
+            GEN_WILD_PREFIX "action-next-type",
+                comb_type[ COMB_ACTION_NEXT ], FALSE,
+            GEN_WILD_PREFIX "goto-base-type",
+                comb_type[ COMB_GOTO_BASE ], FALSE,
+            GEN_WILD_PREFIX "goto-check-type",
+                comb_type[ COMB_GOTO_CHECK ], FALSE,
+            GEN_WILD_PREFIX "goto-next-type",
+                comb_type[ COMB_GOTO_NEXT ], FALSE,
+            GEN_WILD_PREFIX "action-base",
+                comb[ COMB_ACTION_BASE ].buf, FALSE,
+            GEN_WILD_PREFIX "action-check",
+                comb[ COMB_ACTION_CHECK ].buf, FALSE,
+            GEN_WILD_PREFIX "action-next",
+                comb[ COMB_ACTION_NEXT ].buf, FALSE,
+            GEN_WILD_PREFIX "goto-base",
+                comb[ COMB_GOTO_BASE ].buf, FALSE,
+            GEN_WILD_PREFIX "goto-check",
+                comb[ COMB_GOTO_CHECK ].buf, FALSE,
+            GEN_WILD_PREFIX "goto-next",
+                comb[ COMB_GOTO_NEXT ].buf, FALSE,
+            GEN_WILD_PREFIX "action-table-type",
+                table_type( gen, tab_min[ BLOB_ACTION_TABLE ],
+                                tab_max[ BLOB_ACTION_TABLE ] ), FALSE,
+            GEN_WILD_PREFIX "goto-table-type",
+                table_type( gen, tab_min[ BLOB_GOTO_TABLE ],
+                                tab_max[ BLOB_GOTO_TABLE ] ), FALSE,
+            GEN_WILD_PREFIX "default-productions-type",
+                table_type( gen, tab_min[ BLOB_DEF_PROD ],
+                                tab_max[ BLOB_DEF_PROD ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-select-type",
+                table_type( gen, tab_min[ BLOB_DFA_SELECT ],
+                                tab_max[ BLOB_DFA_SELECT ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-index-type",
+                table_type( gen, tab_min[ BLOB_DFA_INDEX ],
+                                tab_max[ BLOB_DFA_INDEX ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-char-type",
+                table_type( gen, tab_min[ BLOB_DFA_CHAR ],
+                                tab_max[ BLOB_DFA_CHAR ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-trans-type",
+                table_type( gen, tab_min[ BLOB_DFA_TRANS ],
+                                tab_max[ BLOB_DFA_TRANS ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-accept-type",
+                table_type( gen, tab_min[ BLOB_DFA_ACCEPT ],
+                                tab_max[ BLOB_DFA_ACCEPT ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-fold-type",
+                table_type( gen, tab_min[ BLOB_DFA_FOLD ],
+                                tab_max[ BLOB_DFA_FOLD ] ), FALSE,
+            GEN_WILD_PREFIX "dfa-mask-type",
+                table_type( gen, tab_min[ BLOB_DFA_MASK ],
+                                tab_max[ BLOB_DFA_MASK ] ), FALSE,
+            GEN_WILD_PREFIX "action-table-blob-width",
+                int_to_str( blob_width[ BLOB_ACTION_TABLE ] ), TRUE,
+            GEN_WILD_PREFIX "action-table-blob",
+                blob[ BLOB_ACTION_TABLE ].buf, FALSE,
+            GEN_WILD_PREFIX "goto-table-blob-width",
+                int_to_str( blob_width[ BLOB_GOTO_TABLE ] ), TRUE,
+            GEN_WILD_PREFIX "goto-table-blob",
+                blob[ BLOB_GOTO_TABLE ].buf, FALSE,
+            GEN_WILD_PREFIX "default-productions-blob-width",
+                int_to_str( blob_width[ BLOB_DEF_PROD ] ), TRUE,
+            GEN_WILD_PREFIX "default-productions-blob",
+                blob[ BLOB_DEF_PROD ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-select-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_SELECT ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-select-blob",
+                blob[ BLOB_DFA_SELECT ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-index-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_INDEX ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-index-blob",
+                blob[ BLOB_DFA_INDEX ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-char-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_CHAR ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-char-blob",
+                blob[ BLOB_DFA_CHAR ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-trans-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_TRANS ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-trans-blob",
+                blob[ BLOB_DFA_TRANS ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-accept-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_ACCEPT ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-accept-blob",
+                blob[ BLOB_DFA_ACCEPT ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-fold-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_FOLD ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-fold-blob",
+                blob[ BLOB_DFA_FOLD ].buf, FALSE,
+            GEN_WILD_PREFIX "dfa-mask-blob-width",
+                int_to_str( blob_width[ BLOB_DFA_MASK ] ), TRUE,
+            GEN_WILD_PREFIX "dfa-mask-blob",
+                blob[ BLOB_DFA_MASK ].buf, FALSE,
+
+            (char*)NULL );
+
+        pfree( complete );
+
         /* Assembling all together - Warning, this is
             ONE single function call! */
 
-        all = pstrrender( xml_txt( file ),
+        all = pstrrender( blobs,
 
             /* Lengths of names and Prologue/Epilogue codes */
             GEN_WILD_PREFIX "prologue" LEN_EXT,
@@ -1412,6 +2480,11 @@ void build_code( PARSER* parser )
             /* Limits and sizes, parse tables */
             GEN_WILD_PREFIX "number-of-symbols",
                 int_to_str( plist_count( parser->symbols ) ), TRUE,
+            GEN_WILD_PREFIX "number-of-terminals",
+                int_to_str( parser->terminals ), TRUE,
+            GEN_WILD_PREFIX "number-of-nonterminals",
+                int_to_str( plist_count( parser->symbols )
+                                - parser->terminals ), TRUE,
             GEN_WILD_PREFIX "number-of-states",
                 int_to_str( parray_count( parser->states ) ), TRUE,
             GEN_WILD_PREFIX "number-of-productions",
@@ -1430,31 +2503,48 @@ void build_code( PARSER* parser )
                 int_to_str( column ), TRUE,
             GEN_WILD_PREFIX "number-of-character-map",
                 int_to_str( charmap_count ), TRUE,
-            GEN_WILD_PREFIX "action-table", action_table, FALSE,
-            GEN_WILD_PREFIX "goto-table", goto_table, FALSE,
-            GEN_WILD_PREFIX "default-productions", def_prod, FALSE,
+
+            GEN_WILD_PREFIX "action-table", action_table.buf, FALSE,
+            GEN_WILD_PREFIX "goto-table", goto_table.buf, FALSE,
+            GEN_WILD_PREFIX "default-productions", def_prod.buf, FALSE,
             GEN_WILD_PREFIX "character-map-symbols", char_map_sym, FALSE,
             GEN_WILD_PREFIX "character-map", char_map, FALSE,
             GEN_WILD_PREFIX "character-universe",
                 int_to_str( parser->p_universe ), TRUE,
-            GEN_WILD_PREFIX "symbols", symbols, FALSE,
-            GEN_WILD_PREFIX "productions", productions, FALSE,
+            GEN_WILD_PREFIX "symbols", symbols.buf, FALSE,
+            GEN_WILD_PREFIX "productions", productions.buf, FALSE,
             GEN_WILD_PREFIX "max-symbol-name-length",
                 int_to_str( max_symbol_name ), TRUE,
-            GEN_WILD_PREFIX "dfa-select", dfa_select, FALSE,
-            GEN_WILD_PREFIX "dfa-index", dfa_idx, FALSE,
-            GEN_WILD_PREFIX "dfa-char", dfa_char, FALSE,
-            GEN_WILD_PREFIX "dfa-trans", dfa_trans, FALSE,
-            GEN_WILD_PREFIX "dfa-accept", dfa_accept, FALSE,
+            GEN_WILD_PREFIX "dfa-select", dfa_select.buf, FALSE,
+            GEN_WILD_PREFIX "dfa-index", dfa_idx.buf, FALSE,
+            GEN_WILD_PREFIX "dfa-char", dfa_char.buf, FALSE,
+            GEN_WILD_PREFIX "dfa-trans", dfa_trans.buf, FALSE,
+            GEN_WILD_PREFIX "dfa-accept", dfa_accept.buf, FALSE,
+            GEN_WILD_PREFIX "dfa-fold", dfa_fold.buf, FALSE,
+            GEN_WILD_PREFIX "case-folding",
+                int_to_str( list_count( parser->folded_dfas ) > 0 ), TRUE,
+            GEN_WILD_PREFIX "dfa-mask-width", int_to_str( mask_width ), TRUE,
+            GEN_WILD_PREFIX "dfa-mask", dfa_mask.buf, FALSE,
+            GEN_WILD_PREFIX "shared-lexers",
+                int_to_str( parser->p_shared_dfas ), TRUE,
+            GEN_WILD_PREFIX "ast-construction",
+                int_to_str( ast_construction ), TRUE,
+            GEN_WILD_PREFIX "scanner-actions",
+                int_to_str( scan_actions.buf && *scan_actions.buf ), TRUE,
+            GEN_WILD_PREFIX "line-info",
+                int_to_str( uses_line_info( parser ) ), TRUE,
             GEN_WILD_PREFIX "value-type-definition", type_def, FALSE,
-            GEN_WILD_PREFIX "actions", actions, FALSE,
-            GEN_WILD_PREFIX "scan_actions", scan_actions, FALSE,
+            GEN_WILD_PREFIX "actions", actions.buf, FALSE,
+            GEN_WILD_PREFIX "scan_actions", scan_actions.buf, FALSE,
             GEN_WILD_PREFIX "top-value", top_value, FALSE,
             GEN_WILD_PREFIX "goal-value", goal_value, FALSE,
             GEN_WILD_PREFIX "goal-type", parser->goal->vtype ?
                                             parser->goal->vtype->real_def : "",
                                                 FALSE,
             GEN_WILD_PREFIX "mode", int_to_str( parser->p_mode ), TRUE,
+            GEN_WILD_PREFIX "skip-whitespace",
+                int_to_str( parser->p_mode == MODE_SCANNER
+                                || parser->skip ), TRUE,
             GEN_WILD_PREFIX "error",
                 ( parser->error ? int_to_str( parser->error->id ) :
                             int_to_str( -1 ) ), TRUE,
@@ -1470,6 +2560,8 @@ void build_code( PARSER* parser )
             (char*)NULL
         );
 
+        pfree( blobs );
+
         /* Replace all top-level options */
         plist_for( parser->options, e )
         {
@@ -1477,14 +2569,19 @@ void build_code( PARSER* parser )
                     GEN_WILD_PREFIX, plist_key( e ) ) ) )
                 OUTOFMEM;
 
-            if( !( complete = pstrrender( all,
-                                option, (char*)plist_access( e ), FALSE,
-                                (char*)NULL ) ) )
-                OUTOFMEM;
+            /* Avoid copying the entire file for options not used there */
+            if( strstr( all, option ) )
+            {
+                if( !( complete = pstrrender( all,
+                                    option, (char*)plist_access( e ), FALSE,
+                                    (char*)NULL ) ) )
+                    OUTOFMEM;
+
+                pfree( all );
+                all = complete;
+            }
 
-            pfree( all );
             pfree( option );
-            all = complete;
         }
 
         /* Perform line number updating on this file */
@@ -1493,33 +2590,19 @@ void build_code( PARSER* parser )
             build_code_localizations( &all, gen );
         */
 
-        /* Now replace all prefixes */
-        complete = pstrrender( all,
-                    GEN_WILD_PREFIX "prefix",
-                        parser->p_prefix, FALSE,
-                    GEN_WILD_PREFIX "basename",
-                        basename, FALSE,
-                    GEN_WILD_PREFIX "Cbasename",
-                        c_identifier( basename, FALSE ), TRUE,
-                    GEN_WILD_PREFIX "CBASENAME",
-                        c_identifier( basename, TRUE ), TRUE,
-                    GEN_WILD_PREFIX "filename" LEN_EXT,
-                        long_to_str(
-                            (long)pstrlen( parser->filename ) ), TRUE,
-                    GEN_WILD_PREFIX "filename", parser->filename, FALSE,
-
-                    (char*)NULL );
-
-        pfree( all );
-
-        /* Open output file */
+        /* Open output file; It is written under a temporary name and
+            renamed when complete, so it is never seen half-written */
         if( filename )
         {
-            if( !( stream = fopen( filename, "wt" ) ) )
+            if( !( tmp_filename = pasprintf( "%s.tmp", filename ) ) )
+                OUTOFMEM;
+
+            if( !( stream = fopen( tmp_filename, "wt" ) ) )
             {
                 print_error( parser, ERR_OPEN_OUTPUT_FILE,
                     ERRSTYLE_FATAL, filename );
 
+                pfree( tmp_filename );
                 pfree( filename );
                 filename = (char*)NULL;
             }
@@ -1534,12 +2617,52 @@ void build_code( PARSER* parser )
         }
 
         parser->files_count++;
-        fprintf( stream, "%s", complete );
-        pfree( complete );
+
+        /* Now replace all prefixes, streaming the result into the file */
+        outbuf_init( &out, stream );
+        outbuf_render( &out, all,
+                    GEN_WILD_PREFIX "prefix",
+                        parser->p_prefix, FALSE,
+                    GEN_WILD_PREFIX "basename",
+                        basename, FALSE,
+                    GEN_WILD_PREFIX "Cbasename",
+                        c_identifier( basename, FALSE ), TRUE,
+                    GEN_WILD_PREFIX "CBASENAME",
+                        c_identifier( basename, TRUE ), TRUE,
+                    GEN_WILD_PREFIX "filename" LEN_EXT,
+                        long_to_str(
+                            (long)pstrlen( parser->filename ) ), TRUE,
+                    GEN_WILD_PREFIX "filename", parser->filename, FALSE,
+
+                    (char*)NULL );
+
+        outbuf_flush( &out );
+        outbuf_free( &out );
+        pfree( all );
 
         if( filename )
         {
             fclose( stream );
+
+            /* Split units are kept when unchanged, to be recompiled only
+                when necessary */
+            if( ( parser->keep_unchanged || split )
+                    && same_content( tmp_filename, filename ) )
+                remove( tmp_filename );
+            else
+            {
+#ifdef _WIN32
+                remove( filename );
+#endif
+                if( rename( tmp_filename, filename ) != 0 )
+                {
+                    print_error( parser, ERR_OPEN_OUTPUT_FILE,
+                        ERRSTYLE_FATAL, filename );
+                    remove( tmp_filename );
+                }
+            }
+
+            pfree( tmp_filename );
             pfree( filename );
         }
     }
@@ -1549,32 +2672,79 @@ void build_code( PARSER* parser )
     pfree( basename );
 
     /* Freeing generated content */
-    pfree( action_table );
-    pfree( goto_table );
-    pfree( def_prod );
+    outbuf_free( &action_table );
+    outbuf_free( &goto_table );
+    outbuf_free( &def_prod );
     pfree( char_map );
     pfree( char_map_sym );
-    pfree( symbols );
-    pfree( productions );
-    pfree( dfa_select );
-    pfree( dfa_idx );
-    pfree( dfa_char );
-    pfree( dfa_trans );
-    pfree( dfa_accept );
+    outbuf_free( &symbols );
+    outbuf_free( &productions );
+    outbuf_free( &dfa_select );
+    outbuf_free( &dfa_idx );
+    outbuf_free( &dfa_char );
+    outbuf_free( &dfa_trans );
+    outbuf_free( &dfa_accept );
+    outbuf_free( &dfa_fold );
+    outbuf_free( &dfa_mask );
     pfree( type_def );
-    pfree( actions );
-    pfree( scan_actions );
+    outbuf_free( &actions );
+    outbuf_free( &scan_actions );
+
+    for( i = 0; i < BLOB_COUNT; i++ )
+        outbuf_free( &blob[ i ] );
+
+    for( i = 0; i < COMB_COUNT; i++ )
+        outbuf_free( &comb[ i ] );
+
     pfree( top_value );
     pfree( goal_value );
 
+    /* Freeing compiled snippets */
+    snippet_free( gen->acttab.snip_row_start );
+    snippet_free( gen->acttab.snip_row_end );
+    snippet_free( gen->acttab.snip_col );
+    snippet_free( gen->gotab.snip_row_start );
+    snippet_free( gen->gotab.snip_row_end );
+    snippet_free( gen->gotab.snip_col );
+    snippet_free( gen->dfa_select.snip_col );
+    snippet_free( gen->dfa_mask.snip_row_start );
+    snippet_free( gen->dfa_mask.snip_row_end );
+    snippet_free( gen->dfa_mask.snip_col );
+    snippet_free( gen->defprod.snip_col );
+    snippet_free( gen->dfa_fold.snip_col );
+    snippet_free( gen->dfa_idx.snip_row_start );
+    snippet_free( gen->dfa_idx.snip_row_end );
+    snippet_free( gen->dfa_idx.snip_col );
+    snippet_free( gen->dfa_accept.snip_row_start );
+    snippet_free( gen->dfa_accept.snip_row_end );
+    snippet_free( gen->dfa_accept.snip_col );
+    snippet_free( gen->dfa_char.snip_col );
+    snippet_free( gen->dfa_trans.snip_col );
+    snippet_free( gen->symbols.snip_col );
+    snippet_free( gen->productions.snip_col );
+    snippet_free( gen->comb.snip_col );
+
     /* Freeing the generator's structure */
     pfree( gen->for_sequences );
     pfree( gen->do_sequences );
     xml_free( gen->xml );
 
     /* Free local lexers */
-    plex_free( action_lex );
-    plex_free( scan_lex );
+    action_lex = plex_free( action_lex );
+    scan_lex = plex_free( scan_lex );
+
+    /* Restore the grammar's value types */
+    i = 0;
+    plist_for( parser->symbols, e )
+        ( (SYMBOL*)plist_access( e ) )->vtype = sym_vtypes[ i++ ];
+
+    pfree( sym_vtypes );
+
+    while( list_count( parser->vtypes ) > vtypes_count )
+    {
+        parser->vtypes = list_pop( parser->vtypes, (void**)&vt );
+        free_vtype( vt );
+    }
 
     VOIDRET;
 }
@@ -43,7 +43,15 @@ char* error_txt[128] =
     "Left-hand side '%s' not known",
     "Terminal '%s' not known",
     "Ignoring semantic code: `#!language´ must explicitly be specified.",
-    "Multiple use of directive '#%s' ignored; It has already been defined."
+    "Multiple use of directive '#%s' ignored; It has already been defined.",
+    "Non-terminal \'%s\' derives no terminal string and is dropped",
+    "Non-terminal \'%s\' can't be reached from the goal symbol and is dropped",
+    "Basename \'%s\' can't be used with multiple grammar files",
+    "Unable to watch \'%s\' for changes",
+    "Target \'%s\' does not support packed tables",
+    "Target \'%s\' does not support split translation units",
+    "Target \'%s\' does not support comb-vector tables",
+    "Unknown condition \'%s\' in target \'%s\'"
 };
 
 int					error_count		= 0;
@@ -51,18 +51,27 @@ consumed by a NFA machine state.
 
 //check_with// is the character-class to test transitions on.
 
+The ranges of //check_with// are split into intervals in which every
+character behaves equally for all NFA states in //res//, so that only one
+move is performed per interval instead of one move per character.
+
 Returns the result of the transition on the given character class,
 0 if there is no transition. */
 static int nfa_transition_on_ccl( pregex_nfa* nfa, plist* res,
                                     unsigned int* accept, pccl* check_with )
 {
     int				i;
+    int				j;
     wchar_t			beg;
     wchar_t			end;
     wchar_t			ch;
+    wchar_t			cut;
+    wchar_t			rbeg;
+    wchar_t			rend;
     plist*			tr;
     plist*			ret_res;
     plistel*		e;
+    pregex_nfa_st*	st;
 
     if( !plist_count( res ) )
         plist_push( res, plist_access( plist_first( nfa->states ) ) );
@@ -72,16 +81,34 @@ static int nfa_transition_on_ccl( pregex_nfa* nfa, plist* res,
 
     for( i = 0; pccl_get( &beg, &end, check_with, i ); i++ )
     {
-        /*
-            This may be the source for large run time latency.
-            The way chosen by pregex/dfa.c should be used if necessary
-            somewhere in future.
-        */
-        for( ch = beg; ch <= end; ch++ )
+        for( ch = beg; ch <= end; ch = cut + 1 )
         {
+            /*
+                Find the end of the interval starting at ch, where no range
+                of any state's character class begins or ends within.
+            */
+            cut = end;
+
+            plist_for( res, e )
+            {
+                st = (pregex_nfa_st*)plist_access( e );
+
+                if( !st->ccl )
+                    continue;
+
+                for( j = 0; pccl_get( &rbeg, &rend, st->ccl, j ); j++ )
+                {
+                    if( rbeg > ch && rbeg <= cut )
+                        cut = rbeg - 1;
+
+                    if( rend >= ch && rend < cut )
+                        cut = rend;
+                }
+            }
+
             tr = plist_dup( res );
 
-            if( pregex_nfa_move( nfa, tr, ch, ch ) > 0 )
+            if( pregex_nfa_move( nfa, tr, ch, cut ) > 0 )
                 plist_union( ret_res, tr );
 
             tr = plist_free( tr );
@@ -255,6 +282,51 @@ static BOOLEAN check_nfa_matches_parser(
 }
 
 
+/** Checks if the left-hand side //lhs// of a production reduced by the
+regular expression terminal //regex// appears somewhere in the grammar where
+it is followed by a symbol that can't start with //regex//.
+
+//parser// is the pointer to the parser information structure.
+
+Returns TRUE if such a position was found, FALSE otherwise. */
+static BOOLEAN lhs_followed_without_regex( PARSER* parser,
+                                            SYMBOL* lhs, SYMBOL* regex )
+{
+    plistel*		e;
+    plistel*		f;
+    PROD*			p;
+    SYMBOL*			sym;
+
+    plist_for( parser->productions, e )
+    {
+        p = (PROD*)plist_access( e );
+
+        plist_for( p->rhs, f )
+        {
+            sym = (SYMBOL*)plist_access( f );
+
+            if( sym == lhs && plist_next( f ) )
+            {
+                do
+                {
+                    f = plist_next( f );
+                    if( !f )
+                        break;
+
+                    sym = (SYMBOL*)plist_access( f );
+
+                    if( !plist_get_by_ptr( sym->first, regex )
+                            && !sym->nullable )
+                        return TRUE;
+                }
+                while( sym && sym->nullable );
+            }
+        }
+    }
+
+    return FALSE;
+}
+
 /** Checks for regex anomalies in the resulting parse tables.
 
 Such regex anomalies occur, when the parser can reduce both by a regular
@@ -274,6 +346,13 @@ A demonstation grammar for a keyword anomaly is the following:
 At the input "[HALLOPRINT]", which is valid, the parser will fail after
 successfully parsing "[HALLO", expecting a "]".
 
+The NFA of every regular expression terminal, its initial move on every
+character class terminal and the left-hand side check of every reduced
+production are only computed once and cached for all states. The parse along
+the tables itself isn't cached: lalr1_closure() merges states of equal kernels,
+so every state has a core of its own, and a (terminal, core) pair is never
+checked twice.
+
 //parser// is the pointer to the parser information structure.
 
 Returns TRUE if regex anomalies where found, FALSE otherwise. */
@@ -283,16 +362,18 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
     LIST*			m;
     LIST*			n;
     plistel*		e;
-    plistel*		f;
     PROD*			p;
-    SYMBOL*			lhs;
-    SYMBOL*			sym;
     TABCOL*			col;
     TABCOL*			ccol;
     int				cnt;
     BOOLEAN			found;
+    char			key			[ ONE_LINE + 1 ];
 
     plist*			res;
+    plist*			move;
+    plist*			nfas;
+    plist*			moves;
+    plist*			follows;
     pregex_nfa*		nfa;
     unsigned int	accept;
 
@@ -315,6 +396,15 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
 
     res = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
 
+    /* NFAs by regex terminal */
+    nfas = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_PTRKEYS );
+
+    /* Initial NFA state sets by regex terminal and character class */
+    moves = plist_create( 0, PLIST_MOD_PTR );
+
+    /* Left-hand side check results by regex terminal and left-hand side */
+    follows = plist_create( sizeof( BOOLEAN ), PLIST_MOD_NONE );
+
     /*
         For every keyword, try to find a character class beginning with the
         same character as the keyword. Then, try to recognize the keyword
@@ -348,13 +438,20 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                     continue;
 
                 /*
-                    Generate NFA from pattern
+                    Generate NFA from pattern, if not already done
                 */
-                nfa = pregex_nfa_create();
+                if( ( e = plist_get_by_key( nfas, (char*)col->symbol ) ) )
+                    nfa = (pregex_nfa*)plist_access( e );
+                else
+                {
+                    nfa = pregex_nfa_create();
 
-                col->symbol->ptn->accept = col->symbol->id + 1;
+                    col->symbol->ptn->accept = col->symbol->id + 1;
 
-                pregex_ptn_to_nfa( nfa, col->symbol->ptn );
+                    pregex_ptn_to_nfa( nfa, col->symbol->ptn );
+                    plist_insert( nfas, (plistel*)NULL,
+                                    (char*)col->symbol, nfa );
+                }
 
                 /*
                     check_nfa_matches_parser() can either be called here;
@@ -371,14 +468,27 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                     if( ccol->symbol->type == SYM_CCL_TERMINAL
                             && ccol->action & SHIFT )
                     {
-                        plist_erase( res );
-
                         /*
                         fprintf( stderr, "col = >%s< ccol = >%s<\n",
                             col->symbol->name,
                                 pccl_to_str( ccol->symbol->ccl, TRUE ) );
                         */
 
+                        sprintf( key, "%d %d",
+                            col->symbol->id, ccol->symbol->id );
+
+                        if( ( e = plist_get_by_key( moves, key ) ) )
+                            move = (plist*)plist_access( e );
+                        else
+                        {
+                            move = plist_create( 0, PLIST_MOD_PTR );
+
+                            nfa_transition_on_ccl( nfa, move, &accept,
+                                                    ccol->symbol->ccl );
+
+                            plist_insert( moves, (plistel*)NULL, key, move );
+                        }
+
                         /*
                             If this is a match with the grammar and the keyword,
                             a keyword anomaly exists between the shift by a
@@ -387,9 +497,7 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                             keyword. This is not the problem if there is only
                             one reduce, but if there are more, output a warning!
                         */
-                        if( nfa_transition_on_ccl(
-                                    nfa, res, &accept,
-                                        ccol->symbol->ccl ) )
+                        if( plist_count( move ) )
                         {
                             /*
                             printf( "state %d\n", st->state_id );
@@ -398,6 +506,9 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                             getchar();
                             */
 
+                            plist_erase( res );
+                            plist_concat( res, move );
+
                             if( check_nfa_matches_parser( parser, nfa, res,
                                     st->state_id ) && cnt > 1 )
                             {
@@ -413,73 +524,43 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                                 p = (PROD*)plist_access(
                                             plist_get( parser->productions,
                                                             col->index ) );
-                                lhs = p->lhs;
 
-                                /* Go trough all productions */
-                                found = FALSE;
+                                sprintf( key, "%d %d",
+                                    col->symbol->id, p->lhs->id );
 
-                                plist_for( parser->productions, e )
+                                if( ( e = plist_get_by_key( follows, key ) ) )
+                                    found = *( (BOOLEAN*)plist_access( e ) );
+                                else
                                 {
-                                    p = (PROD*)plist_access( e );
-
-                                    plist_for( p->rhs, f )
-                                    {
-                                        sym = (SYMBOL*)plist_access( f );
-
-                                        if( sym == lhs && plist_next( f ) )
-                                        {
-                                            do
-                                            {
-                                                f = plist_next( f );
-                                                if( !f )
-                                                    break;
-
-                                                sym = (SYMBOL*)
-                                                        plist_access( f );
-                                                /*
-                                                fprintf( stderr, "sym = " );
-                                                print_symbol( stderr, sym );
-                                                fprintf( stderr, " %d %d\n",
-                                                    list_find( sym->first,
-                                                        col->symbol ),
-                                                            sym->nullable );
-                                                */
-                                                if( !plist_get_by_ptr(
-                                                        sym->first,
-                                                        col->symbol )
-                                                    && !sym->nullable )
-                                                {
-                                                    print_error( parser,
-                                                        ERR_KEYWORD_ANOMALY,
-                                                        ERRSTYLE_WARNING |
-                                                        ERRSTYLE_STATEINFO,
-                                                        st, ccol->symbol->name,
-                                                            col->symbol->name );
-
-                                                    found = TRUE;
-                                                    break;
-                                                }
-                                            }
-                                            while( sym && sym->nullable );
-                                        }
-
-                                        if( found )
-                                            break;
-                                    }
-
-                                    if( found )
-                                        break;
+                                    found = lhs_followed_without_regex(
+                                                parser, p->lhs, col->symbol );
+
+                                    plist_insert( follows, (plistel*)NULL,
+                                                    key, &found );
                                 }
+
+                                if( found )
+                                    print_error( parser, ERR_KEYWORD_ANOMALY,
+                                        ERRSTYLE_WARNING | ERRSTYLE_STATEINFO,
+                                            st, ccol->symbol->name,
+                                                col->symbol->name );
                             }
                         }
                     }
                 }
-
-                nfa = pregex_nfa_free( nfa );
             }
         }
     } /* This is stupid... */
 
+    plist_for( nfas, e )
+        pregex_nfa_free( (pregex_nfa*)plist_access( e ) );
+
+    plist_for( moves, e )
+        plist_free( (plist*)plist_access( e ) );
+
+    plist_free( nfas );
+    plist_free( moves );
+    plist_free( follows );
     plist_free( res );
 
     return FALSE;
@@ -142,7 +142,7 @@ static void close_item( plist* productions, ITEM* it, LIST** closure_set )
                         {
                             if( !first )
                                 first = plist_create( 0,
-                                            PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+                                        PLIST_MOD_PTRSET | PLIST_MOD_RECYCLE );
                             else
                                 plist_erase( first );
 
@@ -359,7 +359,7 @@ static void lalr1_closure( PARSER* parser, int state_id )
             {
                 if( it->next_symbol && cit->next_symbol )
                 {
-                    if( it->next_symbol > cit->next_symbol
+                    if( it->next_symbol->id > cit->next_symbol->id
                         || ( it->next_symbol == cit->next_symbol
                             && it->prod->id > cit->prod->id ) )
                     {
@@ -3,9 +3,90 @@ by using the libphorward regular expression tools. */
 
 #include "unicc.h"
 
+/* Checks if whitespace may be skipped in front of the next token in state
+//st//. This is the case when the state isn't located within a lexeme, and
+doesn't expect a rewritten whitespace. */
+static BOOLEAN skips_whitespace( STATE* st )
+{
+    LIST*	m;
+    ITEM*	it;
+
+    LISTFOR( st->kernel, m )
+    {
+        it = (ITEM*)list_access( m );
+
+        if( it->prod->lhs->lexem
+                || ( it->next_symbol && it->next_symbol->whitespace ) )
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Folds //nfa// to run on lower-case input, if the parser uses
+case-insensitive strings. Case-insensitive strings expand into
+character-classes like [Ll][Ee][Tt]; If every character-class of //nfa// treats
+upper- and lower-case letters alike, the upper-case letters are removed, so
+the DFA constructed from //nfa// requires less transitions. Only the ASCII
+letters are folded.
+
+Returns TRUE if //nfa// has been folded. */
+static BOOLEAN fold_nfa( PARSER* parser, pregex_nfa* nfa )
+{
+    plistel*		e;
+    pregex_nfa_st*	st;
+    pccl*			ccl;
+    BOOLEAN			upper		= FALSE;
+    wchar_t			ch;
+
+    if( !parser->p_cis_strings )
+        return FALSE;
+
+    plist_for( nfa->states, e )
+    {
+        st = (pregex_nfa_st*)plist_access( e );
+
+        if( !st->ccl )
+            continue;
+
+        for( ch = 'A'; ch <= 'Z'; ch++ )
+        {
+            if( pccl_test( st->ccl, ch )
+                    != pccl_test( st->ccl, ch - 'A' + 'a' ) )
+                return FALSE;
+
+            if( !upper && pccl_test( st->ccl, ch ) )
+                upper = TRUE;
+        }
+    }
+
+    if( !upper )
+        return FALSE;
+
+    plist_for( nfa->states, e )
+    {
+        st = (pregex_nfa_st*)plist_access( e );
+
+        if( !st->ccl )
+            continue;
+
+        ccl = pccl_dup( st->ccl );
+        pccl_delrange( ccl, 'A', 'Z' );
+
+        pccl_free( st->ccl );
+        st->ccl = pccl_intern( ccl );
+    }
+
+    return TRUE;
+}
+
 /** Converts the terminal symbols within the states into a DFA, and maybe
 re-uses state machines matching the same pool of terminals.
 
+When whitespace skipping is enabled, the whitespace pattern is also added to
+the DFAs of the states where whitespace is allowed. With case-insensitive
+strings, every NFA is folded before the DFA is constructed, if possible.
+
 //parser// is the pointer to parser information structure. */
 void merge_symbols_to_dfa( PARSER* parser )
 {
@@ -15,6 +96,7 @@ void merge_symbols_to_dfa( PARSER* parser )
     LIST*	m;
     STATE*	s;
     TABCOL*	col;
+    BOOLEAN	folded;
 
     PROC( "merge_symbols_to_dfa" );
     PARMS( "parser", "%p", parser );
@@ -31,10 +113,16 @@ void merge_symbols_to_dfa( PARSER* parser )
             nfa_from_symbol( parser, nfa, col->symbol );
         }
 
+        if( parser->skip && skips_whitespace( s ) )
+            nfa_from_symbol( parser, nfa, parser->skip );
+
         /* Construct DFA, if NFA has been constructed */
         VARS( "plist_count( nfa->states )", "%d", plist_count( nfa->states ) );
         if( plist_count( nfa->states ) )
         {
+            folded = fold_nfa( parser, nfa );
+            VARS( "folded", "%d", folded );
+
             dfa = pregex_dfa_create();
 
             MSG( "Constructing DFA from NFA" );
@@ -54,7 +142,7 @@ void merge_symbols_to_dfa( PARSER* parser )
             VARS( "plist_count( dfa->states )", "%d",
                     plist_count( dfa->states ) );
 
-            if( ( ex_dfa = find_equal_dfa( parser, dfa ) ) )
+            if( ( ex_dfa = find_equal_dfa( parser, dfa, folded ) ) )
             {
                 MSG( "An equal DFA exists; Freeing temporary one!" );
                 dfa = pregex_dfa_free( dfa );
@@ -67,6 +155,10 @@ void merge_symbols_to_dfa( PARSER* parser )
                 if( !( parser->dfas = list_push(
                         parser->dfas, (void*)ex_dfa ) ) )
                     OUTOFMEM;
+
+                if( folded && !( parser->folded_dfas = list_push(
+                        parser->folded_dfas, (void*)ex_dfa ) ) )
+                    OUTOFMEM;
             }
 
             VARS( "ex_dfa", "%p", ex_dfa );
@@ -88,6 +180,7 @@ void construct_single_lexer( PARSER* parser )
     pregex_dfa*			dfa;
     plistel*			e;
     SYMBOL*				s;
+    BOOLEAN				folded;
 
     PROC( "construct_single_lexer" );
     PARMS( "parser", "%p", parser );
@@ -108,6 +201,9 @@ void construct_single_lexer( PARSER* parser )
     VARS( "plist_count( nfa->states )", "%d", plist_count( nfa->states ) );
     if( plist_count( nfa->states ) )
     {
+        folded = fold_nfa( parser, nfa );
+        VARS( "folded", "%d", folded );
+
         MSG( "Constructing DFA from NFA" );
         if( !pregex_dfa_from_nfa( dfa, nfa ) )
             OUTOFMEM;
@@ -127,6 +223,10 @@ void construct_single_lexer( PARSER* parser )
 
         if( !( parser->dfas = list_push( parser->dfas, (void*)dfa ) ) )
             OUTOFMEM;
+
+        if( folded && !( parser->folded_dfas = list_push(
+                parser->folded_dfas, (void*)dfa ) ) )
+            OUTOFMEM;
     }
 
     VOIDRET;
@@ -139,10 +239,13 @@ in the parser.
 //parser// is the parser information structure.
 //ndfa// is the pointer to DFA that is compared with the other machine already
 integrated into the parser structure.
+//folded// defines if //ndfa// runs on case-folded input; Only machines of the
+same kind are compared.
 
 Returns the pointer to a matching DFA, else (pregex_dfa*)NULL.
 */
-pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa )
+pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa,
+                                BOOLEAN folded )
 {
     LIST*			l;
     plistel*		e;
@@ -167,11 +270,18 @@ pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa )
     PROC( "find_equal_dfa" );
     PARMS( "parser", "%p", parser );
     PARMS( "ndfa", "%p", ndfa );
+    PARMS( "folded", "%d", folded );
 
     LISTFOR( parser->dfas, l )
     {
         tdfa = (pregex_dfa*)list_access( l );
 
+        if( ( list_find( parser->folded_dfas, tdfa ) > -1 ) != folded )
+        {
+            MSG( "Case-folding does not match - test next" );
+            continue;
+        }
+
         VARS( "plist_count( tdfa->states )", "%d",
                 plist_count( tdfa->states ) );
         VARS( "plist_count( ndfa->states )", "%d",
@@ -208,8 +318,8 @@ pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa )
                 dfa_ent[0] = (pregex_dfa_tr*)plist_access( g );
                 dfa_ent[1] = (pregex_dfa_tr*)plist_access( h );
 
-                if( !( pccl_compare( dfa_ent[0]->ccl, dfa_ent[1]->ccl )
-                            == 0
+                /* Character classes of DFA transitions are interned */
+                if( !( dfa_ent[0]->ccl == dfa_ent[1]->ccl
                         && dfa_ent[0]->go_to == dfa_ent[1]->go_to ) )
                 {
                     MSG( "Deep scan of transitions not equal" );
@@ -264,3 +374,353 @@ void nfa_from_symbol( PARSER* parser, pregex_nfa* nfa, SYMBOL* sym )
 
     VOIDRET;
 }
+
+/* Lexical family: A superset DFA shared by several state lexers */
+typedef struct
+{
+    pregex_dfa*		dfa;			/* Superset DFA */
+    LIST*			syms;			/* Terminals recognized by the DFA */
+    LIST*			members;		/* Original DFAs replaced by the DFA */
+    BOOLEAN			folded;			/* DFA runs on case-folded input */
+} DFA_FAMILY;
+
+/* Returns a list of the terminal symbols accepted by any state of //dfa//. */
+static LIST* dfa_accepts( PARSER* parser, pregex_dfa* dfa )
+{
+    LIST*			syms	= (LIST*)NULL;
+    plistel*		e;
+    pregex_dfa_st*	st;
+    SYMBOL*			sym;
+
+    plist_for( dfa->states, e )
+    {
+        st = (pregex_dfa_st*)plist_access( e );
+
+        if( !st->accept )
+            continue;
+
+        sym = (SYMBOL*)plist_access(
+                plist_get( parser->symbols, st->accept - 1 ) );
+
+        if( list_find( syms, sym ) == -1 )
+            syms = list_push( syms, sym );
+    }
+
+    return syms;
+}
+
+/* Constructs a minimized DFA recognizing all terminals in //syms//.
+//folded// receives if the DFA runs on case-folded input. */
+static pregex_dfa* dfa_from_symbols( PARSER* parser, LIST* syms,
+                                        BOOLEAN* folded )
+{
+    pregex_nfa*	nfa;
+    pregex_dfa*	dfa;
+    LIST*		l;
+
+    nfa = pregex_nfa_create();
+
+    LISTFOR( syms, l )
+        nfa_from_symbol( parser, nfa, (SYMBOL*)list_access( l ) );
+
+    *folded = fold_nfa( parser, nfa );
+    dfa = pregex_dfa_create();
+
+    if( !pregex_dfa_from_nfa( dfa, nfa ) || !pregex_dfa_minimize( dfa ) )
+        OUTOFMEM;
+
+    pregex_nfa_free( nfa );
+    return dfa;
+}
+
+/* Checks if the superset DFA //super// behaves like //dfa//, when the
+accepting states of //super// are filtered by the terminals accepted in
+//dfa//. Both machines are walked in parallel; on every input, the filtered
+accepting symbol of //super// must be equal to the one of //dfa//.
+
+Returns TRUE if //super// can replace //dfa//. */
+static BOOLEAN dfa_covers( PARSER* parser, pregex_dfa* super, pregex_dfa* dfa )
+{
+    BOOLEAN*		mask;
+    char*			done;
+    int*			stack;
+    int				top		= 0;
+    int				cols;
+    int				i;
+    int				j;
+    unsigned int	accept;
+    plistel*		e;
+    plistel*		f;
+    pregex_dfa_st*	st;
+    pregex_dfa_st*	sst;
+    pregex_dfa_tr*	tr;
+    pregex_dfa_tr*	str;
+    pccl*			rest;
+    pccl*			ccl;
+    BOOLEAN			ret		= TRUE;
+
+    cols = plist_count( super->states );
+    mask = (BOOLEAN*)pmalloc( ( plist_count( parser->symbols ) + 1 )
+                                    * sizeof( BOOLEAN ) );
+    done = (char*)pmalloc( plist_count( dfa->states ) * cols * sizeof( char ) );
+    stack = (int*)pmalloc( plist_count( dfa->states ) * cols * sizeof( int ) );
+
+    plist_for( dfa->states, e )
+        mask[ ( (pregex_dfa_st*)plist_access( e ) )->accept ] = TRUE;
+
+    /* Start with the pair of initial states */
+    done[ 0 ] = TRUE;
+    stack[ top++ ] = 0;
+
+    while( ret && top )
+    {
+        top--;
+        i = stack[ top ] / cols;
+        j = stack[ top ] % cols;
+
+        st = (pregex_dfa_st*)plist_access( plist_get( dfa->states, i ) );
+        sst = (pregex_dfa_st*)plist_access( plist_get( super->states, j ) );
+
+        if( ( accept = sst->accept ) && !mask[ accept ] )
+            accept = 0;
+
+        if( accept != st->accept )
+        {
+            ret = FALSE;
+            break;
+        }
+
+        plist_for( st->trans, e )
+        {
+            tr = (pregex_dfa_tr*)plist_access( e );
+            rest = pccl_dup( tr->ccl );
+
+            plist_for( sst->trans, f )
+            {
+                str = (pregex_dfa_tr*)plist_access( f );
+
+                if( !( ccl = pccl_intersect( rest, str->ccl ) ) )
+                    continue;
+
+                pccl_free( ccl );
+
+                ccl = pccl_diff( rest, str->ccl );
+                pccl_free( rest );
+                rest = ccl;
+
+                if( !done[ tr->go_to * cols + str->go_to ] )
+                {
+                    done[ tr->go_to * cols + str->go_to ] = TRUE;
+                    stack[ top++ ] = tr->go_to * cols + str->go_to;
+                }
+            }
+
+            /* Every input of dfa must be consumed by super */
+            if( pccl_count( rest ) )
+                ret = FALSE;
+
+            pccl_free( rest );
+        }
+    }
+
+    pfree( mask );
+    pfree( done );
+    pfree( stack );
+
+    return ret;
+}
+
+/* Checks if //super// covers all DFAs in the list //dfas//. */
+static BOOLEAN dfa_covers_all( PARSER* parser, pregex_dfa* super, LIST* dfas )
+{
+    LIST*	l;
+
+    LISTFOR( dfas, l )
+        if( !dfa_covers( parser, super, (pregex_dfa*)list_access( l ) ) )
+            return FALSE;
+
+    return TRUE;
+}
+
+/** Shares the lexical analyzers of the states in superset DFAs.
+
+Every DFA constructed by merge_symbols_to_dfa() is joined into a lexical
+family with a DFA recognizing the terminals of all its members. A DFA is only
+joined into a family when the family's DFA, filtered by the terminals the
+member accepts, behaves exactly like the member itself, and both run on
+case-folded input or not. Each state then
+obtains the list of terminals it accepts, which is emitted as the per-state
+accept mask, and uses the DFA of its family.
+
+//parser// is the pointer to parser information structure. */
+void share_dfas( PARSER* parser )
+{
+    LIST*			families	= (LIST*)NULL;
+    LIST*			dfas;
+    LIST*			l;
+    LIST*			m;
+    LIST*			syms;
+    LIST*			ext;
+    DFA_FAMILY*		fam;
+    DFA_FAMILY*		best;
+    pregex_dfa*		dfa;
+    pregex_dfa*		super;
+    STATE*			st;
+    BOOLEAN			folded;
+    BOOLEAN			sfolded;
+    int				cnt;
+    int				max;
+
+    PROC( "share_dfas" );
+    PARMS( "parser", "%p", parser );
+
+    LISTFOR( parser->dfas, l )
+    {
+        dfa = (pregex_dfa*)list_access( l );
+        folded = list_find( parser->folded_dfas, dfa ) > -1;
+        syms = dfa_accepts( parser, dfa );
+        best = (DFA_FAMILY*)NULL;
+        max = 0;
+
+        VARS( "dfa", "%p", dfa );
+        VARS( "folded", "%d", folded );
+
+        /* Find a family which already recognizes the terminals of dfa,
+            or the one sharing most of them. */
+        LISTFOR( families, m )
+        {
+            fam = (DFA_FAMILY*)list_access( m );
+
+            if( fam->folded != folded )
+                continue;
+
+            for( cnt = 0, ext = syms; ext; ext = list_next( ext ) )
+                if( list_find( fam->syms, list_access( ext ) ) > -1 )
+                    cnt++;
+
+            if( cnt == list_count( syms )
+                    && dfa_covers( parser, fam->dfa, dfa ) )
+            {
+                MSG( "Family covers this DFA" );
+                break;
+            }
+
+            if( cnt > max )
+            {
+                best = fam;
+                max = cnt;
+            }
+        }
+
+        if( m )
+        {
+            fam = (DFA_FAMILY*)list_access( m );
+            list_free( syms );
+        }
+        else if( best )
+        {
+            MSG( "Trying to extend the family sharing most terminals" );
+            ext = list_union( list_dup( best->syms ), syms );
+            super = dfa_from_symbols( parser, ext, &sfolded );
+
+            if( sfolded == folded
+                    && dfa_covers( parser, super, dfa )
+                    && dfa_covers_all( parser, super, best->members ) )
+            {
+                MSG( "Family extended" );
+                if( list_find( parser->dfas, best->dfa ) == -1 )
+                    pregex_dfa_free( best->dfa );
+
+                fam = best;
+                fam->dfa = super;
+
+                list_free( fam->syms );
+                fam->syms = ext;
+            }
+            else
+            {
+                pregex_dfa_free( super );
+                list_free( ext );
+                fam = (DFA_FAMILY*)NULL;
+            }
+
+            list_free( syms );
+        }
+        else
+        {
+            list_free( syms );
+            fam = (DFA_FAMILY*)NULL;
+        }
+
+        /* Open up a new family, which is initially the DFA itself */
+        if( !fam )
+        {
+            MSG( "Opening new family" );
+            fam = (DFA_FAMILY*)pmalloc( sizeof( DFA_FAMILY ) );
+            fam->dfa = dfa;
+            fam->syms = dfa_accepts( parser, dfa );
+            fam->folded = folded;
+
+            if( !( families = list_push( families, fam ) ) )
+                OUTOFMEM;
+        }
+
+        if( !( fam->members = list_push( fam->members, dfa ) ) )
+            OUTOFMEM;
+    }
+
+    VARS( "list_count( parser->dfas )", "%d", list_count( parser->dfas ) );
+    VARS( "list_count( families )", "%d", list_count( families ) );
+
+    /* Assign the family DFAs and accept masks to the states */
+    parray_for( parser->states, st )
+    {
+        if( !st->dfa )
+            continue;
+
+        st->accepts = dfa_accepts( parser, st->dfa );
+
+        LISTFOR( families, m )
+        {
+            fam = (DFA_FAMILY*)list_access( m );
+
+            if( list_find( fam->members, st->dfa ) > -1 )
+            {
+                st->dfa = fam->dfa;
+                break;
+            }
+        }
+    }
+
+    /* Replace the lexers by the family DFAs */
+    dfas = (LIST*)NULL;
+
+    list_free( parser->folded_dfas );
+    parser->folded_dfas = (LIST*)NULL;
+
+    LISTFOR( families, m )
+    {
+        fam = (DFA_FAMILY*)list_access( m );
+
+        if( !( dfas = list_push( dfas, fam->dfa ) ) )
+            OUTOFMEM;
+
+        if( fam->folded && !( parser->folded_dfas = list_push(
+                parser->folded_dfas, fam->dfa ) ) )
+            OUTOFMEM;
+
+        list_free( fam->syms );
+        list_free( fam->members );
+        pfree( fam );
+    }
+
+    LISTFOR( parser->dfas, l )
+        if( list_find( dfas, list_access( l ) ) == -1 )
+            pregex_dfa_free( (pregex_dfa*)list_access( l ) );
+
+    list_free( parser->dfas );
+    list_free( families );
+    parser->dfas = dfas;
+
+    VOIDRET;
+}
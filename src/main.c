@@ -2,6 +2,28 @@
 
 #include "unicc.h"
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <errno.h>
+
+/* Delay to wait for further changes before regenerating, in milliseconds */
+#define WATCH_DELAY		50
+
+/* A watched file and the grammar to be regenerated when it changes */
+typedef struct
+{
+    char*	path;		/* Path of the watched file */
+    char*	grammar;	/* Grammar file depending on it */
+    int		wd;			/* Watch descriptor of the file's directory */
+} WATCHED;
+#endif
+
 FILE*			status;
 BOOLEAN			first_progress		= FALSE;
 BOOLEAN 		no_warnings			= TRUE;
@@ -96,25 +118,40 @@ void print_usage( FILE* stream, char* progname )
     if( !stream )
         stream = stdout;
 
-    fprintf( stream, "Usage: %s [OPTION]... FILE\n\n"
+    fprintf( stream, "Usage: %s [OPTION]... FILE...\n\n"
         "  -a    --all             Print all warnings\n"
         "  -b/-o --basename NAME   Use basename NAME for output files\n"
+        "  -c    --comb-tables     Emit action and goto tables as comb "
+            "vectors\n"
         "  -G    --grammar         Dump final (rewritten) grammar\n"
         "  -h    --help            Print this help and exit\n"
-        "  -l    --language TARGET Specify target language (default: %s)\n"
+        "  -j    --jobs N          Process up to N grammar files or "
+            "targets\n"
+        "                          in parallel\n"
+        "  -l    --language TARGET Specify target language (default: %s);\n"
+        "                          can be repeated or a comma-separated list\n"
         "  -n    --no-opt          Disables state optimization\n"
         "                          (this will cause more states)\n"
+        "  -p    --packed-tables   Emit tables as packed byte blobs\n"
         "  -P    --productions     Dump final productions\n"
         "  -s    --stats           Print statistics message\n"
         "  -S    --states          Dump LALR(1) states\n"
         "  -t    --stdout          Print output to stdout instead of files\n"
         "  -T    --symbols         Dump symbols\n"
+        "  -U    --split-units     Split parser into several translation "
+            "units\n"
         "  -v    --verbose         Print progress messages\n"
         "  -V    --version         Print version and copyright and exit\n"
         "  -w    --warnings        Print warnings\n"
+#ifdef __linux__
+        "  -W    --watch           Regenerate whenever a grammar file "
+            "changes\n"
+#endif
         "\n"
         "Errors and warnings are printed to stderr, "
             "everything else to stdout.\n"
+        "A FILE of the form @LIST reads further grammar files from LIST, "
+            "one per line.\n"
 
         "", progname, UNICC_DEFAULT_TARGET );
 }
@@ -123,13 +160,17 @@ void print_usage( FILE* stream, char* progname )
 
 //argc// is the argument count from main().
 //argv// is the argument values from main().
-//filename// is the return pointer for the name of the parser source file.
+//files// is the return pointer for the grammar file arguments.
+//files_count// is the return pointer for the number of grammar file arguments.
 //output// is the return pointer for the name of a possible output file.
+//jobs// is the return pointer for the number of parallel jobs.
+//watch// is the return pointer for the watch mode switch.
 //parser// is the parser structure.
 
 Returns a TRUE, if command-line parameters are correct, FALSE otherwise. */
-BOOLEAN get_command_line( int argc, char** argv, char** filename,
-        char** output, PARSER* parser )
+BOOLEAN get_command_line( int argc, char** argv, char*** files,
+        int* files_count, char** output, int* jobs, BOOLEAN* watch,
+            PARSER* parser )
 {
     int		i;
     int		rc;
@@ -141,10 +182,12 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
 
     for( i = 0;
             ( rc = pgetopt( opt, &param, &next, argc, argv,
-                        "ab:Ghl:no:PsStTvVw",
-                        "all grammar help language: no-opt output: basename: "
-                            "productions stats states stdout symbols verbose "
-                                "version warnings", i ) ) == 0; i++ )
+                        "ab:cGhj:l:no:pPsStTUvVwW",
+                        "all comb-tables grammar help jobs: language: no-opt "
+                            "output: basename: packed-tables productions stats "
+                                "split-units states stdout symbols verbose "
+                                    "version warnings watch",
+                                    i ) ) == 0; i++ )
     {
         if( !strcmp( opt, "output" ) || !strcmp( opt, "o" )
             || !strcmp( opt, "basename" ) || !strcmp( opt, "b" ) )
@@ -154,12 +197,26 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
             else
                 *output = param;
         }
+        else if( !strcmp( opt, "jobs" ) || !strcmp( opt, "j" ) )
+        {
+            if( !param )
+                print_error( parser, ERR_CMD_LINE, ERRSTYLE_FATAL, opt );
+            else if( ( *jobs = atoi( param ) ) < 1 )
+                *jobs = 1;
+        }
         else if( !strcmp( opt, "language" ) || !strcmp( opt, "l" ) )
         {
             if( !param )
                 print_error( parser, ERR_CMD_LINE, ERRSTYLE_FATAL, opt );
             else
-                parser->target = param;
+            {
+                /* Several targets can be separated by commas */
+                for( param = strtok( param, "," ); param;
+                        param = strtok( (char*)NULL, "," ) )
+                    parser->targets = list_push( parser->targets, param );
+
+                parser->target = (char*)list_access( parser->targets );
+            }
         }
         else if( !strcmp( opt, "verbose" ) || !strcmp( opt, "v" ) )
         {
@@ -170,6 +227,14 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
             parser->stats = TRUE;
         else if( !strcmp( opt, "warnings" ) || !strcmp( opt, "w" ) )
             no_warnings = FALSE;
+        else if( !strcmp( opt, "watch" ) || !strcmp( opt, "W" ) )
+            *watch = TRUE;
+        else if( !strcmp( opt, "packed-tables" ) || !strcmp( opt, "p" ) )
+            parser->packed_tables = TRUE;
+        else if( !strcmp( opt, "comb-tables" ) || !strcmp( opt, "c" ) )
+            parser->comb_tables = TRUE;
+        else if( !strcmp( opt, "split-units" ) || !strcmp( opt, "U" ) )
+            parser->split_units = TRUE;
         else if( !strcmp( opt, "grammar" ) || !strcmp( opt, "G" ) )
             parser->show_grammar = TRUE;
         else if( !strcmp( opt, "states" ) || !strcmp( opt, "S" ) )
@@ -203,228 +268,683 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
     }
 
     if( rc == 1 )
-        *filename = param;
+    {
+        *files = argv + next;
+        *files_count = argc - next;
+    }
     else if( rc < 0 && param )
         print_error( parser, ERR_CMD_OPT, ERRSTYLE_FATAL, param );
 
-    return ( *filename ? TRUE : FALSE );
+    return ( *files_count ? TRUE : FALSE );
 }
 
-/** Global program entry.
-
-//argc// is the argument count.
-//argv// is the argument values.
+/** Collects the grammar files to be processed into //files//.
 
-Returns the number of errors count, 0 = all right :D
-*/
-int main( int argc, char** argv )
-{
-    char*	filename	= (char*)NULL;
-    char*	base_name	= (char*)NULL;
-    char*	mbase_name	= (char*)NULL;
-    PARSER*	parser;
-    BOOLEAN	recursions	= FALSE;
+//parser// is the parser structure used for error reporting.
+//args// are the file arguments from the command-line.
+//count// is the number of file arguments.
 
-    status = stdout;
-    parser = create_parser();
+An argument starting with '@' names a manifest file, which lists further
+grammar files line by line. Empty lines and lines starting with '#' are
+ignored.
 
-#ifdef UNICC_BOOTSTRAP
-    /* On bootstrap build, print a warning message */
-    printf( "*** WARNING: YOU'RE RUNNING A BOOTSTRAP BUILD OF UNICC!\n" );
-    printf( "*** Some features may not work as you would expect them.\n\n" );
-#endif
+Returns FALSE if a manifest file can't be read. */
+static BOOLEAN collect_files( PARSER* parser, plist* files,
+                                char** args, int count )
+{
+    char*	manifest;
+    char*	line;
+    int		i;
 
-    if( get_command_line( argc, argv, &filename, &base_name, parser ) )
+    for( i = 0; i < count; i++ )
     {
-        if( !pfiletostr( &parser->source, ( parser->filename = filename ) ) )
+        if( *args[ i ] != '@' )
+        {
+            plist_push( files, pstrdup( args[ i ] ) );
+            continue;
+        }
+
+        if( !pfiletostr( &manifest, args[ i ] + 1 ) )
         {
             print_error( parser, ERR_OPEN_INPUT_FILE,
-                            ERRSTYLE_FATAL, filename );
-            free_parser( parser );
+                            ERRSTYLE_FATAL, args[ i ] + 1 );
+            return FALSE;
+        }
+
+        for( line = strtok( manifest, "\r\n" ); line;
+                line = strtok( (char*)NULL, "\r\n" ) )
+        {
+            line = pstrtrim( line );
 
-            return error_count;
+            if( *line && *line != '#' )
+                plist_push( files, pstrdup( line ) );
         }
 
-        /* Basename */
-        if( !base_name )
+        pfree( manifest );
+    }
+
+    return TRUE;
+}
+
+/* Runs the code generator of //parser// for //target//, or for the parser's
+own target if //target// is (char*)NULL. */
+static void generate_target( PARSER* parser, char* target )
+{
+    if( target )
+        parser->p_template = parser->target = target;
+
+    if( parser->verbose )
+        fprintf( status, "Code generation target: %s%s\n",
+            parser->p_template,
+                ( parser->p_template == parser->target
+                    && strcmp( parser->target,
+                        UNICC_DEFAULT_TARGET ) == 0 ?
+                        " (default)" : "" ) );
+
+    PROGRESS( "Invoking code generator" )
+    build_code( parser );
+    DONE()
+}
+
+#ifndef _WIN32
+/* Runs the code generator of the constructed //parser// for //target// in a
+worker. Returns the number of errors of the code generator only. */
+static int target_job( PARSER* parser, void* target )
+{
+    int		errors	= error_count;
+
+    generate_target( parser, (char*)target );
+
+    errors = error_count - errors;
+    error_count -= errors;
+
+    return errors;
+}
+
+/** Runs jobs on a pool of worker processes.
+
+//job// is the function running one job, called with //parser// and an item.
+//parser// is the parser structure passed to every job.
+//items// is the list of items, one job is run for each.
+//jobs// is the maximum number of workers running at the same time.
+
+Every worker is a forked process running one job, so it gets its own copy of
+the global error state, of the parser and of the compiled-in templates.
+Workers report their error count by their exit status.
+
+Returns the number of errors occurred in all jobs. */
+static int run_workers( int (*job)( PARSER*, void* ), PARSER* parser,
+                            plist* items, int jobs )
+{
+    plistel*	e;
+    pid_t		pid;
+    int			running		= 0;
+    int			errors		= 0;
+    int			rc;
+
+    e = plist_first( items );
+
+    while( e || running )
+    {
+        if( e && running < jobs )
         {
-            parser->p_basename = mbase_name = pstrdup( pbasename( filename ) );
-            if( ( base_name = strrchr( parser->p_basename, '.' ) ) )
-                *base_name = '\0';
+            fflush( stdout );
+            fflush( stderr );
+
+            if( !( pid = fork() ) )
+            {
+                rc = ( *job )( parser, plist_access( e ) );
+
+                fflush( stdout );
+                fflush( stderr );
+                _exit( rc > 255 ? 255 : rc );
+            }
+            else if( pid < 0 )
+                errors += ( *job )( parser, plist_access( e ) );
+            else
+                running++;
+
+            e = plist_next( e );
+            continue;
         }
+
+        if( waitpid( -1, &rc, 0 ) < 0 )
+            break;
+
+        running--;
+
+        if( WIFEXITED( rc ) )
+            errors += WEXITSTATUS( rc );
         else
-            parser->p_basename = base_name;
+            errors++;
+    }
+
+    return errors;
+}
+#endif
+
+/** Runs the parser construction for one grammar file.
+
+//opts// is the parser structure holding the command-line options; the job
+constructs its own parser inheriting these options.
+//filename// is the name of the grammar file.
+//base_name// is the basename for output files, or (char*)NULL to derive it
+from //filename//.
+//jobs// is the maximum number of workers running the code generators of
+several targets at the same time.
+//sources// is the return pointer for the list of further grammar files read
+by the job, or (LIST**)NULL. The list and its file names must be freed by the
+caller.
+
+Returns the number of errors occurred in this job. */
+static int run_job( PARSER* opts, char* filename, char* base_name,
+                        int jobs, LIST** sources )
+{
+    char*	mbase_name	= (char*)NULL;
+    PARSER*	parser;
+    LIST*	l			= (LIST*)NULL;
+#ifndef _WIN32
+    plist*	targets;
+#endif
+    BOOLEAN	recursions	= FALSE;
+
+    error_count = 0;
+    warning_count = 0;
+    first_progress = FALSE;
+
+    parser = create_parser();
+
+    parser->target = opts->target;
+    parser->targets = opts->targets;
+    parser->stats = opts->stats;
+    parser->verbose = opts->verbose;
+    parser->show_states = opts->show_states;
+    parser->show_grammar = opts->show_grammar;
+    parser->show_productions = opts->show_productions;
+    parser->show_symbols = opts->show_symbols;
+    parser->optimize_states = opts->optimize_states;
+    parser->all_warnings = opts->all_warnings;
+    parser->to_stdout = opts->to_stdout;
+    parser->keep_unchanged = opts->keep_unchanged;
+    parser->packed_tables = opts->packed_tables;
+    parser->comb_tables = opts->comb_tables;
+    parser->split_units = opts->split_units;
+
+    if( !pfiletostr( &parser->source, ( parser->filename = filename ) ) )
+    {
+        print_error( parser, ERR_OPEN_INPUT_FILE,
+                        ERRSTYLE_FATAL, filename );
+        free_parser( parser );
+
+        return error_count;
+    }
+
+    /* Basename */
+    if( !base_name )
+    {
+        parser->p_basename = mbase_name = pstrdup( pbasename( filename ) );
+        if( ( base_name = strrchr( parser->p_basename, '.' ) ) )
+            *base_name = '\0';
+    }
+    else
+        parser->p_basename = base_name;
+
+    if( parser->verbose )
+        fprintf( status, "UniCC v%s\n", print_version( FALSE ) );
+
+    PROGRESS( "Parsing grammar" )
+
+    /* Parse grammar structure */
+    if( parse_grammar( parser, parser->filename, parser->source ) == 0 )
+    {
+        DONE()
 
         if( parser->verbose )
-            fprintf( status, "UniCC v%s\n", print_version( FALSE ) );
+            fprintf( status, "Parser construction mode: %s\n",
+                pmod[ parser->p_mode ] );
 
-        PROGRESS( "Parsing grammar" )
 
-        /* Parse grammar structure */
-        if( parse_grammar( parser, parser->filename, parser->source ) == 0 )
+        PROGRESS( "Goal symbol detection" )
+        if( parser->goal )
         {
-            DONE()
-
-            if( parser->verbose )
-                fprintf( status, "Parser construction mode: %s\n",
-                    pmod[ parser->p_mode ] );
+            SUCCESS()
 
+            /* Single goal revision, if necessary */
+            PROGRESS( "Setting up single goal symbol" )
+            setup_single_goal( parser );
+            DONE()
 
-            PROGRESS( "Goal symbol detection" )
-            if( parser->goal )
+            /* Rewrite the grammar, if required */
+            PROGRESS( "Rewriting grammar" )
+            if( parser->p_mode == MODE_SCANNERLESS )
             {
-                SUCCESS()
-
-                /* Single goal revision, if necessary */
-                PROGRESS( "Setting up single goal symbol" )
-                setup_single_goal( parser );
-                DONE()
+                if( parser->p_regular_lexemes )
+                    regular_lexemes( parser );
 
-                /* Rewrite the grammar, if required */
-                PROGRESS( "Rewriting grammar" )
-                if( parser->p_mode == MODE_SCANNERLESS )
-                    rewrite_grammar( parser );
+                rewrite_grammar( parser );
+            }
 
-                inherit_vtypes( parser );
-                unique_charsets( parser );
-                symbol_orders( parser );
-                charsets_to_ptn( parser );
+            inherit_vtypes( parser );
+            unique_charsets( parser );
+            prune_grammar( parser );
+            symbol_orders( parser );
+            charsets_to_ptn( parser );
 
-                if( parser->p_mode == MODE_SCANNERLESS )
-                    inherit_fixiations( parser );
-                DONE()
+            if( parser->p_mode == MODE_SCANNERLESS )
+                inherit_fixiations( parser );
+            DONE()
 
-                /* Precedence fixup */
-                PROGRESS( "Fixing precedences" )
-                fix_precedences( parser );
-                DONE()
+            /* Precedence fixup */
+            PROGRESS( "Fixing precedences" )
+            fix_precedences( parser );
+            DONE()
 
-                /* FIRST-set computation */
-                PROGRESS( "Computing FIRST-sets" )
-                compute_first( parser );
-                DONE()
+            /* FIRST-set computation */
+            PROGRESS( "Computing FIRST-sets" )
+            compute_first( parser );
+            DONE()
 
-                if( parser->show_grammar )
-                    dump_grammar( status, parser );
+            if( parser->show_grammar )
+                dump_grammar( status, parser );
 
-                if( parser->show_symbols )
-                    dump_symbols( status, parser );
+            if( parser->show_symbols )
+                dump_symbols( status, parser );
 
-                if( parser->show_productions )
-                    dump_productions( status, parser );
+            if( parser->show_productions )
+                dump_productions( status, parser );
 
-                /* Stupid production recognition */
-                PROGRESS( "Validating rule integrity" )
+            /* Stupid production recognition */
+            PROGRESS( "Validating rule integrity" )
 
-                if( !find_undef_or_unused( parser ) )
-                {
-                    if( check_stupid_productions( parser ) )
-                        recursions = TRUE;
+            if( !find_undef_or_unused( parser ) )
+            {
+                if( check_stupid_productions( parser ) )
+                    recursions = TRUE;
 
-                    DONE()
+                DONE()
 
-                    /* Parse table generator */
-                    PROGRESS( "Building parse tables" )
-                    generate_tables( parser );
+                /* Parse table generator */
+                PROGRESS( "Building parse tables" )
+                generate_tables( parser );
 
-                    if( parser->show_states )
-                        dump_lalr_states( status, parser );
+                if( parser->show_states )
+                    dump_lalr_states( status, parser );
 
-                    DONE()
+                DONE()
 
-                    /* Terminal anomaly detection */
-                    PROGRESS( "Terminal anomaly detection" )
-                    if( parser->p_mode == MODE_SCANNERLESS )
+                /* Terminal anomaly detection */
+                PROGRESS( "Terminal anomaly detection" )
+                if( parser->p_mode == MODE_SCANNERLESS )
+                {
+                    if( recursions )
+                    {
+                        SKIPPED( "Recursions detected" );
+                    }
+                    else if( parser->p_reserve_regex )
                     {
-                        if( recursions )
-                        {
-                            SKIPPED( "Recursions detected" );
-                        }
-                        else if( parser->p_reserve_regex )
-                        {
-                            SKIPPED( "Tokens are reserved!" );
-                        }
-                        else
-                        {
-                            check_regex_anomalies( parser );
-                            DONE()
-                        }
+                        SKIPPED( "Tokens are reserved!" );
                     }
                     else
                     {
-                        SKIPPED( "Not required" );
+                        check_regex_anomalies( parser );
+                        DONE()
                     }
+                }
+                else
+                {
+                    SKIPPED( "Not required" );
+                }
 
-                    /* Lexical analyzer generator */
-                    PROGRESS( "Constructing lexical analyzer" )
+                /* Lexical analyzer generator */
+                PROGRESS( "Constructing lexical analyzer" )
 
-                    if( parser->p_mode == MODE_SCANNERLESS )
-                        merge_symbols_to_dfa( parser );
-                    else if( parser->p_mode == MODE_SCANNER )
-                        construct_single_lexer( parser );
+                if( parser->p_mode == MODE_SCANNERLESS )
+                {
+                    merge_symbols_to_dfa( parser );
 
-                    DONE()
+                    if( parser->p_shared_dfas )
+                        share_dfas( parser );
+                }
+                else if( parser->p_mode == MODE_SCANNER )
+                    construct_single_lexer( parser );
+
+                DONE()
 
-                    /* Default production detection */
-                    PROGRESS( "Detecting default rules" )
-                    detect_default_productions( parser );
-                    DONE()
+                /* Default production detection */
+                PROGRESS( "Detecting default rules" )
+                detect_default_productions( parser );
+                DONE()
 
-                    /* Code generator */
-                    if( !( parser->p_template ) )
-                        parser->p_template = parser->target;
+                /* Code generator */
+                if( !( parser->p_template ) )
+                    parser->p_template = parser->target;
 
-                    if( parser->gen_prog )
+                if( parser->gen_prog )
+                {
+                    /* All targets given on the command-line are generated
+                        from the same parser, unless the grammar specifies
+                        its own target */
+                    if( parser->p_template == parser->target )
+                        l = parser->targets;
+
+#ifndef _WIN32
+                    /* Several targets are generated by workers sharing the
+                        constructed parser; Statistics require the files to
+                        be counted in this process */
+                    if( jobs > 1 && list_count( l ) > 1
+                            && !parser->to_stdout && !parser->stats )
                     {
-                        if( parser->verbose )
-                            fprintf( status, "Code generation target: %s%s\n",
-                                parser->p_template,
-                                    ( parser->p_template == parser->target
-                                        && strcmp( parser->target,
-                                            UNICC_DEFAULT_TARGET ) == 0 ?
-                                            " (default)" : "" ) );
-
-                        PROGRESS( "Invoking code generator" )
-                        build_code( parser );
-                        DONE()
+                        targets = plist_create( 0, PLIST_MOD_PTR );
+
+                        for( ; l; l = list_next( l ) )
+                            plist_push( targets, list_access( l ) );
+
+                        error_count += run_workers( target_job, parser,
+                                                        targets, jobs );
+                        plist_free( targets );
                     }
-                }
-                else
-                {
-                    FAIL()
+                    else
+#endif
+                    do
+                        generate_target( parser, l ?
+                                            (char*)list_access( l ) :
+                                                (char*)NULL );
+                    while( ( l = list_next( l ) ) );
                 }
             }
             else
             {
                 FAIL()
-                print_error( parser, ERR_NO_GOAL_SYMBOL, ERRSTYLE_FATAL );
             }
-
-            if( parser->stats )
-                fprintf( status, "%s%s produced %ld states "
-                            "(%d error%s, %d warning%s), %d file%s\n",
-                    ( parser->verbose ? "\n" : "" ),
-                    filename, parray_count( parser->states ),
-                        error_count, ( error_count == 1 ) ? "" : "s",
-                        warning_count, ( warning_count == 1 ) ? "" : "s",
-                        parser->files_count,
-                            ( parser->files_count == 1 ) ? "" : "s" );
         }
         else
         {
             FAIL()
-            error_count++;
+            print_error( parser, ERR_NO_GOAL_SYMBOL, ERRSTYLE_FATAL );
         }
 
-        free_parser( parser );
+        if( parser->stats )
+            fprintf( status, "%s%s produced %ld states "
+                        "(%d error%s, %d warning%s), %d file%s\n",
+                ( parser->verbose ? "\n" : "" ),
+                filename, parray_count( parser->states ),
+                    error_count, ( error_count == 1 ) ? "" : "s",
+                    warning_count, ( warning_count == 1 ) ? "" : "s",
+                    parser->files_count,
+                        ( parser->files_count == 1 ) ? "" : "s" );
     }
-    else if( !error_count )
+    else
     {
-        print_usage( status, *argv );
+        FAIL()
         error_count++;
     }
 
+    if( sources )
+    {
+        *sources = parser->sources;
+        parser->sources = (LIST*)NULL;
+    }
+
+    free_parser( parser );
     pfree( mbase_name );
 
     return error_count;
 }
+
+#ifndef _WIN32
+/* Runs a job for a grammar file in a worker; //filename// is the grammar. */
+static int file_job( PARSER* opts, void* filename )
+{
+    return run_job( opts, (char*)filename, (char*)NULL, 1, (LIST**)NULL );
+}
+#endif
+
+#ifdef __linux__
+/* Adds //path// to the files watched for //grammar//, unless already done. */
+static void watch_file( PARSER* parser, int fd, plist* watched,
+                            char* path, char* grammar )
+{
+    WATCHED		w;
+    WATCHED*	wp;
+    plistel*	e;
+    char*		dir;
+    char*		sep;
+
+    plist_for( watched, e )
+    {
+        wp = (WATCHED*)plist_access( e );
+
+        if( wp->grammar == grammar && strcmp( wp->path, path ) == 0 )
+            return;
+    }
+
+    /* Editors often replace a file on save, so its directory is watched */
+    if( !( dir = pstrdup( path ) ) )
+        OUTOFMEM;
+
+    if( ( sep = strrchr( dir, PPATHSEP ) ) )
+        *( sep == dir ? sep + 1 : sep ) = '\0';
+    else
+        strcpy( dir, "." );
+
+    if( ( w.wd = inotify_add_watch( fd, dir,
+                    IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE ) ) < 0 )
+        print_error( parser, ERR_WATCH_FILE, ERRSTYLE_WARNING, path );
+    else
+    {
+        if( !( w.path = pstrdup( path ) ) )
+            OUTOFMEM;
+
+        w.grammar = grammar;
+        plist_push( watched, &w );
+    }
+
+    pfree( dir );
+}
+
+/** Runs the parser construction for several grammar files, and runs it again
+for every grammar whenever its grammar file or a grammar file it extends is
+written.
+
+//opts// is the parser structure holding the command-line options.
+//files// is the list of grammar files.
+//base_name// is the basename for output files, or (char*)NULL.
+
+Output files with unchanged content are not rewritten, so tools watching
+them are only triggered by real changes. This function only returns when
+the files can't be watched anymore.
+
+Returns the number of errors occurred in the last run of every grammar. */
+static int run_watch( PARSER* opts, plist* files, char* base_name )
+{
+    struct pollfd			pfd;
+    struct inotify_event*	ev;
+    char					buf	[ 64 * ( sizeof( struct inotify_event )
+                                                + NAME_MAX + 1 ) ];
+    char*					ptr;
+    ssize_t					len;
+    int						timeout;
+    int						rc;
+    plist*					watched;
+    plist*					dirty;
+    plistel*				e;
+    plistel*				f;
+    WATCHED*				w;
+    LIST*					sources;
+    LIST*					l;
+    char*					grammar;
+    int						errors		= 0;
+
+    if( ( pfd.fd = inotify_init() ) < 0 )
+    {
+        print_error( opts, ERR_WATCH_FILE, ERRSTYLE_FATAL,
+                        (char*)plist_access( plist_first( files ) ) );
+        return error_count;
+    }
+
+    pfd.events = POLLIN;
+
+    watched = plist_create( sizeof( WATCHED ), PLIST_MOD_NONE );
+    dirty = plist_create( 0, PLIST_MOD_PTR );
+
+    plist_for( files, e )
+        plist_push( dirty, plist_access( e ) );
+
+    while( TRUE )
+    {
+        /* Regenerate grammars that changed */
+        plist_for( dirty, e )
+        {
+            grammar = (char*)plist_access( e );
+            errors += run_job( opts, grammar, base_name, 1, &sources );
+
+            watch_file( opts, pfd.fd, watched, grammar, grammar );
+
+            for( l = sources; l; l = list_next( l ) )
+            {
+                watch_file( opts, pfd.fd, watched,
+                                (char*)list_access( l ), grammar );
+                pfree( list_access( l ) );
+            }
+
+            list_free( sources );
+        }
+
+        plist_clear( dirty );
+
+        fflush( status );
+        fflush( stderr );
+
+        /* Wait for changes; Events following shortly after each other, as
+            caused by one save, are collected into one run */
+        for( timeout = -1; ( rc = poll( &pfd, 1, timeout ) ) != 0;
+                timeout = plist_count( dirty ) ? WATCH_DELAY : -1 )
+        {
+            if( rc < 0 )
+            {
+                if( errno == EINTR )
+                    continue;
+
+                break;
+            }
+
+            if( ( len = read( pfd.fd, buf, sizeof( buf ) ) ) <= 0 )
+                break;
+
+            for( ptr = buf; ptr < buf + len;
+                    ptr += sizeof( struct inotify_event ) + ev->len )
+            {
+                ev = (struct inotify_event*)ptr;
+
+                if( !ev->len )
+                    continue;
+
+                plist_for( watched, f )
+                {
+                    w = (WATCHED*)plist_access( f );
+
+                    if( w->wd == ev->wd
+                            && strcmp( pbasename( w->path ), ev->name ) == 0
+                            && !plist_get_by_ptr( dirty, w->grammar ) )
+                        plist_push( dirty, w->grammar );
+                }
+            }
+        }
+
+        if( !plist_count( dirty ) )
+            break;
+
+        errors = 0;
+    }
+
+    plist_for( watched, e )
+        pfree( ( (WATCHED*)plist_access( e ) )->path );
+
+    plist_free( watched );
+    plist_free( dirty );
+    close( pfd.fd );
+
+    return errors;
+}
+#endif
+
+/** Global program entry.
+
+//argc// is the argument count.
+//argv// is the argument values.
+
+Returns the number of errors count, 0 = all right :D
+*/
+int main( int argc, char** argv )
+{
+    char**	args		= (char**)NULL;
+    int		args_count	= 0;
+    char*	base_name	= (char*)NULL;
+    int		jobs		= 1;
+    int		errors		= 0;
+    BOOLEAN	watch		= FALSE;
+    plist*	files;
+    plistel*	e;
+    PARSER*	opts;
+
+    status = stdout;
+    opts = create_parser();
+
+#ifdef UNICC_BOOTSTRAP
+    /* On bootstrap build, print a warning message */
+    printf( "*** WARNING: YOU'RE RUNNING A BOOTSTRAP BUILD OF UNICC!\n" );
+    printf( "*** Some features may not work as you would expect them.\n\n" );
+#endif
+
+    if( get_command_line( argc, argv, &args, &args_count,
+                            &base_name, &jobs, &watch, opts ) )
+    {
+        files = plist_create( 0, PLIST_MOD_PTR );
+
+        if( !collect_files( opts, files, args, args_count ) )
+            errors = error_count;
+        else if( base_name && plist_count( files ) > 1 )
+        {
+            print_error( opts, ERR_BASENAME_MULTIPLE_FILES,
+                            ERRSTYLE_FATAL, base_name );
+            errors = error_count;
+        }
+#ifdef __linux__
+        else if( watch )
+        {
+            opts->keep_unchanged = TRUE;
+            errors = run_watch( opts, files, base_name );
+        }
+#endif
+#ifndef _WIN32
+        else if( jobs > 1 && plist_count( files ) > 1 && !opts->to_stdout )
+            errors = run_workers( file_job, opts, files, jobs );
+#endif
+        else
+        {
+            plist_for( files, e )
+                errors += run_job( opts, (char*)plist_access( e ),
+                                    base_name, jobs, (LIST**)NULL );
+        }
+
+        plist_for( files, e )
+            pfree( plist_access( e ) );
+
+        plist_free( files );
+    }
+    else
+    {
+        if( !error_count )
+        {
+            print_usage( status, *argv );
+            error_count++;
+        }
+
+        errors = error_count;
+    }
+
+    list_free( opts->targets );
+    free_parser( opts );
+
+    return errors;
+}
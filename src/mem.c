@@ -9,7 +9,9 @@ a non-terminal symbol.
 
 //p// is the parser information structure
 //dfn// is the symbol definition; in case of a charclass terminal, this is a
-pointer to the ccl, else an identifying name.
+pointer to the ccl, else an identifying name. A ccl is taken over by a newly
+created symbol and may be freed in favor of an equal, interned one; on lookup,
+it is left untouched.
 //type// is the symbol type.
 //atts// is the symbol attributes.
 //create// defines, if TRUE, create symbol if it does not exist!
@@ -21,6 +23,7 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
     char		keych;
     char*		name		= (char*)dfn;
     SYMBOL*		sym			= (SYMBOL*)NULL;
+    pccl*		ccl;
     plistel*	e;
 
     /*
@@ -40,10 +43,23 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
     PARMS( "type", "%d", type );
     PARMS( "create", "%d", create );
 
-    /* In case of a ccl-terminal, generate the name from the ccl */
+    /*
+        Character-class terminals are looked up by their interned ccl,
+        so no string must be rendered from the ccl unless a new symbol
+        is created.
+    */
     if( type == SYM_CCL_TERMINAL )
     {
-        MSG( "SYM_CCL_TERMINAL detected - converting character class" );
+        MSG( "SYM_CCL_TERMINAL detected - looking up character class" );
+
+        if( ( ccl = pccl_interned( (pccl*)dfn ) )
+                && ( e = plist_get_by_key( p->ccls, (char*)ccl ) ) )
+            RETURN( (SYMBOL*)plist_access( e ) );
+
+        if( !create )
+            RETURN( (SYMBOL*)NULL );
+
+        MSG( "Converting character class" );
         name = pccl_to_str( (pccl*)dfn, TRUE );
 
         VARS( "name", "%s", name );
@@ -107,7 +123,7 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
         sym->nullable = FALSE;
         sym->greedy = TRUE;
 
-        sym->first = plist_create( 0, PLIST_MOD_PTR );
+        sym->first = plist_create( 0, PLIST_MOD_PTRSET );
 
         /* Terminal symbols have always theirself in the FIRST-set... */
         if( IS_TERMINAL( sym ) )
@@ -122,9 +138,6 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
         sym->options = plist_create( sizeof( OPT ), PLIST_MOD_EXTKEYS );
 
         /* Identifying name */
-        if( type == SYM_CCL_TERMINAL )
-            sym->ccl = (pccl*)dfn;
-
         sym->keyname = keyname;
         keyname = (char*)NULL;
 
@@ -134,6 +147,13 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
             RETURN( (SYMBOL*)NULL );
         }
 
+        /* Character-class; name is rendered from it, so intern it last */
+        if( type == SYM_CCL_TERMINAL )
+        {
+            sym->ccl = pccl_intern( (pccl*)dfn );
+            plist_insert( p->ccls, (plistel*)NULL, (char*)sym->ccl, sym );
+        }
+
         /* System terminals are linked to the parser object */
         if( type == SYM_SYSTEM_TERMINAL )
         {
@@ -283,7 +303,7 @@ ITEM* create_item( PROD* p )
     i->prod = p;
     i->next_symbol = (SYMBOL*)plist_access( plist_first( p->rhs ) );
 
-    plist_init( &i->lookahead, 0, PLIST_MOD_PTR );
+    plist_init( &i->lookahead, 0, PLIST_MOD_PTRSET );
 
     return i;
 }
@@ -344,6 +364,7 @@ void free_state( STATE* st )
     list_free( st->epsilon );
     list_free( st->actions );
     list_free( st->gotos );
+    list_free( st->accepts );
 }
 
 /** Creates a table column to be added to a state's goto-table or action-table
@@ -513,6 +534,7 @@ PARSER* create_parser( void )
                         PLIST_MOD_EXTKEYS | PLIST_MOD_UNIQUE
                             | PLIST_MOD_AUTOSORT );
     plist_set_sortfn( pptr->symbols, sort_symbols );
+    pptr->ccls = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_PTRKEYS );
 
     pptr->productions = plist_create( sizeof( PROD ), PLIST_MOD_NONE );
 
@@ -554,6 +576,7 @@ void free_parser( PARSER* parser )
 
     plist_iter_access( parser->symbols, (plistfn)free_symbol );
     plist_free( parser->symbols );
+    plist_free( parser->ccls );
 
     plist_free( parser->productions );
 
@@ -564,6 +587,7 @@ void free_parser( PARSER* parser )
 
     list_free( parser->vtypes );
     list_free( parser->dfas );
+    list_free( parser->folded_dfas );
 
     if( parser->p_template != parser->target )
         pfree( parser->p_template );
@@ -578,6 +602,11 @@ void free_parser( PARSER* parser )
 
     pfree( parser->source );
 
+    for( it = parser->sources; it; it = it->next )
+        pfree( it->pptr );
+
+    list_free( parser->sources );
+
     parser->options = free_opts( parser->options );
 
     xml_free( parser->err_xml );
@@ -105,5329 +105,5347 @@ static void parse_error();
 /* Include parser control block definitions */
 #include "parse.h"
 
+/* Functions and tables shared between the parts of the parser */
+#define UNICC_INTERN			UNICC_STATIC
+
+#if 0
+/* Action Table as comb vectors */
+UNICC_INTERN  _act_base[ 164 ] =
+{
+
+};
+
+UNICC_INTERN  _act_check[ 0 ] =
+{
+
+};
+
+UNICC_INTERN  _act_next[ 0 ] =
+{
+
+};
+
+/* GoTo Table as comb vectors */
+UNICC_INTERN  _go_base[ 164 ] =
+{
+
+};
+
+UNICC_INTERN  _go_check[ 0 ] =
+{
+
+};
+
+UNICC_INTERN  _go_next[ 0 ] =
+{
+
+};
+
+#endif
+#if 0
+#if UNICC_ACTION_TABLE
+/* Action Table */
+UNICC_INTERN const unsigned char _act[] =
+        "";
+#endif
+
+#if !0 && !0
+/* GoTo Table */
+UNICC_INTERN const unsigned char _go[] =
+        "";
+#endif
+
+/* Default productions per state */
+UNICC_INTERN const unsigned char _def_prod[] =
+        "";
+
+#if !0
+/* DFA selection table */
+UNICC_INTERN const unsigned char _dfa_select[] =
+        "";
+#endif
+
+#if 87
+/* DFA index table */
+UNICC_INTERN const unsigned char _dfa_idx[] =
+        "";
+
+/* DFA transition chars */
+UNICC_INTERN const unsigned char _dfa_chars[] =
+        "";
+
+/* DFA transitions */
+UNICC_INTERN const unsigned char _dfa_trans[] =
+        "";
+
+/* DFA acception states */
+UNICC_INTERN const unsigned char _dfa_accept[] =
+        "";
+
+#if 0
+/* DFA case-folding flags */
+UNICC_INTERN const unsigned char _dfa_fold[] =
+        "";
+#endif
+
+#if 0
+/* Accept masks of the states using a shared DFA */
+UNICC_INTERN const unsigned char _dfa_mask[] =
+        "";
+#endif
+
+#endif
+#else
+#if UNICC_ACTION_TABLE
 /* Action Table */
-UNICC_STATIC int _act[ 158 ][ 27 * 3 + 1 ] =
+UNICC_INTERN unsigned short _act[ 164 ][ 27 * 3 + 1 ] =
 {
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        26,
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 350,
+        43, 3, 340,
+        44, 3, 349,
+        45, 3, 355,
+        46, 3, 341,
+        47, 3, 358,
+        48, 3, 352,
+        49, 3, 343,
+        50, 3, 344,
+        51, 3, 345,
+        52, 3, 346,
+        53, 3, 354,
+        54, 3, 347,
+        55, 3, 338,
+        56, 3, 342,
+        57, 3, 357,
+        58, 3, 339,
+        59, 3, 351,
+        60, 3, 353,
+        61, 3, 356,
+        62, 3, 348,
+        63, 3, 337,
+        64, 3, 335,
+        66, 3, 336,
+        67, 3, 333,
+        68, 3, 334
     },
     {
-        26,
-        65, 3, 413,
-        64, 3, 405,
-        63, 3, 397,
-        62, 3, 389,
-        61, 3, 381,
-        60, 3, 373,
-        59, 3, 365,
-        58, 3, 357,
-        57, 3, 349,
-        56, 3, 341,
-        55, 3, 333,
-        54, 3, 325,
-        53, 3, 317,
-        52, 3, 309,
-        51, 3, 301,
-        50, 3, 297,
-        49, 3, 289,
-        48, 3, 285,
-        47, 3, 436,
-        46, 3, 273,
-        45, 3, 435,
-        44, 3, 255,
-        43, 3, 431,
-        41, 3, 239,
-        40, 3, 425,
-        39, 3, 426
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         2,
-        38, 2, 12,
-        37, 2, 13
+        1, 2, 9,
+        2, 2, 10
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
     },
     {
         1,
-        2, 3, 150
+        40, 3, 151
     },
     {
         26,
-        65, 3, 413,
-        64, 3, 405,
-        63, 3, 397,
-        62, 3, 389,
-        61, 3, 381,
-        60, 3, 373,
-        59, 3, 365,
-        58, 3, 357,
-        57, 3, 349,
-        56, 3, 341,
-        55, 3, 333,
-        54, 3, 325,
-        53, 3, 317,
-        52, 3, 309,
-        51, 3, 301,
-        50, 3, 297,
-        49, 3, 289,
-        48, 3, 285,
-        47, 3, 436,
-        46, 3, 273,
-        45, 3, 435,
-        44, 3, 255,
-        43, 3, 431,
-        41, 3, 239,
-        40, 3, 425,
-        39, 3, 426
+        42, 3, 350,
+        43, 3, 340,
+        44, 3, 349,
+        45, 3, 355,
+        46, 3, 341,
+        47, 3, 358,
+        48, 3, 352,
+        49, 3, 343,
+        50, 3, 344,
+        51, 3, 345,
+        52, 3, 346,
+        53, 3, 354,
+        54, 3, 347,
+        55, 3, 338,
+        56, 3, 342,
+        57, 3, 357,
+        58, 3, 339,
+        59, 3, 351,
+        60, 3, 353,
+        61, 3, 356,
+        62, 3, 348,
+        63, 3, 337,
+        64, 3, 335,
+        66, 3, 336,
+        67, 3, 333,
+        68, 3, 334
     },
     {
         1,
-        42, 3, 153
+        65, 3, 154
     },
     {
-        1,
-        0, 3, 164
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        2,
-        38, 2, 12,
-        37, 2, 13
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        4,
-        64, 2, 21,
-        62, 2, 23,
-        46, 3, 132,
-        4, 3, 143
+        1,
+        0, 3, 165
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        2,
+        1, 2, 9,
+        2, 2, 10
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        4,
+        38, 3, 144,
+        43, 2, 16,
+        45, 2, 17,
+        61, 3, 135
     },
     {
         2,
-        36, 2, 29,
-        35, 2, 30
+        3, 2, 28,
+        4, 2, 29
     },
     {
         2,
-        36, 2, 29,
-        35, 2, 30
+        3, 2, 28,
+        4, 2, 29
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        4,
-        64, 2, 21,
-        62, 2, 23,
-        46, 3, 132,
-        4, 3, 143
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        1,
-        65, 2, 34
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        1,
-        65, 2, 34
+        4,
+        38, 3, 144,
+        43, 2, 16,
+        45, 2, 17,
+        61, 3, 135
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        42, 2, 34
     },
     {
         1,
-        61, 2, 36
+        42, 2, 34
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        46, 2, 35
     },
     {
         0
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
     },
     {
-        17,
-        32, 2, 40,
-        31, 2, 41,
-        30, 2, 42,
-        29, 2, 43,
-        28, 2, 44,
-        27, 2, 45,
-        26, 2, 46,
-        25, 2, 47,
-        24, 2, 48,
-        22, 2, 49,
-        23, 2, 50,
-        21, 2, 51,
-        20, 2, 52,
-        19, 2, 53,
-        18, 2, 54,
-        17, 2, 55,
-        16, 2, 56
+        20,
+        7, 2, 40,
+        8, 2, 41,
+        9, 2, 42,
+        10, 2, 43,
+        11, 2, 44,
+        12, 2, 45,
+        13, 2, 46,
+        14, 2, 47,
+        15, 2, 48,
+        16, 2, 49,
+        17, 2, 50,
+        18, 2, 51,
+        19, 2, 52,
+        20, 2, 53,
+        21, 2, 54,
+        22, 2, 55,
+        23, 2, 56,
+        24, 2, 57,
+        25, 2, 58,
+        26, 2, 59
     },
     {
         1,
-        46, 3, 132
+        61, 3, 135
     },
     {
-        1,
-        65, 2, 34
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        42, 2, 34
     },
     {
         2,
-        34, 2, 75,
-        33, 2, 76
+        5, 2, 81,
+        6, 2, 82
     },
     {
         3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
+        56, 2, 83,
+        58, 2, 84,
+        61, 3, 135
     },
     {
         1,
-        65, 2, 34
+        42, 2, 34
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        1,
-        46, 3, 132
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        61, 3, 135
     },
     {
         2,
-        46, 3, 266,
-        45, 3, 265
+        61, 3, 332,
+        62, 3, 331
     },
     {
         1,
-        5, 3, 142
+        37, 3, 143
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
+    },
+    {
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
+    },
+    {
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
+    },
+    {
+        6,
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135
     },
     {
         2,
-        51, 2, 80,
-        49, 2, 81
+        56, 2, 83,
+        58, 2, 84
     },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         1,
-        48, 2, 89
+        59, 2, 92
+    },
+    {
+        2,
+        27, 2, 102,
+        28, 2, 103
+    },
+    {
+        2,
+        27, 2, 102,
+        28, 2, 103
+    },
+    {
+        2,
+        27, 2, 102,
+        28, 2, 103
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        27, 2, 102,
+        28, 2, 103
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        27, 2, 102,
+        28, 2, 103
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        27, 2, 102,
+        28, 2, 103
     },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         2,
-        51, 2, 80,
-        49, 2, 81
+        56, 2, 83,
+        58, 2, 84
     },
     {
         2,
-        48, 2, 89,
-        46, 3, 132
+        59, 2, 92,
+        61, 3, 135
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
+    },
+    {
+        0
+    },
+    {
+        1,
+        58, 2, 106
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         2,
-        51, 2, 80,
-        49, 2, 81
+        56, 2, 83,
+        58, 2, 84
     },
     {
-        0
+        1,
+        61, 3, 135
     },
     {
         1,
-        49, 2, 100
+        59, 2, 92
     },
     {
         1,
-        46, 3, 132
+        61, 3, 135
     },
     {
         1,
-        48, 2, 89
+        56, 2, 83
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        0
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
-    },
-    {
-        7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 19
-    },
-    {
-        1,
-        46, 3, 132
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        1,
-        51, 2, 80
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        0
+        7,
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 19
     },
     {
         1,
-        58, 2, 104
+        49, 2, 110
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 20
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 20
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 21
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 21
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 22
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 22
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 23
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 23
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 24
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        42, 1, 24
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        49, 2, 110,
+        54, 2, 112,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     },
     {
         27,
-        65, 3, 466,
-        64, 3, 409,
-        63, 3, 465,
-        62, 3, 393,
-        61, 3, 461,
-        60, 3, 377,
-        59, 3, 457,
-        58, 3, 361,
-        57, 3, 453,
-        56, 3, 345,
-        55, 3, 449,
-        54, 3, 329,
-        53, 3, 445,
-        52, 3, 313,
-        51, 3, 116,
-        50, 2, 113,
-        49, 3, 293,
-        48, 3, 439,
-        47, 3, 279,
-        46, 3, 437,
-        45, 3, 263,
-        44, 3, 433,
-        43, 3, 247,
-        42, 3, 232,
-        41, 3, 429,
-        40, 3, 425,
-        39, 3, 426
+        42, 3, 246,
+        43, 3, 237,
+        44, 3, 245,
+        45, 3, 251,
+        46, 3, 238,
+        47, 3, 253,
+        48, 3, 248,
+        49, 3, 239,
+        50, 3, 240,
+        51, 3, 241,
+        52, 3, 242,
+        53, 3, 250,
+        54, 3, 243,
+        55, 3, 235,
+        56, 3, 119,
+        57, 2, 119,
+        58, 3, 236,
+        59, 3, 247,
+        60, 3, 249,
+        61, 3, 252,
+        62, 3, 244,
+        63, 3, 234,
+        64, 3, 231,
+        65, 3, 232,
+        66, 3, 233,
+        67, 3, 229,
+        68, 3, 230
     },
     {
         0
     },
     {
         27,
-        65, 3, 417,
-        64, 3, 467,
-        63, 3, 401,
-        62, 3, 463,
-        61, 3, 385,
-        60, 3, 459,
-        59, 3, 369,
-        58, 3, 455,
-        57, 3, 353,
-        56, 3, 451,
-        55, 3, 337,
-        54, 3, 447,
-        53, 3, 321,
-        52, 3, 443,
-        51, 3, 305,
-        50, 2, 115,
-        49, 3, 122,
-        48, 3, 283,
-        47, 3, 275,
-        46, 3, 269,
-        45, 3, 259,
-        44, 3, 251,
-        43, 3, 243,
-        42, 3, 228,
-        41, 3, 235,
-        40, 3, 427,
-        39, 3, 468
+        42, 3, 297,
+        43, 3, 287,
+        44, 3, 296,
+        45, 3, 302,
+        46, 3, 288,
+        47, 3, 304,
+        48, 3, 299,
+        49, 3, 290,
+        50, 3, 291,
+        51, 3, 292,
+        52, 3, 293,
+        53, 3, 301,
+        54, 3, 294,
+        55, 3, 286,
+        56, 3, 289,
+        57, 2, 121,
+        58, 3, 125,
+        59, 3, 298,
+        60, 3, 300,
+        61, 3, 303,
+        62, 3, 295,
+        63, 3, 285,
+        64, 3, 282,
+        65, 3, 283,
+        66, 3, 284,
+        67, 3, 280,
+        68, 3, 281
     },
     {
         4,
-        13, 2, 117,
-        63, 2, 118,
-        12, 2, 119,
-        11, 2, 120
+        29, 2, 122,
+        30, 2, 123,
+        31, 2, 124,
+        44, 2, 125
     },
     {
         27,
-        65, 3, 411,
-        64, 3, 407,
-        63, 3, 395,
-        62, 3, 391,
-        61, 3, 379,
-        60, 3, 375,
-        59, 3, 363,
-        58, 3, 359,
-        57, 3, 347,
-        56, 3, 343,
-        55, 3, 331,
-        54, 3, 327,
-        53, 3, 315,
-        52, 3, 311,
-        51, 3, 442,
-        50, 3, 299,
-        49, 3, 441,
-        48, 3, 287,
-        47, 3, 127,
-        46, 3, 271,
-        45, 3, 257,
-        44, 3, 253,
-        43, 3, 241,
-        42, 3, 226,
-        41, 3, 237,
-        40, 3, 425,
-        39, 3, 426
+        42, 3, 323,
+        43, 3, 313,
+        44, 3, 322,
+        45, 3, 327,
+        46, 3, 314,
+        47, 3, 330,
+        48, 3, 325,
+        49, 3, 316,
+        50, 3, 317,
+        51, 3, 318,
+        52, 3, 319,
+        53, 3, 326,
+        54, 3, 320,
+        55, 3, 311,
+        56, 3, 315,
+        57, 3, 329,
+        58, 3, 312,
+        59, 3, 324,
+        60, 3, 130,
+        61, 3, 328,
+        62, 3, 321,
+        63, 3, 310,
+        64, 3, 307,
+        65, 3, 308,
+        66, 3, 309,
+        67, 3, 305,
+        68, 3, 306
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         0
     },
+    {
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
+    },
     {
         1,
-        4, 3, 143
+        38, 3, 144
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         1,
-        60, 2, 123
+        47, 2, 129
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        49, 2, 110,
+        54, 2, 112,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     },
     {
         3,
-        56, 2, 125,
-        55, 2, 126,
-        54, 2, 127
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        51, 2, 131,
+        52, 2, 132,
+        53, 2, 133
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        49, 2, 110,
+        54, 2, 112,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
     },
     {
         27,
-        65, 3, 417,
-        64, 3, 467,
-        63, 3, 401,
-        62, 3, 463,
-        61, 3, 385,
-        60, 3, 459,
-        59, 3, 369,
-        58, 3, 455,
-        57, 3, 353,
-        56, 3, 451,
-        55, 3, 337,
-        54, 3, 447,
-        53, 3, 321,
-        52, 3, 443,
-        51, 3, 305,
-        50, 2, 115,
-        49, 2, 129,
-        48, 3, 283,
-        47, 3, 275,
-        46, 3, 269,
-        45, 3, 259,
-        44, 3, 251,
-        43, 3, 243,
-        42, 3, 228,
-        41, 3, 235,
-        40, 3, 427,
-        39, 3, 468
+        42, 3, 297,
+        43, 3, 287,
+        44, 3, 296,
+        45, 3, 302,
+        46, 3, 288,
+        47, 3, 304,
+        48, 3, 299,
+        49, 3, 290,
+        50, 3, 291,
+        51, 3, 292,
+        52, 3, 293,
+        53, 3, 301,
+        54, 3, 294,
+        55, 3, 286,
+        56, 3, 289,
+        57, 2, 121,
+        58, 2, 135,
+        59, 3, 298,
+        60, 3, 300,
+        61, 3, 303,
+        62, 3, 295,
+        63, 3, 285,
+        64, 3, 282,
+        65, 3, 283,
+        66, 3, 284,
+        67, 3, 280,
+        68, 3, 281
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        42, 3, 271,
+        43, 3, 261,
+        44, 3, 270,
+        45, 3, 276,
+        46, 3, 262,
+        47, 3, 279,
+        48, 3, 273,
+        49, 3, 264,
+        50, 3, 265,
+        51, 3, 266,
+        52, 3, 267,
+        53, 3, 275,
+        54, 3, 268,
+        55, 3, 259,
+        56, 3, 263,
+        57, 3, 278,
+        58, 3, 260,
+        59, 3, 272,
+        60, 3, 274,
+        61, 3, 277,
+        62, 3, 269,
+        63, 3, 258,
+        64, 3, 255,
+        65, 3, 256,
+        66, 3, 257,
+        68, 3, 254
     },
     {
-        0
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        0
     },
     {
         0
     },
     {
         1,
-        59, 2, 134
+        48, 2, 139
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        49, 2, 110,
+        54, 2, 112,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         1,
-        57, 2, 137
+        50, 2, 143
     },
     {
         1,
-        49, 3, 121
+        58, 3, 124
     },
     {
         1,
-        60, 2, 123
+        47, 2, 129
     },
     {
         14,
-        62, 2, 87,
-        7, 2, 143,
-        6, 2, 144,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        4, 1, 75,
-        59, 1, 75,
-        64, 1, 75,
-        65, 1, 75,
-        60, 1, 75,
-        57, 1, 75
+        35, 2, 145,
+        36, 2, 146,
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        38, 1, 78,
+        48, 1, 78,
+        43, 1, 78,
+        42, 1, 78,
+        47, 1, 78,
+        50, 1, 78
     },
     {
         2,
-        60, 2, 123,
-        57, 2, 137
+        47, 2, 129,
+        50, 2, 143
     },
     {
-        1,
-        64, 2, 21
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        43, 2, 16
     },
     {
         3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
+        56, 2, 83,
+        58, 2, 84,
+        61, 3, 135
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        49, 2, 110,
+        54, 2, 112,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         0
     },
     {
-        3,
-        56, 3, 89,
-        55, 3, 90,
-        54, 3, 91
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        1,
-        4, 3, 143
+        6,
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
-        14,
-        62, 2, 87,
-        7, 2, 143,
-        6, 2, 144,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        4, 1, 74,
-        59, 1, 74,
-        64, 1, 74,
-        65, 1, 74,
-        60, 1, 74,
-        57, 1, 74
+        3,
+        51, 3, 92,
+        52, 3, 93,
+        53, 3, 94
     },
     {
         1,
-        63, 2, 118
+        38, 3, 144
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        14,
+        35, 2, 145,
+        36, 2, 146,
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84,
+        59, 2, 92,
+        61, 3, 135,
+        38, 1, 77,
+        48, 1, 77,
+        43, 1, 77,
+        42, 1, 77,
+        47, 1, 77,
+        50, 1, 77
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        44, 2, 125
     },
     {
         1,
-        64, 2, 21
+        43, 2, 16
     },
     {
         2,
-        10, 2, 151,
-        9, 2, 152
+        32, 2, 157,
+        33, 2, 158
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         1,
-        59, 2, 134
+        48, 2, 139
     },
     {
         1,
-        63, 2, 118
+        44, 2, 125
     },
     {
         3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
+        56, 2, 83,
+        58, 2, 84,
+        61, 3, 135
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         1,
-        64, 2, 21
+        43, 2, 16
     },
     {
         1,
-        64, 2, 21
+        43, 2, 16
     },
     {
         1,
-        8, 2, 156
+        34, 2, 162
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        39, 2, 1,
+        41, 2, 2,
+        63, 3, 149,
+        64, 3, 150,
+        65, 3, 158,
+        66, 3, 157
     },
     {
         4,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        45, 2, 90,
+        55, 2, 91,
+        56, 2, 83,
+        58, 2, 84
     }
 };
+#endif
 
+#if !0 && !0
 /* GoTo Table */
-UNICC_STATIC int _go[ 158 ][ 28 * 3 + 1 ] =
+UNICC_INTERN unsigned char _go[ 164 ][ 21 * 3 + 1 ] =
 {
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 2, 4
+        148, 3, 168,
+        149, 2, 3,
+        150, 2, 4,
+        209, 3, 166
     },
     {
-        2,
-        320, 3, 165,
-        239, 3, 166
+        4,
+        70, 3, 161,
+        142, 3, 160,
+        143, 2, 5,
+        144, 2, 6
     },
     {
-        28,
-        259, 3, 160,
-        246, 3, 159,
-        245, 2, 5,
-        244, 2, 6,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        3,
+        74, 3, 163,
+        145, 2, 7,
+        146, 2, 8
     },
     {
-        27,
-        243, 2, 7,
-        242, 2, 8,
-        241, 3, 162,
-        174, 3, 240,
-        166, 3, 256,
-        158, 3, 274,
-        152, 3, 286,
-        150, 3, 290,
-        146, 3, 298,
-        144, 3, 302,
-        140, 3, 310,
-        136, 3, 318,
-        132, 3, 326,
-        128, 3, 334,
-        124, 3, 342,
-        120, 3, 350,
-        116, 3, 358,
-        112, 3, 366,
-        108, 3, 374,
-        104, 3, 382,
-        100, 3, 390,
-        96, 3, 398,
-        92, 3, 406,
-        88, 3, 414,
-        86, 3, 419,
-        85, 3, 420,
-        80, 3, 432
+        2,
+        148, 3, 167,
+        209, 3, 166
     },
     {
         7,
-        312, 2, 9,
-        311, 3, 1,
-        310, 2, 10,
-        309, 2, 11,
-        240, 3, 224,
-        188, 2, 14,
-        187, 2, 15
+        82, 2, 11,
+        83, 3, 1,
+        84, 2, 12,
+        85, 2, 13,
+        147, 3, 228,
+        202, 2, 14,
+        203, 2, 15
     },
     {
-        26,
-        259, 3, 160,
-        246, 3, 158,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        2,
+        70, 3, 161,
+        142, 3, 159
     },
     {
         0
     },
     {
-        25,
-        241, 3, 161,
-        174, 3, 240,
-        166, 3, 256,
-        158, 3, 274,
-        152, 3, 286,
-        150, 3, 290,
-        146, 3, 298,
-        144, 3, 302,
-        140, 3, 310,
-        136, 3, 318,
-        132, 3, 326,
-        128, 3, 334,
-        124, 3, 342,
-        120, 3, 350,
-        116, 3, 358,
-        112, 3, 366,
-        108, 3, 374,
-        104, 3, 382,
-        100, 3, 390,
-        96, 3, 398,
-        92, 3, 406,
-        88, 3, 414,
-        86, 3, 419,
-        85, 3, 420,
-        80, 3, 432
+        1,
+        74, 3, 162
     },
     {
         0
     },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 222,
+        209, 3, 166
+    },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 223,
+        209, 3, 166
+    },
     {
         0
     },
     {
         3,
-        311, 3, 0,
-        188, 2, 14,
-        187, 2, 15
+        83, 3, 0,
+        202, 2, 14,
+        203, 2, 15
     },
     {
         14,
-        318, 2, 16,
-        316, 2, 17,
-        308, 3, 6,
-        307, 2, 18,
-        306, 3, 4,
-        302, 2, 19,
-        301, 2, 20,
-        293, 2, 22,
-        253, 2, 24,
-        249, 2, 25,
-        236, 3, 15,
-        234, 2, 26,
-        210, 3, 42,
-        200, 2, 27
+        76, 2, 18,
+        78, 2, 19,
+        86, 3, 6,
+        87, 2, 20,
+        88, 3, 4,
+        92, 2, 21,
+        93, 2, 22,
+        101, 2, 23,
+        137, 2, 24,
+        139, 2, 25,
+        151, 3, 15,
+        153, 2, 26,
+        180, 3, 45,
+        190, 2, 27
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 218
+        3,
+        89, 2, 30,
+        204, 2, 31,
+        205, 2, 32
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 219
+        3,
+        89, 2, 33,
+        204, 2, 31,
+        205, 2, 32
     },
     {
-        3,
-        305, 2, 28,
-        186, 2, 31,
-        185, 2, 32
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 173,
+        209, 3, 166
     },
     {
-        3,
-        305, 2, 33,
-        186, 2, 31,
-        185, 2, 32
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 210,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 196
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 200,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 170
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 171,
+        209, 3, 166
     },
     {
         12,
-        318, 2, 16,
-        316, 2, 17,
-        308, 3, 5,
-        302, 2, 19,
-        301, 2, 20,
-        293, 2, 22,
-        253, 2, 24,
-        249, 2, 25,
-        236, 3, 15,
-        234, 2, 26,
-        210, 3, 42,
-        200, 2, 27
+        76, 2, 18,
+        78, 2, 19,
+        86, 3, 5,
+        92, 2, 21,
+        93, 2, 22,
+        101, 2, 23,
+        137, 2, 24,
+        139, 2, 25,
+        151, 3, 15,
+        153, 2, 26,
+        180, 3, 45,
+        190, 2, 27
     },
     {
         1,
-        235, 3, 16
+        152, 3, 16
     },
     {
         1,
-        235, 3, 17
-    },
-    {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 172
+        152, 3, 17
     },
     {
         2,
-        288, 2, 35,
-        189, 3, 62
-    },
-    {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 206
+        106, 2, 36,
+        201, 3, 65
     },
     {
         1,
-        252, 2, 37
+        138, 2, 37
     },
     {
-        28,
-        259, 3, 160,
-        248, 2, 38,
-        247, 2, 39,
-        246, 3, 147,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        4,
+        70, 3, 161,
+        140, 2, 38,
+        141, 2, 39,
+        142, 3, 148
     },
     {
-        18,
-        300, 3, 18,
-        233, 2, 57,
-        232, 2, 58,
-        231, 2, 59,
-        230, 2, 60,
-        229, 2, 61,
-        228, 2, 62,
-        227, 2, 63,
-        226, 2, 64,
-        225, 2, 65,
-        224, 2, 66,
-        222, 2, 67,
-        221, 2, 68,
-        220, 2, 69,
-        219, 2, 70,
-        218, 2, 71,
-        217, 2, 72,
-        216, 2, 73
+        21,
+        94, 3, 18,
+        154, 2, 60,
+        155, 2, 61,
+        156, 2, 62,
+        157, 2, 63,
+        158, 2, 64,
+        159, 2, 65,
+        160, 2, 66,
+        161, 2, 67,
+        162, 2, 68,
+        163, 2, 69,
+        165, 2, 70,
+        166, 2, 71,
+        167, 2, 72,
+        168, 2, 73,
+        169, 2, 74,
+        170, 2, 75,
+        171, 2, 76,
+        172, 2, 77,
+        173, 2, 78,
+        174, 2, 79
     },
     {
         5,
-        318, 2, 16,
-        291, 2, 74,
-        290, 3, 46,
-        253, 2, 24,
-        210, 3, 47
+        76, 2, 18,
+        103, 2, 80,
+        104, 3, 49,
+        137, 2, 24,
+        180, 3, 50
     },
     {
-        1,
-        235, 3, 9
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 224,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 220
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 225,
+        209, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 221
+        1,
+        152, 3, 9
     },
     {
         3,
-        304, 3, 11,
-        184, 3, 13,
-        183, 3, 14
+        90, 3, 11,
+        206, 3, 13,
+        207, 3, 14
     },
     {
         11,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        303, 3, 12,
-        298, 3, 135,
-        268, 3, 110,
-        263, 2, 79,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 136
+        76, 2, 18,
+        79, 2, 85,
+        80, 2, 86,
+        91, 3, 12,
+        96, 3, 138,
+        126, 3, 113,
+        131, 2, 87,
+        137, 2, 24,
+        177, 3, 115,
+        178, 3, 116,
+        180, 3, 139
     },
     {
         1,
-        235, 3, 10
+        152, 3, 10
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 171
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 172,
+        209, 3, 166
     },
     {
-        6,
-        318, 2, 16,
-        293, 3, 44,
-        292, 2, 82,
-        287, 2, 83,
-        253, 2, 24,
-        210, 3, 42
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 221,
+        209, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 217
+        6,
+        76, 2, 18,
+        101, 3, 47,
+        102, 2, 88,
+        107, 2, 89,
+        137, 2, 24,
+        180, 3, 45
     },
     {
         1,
-        251, 3, 133
+        73, 3, 136
     },
     {
         0
     },
     {
-        26,
-        259, 3, 160,
-        246, 3, 146,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        2,
+        70, 3, 161,
+        142, 3, 147
+    },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 174,
+        209, 3, 166
+    },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 175,
+        209, 3, 166
+    },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 176,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 173
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 177,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 174
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 178,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 175
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 179,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 176
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 180,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 177
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 181,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 178
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 182,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 179
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 183,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 180
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 185,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 181
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 186,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 184
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 187,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 182
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 188,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 185
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 189,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 186
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 190,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 187
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 191,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 188
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 192,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 189
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 193,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 190
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 194,
+        209, 3, 166
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 86,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 95,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 91,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 97,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 92,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 98,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 93,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 99,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 94,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 100,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 95,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        95, 2, 101,
+        100, 3, 44,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         7,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 25,
-        268, 3, 110,
-        263, 2, 79,
-        213, 3, 112,
-        212, 3, 113
+        79, 2, 85,
+        80, 2, 86,
+        96, 3, 25,
+        126, 3, 113,
+        131, 2, 87,
+        177, 3, 115,
+        178, 3, 116
     },
     {
         4,
-        316, 2, 17,
-        297, 3, 26,
-        249, 2, 25,
-        236, 3, 140
+        78, 2, 19,
+        97, 3, 26,
+        139, 2, 25,
+        151, 3, 141
     },
     {
         4,
-        316, 2, 17,
-        297, 3, 27,
-        249, 2, 25,
-        236, 3, 140
+        78, 2, 19,
+        97, 3, 27,
+        139, 2, 25,
+        151, 3, 141
     },
     {
         2,
-        313, 2, 85,
-        223, 3, 28
+        81, 2, 94,
+        164, 3, 28
+    },
+    {
+        4,
+        98, 3, 29,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
     },
     {
         4,
-        296, 3, 29,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        98, 3, 30,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
     },
     {
         4,
-        296, 3, 30,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        98, 3, 31,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
     },
     {
         4,
-        296, 3, 31,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        98, 3, 32,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
+    },
+    {
+        4,
+        98, 3, 33,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
+    },
+    {
+        4,
+        98, 3, 34,
+        99, 3, 39,
+        175, 3, 41,
+        176, 3, 42
     },
     {
         3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 32
+        78, 2, 19,
+        139, 2, 25,
+        151, 3, 35
     },
     {
         3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 33
+        78, 2, 19,
+        139, 2, 25,
+        151, 3, 36
     },
     {
         3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 34
+        78, 2, 19,
+        139, 2, 25,
+        151, 3, 37
     },
     {
         7,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 35,
-        268, 3, 110,
-        263, 2, 79,
-        213, 3, 112,
-        212, 3, 113
+        79, 2, 85,
+        80, 2, 86,
+        96, 3, 38,
+        126, 3, 113,
+        131, 2, 87,
+        177, 3, 115,
+        178, 3, 116
     },
     {
         6,
-        318, 2, 16,
-        313, 2, 85,
-        290, 3, 45,
-        253, 2, 24,
-        223, 2, 98,
-        210, 3, 47
+        76, 2, 18,
+        81, 2, 94,
+        104, 3, 48,
+        137, 2, 24,
+        164, 2, 104,
+        180, 3, 50
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 222
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 226,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 223
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 227,
+        209, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 193
+        1,
+        132, 2, 105
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 194
+        1,
+        134, 2, 107
     },
     {
-        5,
-        315, 2, 77,
-        314, 2, 78,
-        268, 3, 109,
-        213, 3, 112,
-        212, 3, 113
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 197,
+        209, 3, 166
     },
     {
-        1,
-        262, 2, 99
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 198,
+        209, 3, 166
     },
     {
-        1,
-        258, 2, 101
+        5,
+        79, 2, 85,
+        80, 2, 86,
+        126, 3, 112,
+        177, 3, 115,
+        178, 3, 116
     },
     {
         4,
-        318, 2, 16,
-        293, 3, 43,
-        253, 2, 24,
-        210, 3, 42
+        76, 2, 18,
+        101, 3, 46,
+        137, 2, 24,
+        180, 3, 45
     },
     {
         2,
-        313, 2, 85,
-        223, 2, 102
+        81, 2, 94,
+        164, 2, 108
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 195
+        2,
+        76, 3, 91,
+        137, 2, 24
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 183
+        1,
+        79, 3, 118
     },
     {
-        11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        1,
+        136, 2, 109
     },
     {
-        2,
-        318, 3, 88,
-        253, 2, 24
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 199,
+        209, 3, 166
     },
     {
-        1,
-        315, 3, 115
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 184,
+        209, 3, 166
     },
     {
-        1,
-        255, 2, 103
+        11,
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         1,
-        209, 2, 105
+        181, 2, 111
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 3, 43,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 191
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 195,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 192
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 196,
+        209, 3, 166
     },
     {
         12,
-        315, 3, 114,
-        314, 2, 78,
-        285, 2, 106,
-        269, 2, 107,
-        267, 2, 108,
-        266, 2, 109,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        79, 3, 117,
+        80, 2, 86,
+        109, 2, 113,
+        125, 2, 114,
+        127, 2, 115,
+        128, 2, 116,
+        129, 3, 103,
+        130, 2, 117,
+        178, 3, 109,
+        181, 2, 118,
+        196, 3, 108,
+        197, 3, 110
     },
     {
-        25,
-        261, 3, 117,
-        260, 3, 119,
-        178, 3, 231,
-        170, 3, 248,
-        162, 3, 264,
-        155, 3, 280,
-        148, 3, 294,
-        138, 3, 314,
-        130, 3, 330,
-        122, 3, 346,
-        114, 3, 362,
-        106, 3, 378,
-        98, 3, 394,
-        90, 3, 410,
-        86, 3, 423,
-        83, 3, 424,
-        81, 3, 430,
-        79, 3, 434,
-        78, 3, 438,
-        77, 3, 440,
-        75, 3, 446,
-        73, 3, 450,
-        71, 3, 454,
-        69, 3, 458,
-        67, 3, 462
+        2,
+        69, 3, 122,
+        133, 3, 120
     },
     {
         1,
-        258, 2, 114
+        134, 2, 120
     },
     {
-        25,
-        257, 3, 123,
-        256, 3, 125,
-        180, 3, 227,
-        176, 3, 236,
-        172, 3, 244,
-        168, 3, 252,
-        164, 3, 260,
-        160, 3, 270,
-        157, 3, 276,
-        153, 3, 284,
-        142, 3, 306,
-        134, 3, 322,
-        126, 3, 338,
-        118, 3, 354,
-        110, 3, 370,
-        102, 3, 386,
-        94, 3, 402,
-        87, 3, 418,
-        82, 3, 428,
-        76, 3, 444,
-        74, 3, 448,
-        72, 3, 452,
-        70, 3, 456,
-        68, 3, 460,
-        66, 3, 464
+        2,
+        71, 3, 128,
+        135, 3, 126
     },
     {
         5,
-        289, 2, 116,
-        204, 3, 49,
-        192, 3, 48,
-        191, 3, 50,
-        190, 3, 51
+        105, 2, 126,
+        186, 3, 52,
+        198, 3, 51,
+        199, 3, 53,
+        200, 3, 54
     },
     {
-        25,
-        254, 3, 129,
-        181, 3, 225,
-        175, 3, 238,
-        173, 3, 242,
-        167, 3, 254,
-        165, 3, 258,
-        159, 3, 272,
-        151, 3, 288,
-        145, 3, 300,
-        139, 3, 312,
-        137, 3, 316,
-        131, 3, 328,
-        129, 3, 332,
-        123, 3, 344,
-        121, 3, 348,
-        115, 3, 360,
-        113, 3, 364,
-        107, 3, 376,
-        105, 3, 380,
-        99, 3, 392,
-        97, 3, 396,
-        91, 3, 408,
-        89, 3, 412,
-        86, 3, 421,
-        84, 3, 422
+        1,
+        72, 3, 132
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 197
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 201,
+        209, 3, 166
     },
     {
         1,
-        270, 2, 121
+        124, 2, 127
+    },
+    {
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 217,
+        209, 3, 166
     },
     {
         4,
-        316, 2, 17,
-        297, 2, 122,
-        249, 2, 25,
-        236, 3, 140
+        78, 2, 19,
+        97, 2, 128,
+        139, 2, 25,
+        151, 3, 141
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 212
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 216,
+        209, 3, 166
     },
     {
         1,
-        207, 2, 124
+        183, 2, 130
     },
     {
         9,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        265, 3, 99,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        79, 3, 117,
+        80, 2, 86,
+        125, 2, 114,
+        129, 3, 102,
+        130, 2, 117,
+        178, 3, 109,
+        181, 2, 118,
+        196, 3, 108,
+        197, 3, 110
     },
     {
         3,
-        197, 3, 101,
-        196, 3, 102,
-        195, 3, 103
-    },
-    {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 213
+        193, 3, 104,
+        194, 3, 105,
+        195, 3, 106
     },
     {
         12,
-        315, 3, 114,
-        314, 2, 78,
-        285, 2, 128,
-        269, 2, 107,
-        267, 2, 108,
-        266, 2, 109,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        79, 3, 117,
+        80, 2, 86,
+        109, 2, 134,
+        125, 2, 114,
+        127, 2, 115,
+        128, 2, 116,
+        129, 3, 103,
+        130, 2, 117,
+        178, 3, 109,
+        181, 2, 118,
+        196, 3, 108,
+        197, 3, 110
     },
     {
-        25,
-        259, 3, 120,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        1,
+        70, 3, 123
     },
     {
-        25,
-        257, 3, 123,
-        256, 3, 125,
-        180, 3, 227,
-        176, 3, 236,
-        172, 3, 244,
-        168, 3, 252,
-        164, 3, 260,
-        160, 3, 270,
-        157, 3, 276,
-        153, 3, 284,
-        142, 3, 306,
-        134, 3, 322,
-        126, 3, 338,
-        118, 3, 354,
-        110, 3, 370,
-        102, 3, 386,
-        94, 3, 402,
-        87, 3, 418,
-        82, 3, 428,
-        76, 3, 444,
-        74, 3, 448,
-        72, 3, 452,
-        70, 3, 456,
-        68, 3, 460,
-        66, 3, 464
+        2,
+        71, 3, 128,
+        135, 3, 126
     },
     {
-        25,
-        259, 3, 126,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        1,
+        70, 3, 129
     },
     {
-        3,
-        286, 2, 130,
-        280, 3, 65,
-        279, 2, 131
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 218,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 214
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 219,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 202
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 220,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 215
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 206,
+        209, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 216
+        3,
+        108, 2, 136,
+        114, 3, 68,
+        115, 2, 137
     },
     {
         3,
-        286, 2, 132,
-        280, 3, 65,
-        279, 2, 131
+        108, 2, 138,
+        114, 3, 68,
+        115, 2, 137
     },
     {
         2,
-        284, 2, 133,
-        205, 2, 135
+        110, 2, 140,
+        185, 2, 141
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 199
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 203,
+        209, 3, 166
     },
     {
         10,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        266, 2, 136,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        79, 3, 117,
+        80, 2, 86,
+        125, 2, 114,
+        128, 2, 142,
+        129, 3, 103,
+        130, 2, 117,
+        178, 3, 109,
+        181, 2, 118,
+        196, 3, 108,
+        197, 3, 110
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 209
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 213,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 210
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 214,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 211
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 215,
+        209, 3, 166
     },
     {
         1,
-        208, 3, 108
+        182, 3, 111
     },
     {
         0
     },
     {
         1,
-        207, 2, 138
+        183, 2, 144
     },
     {
         16,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 2, 139,
-        278, 2, 140,
-        273, 2, 141,
-        272, 2, 142,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83,
-        202, 3, 80,
-        201, 3, 81
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 2, 147,
+        116, 2, 148,
+        121, 2, 149,
+        122, 2, 150,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86,
+        188, 3, 83,
+        189, 3, 84
     },
     {
         2,
-        208, 3, 84,
-        207, 2, 138
+        182, 3, 87,
+        183, 2, 144
     },
     {
         4,
-        283, 3, 57,
-        282, 2, 145,
-        281, 3, 55,
-        234, 2, 146
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 205,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 201
+        111, 3, 60,
+        112, 2, 151,
+        113, 3, 58,
+        153, 2, 152
     },
     {
         10,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 67,
-        268, 3, 110,
-        263, 2, 79,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 66
+        76, 2, 18,
+        79, 2, 85,
+        80, 2, 86,
+        96, 3, 70,
+        126, 3, 113,
+        131, 2, 87,
+        137, 2, 24,
+        177, 3, 115,
+        178, 3, 116,
+        180, 3, 69
     },
     {
         9,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        265, 3, 99,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        79, 3, 117,
+        80, 2, 86,
+        125, 2, 114,
+        129, 3, 102,
+        130, 2, 117,
+        178, 3, 109,
+        181, 2, 118,
+        196, 3, 108,
+        197, 3, 110
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 198
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 202,
+        209, 3, 166
     },
     {
         2,
-        280, 3, 64,
-        279, 2, 131
+        114, 3, 67,
+        115, 2, 137
     },
     {
-        2,
-        317, 2, 147,
-        203, 3, 79
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 208,
+        209, 3, 166
     },
     {
-        5,
-        316, 2, 17,
-        297, 3, 139,
-        277, 2, 148,
-        249, 2, 25,
-        236, 3, 140
+        4,
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 209,
+        209, 3, 166
     },
     {
-        14,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 2, 139,
-        272, 2, 149,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83,
-        202, 3, 80,
-        201, 3, 81
+        2,
+        77, 2, 153,
+        187, 3, 82
     },
     {
-        2,
-        271, 3, 78,
-        204, 2, 150
+        5,
+        78, 2, 19,
+        97, 3, 140,
+        117, 2, 154,
+        139, 2, 25,
+        151, 3, 141
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 204
+        14,
+        75, 2, 93,
+        76, 2, 18,
+        79, 3, 117,
+        80, 3, 90,
+        81, 2, 94,
+        100, 2, 147,
+        122, 2, 155,
+        125, 3, 89,
+        137, 2, 24,
+        164, 2, 96,
+        179, 3, 85,
+        180, 3, 86,
+        188, 3, 83,
+        189, 3, 84
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 205
+        2,
+        123, 3, 81,
+        186, 2, 156
     },
     {
         2,
-        283, 3, 56,
-        234, 2, 146
+        111, 3, 59,
+        153, 2, 152
     },
     {
         2,
-        199, 3, 60,
-        198, 3, 61
+        191, 3, 63,
+        192, 3, 64
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 203
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 207,
+        209, 3, 166
     },
     {
         2,
-        284, 2, 153,
-        205, 2, 135
+        110, 2, 159,
+        185, 2, 141
     },
     {
         2,
-        271, 3, 77,
-        204, 2, 150
+        123, 3, 80,
+        186, 2, 156
     },
     {
         8,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        268, 3, 94,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 93
+        76, 2, 18,
+        79, 2, 85,
+        80, 2, 86,
+        126, 3, 97,
+        137, 2, 24,
+        177, 3, 115,
+        178, 3, 116,
+        180, 3, 96
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 207
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 211,
+        209, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 208
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 212,
+        209, 3, 166
     },
     {
         4,
-        276, 3, 71,
-        275, 2, 154,
-        274, 3, 69,
-        234, 2, 155
+        118, 3, 74,
+        119, 2, 160,
+        120, 3, 72,
+        153, 2, 161
     },
     {
         2,
-        276, 3, 70,
-        234, 2, 155
+        118, 3, 73,
+        153, 2, 161
     },
     {
         1,
-        206, 2, 157
+        184, 2, 163
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 200
+        148, 3, 168,
+        149, 2, 3,
+        150, 3, 204,
+        209, 3, 166
     },
     {
         5,
-        319, 2, 84,
-        315, 3, 114,
-        314, 3, 87,
-        269, 3, 86,
-        211, 3, 76
+        75, 2, 93,
+        79, 3, 117,
+        80, 3, 90,
+        125, 3, 89,
+        179, 3, 79
     }
 };
+#endif
 
 /* Default productions per state */
-UNICC_STATIC int _def_prod[ 158 ] =
+UNICC_INTERN short _def_prod[ 164 ] =
 {
+    170,
+    153,
+    156,
     169,
-    168,
-    152,
-    155,
     3,
-    151,
+    152,
     -1,
-    154,
+    155,
     -1,
+    170,
+    170,
     -1,
     2,
     8,
-    169,
-    169,
     -1,
     -1,
-    169,
-    169,
+    170,
+    170,
+    170,
+    170,
     7,
     -1,
     -1,
-    169,
-    63,
-    169,
-    134,
-    145,
+    66,
+    137,
+    146,
     -1,
     -1,
+    170,
+    170,
     -1,
-    169,
-    169,
     -1,
     -1,
     -1,
-    169,
-    54,
-    169,
-    131,
+    170,
+    170,
+    57,
+    134,
     -1,
-    144,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
+    145,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
     -1,
-    141,
-    141,
-    128,
-    37,
-    37,
-    37,
+    142,
+    142,
+    131,
+    40,
+    40,
+    40,
+    40,
+    40,
+    40,
     -1,
     -1,
     -1,
     -1,
-    128,
-    169,
-    169,
-    169,
-    169,
-    111,
-    118,
-    124,
-    53,
-    128,
-    169,
-    169,
-    128,
+    131,
+    170,
+    170,
+    121,
+    127,
+    170,
+    170,
+    114,
+    56,
+    131,
     -1,
     -1,
-    130,
+    133,
+    170,
+    170,
+    131,
     -1,
-    128,
-    128,
-    128,
-    128,
-    128,
-    169,
-    169,
+    131,
+    131,
+    131,
+    131,
+    131,
+    170,
+    170,
     -1,
     -1,
-    124,
+    127,
     -1,
     -1,
     -1,
-    169,
-    85,
-    141,
-    169,
-    96,
-    98,
-    104,
-    169,
+    170,
+    88,
+    170,
+    142,
+    170,
+    99,
+    101,
+    107,
     -1,
     -1,
     -1,
     -1,
-    163,
-    169,
-    169,
-    169,
-    169,
-    163,
-    68,
-    169,
+    170,
+    170,
+    170,
+    170,
+    164,
+    164,
+    71,
+    170,
     -1,
-    169,
-    169,
-    169,
+    170,
+    170,
+    170,
     -1,
     -1,
-    52,
-    128,
+    55,
+    131,
     -1,
-    59,
-    169,
+    170,
+    62,
     -1,
-    97,
-    169,
-    163,
-    92,
-    141,
-    128,
+    100,
+    170,
+    164,
+    170,
+    170,
     95,
-    169,
-    169,
-    58,
+    142,
+    131,
+    98,
+    61,
     -1,
-    169,
-    68,
-    95,
+    170,
+    71,
+    98,
     -1,
-    169,
-    169,
-    73,
-    72,
+    170,
+    170,
+    76,
+    75,
     -1,
-    169,
+    170,
     -1
 };
 
 #if !0
 /* DFA selection table */
-UNICC_STATIC int _dfa_select[ 158 ] =
+UNICC_INTERN signed char _dfa_select[ 164 ] =
 {
         0,
         1,
         2,
         3,
         4,
-        2,
+        1,
         5,
-        3,
+        2,
         6,
+        7,
+        7,
         -1,
         4,
-        7,
-        8,
         8,
         9,
         9,
         10,
         11,
-        7,
-        12,
         12,
         13,
+        8,
+        14,
         14,
         15,
         16,
         17,
         18,
         19,
-        12,
         20,
         21,
+        14,
         22,
         23,
-        12,
+        14,
+        0,
         24,
         25,
         26,
         27,
-        28,
         17,
-        29,
-        29,
-        29,
-        29,
-        29,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
         29,
         30,
-        31,
+        30,
         31,
         32,
-        33,
         32,
         32,
+        32,
+        32,
+        32,
+        33,
+        33,
+        33,
+        29,
+        34,
+        34,
+        34,
         34,
         34,
         34,
-        30,
-        35,
-        35,
-        35,
-        35,
-        35,
         35,
         36,
+        36,
+        31,
+        37,
+        37,
+        37,
+        37,
         37,
         37,
-        33,
         38,
         38,
         38,
+        35,
         39,
-        39,
-        39,
-        36,
         40,
-        41,
+        40,
         41,
         42,
         43,
         44,
         45,
-        46,
         25,
+        46,
+        19,
         47,
         48,
         49,
         50,
-        19,
         51,
         52,
+        51,
+        51,
+        51,
+        51,
+        51,
+        40,
+        40,
         53,
-        50,
-        50,
-        50,
-        50,
-        50,
-        41,
-        41,
+        2,
+        42,
+        2,
         54,
-        3,
-        46,
-        3,
+        2,
         55,
-        3,
         56,
         57,
         58,
+        57,
         59,
         60,
         61,
+        53,
+        62,
+        2,
         62,
-        59,
-        54,
         63,
-        3,
+        63,
+        63,
         63,
         64,
         65,
-        65,
-        65,
-        65,
         66,
         67,
+        53,
+        68,
+        68,
         68,
-        54,
-        69,
-        69,
         69,
         70,
         71,
         72,
         73,
-        74,
-        75,
         21,
+        74,
         23,
-        61,
+        60,
+        75,
         76,
         77,
+        77,
         78,
-        60,
-        73,
+        59,
+        72,
         79,
+        74,
         80,
-        80,
-        75,
+        77,
         81,
-        80,
-        82,
         79,
         23,
+        82,
+        82,
         83,
         83,
         84,
-        84,
         85,
-        86,
-        87
+        86
 };
 #endif
 
-#if 88
+#if 87
 /* DFA index table */
-UNICC_STATIC int _dfa_idx[ 88 ][ 244 ] =
+UNICC_INTERN unsigned short _dfa_idx[ 87 ][ 284 ] =
 {
     {
-        0 * 2,
-        13 * 2,
-        15 * 2,
-        16 * 2,
-        17 * 2,
-        18 * 2,
-        19 * 2,
-        20 * 2,
-        21 * 2,
-        22 * 2,
-        23 * 2,
-        24 * 2,
-        25 * 2,
-        26 * 2,
-        29 * 2,
-        31 * 2
-    },
-    {
-        33 * 2,
-        80 * 2,
-        82 * 2,
-        83 * 2,
-        85 * 2,
-        86 * 2,
-        87 * 2,
-        89 * 2,
-        91 * 2,
-        92 * 2,
-        93 * 2,
-        94 * 2,
-        95 * 2,
-        96 * 2,
-        97 * 2,
-        98 * 2,
-        99 * 2,
-        100 * 2,
-        101 * 2,
-        102 * 2,
-        103 * 2,
-        104 * 2,
-        105 * 2,
-        106 * 2,
-        107 * 2,
-        108 * 2,
-        109 * 2,
-        110 * 2,
-        111 * 2,
-        112 * 2,
-        113 * 2,
-        114 * 2,
-        115 * 2,
-        116 * 2,
-        117 * 2,
-        118 * 2,
-        119 * 2,
-        120 * 2,
-        121 * 2,
-        122 * 2,
-        124 * 2,
-        125 * 2,
-        126 * 2,
-        127 * 2,
-        128 * 2,
-        130 * 2,
-        131 * 2,
-        132 * 2,
-        133 * 2,
-        134 * 2,
-        135 * 2,
-        136 * 2,
-        137 * 2,
-        138 * 2,
-        139 * 2,
-        140 * 2,
-        141 * 2,
-        142 * 2,
-        143 * 2,
-        144 * 2,
-        147 * 2,
-        149 * 2,
-        151 * 2,
-        153 * 2,
-        155 * 2,
-        157 * 2,
-        160 * 2,
-        162 * 2,
-        164 * 2,
-        166 * 2,
-        169 * 2,
-        171 * 2,
-        173 * 2,
-        175 * 2,
-        178 * 2,
-        180 * 2,
-        182 * 2,
-        184 * 2,
-        187 * 2,
-        189 * 2,
-        191 * 2,
-        193 * 2,
-        196 * 2,
-        199 * 2,
-        200 * 2,
-        202 * 2,
-        204 * 2,
-        206 * 2,
-        208 * 2,
-        211 * 2,
-        214 * 2,
-        216 * 2,
-        218 * 2,
-        220 * 2,
-        223 * 2,
-        225 * 2,
-        227 * 2,
-        229 * 2,
-        231 * 2,
-        234 * 2,
-        236 * 2,
-        238 * 2,
-        240 * 2,
-        242 * 2,
-        244 * 2,
-        246 * 2,
-        248 * 2,
-        250 * 2,
-        252 * 2,
-        254 * 2,
-        256 * 2,
-        258 * 2,
-        260 * 2,
-        262 * 2,
-        264 * 2,
-        266 * 2,
-        268 * 2,
-        270 * 2,
-        272 * 2,
-        274 * 2,
-        278 * 2,
-        280 * 2,
-        282 * 2,
-        284 * 2,
-        286 * 2,
-        288 * 2,
-        290 * 2,
-        292 * 2,
-        294 * 2,
-        296 * 2,
-        298 * 2,
-        300 * 2,
-        302 * 2,
-        304 * 2,
-        306 * 2,
-        308 * 2,
-        310 * 2,
-        312 * 2,
-        314 * 2,
-        316 * 2,
-        318 * 2,
-        320 * 2,
-        322 * 2,
-        324 * 2,
-        326 * 2,
-        328 * 2,
-        330 * 2,
-        332 * 2,
-        334 * 2,
-        336 * 2,
-        338 * 2,
-        340 * 2,
-        342 * 2,
-        344 * 2,
-        346 * 2,
-        348 * 2,
-        350 * 2,
-        352 * 2,
-        354 * 2,
-        356 * 2,
-        358 * 2,
-        360 * 2,
-        362 * 2,
-        364 * 2,
-        366 * 2,
-        368 * 2,
-        370 * 2,
-        372 * 2,
-        374 * 2,
-        376 * 2,
-        378 * 2,
-        380 * 2,
-        382 * 2,
-        384 * 2,
-        386 * 2,
-        388 * 2,
-        390 * 2,
-        392 * 2,
-        394 * 2,
-        396 * 2,
-        398 * 2,
-        400 * 2,
-        402 * 2,
-        404 * 2,
-        406 * 2,
-        408 * 2,
-        410 * 2,
-        412 * 2,
-        414 * 2,
-        416 * 2,
-        418 * 2,
-        420 * 2,
-        422 * 2,
-        424 * 2,
-        426 * 2,
-        428 * 2,
-        430 * 2,
-        432 * 2,
-        434 * 2,
-        436 * 2,
-        438 * 2,
-        440 * 2,
-        442 * 2,
-        444 * 2,
-        446 * 2,
-        448 * 2,
-        450 * 2,
-        452 * 2,
-        454 * 2,
-        456 * 2,
-        458 * 2,
-        460 * 2,
-        462 * 2,
-        464 * 2,
-        466 * 2,
-        468 * 2,
-        470 * 2,
-        472 * 2,
-        474 * 2,
-        476 * 2,
-        478 * 2,
-        480 * 2,
-        482 * 2,
-        484 * 2,
-        486 * 2,
-        488 * 2,
-        490 * 2,
-        492 * 2,
-        494 * 2,
-        496 * 2,
-        498 * 2,
-        500 * 2,
-        502 * 2,
-        504 * 2,
-        506 * 2,
-        508 * 2,
-        510 * 2,
-        512 * 2,
-        514 * 2,
-        516 * 2,
-        518 * 2,
-        520 * 2,
-        522 * 2,
-        524 * 2
-    },
-    {
-        526 * 2,
-        566 * 2,
-        567 * 2,
-        568 * 2,
-        569 * 2,
-        570 * 2,
-        571 * 2,
-        572 * 2,
-        573 * 2,
-        574 * 2,
-        575 * 2,
-        576 * 2,
-        577 * 2,
-        578 * 2,
-        579 * 2,
-        580 * 2,
-        581 * 2,
-        583 * 2,
-        584 * 2,
-        585 * 2,
-        586 * 2,
-        587 * 2,
-        588 * 2,
-        589 * 2,
-        590 * 2,
-        591 * 2,
-        592 * 2,
-        593 * 2
-    },
-    {
-        594 * 2,
-        635 * 2,
-        636 * 2,
-        637 * 2,
-        638 * 2,
-        639 * 2,
-        640 * 2,
-        641 * 2,
-        642 * 2,
-        643 * 2,
-        644 * 2,
-        645 * 2,
-        646 * 2,
-        647 * 2,
-        648 * 2,
-        649 * 2,
-        650 * 2,
-        651 * 2,
-        652 * 2,
-        653 * 2,
-        654 * 2,
-        655 * 2,
-        656 * 2,
-        657 * 2,
-        658 * 2,
-        659 * 2,
-        660 * 2,
-        661 * 2
-    },
-    {
-        662 * 2,
-        670 * 2,
-        672 * 2,
-        673 * 2,
-        674 * 2,
-        675 * 2,
-        676 * 2,
-        677 * 2,
-        679 * 2
-    },
-    {
-        681 * 2,
-        683 * 2,
-        684 * 2
-    },
-    {
-        686 * 2,
-        688 * 2
-    },
-    {
-        689 * 2,
-        697 * 2,
-        698 * 2,
-        699 * 2,
-        700 * 2,
-        701 * 2
-    },
-    {
-        703 * 2,
-        711 * 2,
-        712 * 2,
-        713 * 2,
-        714 * 2,
-        715 * 2,
-        716 * 2,
-        717 * 2,
-        718 * 2,
-        719 * 2,
-        722 * 2,
-        724 * 2,
-        726 * 2,
-        728 * 2,
-        730 * 2,
-        732 * 2,
-        734 * 2,
-        736 * 2,
-        738 * 2,
-        740 * 2
-    },
-    {
-        742 * 2,
-        745 * 2,
-        746 * 2,
-        747 * 2,
-        749 * 2,
-        751 * 2,
-        753 * 2,
-        755 * 2,
-        757 * 2,
-        759 * 2,
-        761 * 2,
-        763 * 2,
-        765 * 2
-    },
-    {
-        767 * 2,
-        797 * 2,
-        798 * 2,
-        799 * 2,
-        800 * 2,
-        802 * 2,
-        804 * 2,
-        805 * 2,
-        806 * 2,
-        807 * 2,
-        808 * 2,
-        809 * 2,
-        810 * 2,
-        811 * 2,
-        812 * 2,
-        813 * 2,
-        814 * 2,
-        815 * 2,
-        816 * 2,
-        817 * 2,
-        818 * 2,
-        819 * 2,
-        820 * 2,
-        821 * 2,
-        822 * 2,
-        823 * 2,
-        824 * 2,
-        825 * 2,
-        826 * 2,
-        827 * 2,
-        828 * 2,
-        829 * 2,
-        832 * 2,
-        834 * 2,
-        836 * 2,
-        838 * 2,
-        841 * 2,
-        843 * 2,
-        845 * 2,
-        847 * 2
-    },
-    {
-        849 * 2,
-        866 * 2,
-        867 * 2,
-        868 * 2,
-        869 * 2,
-        870 * 2,
-        871 * 2,
-        872 * 2,
-        873 * 2,
-        874 * 2,
-        875 * 2,
-        876 * 2,
-        877 * 2,
-        878 * 2,
-        879 * 2,
-        880 * 2,
-        883 * 2
-    },
-    {
-        885 * 2,
-        887 * 2
-    },
-    {
-        888 * 2,
-        904 * 2,
-        905 * 2,
-        906 * 2,
-        907 * 2,
-        908 * 2,
-        909 * 2,
-        910 * 2,
-        911 * 2,
-        912 * 2,
-        913 * 2,
-        914 * 2,
-        916 * 2,
-        917 * 2,
-        918 * 2,
-        919 * 2,
-        920 * 2,
-        921 * 2,
-        922 * 2,
-        923 * 2,
-        924 * 2,
-        925 * 2,
-        926 * 2,
-        927 * 2,
-        928 * 2,
-        929 * 2,
-        930 * 2,
-        931 * 2,
-        934 * 2,
-        936 * 2,
-        938 * 2,
-        941 * 2,
-        943 * 2,
-        945 * 2,
-        947 * 2,
-        950 * 2,
-        952 * 2,
-        955 * 2,
-        957 * 2,
-        959 * 2,
-        961 * 2,
-        963 * 2,
-        965 * 2,
-        968 * 2,
-        970 * 2,
-        973 * 2,
-        975 * 2,
-        978 * 2,
-        980 * 2,
-        982 * 2,
-        985 * 2,
-        987 * 2,
-        989 * 2,
-        991 * 2,
-        993 * 2,
-        995 * 2,
-        997 * 2,
-        999 * 2,
-        1001 * 2,
-        1003 * 2,
-        1005 * 2,
-        1007 * 2,
-        1009 * 2,
-        1011 * 2,
-        1013 * 2,
-        1015 * 2,
-        1017 * 2,
-        1019 * 2,
-        1021 * 2,
-        1023 * 2,
-        1025 * 2,
-        1027 * 2,
-        1031 * 2,
-        1033 * 2,
-        1035 * 2,
-        1037 * 2,
-        1039 * 2,
-        1041 * 2,
-        1043 * 2,
-        1045 * 2,
-        1047 * 2,
-        1049 * 2,
-        1051 * 2,
-        1053 * 2,
-        1055 * 2,
-        1057 * 2,
-        1059 * 2,
-        1061 * 2,
-        1063 * 2,
-        1065 * 2,
-        1067 * 2,
-        1069 * 2,
-        1071 * 2,
-        1073 * 2,
-        1075 * 2,
-        1077 * 2,
-        1079 * 2,
-        1081 * 2,
-        1083 * 2,
-        1085 * 2,
-        1087 * 2,
-        1089 * 2,
-        1091 * 2,
-        1093 * 2,
-        1095 * 2,
-        1097 * 2,
-        1099 * 2,
-        1101 * 2,
-        1103 * 2,
-        1105 * 2,
-        1107 * 2,
-        1109 * 2,
-        1111 * 2,
-        1113 * 2,
-        1115 * 2,
-        1117 * 2,
-        1119 * 2,
-        1121 * 2,
-        1123 * 2,
-        1125 * 2,
-        1127 * 2,
-        1129 * 2,
-        1131 * 2,
-        1133 * 2,
-        1135 * 2,
-        1137 * 2,
-        1139 * 2,
-        1141 * 2,
-        1143 * 2,
-        1145 * 2,
-        1147 * 2,
-        1149 * 2,
-        1151 * 2,
-        1153 * 2,
-        1155 * 2,
-        1157 * 2,
-        1159 * 2,
-        1161 * 2,
-        1163 * 2,
-        1165 * 2,
-        1167 * 2,
-        1169 * 2,
-        1171 * 2,
-        1173 * 2,
-        1175 * 2,
-        1177 * 2,
-        1179 * 2,
-        1181 * 2,
-        1183 * 2,
-        1185 * 2,
-        1187 * 2,
-        1189 * 2,
-        1191 * 2,
-        1193 * 2,
-        1195 * 2,
-        1197 * 2,
-        1199 * 2,
-        1201 * 2,
-        1203 * 2,
-        1205 * 2,
-        1207 * 2,
-        1209 * 2,
-        1211 * 2,
-        1213 * 2,
-        1215 * 2,
-        1217 * 2,
-        1219 * 2,
-        1221 * 2,
-        1223 * 2,
-        1225 * 2,
-        1227 * 2,
-        1229 * 2,
-        1231 * 2,
-        1233 * 2,
-        1235 * 2,
-        1237 * 2,
-        1239 * 2,
-        1241 * 2,
-        1243 * 2,
-        1245 * 2,
-        1247 * 2,
-        1249 * 2,
-        1251 * 2
-    },
-    {
-        1253 * 2,
-        1267 * 2,
-        1268 * 2,
-        1269 * 2,
-        1271 * 2,
-        1272 * 2,
-        1273 * 2,
-        1274 * 2,
-        1275 * 2,
-        1276 * 2,
-        1277 * 2,
-        1278 * 2,
-        1279 * 2,
-        1280 * 2,
-        1281 * 2,
-        1284 * 2,
-        1286 * 2
-    },
-    {
-        1288 * 2,
-        1297 * 2,
-        1298 * 2,
-        1299 * 2,
-        1300 * 2,
-        1301 * 2,
-        1302 * 2,
-        1303 * 2,
-        1304 * 2
-    },
-    {
-        1307 * 2,
-        1338 * 2,
-        1339 * 2,
-        1340 * 2,
-        1341 * 2,
-        1343 * 2,
-        1345 * 2,
-        1346 * 2,
-        1347 * 2,
-        1348 * 2,
-        1349 * 2,
-        1350 * 2,
-        1351 * 2,
-        1352 * 2,
-        1353 * 2,
-        1354 * 2,
-        1355 * 2,
-        1356 * 2,
-        1357 * 2,
-        1358 * 2,
-        1359 * 2,
-        1360 * 2,
-        1361 * 2,
-        1362 * 2,
-        1363 * 2,
-        1364 * 2,
-        1365 * 2,
-        1366 * 2,
-        1367 * 2,
-        1368 * 2,
-        1369 * 2,
-        1370 * 2,
-        1371 * 2,
-        1374 * 2,
-        1376 * 2,
-        1378 * 2,
-        1380 * 2,
-        1383 * 2,
-        1385 * 2,
-        1387 * 2,
-        1389 * 2
-    },
-    {
-        1391 * 2,
-        1431 * 2,
-        1432 * 2,
-        1433 * 2,
-        1434 * 2,
-        1435 * 2,
-        1436 * 2,
-        1437 * 2,
-        1438 * 2,
-        1439 * 2,
-        1440 * 2,
-        1441 * 2,
-        1442 * 2,
-        1443 * 2,
-        1444 * 2,
-        1445 * 2,
-        1446 * 2,
-        1448 * 2,
-        1449 * 2,
-        1450 * 2,
-        1451 * 2,
-        1452 * 2,
-        1453 * 2,
-        1454 * 2,
-        1455 * 2,
-        1456 * 2,
-        1457 * 2,
-        1458 * 2
-    },
-    {
-        1459 * 2,
-        1469 * 2,
-        1470 * 2,
-        1471 * 2,
-        1472 * 2,
-        1473 * 2,
-        1475 * 2,
-        1476 * 2,
-        1477 * 2,
-        1478 * 2,
-        1479 * 2,
-        1480 * 2,
-        1481 * 2,
-        1482 * 2,
-        1483 * 2,
-        1484 * 2,
-        1485 * 2,
-        1486 * 2,
-        1487 * 2,
-        1489 * 2,
-        1492 * 2,
-        1495 * 2,
-        1497 * 2,
-        1499 * 2,
-        1501 * 2,
-        1504 * 2,
-        1506 * 2,
-        1508 * 2,
-        1510 * 2,
-        1513 * 2,
-        1515 * 2,
-        1517 * 2,
-        1520 * 2,
-        1522 * 2,
-        1524 * 2,
-        1526 * 2,
-        1528 * 2,
-        1530 * 2,
-        1532 * 2,
-        1534 * 2,
-        1536 * 2,
-        1538 * 2,
-        1540 * 2,
-        1542 * 2,
-        1544 * 2,
-        1546 * 2,
-        1548 * 2,
-        1550 * 2,
-        1552 * 2,
-        1554 * 2,
-        1556 * 2,
-        1558 * 2,
-        1560 * 2,
-        1562 * 2,
-        1564 * 2,
-        1566 * 2,
-        1568 * 2,
-        1570 * 2,
-        1574 * 2,
-        1576 * 2,
-        1578 * 2,
-        1580 * 2,
-        1582 * 2,
-        1584 * 2,
-        1586 * 2,
-        1588 * 2,
-        1590 * 2,
-        1592 * 2,
-        1594 * 2,
-        1596 * 2,
-        1598 * 2,
-        1600 * 2,
-        1602 * 2,
-        1604 * 2,
-        1606 * 2,
-        1608 * 2,
-        1610 * 2,
-        1612 * 2,
-        1614 * 2,
-        1616 * 2,
-        1618 * 2,
-        1620 * 2,
-        1622 * 2,
-        1624 * 2,
-        1626 * 2,
-        1628 * 2,
-        1630 * 2,
-        1632 * 2,
-        1634 * 2,
-        1636 * 2,
-        1638 * 2,
-        1640 * 2,
-        1642 * 2,
-        1644 * 2,
-        1646 * 2,
-        1648 * 2,
-        1650 * 2,
-        1652 * 2,
-        1654 * 2,
-        1656 * 2,
-        1658 * 2,
-        1660 * 2,
-        1662 * 2,
-        1664 * 2,
-        1666 * 2,
-        1668 * 2,
-        1670 * 2,
-        1672 * 2,
-        1674 * 2,
-        1676 * 2,
-        1678 * 2,
-        1680 * 2,
-        1682 * 2,
-        1684 * 2,
-        1686 * 2,
-        1688 * 2,
-        1690 * 2,
-        1692 * 2,
-        1694 * 2,
-        1696 * 2,
-        1698 * 2,
-        1700 * 2,
-        1702 * 2,
-        1704 * 2,
-        1706 * 2,
-        1708 * 2,
-        1710 * 2,
-        1712 * 2,
-        1714 * 2,
-        1716 * 2,
-        1718 * 2,
-        1720 * 2,
-        1722 * 2,
-        1724 * 2,
-        1726 * 2,
-        1728 * 2,
-        1730 * 2,
-        1732 * 2,
-        1734 * 2,
-        1736 * 2,
-        1738 * 2,
-        1740 * 2,
-        1742 * 2,
-        1744 * 2,
-        1746 * 2,
-        1748 * 2,
-        1750 * 2,
-        1752 * 2,
-        1754 * 2,
-        1756 * 2,
-        1758 * 2,
-        1760 * 2,
-        1762 * 2,
-        1764 * 2,
-        1766 * 2,
-        1768 * 2
-    },
-    {
-        1770 * 2,
-        1774 * 2
-    },
-    {
-        1775 * 2,
-        1782 * 2,
-        1783 * 2,
-        1784 * 2,
-        1785 * 2,
-        1786 * 2,
-        1787 * 2,
-        1788 * 2,
-        1790 * 2,
-        1791 * 2,
-        1794 * 2,
-        1796 * 2,
-        1798 * 2,
-        1800 * 2,
-        1802 * 2,
-        1804 * 2,
-        1806 * 2,
-        1808 * 2,
-        1810 * 2
-    },
-    {
-        1812 * 2,
-        1823 * 2,
-        1824 * 2,
-        1825 * 2,
-        1826 * 2,
-        1827 * 2,
-        1828 * 2,
-        1829 * 2,
-        1830 * 2,
-        1831 * 2,
-        1832 * 2
-    },
-    {
-        1835 * 2,
-        1837 * 2,
-        1839 * 2,
-        1840 * 2,
-        1842 * 2,
-        1844 * 2,
-        1846 * 2,
-        1848 * 2,
-        1850 * 2,
-        1852 * 2,
-        1854 * 2,
-        1856 * 2
-    },
-    {
-        1858 * 2,
-        1864 * 2,
-        1865 * 2,
-        1866 * 2
-    },
-    {
-        1867 * 2,
-        1880 * 2,
-        1881 * 2,
-        1882 * 2,
-        1884 * 2,
-        1885 * 2,
-        1886 * 2,
-        1887 * 2,
-        1888 * 2,
-        1889 * 2,
-        1890 * 2,
-        1891 * 2,
-        1892 * 2,
-        1893 * 2,
-        1896 * 2,
-        1898 * 2
-    },
-    {
-        1900 * 2,
-        1913 * 2,
-        1914 * 2,
-        1915 * 2,
-        1916 * 2,
-        1917 * 2,
-        1918 * 2,
-        1920 * 2,
-        1921 * 2,
-        1922 * 2,
-        1923 * 2,
-        1924 * 2,
-        1925 * 2,
-        1926 * 2,
-        1929 * 2,
-        1931 * 2
-    },
-    {
-        1933 * 2,
-        1946 * 2,
-        1947 * 2,
-        1948 * 2,
-        1950 * 2,
-        1951 * 2,
-        1952 * 2,
-        1953 * 2,
-        1954 * 2,
-        1955 * 2,
-        1956 * 2,
-        1957 * 2,
-        1958 * 2,
-        1959 * 2,
-        1962 * 2,
-        1964 * 2
-    },
-    {
-        1966 * 2,
-        1997 * 2,
-        1998 * 2,
-        1999 * 2,
-        2000 * 2,
-        2001 * 2,
-        2002 * 2,
-        2003 * 2,
-        2004 * 2,
-        2006 * 2,
-        2008 * 2,
-        2009 * 2,
-        2010 * 2,
-        2011 * 2,
-        2012 * 2,
-        2013 * 2,
-        2014 * 2,
-        2015 * 2,
-        2016 * 2,
-        2017 * 2,
-        2018 * 2,
-        2019 * 2,
-        2020 * 2,
-        2021 * 2,
-        2022 * 2,
-        2023 * 2,
-        2024 * 2,
-        2025 * 2,
-        2026 * 2,
-        2027 * 2,
-        2028 * 2,
-        2029 * 2,
-        2030 * 2,
-        2033 * 2,
-        2035 * 2,
-        2037 * 2,
-        2039 * 2,
-        2042 * 2,
-        2044 * 2,
-        2046 * 2,
-        2048 * 2
-    },
-    {
-        2050 * 2,
-        2052 * 2,
-        2053 * 2
-    },
-    {
-        2055 * 2,
-        2070 * 2,
-        2071 * 2,
-        2072 * 2,
-        2073 * 2,
-        2074 * 2,
-        2075 * 2,
-        2076 * 2,
-        2077 * 2,
-        2078 * 2,
-        2079 * 2,
-        2080 * 2,
-        2081 * 2,
-        2082 * 2,
-        2083 * 2
-    },
-    {
-        2086 * 2,
-        2094 * 2,
-        2095 * 2,
-        2096 * 2,
-        2097 * 2,
-        2098 * 2,
-        2099 * 2,
-        2100 * 2,
-        2101 * 2,
-        2102 * 2
-    },
-    {
-        2105 * 2,
-        2113 * 2,
-        2114 * 2,
-        2115 * 2,
-        2116 * 2,
-        2117 * 2,
-        2118 * 2,
-        2119 * 2,
-        2120 * 2,
-        2121 * 2,
-        2124 * 2
-    },
-    {
-        2126 * 2,
-        2134 * 2,
-        2135 * 2,
-        2136 * 2,
-        2137 * 2,
-        2138 * 2,
-        2139 * 2,
-        2140 * 2,
-        2141 * 2,
-        2142 * 2,
-        2143 * 2,
-        2146 * 2,
-        2149 * 2
-    },
-    {
-        2151 * 2,
-        2159 * 2,
-        2160 * 2,
-        2161 * 2,
-        2162 * 2,
-        2163 * 2,
-        2164 * 2,
-        2165 * 2,
-        2166 * 2,
-        2167 * 2
-    },
-    {
-        2170 * 2,
-        2177 * 2,
-        2178 * 2,
-        2179 * 2,
-        2180 * 2,
-        2181 * 2,
-        2182 * 2,
-        2183 * 2,
-        2184 * 2,
-        2187 * 2
-    },
-    {
-        2189 * 2,
-        2204 * 2,
-        2205 * 2,
-        2206 * 2,
-        2207 * 2,
-        2208 * 2,
-        2209 * 2,
-        2210 * 2,
-        2211 * 2,
-        2212 * 2,
-        2213 * 2,
-        2214 * 2,
-        2215 * 2,
-        2216 * 2,
-        2217 * 2
-    },
-    {
-        2220 * 2,
-        2223 * 2,
-        2224 * 2
-    },
-    {
-        2225 * 2,
-        2228 * 2,
-        2229 * 2,
-        2230 * 2
-    },
-    {
-        2232 * 2,
-        2235 * 2,
-        2236 * 2,
-        2237 * 2,
-        2238 * 2,
-        2241 * 2
-    },
-    {
-        2243 * 2,
-        2245 * 2,
-        2246 * 2
-    },
-    {
-        2248 * 2,
-        2263 * 2,
-        2264 * 2,
-        2265 * 2,
-        2266 * 2,
-        2267 * 2,
-        2268 * 2,
-        2269 * 2,
-        2270 * 2,
-        2271 * 2,
-        2272 * 2,
-        2273 * 2,
-        2274 * 2,
-        2275 * 2,
-        2276 * 2
-    },
-    {
-        2279 * 2,
-        2286 * 2,
-        2287 * 2,
-        2288 * 2,
-        2289 * 2,
-        2290 * 2,
-        2291 * 2,
-        2292 * 2,
-        2293 * 2
-    },
-    {
-        2296 * 2,
-        2319 * 2,
-        2320 * 2,
-        2321 * 2,
-        2322 * 2,
-        2323 * 2,
-        2324 * 2,
-        2325 * 2,
-        2326 * 2,
-        2327 * 2,
-        2328 * 2,
-        2329 * 2,
-        2330 * 2,
-        2331 * 2,
-        2332 * 2,
-        2333 * 2,
-        2334 * 2,
-        2335 * 2,
-        2336 * 2,
-        2337 * 2,
-        2338 * 2,
-        2339 * 2,
-        2340 * 2,
-        2343 * 2,
-        2345 * 2,
-        2347 * 2,
-        2350 * 2,
-        2352 * 2,
-        2354 * 2,
-        2356 * 2
-    },
-    {
-        2358 * 2,
-        2385 * 2,
-        2386 * 2,
-        2387 * 2,
-        2388 * 2,
-        2389 * 2,
-        2390 * 2,
-        2391 * 2,
-        2392 * 2,
-        2393 * 2,
-        2394 * 2,
-        2395 * 2,
-        2396 * 2,
-        2397 * 2,
-        2398 * 2,
-        2399 * 2,
-        2400 * 2,
-        2401 * 2,
-        2402 * 2,
-        2403 * 2,
-        2404 * 2,
-        2405 * 2,
-        2406 * 2,
-        2407 * 2,
-        2408 * 2,
-        2409 * 2,
-        2410 * 2,
-        2413 * 2,
-        2415 * 2,
-        2417 * 2,
-        2420 * 2,
-        2422 * 2,
-        2424 * 2,
-        2426 * 2
-    },
-    {
-        2428 * 2,
-        2436 * 2,
-        2437 * 2,
-        2438 * 2,
-        2439 * 2,
-        2440 * 2,
-        2441 * 2
-    },
-    {
-        2442 * 2,
-        2483 * 2,
-        2484 * 2,
-        2485 * 2,
-        2486 * 2,
-        2487 * 2,
-        2488 * 2,
-        2489 * 2,
-        2490 * 2,
-        2491 * 2,
-        2492 * 2,
-        2493 * 2,
-        2494 * 2,
-        2495 * 2,
-        2496 * 2,
-        2497 * 2,
-        2498 * 2,
-        2499 * 2,
-        2500 * 2,
-        2501 * 2,
-        2502 * 2,
-        2503 * 2,
-        2504 * 2,
-        2505 * 2,
-        2506 * 2,
-        2507 * 2,
-        2508 * 2,
-        2509 * 2
-    },
-    {
-        2510 * 2,
-        2551 * 2,
-        2552 * 2,
-        2553 * 2,
-        2554 * 2,
-        2555 * 2,
-        2556 * 2,
-        2557 * 2,
-        2558 * 2,
-        2559 * 2,
-        2560 * 2,
-        2561 * 2,
-        2562 * 2,
-        2563 * 2,
-        2564 * 2,
-        2565 * 2,
-        2566 * 2,
-        2567 * 2,
-        2568 * 2,
-        2569 * 2,
-        2570 * 2,
-        2571 * 2,
-        2572 * 2,
-        2573 * 2,
-        2574 * 2,
-        2575 * 2,
-        2576 * 2,
-        2577 * 2
-    },
-    {
-        2578 * 2,
-        2588 * 2,
-        2589 * 2,
-        2591 * 2,
-        2592 * 2,
-        2593 * 2,
-        2594 * 2,
-        2595 * 2,
-        2596 * 2,
-        2597 * 2,
-        2598 * 2,
-        2599 * 2,
-        2600 * 2,
-        2602 * 2,
-        2605 * 2
-    },
-    {
-        2607 * 2,
-        2634 * 2,
-        2635 * 2,
-        2636 * 2,
-        2637 * 2,
-        2638 * 2,
-        2639 * 2,
-        2640 * 2,
-        2641 * 2,
-        2642 * 2,
-        2643 * 2,
-        2644 * 2,
-        2645 * 2,
-        2646 * 2,
-        2647 * 2,
-        2648 * 2,
-        2649 * 2,
-        2650 * 2,
-        2651 * 2,
-        2652 * 2,
-        2653 * 2,
-        2654 * 2,
-        2655 * 2,
-        2656 * 2,
-        2657 * 2,
-        2658 * 2,
-        2659 * 2,
-        2662 * 2,
-        2664 * 2,
-        2666 * 2,
-        2669 * 2,
-        2671 * 2,
-        2673 * 2,
-        2675 * 2
-    },
-    {
-        2677 * 2,
-        2692 * 2,
-        2693 * 2,
-        2694 * 2,
-        2695 * 2,
-        2696 * 2,
-        2697 * 2,
-        2698 * 2,
-        2700 * 2,
-        2701 * 2,
-        2702 * 2,
-        2703 * 2,
-        2704 * 2,
-        2705 * 2,
-        2706 * 2,
-        2707 * 2,
-        2708 * 2,
-        2709 * 2,
-        2712 * 2,
-        2714 * 2
-    },
-    {
-        2716 * 2,
-        2732 * 2,
-        2733 * 2,
-        2734 * 2,
-        2735 * 2,
-        2736 * 2,
-        2737 * 2,
-        2738 * 2,
-        2739 * 2,
-        2740 * 2,
-        2741 * 2,
-        2742 * 2,
-        2743 * 2,
-        2744 * 2,
-        2745 * 2,
-        2746 * 2
-    },
-    {
-        2749 * 2,
-        2751 * 2
-    },
-    {
-        2752 * 2,
-        2793 * 2,
-        2794 * 2,
-        2795 * 2,
-        2796 * 2,
-        2797 * 2,
-        2798 * 2,
-        2799 * 2,
-        2800 * 2,
-        2801 * 2,
-        2802 * 2,
-        2803 * 2,
-        2804 * 2,
-        2805 * 2,
-        2806 * 2,
-        2807 * 2,
-        2808 * 2,
-        2809 * 2,
-        2810 * 2,
-        2811 * 2,
-        2812 * 2,
-        2813 * 2,
-        2814 * 2,
-        2815 * 2,
-        2816 * 2,
-        2817 * 2,
-        2818 * 2,
-        2819 * 2
-    },
-    {
-        2820 * 2,
-        2822 * 2
-    },
-    {
-        2823 * 2,
-        2829 * 2,
-        2830 * 2,
-        2831 * 2,
-        2832 * 2,
-        2833 * 2
-    },
-    {
-        2834 * 2,
-        2838 * 2,
-        2840 * 2,
-        2841 * 2,
-        2842 * 2,
-        2843 * 2,
-        2845 * 2
-    },
-    {
-        2847 * 2,
-        2870 * 2,
-        2871 * 2,
-        2872 * 2,
-        2873 * 2,
-        2874 * 2,
-        2875 * 2,
-        2876 * 2,
-        2877 * 2,
-        2878 * 2,
-        2879 * 2,
-        2880 * 2,
-        2881 * 2,
-        2882 * 2,
-        2883 * 2,
-        2884 * 2,
-        2885 * 2,
-        2886 * 2,
-        2887 * 2,
-        2888 * 2,
-        2889 * 2,
-        2890 * 2,
-        2891 * 2,
-        2894 * 2,
-        2896 * 2,
-        2898 * 2,
-        2901 * 2,
-        2903 * 2,
-        2905 * 2,
-        2907 * 2
-    },
-    {
-        2909 * 2,
-        2931 * 2,
-        2932 * 2,
-        2933 * 2,
-        2934 * 2,
-        2935 * 2,
-        2936 * 2,
-        2937 * 2,
-        2938 * 2,
-        2939 * 2,
-        2940 * 2,
-        2941 * 2,
-        2942 * 2,
-        2943 * 2,
-        2944 * 2,
-        2945 * 2,
-        2946 * 2,
-        2947 * 2,
-        2948 * 2,
-        2949 * 2,
-        2950 * 2,
-        2951 * 2,
-        2953 * 2,
-        2956 * 2,
-        2958 * 2,
-        2961 * 2,
-        2963 * 2,
-        2965 * 2,
-        2967 * 2
-    },
-    {
-        2969 * 2,
-        2975 * 2,
-        2976 * 2,
-        2977 * 2,
-        2978 * 2,
-        2979 * 2
-    },
-    {
-        2981 * 2,
-        3002 * 2,
-        3003 * 2,
-        3004 * 2,
-        3005 * 2,
-        3006 * 2,
-        3007 * 2,
-        3008 * 2,
-        3009 * 2,
-        3010 * 2,
-        3011 * 2,
-        3012 * 2,
-        3013 * 2,
-        3014 * 2,
-        3015 * 2,
-        3016 * 2,
-        3017 * 2,
-        3018 * 2,
-        3019 * 2,
-        3020 * 2,
-        3021 * 2,
-        3022 * 2,
-        3025 * 2
-    },
-    {
-        3027 * 2,
-        3035 * 2,
-        3036 * 2,
-        3037 * 2,
-        3038 * 2,
-        3039 * 2,
-        3040 * 2,
-        3041 * 2
-    },
-    {
-        3043 * 2,
-        3056 * 2,
-        3057 * 2,
-        3058 * 2,
-        3059 * 2,
-        3060 * 2,
-        3061 * 2,
-        3062 * 2,
-        3063 * 2,
-        3064 * 2,
-        3065 * 2,
-        3066 * 2,
-        3067 * 2
-    },
-    {
-        3069 * 2,
-        3085 * 2,
-        3086 * 2,
-        3087 * 2,
-        3088 * 2,
-        3089 * 2,
-        3090 * 2,
-        3091 * 2,
-        3092 * 2,
-        3093 * 2,
-        3094 * 2,
-        3095 * 2,
-        3096 * 2,
-        3097 * 2,
-        3098 * 2,
-        3099 * 2
-    },
-    {
-        3101 * 2,
-        3141 * 2,
-        3142 * 2,
-        3143 * 2,
-        3144 * 2,
-        3145 * 2,
-        3146 * 2,
-        3147 * 2,
-        3148 * 2,
-        3149 * 2,
-        3150 * 2,
-        3151 * 2,
-        3152 * 2,
-        3153 * 2,
-        3154 * 2,
-        3155 * 2,
-        3156 * 2,
-        3157 * 2,
-        3158 * 2,
-        3159 * 2,
-        3160 * 2,
-        3161 * 2,
-        3162 * 2,
-        3163 * 2,
-        3164 * 2,
-        3165 * 2,
-        3166 * 2
-    },
-    {
-        3167 * 2,
-        3189 * 2,
-        3190 * 2,
-        3191 * 2,
-        3192 * 2,
-        3193 * 2,
-        3194 * 2,
-        3195 * 2,
-        3196 * 2,
-        3197 * 2,
-        3198 * 2,
-        3199 * 2,
-        3200 * 2,
-        3201 * 2,
-        3202 * 2,
-        3203 * 2,
-        3204 * 2,
-        3205 * 2,
-        3206 * 2,
-        3207 * 2,
-        3208 * 2,
-        3209 * 2,
-        3212 * 2,
-        3214 * 2,
-        3216 * 2,
-        3219 * 2,
-        3221 * 2,
-        3223 * 2,
-        3225 * 2
-    },
-    {
-        3227 * 2,
-        3249 * 2,
-        3250 * 2,
-        3251 * 2,
-        3252 * 2,
-        3253 * 2,
-        3254 * 2,
-        3255 * 2,
-        3256 * 2,
-        3257 * 2,
-        3258 * 2,
-        3259 * 2,
-        3260 * 2,
-        3261 * 2,
-        3262 * 2,
-        3263 * 2,
-        3264 * 2,
-        3265 * 2,
-        3266 * 2,
-        3267 * 2,
-        3268 * 2,
-        3269 * 2,
-        3272 * 2,
-        3274 * 2,
-        3276 * 2,
-        3279 * 2,
-        3281 * 2,
-        3283 * 2,
-        3285 * 2
-    },
-    {
-        3287 * 2,
-        3309 * 2,
-        3310 * 2,
-        3311 * 2,
-        3312 * 2,
-        3313 * 2,
-        3314 * 2,
-        3315 * 2,
-        3316 * 2,
-        3317 * 2,
-        3318 * 2,
-        3319 * 2,
-        3320 * 2,
-        3321 * 2,
-        3322 * 2,
-        3323 * 2,
-        3324 * 2,
-        3325 * 2,
-        3326 * 2,
-        3327 * 2,
-        3328 * 2,
-        3329 * 2,
-        3332 * 2,
-        3334 * 2,
-        3336 * 2,
-        3339 * 2,
-        3341 * 2,
-        3343 * 2,
-        3345 * 2
-    },
-    {
-        3347 * 2,
-        3352 * 2,
-        3353 * 2,
-        3354 * 2
-    },
-    {
-        3355 * 2,
-        3379 * 2,
-        3380 * 2,
-        3381 * 2,
-        3382 * 2,
-        3383 * 2,
-        3384 * 2,
-        3385 * 2,
-        3386 * 2,
-        3387 * 2,
-        3388 * 2,
-        3389 * 2,
-        3390 * 2,
-        3391 * 2,
-        3392 * 2,
-        3393 * 2,
-        3394 * 2,
-        3395 * 2,
-        3396 * 2,
-        3397 * 2,
-        3398 * 2,
-        3399 * 2,
-        3400 * 2,
-        3401 * 2,
-        3404 * 2,
-        3406 * 2,
-        3408 * 2,
-        3411 * 2,
-        3413 * 2,
-        3415 * 2,
-        3417 * 2
-    },
-    {
-        3419 * 2,
-        3437 * 2,
-        3438 * 2,
-        3439 * 2,
-        3440 * 2,
-        3441 * 2,
-        3442 * 2,
-        3443 * 2,
-        3444 * 2,
-        3445 * 2,
-        3446 * 2,
-        3447 * 2,
-        3448 * 2,
-        3449 * 2,
-        3450 * 2,
-        3451 * 2,
-        3452 * 2,
-        3453 * 2,
-        3454 * 2,
-        3457 * 2
-    },
-    {
-        3459 * 2,
-        3461 * 2
-    },
-    {
-        3462 * 2,
-        3464 * 2
-    },
-    {
-        3465 * 2,
-        3468 * 2,
-        3469 * 2
-    },
-    {
-        3470 * 2,
-        3493 * 2,
-        3494 * 2,
-        3495 * 2,
-        3496 * 2,
-        3497 * 2,
-        3498 * 2,
-        3499 * 2,
-        3500 * 2,
-        3501 * 2,
-        3502 * 2,
-        3503 * 2,
-        3504 * 2,
-        3505 * 2,
-        3506 * 2,
-        3507 * 2,
-        3508 * 2,
-        3509 * 2,
-        3510 * 2,
-        3511 * 2,
-        3512 * 2,
-        3513 * 2,
-        3514 * 2,
-        3516 * 2,
-        3519 * 2,
-        3521 * 2,
-        3524 * 2,
-        3526 * 2,
-        3528 * 2,
-        3530 * 2
-    },
-    {
-        3532 * 2,
-        3535 * 2,
-        3536 * 2
-    },
-    {
-        3537 * 2,
-        3541 * 2,
-        3542 * 2
-    },
-    {
-        3543 * 2,
-        3571 * 2,
-        3572 * 2,
-        3573 * 2,
-        3574 * 2,
-        3575 * 2,
-        3576 * 2,
-        3577 * 2,
-        3578 * 2,
-        3579 * 2,
-        3580 * 2,
-        3581 * 2,
-        3582 * 2,
-        3583 * 2,
-        3584 * 2,
-        3585 * 2,
-        3586 * 2,
-        3587 * 2,
-        3588 * 2,
-        3589 * 2,
-        3590 * 2,
-        3591 * 2,
-        3592 * 2,
-        3593 * 2,
-        3594 * 2,
-        3595 * 2,
-        3596 * 2,
-        3597 * 2,
-        3600 * 2,
-        3602 * 2,
-        3604 * 2,
-        3607 * 2,
-        3609 * 2,
-        3611 * 2,
-        3613 * 2
-    },
-    {
-        3615 * 2,
-        3638 * 2,
-        3639 * 2,
-        3640 * 2,
-        3641 * 2,
-        3642 * 2,
-        3643 * 2,
-        3644 * 2,
-        3645 * 2,
-        3646 * 2,
-        3647 * 2,
-        3648 * 2,
-        3649 * 2,
-        3650 * 2,
-        3651 * 2,
-        3652 * 2,
-        3653 * 2,
-        3654 * 2,
-        3655 * 2,
-        3656 * 2,
-        3657 * 2,
-        3658 * 2,
-        3659 * 2,
-        3662 * 2,
-        3664 * 2,
-        3666 * 2,
-        3669 * 2,
-        3671 * 2,
-        3673 * 2,
-        3675 * 2
-    },
-    {
-        3677 * 2,
-        3704 * 2,
-        3705 * 2,
-        3706 * 2,
-        3707 * 2,
-        3708 * 2,
-        3709 * 2,
-        3710 * 2,
-        3711 * 2,
-        3712 * 2,
-        3713 * 2,
-        3714 * 2,
-        3715 * 2,
-        3716 * 2,
-        3717 * 2,
-        3718 * 2,
-        3719 * 2,
-        3720 * 2,
-        3721 * 2,
-        3722 * 2,
-        3723 * 2,
-        3724 * 2,
-        3725 * 2,
-        3726 * 2,
-        3727 * 2,
-        3728 * 2,
-        3729 * 2,
-        3732 * 2,
-        3734 * 2,
-        3736 * 2,
-        3739 * 2,
-        3741 * 2,
-        3743 * 2,
-        3745 * 2
-    },
-    {
-        3747 * 2,
-        3771 * 2,
-        3772 * 2,
-        3773 * 2,
-        3774 * 2,
-        3775 * 2,
-        3776 * 2,
-        3777 * 2,
-        3778 * 2,
-        3779 * 2,
-        3780 * 2,
-        3781 * 2,
-        3782 * 2,
-        3783 * 2,
-        3784 * 2,
-        3785 * 2,
-        3786 * 2,
-        3787 * 2,
-        3788 * 2,
-        3789 * 2,
-        3790 * 2,
-        3791 * 2,
-        3792 * 2,
-        3793 * 2,
-        3795 * 2,
-        3798 * 2,
-        3800 * 2,
-        3803 * 2,
-        3805 * 2,
-        3807 * 2,
-        3809 * 2
-    },
-    {
-        3811 * 2,
-        3835 * 2,
-        3836 * 2,
-        3837 * 2,
-        3838 * 2,
-        3839 * 2,
-        3840 * 2,
-        3841 * 2,
-        3842 * 2,
-        3843 * 2,
-        3844 * 2,
-        3845 * 2,
-        3846 * 2,
-        3847 * 2,
-        3848 * 2,
-        3849 * 2,
-        3850 * 2,
-        3851 * 2,
-        3852 * 2,
-        3853 * 2,
-        3854 * 2,
-        3855 * 2,
-        3856 * 2,
-        3857 * 2,
-        3860 * 2,
-        3862 * 2,
-        3864 * 2,
-        3867 * 2,
-        3869 * 2,
-        3871 * 2,
-        3873 * 2
-    },
-    {
-        3875 * 2,
-        3878 * 2,
-        3879 * 2,
-        3880 * 2,
-        3882 * 2,
-        3884 * 2,
-        3886 * 2,
-        3888 * 2,
-        3890 * 2,
-        3892 * 2,
-        3894 * 2,
-        3896 * 2,
-        3898 * 2,
-        3900 * 2,
-        3902 * 2,
-        3904 * 2,
-        3906 * 2
-    },
-    {
-        3908 * 2,
-        3915 * 2,
-        3916 * 2,
-        3917 * 2,
-        3918 * 2,
-        3919 * 2
-    },
-    {
-        3920 * 2,
-        3929 * 2,
-        3930 * 2,
-        3931 * 2,
-        3932 * 2,
-        3933 * 2,
-        3934 * 2,
-        3935 * 2,
-        3936 * 2,
-        3937 * 2
-    },
-    {
-        3940 * 2,
-        3946 * 2,
-        3947 * 2,
-        3948 * 2,
-        3949 * 2
-    },
-    {
-        3950 * 2,
-        3952 * 2,
-        3953 * 2,
-        3955 * 2,
-        3957 * 2,
-        3959 * 2,
-        3961 * 2,
-        3963 * 2,
-        3965 * 2,
-        3967 * 2,
-        3969 * 2
-    },
-    {
-        3971 * 2,
-        3981 * 2,
-        3982 * 2,
-        3983 * 2,
-        3984 * 2,
-        3985 * 2,
-        3986 * 2,
-        3987 * 2,
-        3988 * 2,
-        3989 * 2,
-        3990 * 2,
-        3991 * 2
-    },
-    {
-        3994 * 2,
-        3999 * 2,
-        4000 * 2,
-        4001 * 2,
-        4002 * 2
-    }
-};
-
-/* DFA transition chars */
-UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
-{
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        47, 47,
-        37, 37,
-        35, 35,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
+        0,
+        13,
+        14,
+        15,
+        17,
+        18,
+        19,
+        20,
+        21,
+        22,
+        23,
+        24,
+        25,
+        26,
+        28,
+        30
+    },
+    {
+        33,
+        73,
+        74,
+        75,
+        76,
+        77,
+        78,
+        79,
+        80,
+        81,
+        82,
+        83,
+        84,
+        85,
+        86,
+        87,
+        88,
+        90,
+        91,
+        92,
+        93,
+        94,
+        95,
+        96,
+        97,
+        98,
+        99,
+        100
+    },
+    {
+        101,
+        142,
+        143,
+        144,
+        145,
+        146,
+        147,
+        148,
+        149,
+        150,
+        151,
+        152,
+        153,
+        154,
+        155,
+        156,
+        157,
+        158,
+        159,
+        160,
+        161,
+        162,
+        163,
+        164,
+        165,
+        166,
+        167,
+        168
+    },
+    {
+        169,
+        216,
+        217,
+        219,
+        220,
+        222,
+        224,
+        225,
+        226,
+        227,
+        228,
+        229,
+        230,
+        231,
+        232,
+        233,
+        235,
+        236,
+        237,
+        238,
+        239,
+        240,
+        241,
+        242,
+        243,
+        244,
+        245,
+        246,
+        247,
+        248,
+        249,
+        250,
+        251,
+        252,
+        253,
+        254,
+        255,
+        256,
+        257,
+        258,
+        260,
+        261,
+        262,
+        263,
+        264,
+        266,
+        267,
+        268,
+        269,
+        270,
+        271,
+        272,
+        273,
+        274,
+        275,
+        276,
+        277,
+        278,
+        279,
+        280,
+        281,
+        282,
+        283,
+        285,
+        287,
+        289,
+        292,
+        294,
+        296,
+        298,
+        300,
+        303,
+        305,
+        307,
+        309,
+        312,
+        314,
+        317,
+        319,
+        323,
+        325,
+        328,
+        331,
+        333,
+        335,
+        338,
+        340,
+        341,
+        344,
+        346,
+        348,
+        350,
+        352,
+        355,
+        357,
+        360,
+        362,
+        365,
+        367,
+        369,
+        371,
+        373,
+        375,
+        377,
+        380,
+        382,
+        384,
+        386,
+        388,
+        390,
+        392,
+        394,
+        396,
+        398,
+        400,
+        402,
+        404,
+        406,
+        408,
+        410,
+        412,
+        414,
+        416,
+        418,
+        420,
+        422,
+        426,
+        428,
+        430,
+        432,
+        434,
+        436,
+        438,
+        440,
+        442,
+        444,
+        446,
+        448,
+        450,
+        452,
+        454,
+        456,
+        458,
+        460,
+        462,
+        464,
+        466,
+        468,
+        470,
+        472,
+        474,
+        476,
+        478,
+        480,
+        482,
+        484,
+        486,
+        488,
+        490,
+        492,
+        494,
+        496,
+        498,
+        500,
+        502,
+        504,
+        506,
+        508,
+        510,
+        512,
+        514,
+        516,
+        518,
+        520,
+        522,
+        524,
+        526,
+        528,
+        530,
+        532,
+        534,
+        536,
+        538,
+        540,
+        542,
+        544,
+        546,
+        548,
+        550,
+        552,
+        554,
+        556,
+        558,
+        560,
+        562,
+        564,
+        566,
+        568,
+        570,
+        572,
+        574,
+        576,
+        578,
+        580,
+        582,
+        584,
+        586,
+        588,
+        590,
+        592,
+        594,
+        596,
+        598,
+        600,
+        602,
+        604,
+        606,
+        608,
+        610,
+        612,
+        614,
+        616,
+        618,
+        620,
+        622,
+        624,
+        626,
+        628,
+        630,
+        632,
+        634,
+        636,
+        638,
+        640,
+        642,
+        644,
+        646,
+        648,
+        650,
+        652,
+        654,
+        656,
+        658,
+        660,
+        662,
+        664,
+        666,
+        668,
+        670,
+        672,
+        674,
+        676,
+        678,
+        680,
+        682,
+        684,
+        686,
+        688,
+        690,
+        692,
+        694,
+        696,
+        698,
+        700,
+        702,
+        704,
+        706,
+        708,
+        710,
+        712,
+        714,
+        716,
+        718,
+        720,
+        722,
+        724,
+        726,
+        728,
+        730,
+        732,
+        734,
+        736,
+        738,
+        740
+    },
+    {
+        742,
+        750,
+        752,
+        753,
+        754,
+        755,
+        756,
+        757,
+        759
+    },
+    {
+        761,
+        763,
+        764
+    },
+    {
+        766,
+        768
+    },
+    {
+        769,
+        777,
+        778,
+        779,
+        780,
+        781,
+        782,
+        783,
+        784,
+        785,
+        787,
+        789,
+        792,
+        794,
+        796,
+        798,
+        800,
+        802,
+        804,
+        806
+    },
+    {
+        808,
+        816,
+        817,
+        818,
+        819,
+        820
+    },
+    {
+        822,
+        825,
+        826,
+        827,
+        829,
+        831,
+        833,
+        835,
+        837,
+        839,
+        841,
+        843,
+        845
+    },
+    {
+        847,
+        864,
+        865,
+        866,
+        867,
+        868,
+        869,
+        870,
+        871,
+        872,
+        873,
+        874,
+        876,
+        877,
+        878,
+        879,
+        880,
+        881,
+        882,
+        883,
+        884,
+        885,
+        886,
+        887,
+        888,
+        889,
+        890,
+        891,
+        892,
+        893,
+        894,
+        896,
+        898,
+        900,
+        902,
+        905,
+        907,
+        910,
+        913,
+        915,
+        918,
+        921,
+        923,
+        925,
+        927,
+        930,
+        932,
+        934,
+        937,
+        939,
+        942,
+        944,
+        947,
+        949,
+        951,
+        953,
+        955,
+        958,
+        960,
+        962,
+        964,
+        966,
+        968,
+        970,
+        972,
+        974,
+        976,
+        978,
+        980,
+        982,
+        984,
+        986,
+        988,
+        990,
+        992,
+        994,
+        996,
+        998,
+        1000,
+        1002,
+        1006,
+        1008,
+        1010,
+        1012,
+        1014,
+        1016,
+        1018,
+        1020,
+        1022,
+        1024,
+        1026,
+        1028,
+        1030,
+        1032,
+        1034,
+        1036,
+        1038,
+        1040,
+        1042,
+        1044,
+        1046,
+        1048,
+        1050,
+        1052,
+        1054,
+        1056,
+        1058,
+        1060,
+        1062,
+        1064,
+        1066,
+        1068,
+        1070,
+        1072,
+        1074,
+        1076,
+        1078,
+        1080,
+        1082,
+        1084,
+        1086,
+        1088,
+        1090,
+        1092,
+        1094,
+        1096,
+        1098,
+        1100,
+        1102,
+        1104,
+        1106,
+        1108,
+        1110,
+        1112,
+        1114,
+        1116,
+        1118,
+        1120,
+        1122,
+        1124,
+        1126,
+        1128,
+        1130,
+        1132,
+        1134,
+        1136,
+        1138,
+        1140,
+        1142,
+        1144,
+        1146,
+        1148,
+        1150,
+        1152,
+        1154,
+        1156,
+        1158,
+        1160,
+        1162,
+        1164,
+        1166,
+        1168,
+        1170,
+        1172,
+        1174,
+        1176,
+        1178,
+        1180,
+        1182,
+        1184,
+        1186,
+        1188,
+        1190,
+        1192,
+        1194,
+        1196,
+        1198,
+        1200,
+        1202,
+        1204,
+        1206,
+        1208,
+        1210,
+        1212,
+        1214,
+        1216,
+        1218,
+        1220,
+        1222,
+        1224,
+        1226,
+        1228,
+        1230,
+        1232,
+        1234,
+        1236,
+        1238,
+        1240,
+        1242,
+        1244,
+        1246,
+        1248,
+        1250,
+        1252,
+        1254,
+        1256,
+        1258,
+        1260,
+        1262,
+        1264,
+        1266,
+        1268,
+        1270,
+        1272,
+        1274,
+        1276,
+        1278,
+        1280,
+        1282,
+        1284,
+        1286,
+        1288,
+        1290,
+        1292
+    },
+    {
+        1294,
+        1303,
+        1304,
+        1305,
+        1306,
+        1307,
+        1308,
+        1309,
+        1310
+    },
+    {
+        1313,
+        1343,
+        1344,
+        1345,
+        1347,
+        1349,
+        1350,
+        1351,
+        1352,
+        1353,
+        1354,
+        1355,
+        1356,
+        1357,
+        1358,
+        1359,
+        1360,
+        1361,
+        1362,
+        1363,
+        1364,
+        1365,
+        1366,
+        1367,
+        1368,
+        1369,
+        1370,
+        1371,
+        1372,
+        1373,
+        1374,
+        1375,
+        1377,
+        1380,
+        1382,
+        1384,
+        1387,
+        1389,
+        1391,
+        1393
+    },
+    {
+        1395,
+        1412,
+        1413,
+        1414,
+        1415,
+        1416,
+        1417,
+        1418,
+        1419,
+        1420,
+        1421,
+        1422,
+        1423,
+        1424,
+        1425,
+        1426,
+        1428
+    },
+    {
+        1431,
+        1433
+    },
+    {
+        1434,
+        1448,
+        1449,
+        1450,
+        1452,
+        1453,
+        1454,
+        1455,
+        1456,
+        1457,
+        1458,
+        1459,
+        1460,
+        1461,
+        1462,
+        1465,
+        1467
+    },
+    {
+        1469,
+        1500,
+        1501,
+        1502,
+        1503,
+        1505,
+        1507,
+        1508,
+        1509,
+        1510,
+        1511,
+        1512,
+        1513,
+        1514,
+        1515,
+        1516,
+        1517,
+        1518,
+        1519,
+        1520,
+        1521,
+        1522,
+        1523,
+        1524,
+        1525,
+        1526,
+        1527,
+        1528,
+        1529,
+        1530,
+        1531,
+        1532,
+        1533,
+        1536,
+        1538,
+        1540,
+        1542,
+        1545,
+        1547,
+        1549,
+        1551
+    },
+    {
+        1553,
+        1593,
+        1594,
+        1595,
+        1596,
+        1597,
+        1598,
+        1599,
+        1600,
+        1601,
+        1602,
+        1603,
+        1604,
+        1605,
+        1606,
+        1607,
+        1608,
+        1610,
+        1611,
+        1612,
+        1613,
+        1614,
+        1615,
+        1616,
+        1617,
+        1618,
+        1619,
+        1620
+    },
+    {
+        1621,
+        1632,
+        1633,
+        1634,
+        1635,
+        1636,
+        1638,
+        1639,
+        1640,
+        1641,
+        1642,
+        1643,
+        1644,
+        1645,
+        1646,
+        1647,
+        1648,
+        1649,
+        1650,
+        1651,
+        1652,
+        1653,
+        1655,
+        1658,
+        1661,
+        1664,
+        1666,
+        1668,
+        1670,
+        1673,
+        1675,
+        1677,
+        1680,
+        1683,
+        1685,
+        1687,
+        1690,
+        1692,
+        1694,
+        1696,
+        1698,
+        1700,
+        1702,
+        1704,
+        1706,
+        1708,
+        1710,
+        1712,
+        1714,
+        1716,
+        1718,
+        1720,
+        1722,
+        1724,
+        1726,
+        1728,
+        1730,
+        1732,
+        1734,
+        1736,
+        1738,
+        1740,
+        1742,
+        1744,
+        1746,
+        1748,
+        1750,
+        1754,
+        1756,
+        1758,
+        1760,
+        1762,
+        1764,
+        1766,
+        1768,
+        1770,
+        1772,
+        1774,
+        1776,
+        1778,
+        1780,
+        1782,
+        1784,
+        1786,
+        1788,
+        1790,
+        1792,
+        1794,
+        1796,
+        1798,
+        1800,
+        1802,
+        1804,
+        1806,
+        1808,
+        1810,
+        1812,
+        1814,
+        1816,
+        1818,
+        1820,
+        1822,
+        1824,
+        1826,
+        1828,
+        1830,
+        1832,
+        1834,
+        1836,
+        1838,
+        1840,
+        1842,
+        1844,
+        1846,
+        1848,
+        1850,
+        1852,
+        1854,
+        1856,
+        1858,
+        1860,
+        1862,
+        1864,
+        1866,
+        1868,
+        1870,
+        1872,
+        1874,
+        1876,
+        1878,
+        1880,
+        1882,
+        1884,
+        1886,
+        1888,
+        1890,
+        1892,
+        1894,
+        1896,
+        1898,
+        1900,
+        1902,
+        1904,
+        1906,
+        1908,
+        1910,
+        1912,
+        1914,
+        1916,
+        1918,
+        1920,
+        1922,
+        1924,
+        1926,
+        1928,
+        1930,
+        1932,
+        1934,
+        1936,
+        1938,
+        1940,
+        1942,
+        1944,
+        1946,
+        1948,
+        1950,
+        1952,
+        1954,
+        1956,
+        1958,
+        1960,
+        1962,
+        1964,
+        1966,
+        1968,
+        1970,
+        1972,
+        1974,
+        1976,
+        1978,
+        1980,
+        1982,
+        1984,
+        1986,
+        1988,
+        1990,
+        1992,
+        1994,
+        1996,
+        1998,
+        2000,
+        2002,
+        2004,
+        2006,
+        2008,
+        2010,
+        2012
+    },
+    {
+        2014,
+        2018
+    },
+    {
+        2019,
+        2026,
+        2027,
+        2028,
+        2029,
+        2030,
+        2031,
+        2032,
+        2034,
+        2035,
+        2037,
+        2040,
+        2042,
+        2044,
+        2046,
+        2048,
+        2050,
+        2052,
+        2054
+    },
+    {
+        2056,
+        2067,
+        2068,
+        2069,
+        2070,
+        2071,
+        2072,
+        2073,
+        2074,
+        2075,
+        2076
+    },
+    {
+        2079,
+        2081,
+        2083,
+        2084,
+        2086,
+        2088,
+        2090,
+        2092,
+        2094,
+        2096,
+        2098,
+        2100
+    },
+    {
+        2102,
+        2108,
+        2109,
+        2110
+    },
+    {
+        2111,
+        2124,
+        2125,
+        2126,
+        2128,
+        2129,
+        2130,
+        2131,
+        2132,
+        2133,
+        2134,
+        2135,
+        2136,
+        2137,
+        2139,
+        2142
+    },
+    {
+        2144,
+        2157,
+        2158,
+        2159,
+        2160,
+        2161,
+        2162,
+        2164,
+        2165,
+        2166,
+        2167,
+        2168,
+        2169,
+        2170,
+        2173,
+        2175
+    },
+    {
+        2177,
+        2208,
+        2209,
+        2210,
+        2211,
+        2212,
+        2213,
+        2214,
+        2215,
+        2217,
+        2219,
+        2220,
+        2221,
+        2222,
+        2223,
+        2224,
+        2225,
+        2226,
+        2227,
+        2228,
+        2229,
+        2230,
+        2231,
+        2232,
+        2233,
+        2234,
+        2235,
+        2236,
+        2237,
+        2238,
+        2239,
+        2240,
+        2241,
+        2244,
+        2246,
+        2248,
+        2250,
+        2253,
+        2255,
+        2257,
+        2259
+    },
+    {
+        2261,
+        2263,
+        2264
+    },
+    {
+        2266,
+        2281,
+        2282,
+        2283,
+        2284,
+        2285,
+        2286,
+        2287,
+        2288,
+        2289,
+        2290,
+        2291,
+        2292,
+        2293,
+        2294
+    },
+    {
+        2297,
+        2305,
+        2306,
+        2307,
+        2308,
+        2309,
+        2310,
+        2311,
+        2312,
+        2313
+    },
+    {
+        2316,
+        2324,
+        2325,
+        2326,
+        2327,
+        2328,
+        2329,
+        2330,
+        2331,
+        2332,
+        2334
+    },
+    {
+        2337,
+        2345,
+        2346,
+        2347,
+        2348,
+        2349,
+        2350,
+        2351,
+        2352,
+        2353
+    },
+    {
+        2356,
+        2364,
+        2365,
+        2366,
+        2367,
+        2368,
+        2369,
+        2370,
+        2371,
+        2372,
+        2373,
+        2376,
+        2379
+    },
+    {
+        2381,
+        2388,
+        2389,
+        2390,
+        2391,
+        2392,
+        2393,
+        2394,
+        2395,
+        2397
+    },
+    {
+        2400,
+        2415,
+        2416,
+        2417,
+        2418,
+        2419,
+        2420,
+        2421,
+        2422,
+        2423,
+        2424,
+        2425,
+        2426,
+        2427,
+        2428
+    },
+    {
+        2431,
+        2434,
+        2435
+    },
+    {
+        2436,
+        2439,
+        2440,
+        2441
+    },
+    {
+        2443,
+        2446,
+        2447,
+        2448,
+        2449,
+        2452
+    },
+    {
+        2454,
+        2456,
+        2457
+    },
+    {
+        2459,
+        2474,
+        2475,
+        2476,
+        2477,
+        2478,
+        2479,
+        2480,
+        2481,
+        2482,
+        2483,
+        2484,
+        2485,
+        2486,
+        2487
+    },
+    {
+        2490,
+        2497,
+        2498,
+        2499,
+        2500,
+        2501,
+        2502,
+        2503,
+        2504
+    },
+    {
+        2507,
+        2548,
+        2549,
+        2550,
+        2551,
+        2552,
+        2553,
+        2554,
+        2555,
+        2556,
+        2557,
+        2558,
+        2559,
+        2560,
+        2561,
+        2562,
+        2563,
+        2564,
+        2565,
+        2566,
+        2567,
+        2568,
+        2569,
+        2570,
+        2571,
+        2572,
+        2573,
+        2574
+    },
+    {
+        2575,
+        2616,
+        2617,
+        2618,
+        2619,
+        2620,
+        2621,
+        2622,
+        2623,
+        2624,
+        2625,
+        2626,
+        2627,
+        2628,
+        2629,
+        2630,
+        2631,
+        2632,
+        2633,
+        2634,
+        2635,
+        2636,
+        2637,
+        2638,
+        2639,
+        2640,
+        2641,
+        2642
+    },
+    {
+        2643,
+        2666,
+        2667,
+        2668,
+        2669,
+        2670,
+        2671,
+        2672,
+        2673,
+        2674,
+        2675,
+        2676,
+        2677,
+        2678,
+        2679,
+        2680,
+        2681,
+        2682,
+        2683,
+        2684,
+        2685,
+        2686,
+        2687,
+        2689,
+        2692,
+        2694,
+        2697,
+        2699,
+        2701,
+        2703
+    },
+    {
+        2705,
+        2732,
+        2733,
+        2734,
+        2735,
+        2736,
+        2737,
+        2738,
+        2739,
+        2740,
+        2741,
+        2742,
+        2743,
+        2744,
+        2745,
+        2746,
+        2747,
+        2748,
+        2749,
+        2750,
+        2751,
+        2752,
+        2753,
+        2754,
+        2755,
+        2756,
+        2757,
+        2759,
+        2762,
+        2764,
+        2767,
+        2769,
+        2771,
+        2773
+    },
+    {
+        2775,
+        2783,
+        2784,
+        2785,
+        2786,
+        2787,
+        2788
+    },
+    {
+        2789,
+        2799,
+        2800,
+        2802,
+        2803,
+        2804,
+        2805,
+        2806,
+        2807,
+        2808,
+        2809,
+        2810,
+        2811,
+        2813,
+        2816
+    },
+    {
+        2818,
+        2820
+    },
+    {
+        2821,
+        2862,
+        2863,
+        2864,
+        2865,
+        2866,
+        2867,
+        2868,
+        2869,
+        2870,
+        2871,
+        2872,
+        2873,
+        2874,
+        2875,
+        2876,
+        2877,
+        2878,
+        2879,
+        2880,
+        2881,
+        2882,
+        2883,
+        2884,
+        2885,
+        2886,
+        2887,
+        2888
+    },
+    {
+        2889,
+        2916,
+        2917,
+        2918,
+        2919,
+        2920,
+        2921,
+        2922,
+        2923,
+        2924,
+        2925,
+        2926,
+        2927,
+        2928,
+        2929,
+        2930,
+        2931,
+        2932,
+        2933,
+        2934,
+        2935,
+        2936,
+        2937,
+        2938,
+        2939,
+        2940,
+        2941,
+        2943,
+        2946,
+        2948,
+        2951,
+        2953,
+        2955,
+        2957
+    },
+    {
+        2959,
+        2974,
+        2975,
+        2977,
+        2978,
+        2979,
+        2980,
+        2981,
+        2982,
+        2983,
+        2984,
+        2985,
+        2986,
+        2987,
+        2988,
+        2989,
+        2990,
+        2991,
+        2993,
+        2996
+    },
+    {
+        2998,
+        3014,
+        3015,
+        3016,
+        3017,
+        3018,
+        3019,
+        3020,
+        3021,
+        3022,
+        3023,
+        3024,
+        3025,
+        3026,
+        3027,
+        3028
+    },
+    {
+        3031,
+        3033
+    },
+    {
+        3034,
+        3040,
+        3041,
+        3042,
+        3043,
+        3044
+    },
+    {
+        3045,
+        3049,
+        3051,
+        3052,
+        3053,
+        3054,
+        3056
+    },
+    {
+        3058,
+        3081,
+        3082,
+        3083,
+        3084,
+        3085,
+        3086,
+        3087,
+        3088,
+        3089,
+        3090,
+        3091,
+        3092,
+        3093,
+        3094,
+        3095,
+        3096,
+        3097,
+        3098,
+        3099,
+        3100,
+        3101,
+        3102,
+        3104,
+        3107,
+        3109,
+        3112,
+        3114,
+        3116,
+        3118
+    },
+    {
+        3120,
+        3142,
+        3143,
+        3144,
+        3145,
+        3146,
+        3147,
+        3148,
+        3149,
+        3150,
+        3151,
+        3152,
+        3153,
+        3154,
+        3155,
+        3156,
+        3157,
+        3158,
+        3159,
+        3160,
+        3161,
+        3162,
+        3164,
+        3167,
+        3169,
+        3172,
+        3174,
+        3176,
+        3178
+    },
+    {
+        3180,
+        3201,
+        3202,
+        3203,
+        3204,
+        3205,
+        3206,
+        3207,
+        3208,
+        3209,
+        3210,
+        3211,
+        3212,
+        3213,
+        3214,
+        3215,
+        3216,
+        3217,
+        3218,
+        3219,
+        3220,
+        3221,
+        3223
+    },
+    {
+        3226,
+        3232,
+        3233,
+        3234,
+        3235,
+        3236
+    },
+    {
+        3238,
+        3246,
+        3247,
+        3248,
+        3249,
+        3250,
+        3251,
+        3252
+    },
+    {
+        3254,
+        3267,
+        3268,
+        3269,
+        3270,
+        3271,
+        3272,
+        3273,
+        3274,
+        3275,
+        3276,
+        3277,
+        3278
+    },
+    {
+        3280,
+        3296,
+        3297,
+        3298,
+        3299,
+        3300,
+        3301,
+        3302,
+        3303,
+        3304,
+        3305,
+        3306,
+        3307,
+        3308,
+        3309,
+        3310
+    },
+    {
+        3312,
+        3352,
+        3353,
+        3354,
+        3355,
+        3356,
+        3357,
+        3358,
+        3359,
+        3360,
+        3361,
+        3362,
+        3363,
+        3364,
+        3365,
+        3366,
+        3367,
+        3368,
+        3369,
+        3370,
+        3371,
+        3372,
+        3373,
+        3374,
+        3375,
+        3376,
+        3377
+    },
+    {
+        3378,
+        3400,
+        3401,
+        3402,
+        3403,
+        3404,
+        3405,
+        3406,
+        3407,
+        3408,
+        3409,
+        3410,
+        3411,
+        3412,
+        3413,
+        3414,
+        3415,
+        3416,
+        3417,
+        3418,
+        3419,
+        3420,
+        3422,
+        3425,
+        3427,
+        3430,
+        3432,
+        3434,
+        3436
+    },
+    {
+        3438,
+        3460,
+        3461,
+        3462,
+        3463,
+        3464,
+        3465,
+        3466,
+        3467,
+        3468,
+        3469,
+        3470,
+        3471,
+        3472,
+        3473,
+        3474,
+        3475,
+        3476,
+        3477,
+        3478,
+        3479,
+        3480,
+        3482,
+        3485,
+        3487,
+        3490,
+        3492,
+        3494,
+        3496
+    },
+    {
+        3498,
+        3520,
+        3521,
+        3522,
+        3523,
+        3524,
+        3525,
+        3526,
+        3527,
+        3528,
+        3529,
+        3530,
+        3531,
+        3532,
+        3533,
+        3534,
+        3535,
+        3536,
+        3537,
+        3538,
+        3539,
+        3540,
+        3542,
+        3545,
+        3547,
+        3550,
+        3552,
+        3554,
+        3556
+    },
+    {
+        3558,
+        3563,
+        3564,
+        3565
+    },
+    {
+        3566,
+        3590,
+        3591,
+        3592,
+        3593,
+        3594,
+        3595,
+        3596,
+        3597,
+        3598,
+        3599,
+        3600,
+        3601,
+        3602,
+        3603,
+        3604,
+        3605,
+        3606,
+        3607,
+        3608,
+        3609,
+        3610,
+        3611,
+        3612,
+        3614,
+        3617,
+        3619,
+        3622,
+        3624,
+        3626,
+        3628
+    },
+    {
+        3630,
+        3648,
+        3649,
+        3650,
+        3651,
+        3652,
+        3653,
+        3654,
+        3655,
+        3656,
+        3657,
+        3658,
+        3659,
+        3660,
+        3661,
+        3662,
+        3663,
+        3664,
+        3665,
+        3667
+    },
+    {
+        3670,
+        3672
+    },
+    {
+        3673,
+        3675
+    },
+    {
+        3676,
+        3679,
+        3680
+    },
+    {
+        3681,
+        3704,
+        3705,
+        3706,
+        3707,
+        3708,
+        3709,
+        3710,
+        3711,
+        3712,
+        3713,
+        3714,
+        3715,
+        3716,
+        3717,
+        3718,
+        3719,
+        3720,
+        3721,
+        3722,
+        3723,
+        3724,
+        3725,
+        3727,
+        3730,
+        3732,
+        3735,
+        3737,
+        3739,
+        3741
+    },
+    {
+        3743,
+        3746,
+        3747
+    },
+    {
+        3748,
+        3752,
+        3753
+    },
+    {
+        3754,
+        3782,
+        3783,
+        3784,
+        3785,
+        3786,
+        3787,
+        3788,
+        3789,
+        3790,
+        3791,
+        3792,
+        3793,
+        3794,
+        3795,
+        3796,
+        3797,
+        3798,
+        3799,
+        3800,
+        3801,
+        3802,
+        3803,
+        3804,
+        3805,
+        3806,
+        3807,
+        3808,
+        3810,
+        3813,
+        3815,
+        3818,
+        3820,
+        3822,
+        3824
+    },
+    {
+        3826,
+        3849,
+        3850,
+        3851,
+        3852,
+        3853,
+        3854,
+        3855,
+        3856,
+        3857,
+        3858,
+        3859,
+        3860,
+        3861,
+        3862,
+        3863,
+        3864,
+        3865,
+        3866,
+        3867,
+        3868,
+        3869,
+        3870,
+        3872,
+        3875,
+        3877,
+        3880,
+        3882,
+        3884,
+        3886
+    },
+    {
+        3888,
+        3912,
+        3913,
+        3914,
+        3915,
+        3916,
+        3917,
+        3918,
+        3919,
+        3920,
+        3921,
+        3922,
+        3923,
+        3924,
+        3925,
+        3926,
+        3927,
+        3928,
+        3929,
+        3930,
+        3931,
+        3932,
+        3933,
+        3934,
+        3936,
+        3939,
+        3941,
+        3944,
+        3946,
+        3948,
+        3950
+    },
+    {
+        3952,
+        3979,
+        3980,
+        3981,
+        3982,
+        3983,
+        3984,
+        3985,
+        3986,
+        3987,
+        3988,
+        3989,
+        3990,
+        3991,
+        3992,
+        3993,
+        3994,
+        3995,
+        3996,
+        3997,
+        3998,
+        3999,
+        4000,
+        4001,
+        4002,
+        4003,
+        4004,
+        4007,
+        4009,
+        4011,
+        4014,
+        4016,
+        4018,
+        4020
+    },
+    {
+        4022,
+        4046,
+        4047,
+        4048,
+        4049,
+        4050,
+        4051,
+        4052,
+        4053,
+        4054,
+        4055,
+        4056,
+        4057,
+        4058,
+        4059,
+        4060,
+        4061,
+        4062,
+        4063,
+        4064,
+        4065,
+        4066,
+        4067,
+        4068,
+        4070,
+        4073,
+        4075,
+        4078,
+        4080,
+        4082,
+        4084
+    },
+    {
+        4086,
+        4089,
+        4090,
+        4091,
+        4093,
+        4095,
+        4097,
+        4099,
+        4101,
+        4103,
+        4105,
+        4107,
+        4109,
+        4111,
+        4113,
+        4115,
+        4117
+    },
+    {
+        4119,
+        4126,
+        4127,
+        4128,
+        4129,
+        4130
+    },
+    {
+        4131,
+        4140,
+        4141,
+        4142,
+        4143,
+        4144,
+        4145,
+        4146,
+        4147,
+        4148
+    },
+    {
+        4151,
+        4157,
+        4158,
+        4159,
+        4160
+    },
+    {
+        4161,
+        4163,
+        4164,
+        4166,
+        4168,
+        4170,
+        4172,
+        4174,
+        4176,
+        4178,
+        4180
+    },
+    {
+        4182,
+        4192,
+        4193,
+        4194,
+        4195,
+        4196,
+        4197,
+        4198,
+        4199,
+        4200,
+        4201,
+        4202
+    },
+    {
+        4205,
+        4210,
+        4211,
+        4212,
+        4213
+    }
+};
+
+/* DFA transition chars */
+UNICC_INTERN int _dfa_chars[ 4214 * 2 ] =
+{
+        91, 91,
+        64, 64,
+        47, 47,
+        37, 37,
+        35, 35,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        65, 90,
+        95, 95,
+        97, 122,
+        -1, -1,
+        -1, -1,
         -1, -1,
         33, 33,
         -1, -1,
@@ -5440,29 +5458,155 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
         -1, -1,
+        33, 33,
         -1, -1,
         47, 47,
         42, 42,
         -1, -1,
+        124, 124,
+        92, 92,
+        65, 90,
+        95, 95,
+        97, 122,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
+        91, 91,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
+        64, 64,
+        63, 63,
+        62, 62,
+        61, 61,
+        60, 60,
+        59, 59,
+        58, 58,
+        48, 57,
+        46, 46,
+        43, 43,
+        42, 42,
+        41, 41,
+        40, 40,
+        39, 39,
+        36, 36,
+        34, 34,
         33, 33,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
         -1, -1,
-        42, 42,
         -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        124, 124,
+        92, 92,
+        65, 90,
+        95, 95,
+        97, 122,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
         91, 91,
-        109, 109,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
+        64, 64,
+        63, 63,
+        62, 62,
+        61, 61,
+        60, 60,
+        59, 59,
+        58, 58,
+        48, 57,
+        46, 46,
+        43, 43,
+        42, 42,
+        41, 41,
+        40, 40,
+        39, 39,
+        36, 36,
+        34, 34,
+        33, 33,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        0, 0,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
         119, 119,
-        102, 102,
-        114, 114,
         110, 110,
-        100, 100,
-        108, 108,
-        99, 99,
-        101, 101,
+        114, 114,
         115, 115,
         111, 111,
         124, 124,
-        103, 103,
         112, 112,
         65, 90,
         95, 95,
@@ -5471,6 +5615,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         113, 113,
         116, 118,
         120, 122,
+        109, 109,
+        108, 108,
+        103, 103,
+        102, 102,
+        101, 101,
+        100, 100,
+        99, 99,
+        91, 91,
         64, 64,
         63, 63,
         61, 61,
@@ -5496,13 +5648,10 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         10, 10,
         9, 9,
         -1, -1,
-        33, 33,
-        -1, -1,
         -1, -1,
         111, 111,
         -1, -1,
         -1, -1,
-        -1, -1,
         61, 61,
         -1, -1,
         62, 62,
@@ -5516,6 +5665,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        33, 33,
+        -1, -1,
+        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -5560,119 +5712,137 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
-        42, 42,
         -1, -1,
-        33, 33,
+        -1, -1,
+        -1, -1,
+        42, 42,
         -1, -1,
         104, 104,
         -1, -1,
+        33, 33,
+        -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         105, 105,
         -1, -1,
         62, 62,
         -1, -1,
-        105, 105,
         101, 101,
         -1, -1,
         101, 101,
         -1, -1,
         101, 101,
+        97, 97,
         -1, -1,
         100, 100,
         -1, -1,
-        101, 101,
         97, 97,
         -1, -1,
         105, 105,
         -1, -1,
-        97, 97,
+        105, 105,
+        101, 101,
         -1, -1,
         120, 120,
         -1, -1,
         120, 120,
         112, 112,
         -1, -1,
-        103, 103,
+        110, 110,
         -1, -1,
+        107, 107,
+        104, 104,
         99, 99,
         -1, -1,
-        115, 115,
+        102, 102,
         -1, -1,
         110, 110,
         102, 102,
         -1, -1,
-        110, 110,
+        120, 120,
+        102, 102,
         -1, -1,
         114, 114,
         -1, -1,
-        102, 102,
+        115, 115,
         -1, -1,
         114, 114,
         99, 99,
         -1, -1,
-        120, 120,
-        102, 102,
+        103, 103,
         -1, -1,
         -1, -1,
-        110, 110,
+        115, 115,
+        103, 103,
         -1, -1,
         116, 116,
         -1, -1,
         97, 97,
         -1, -1,
-        102, 102,
+        97, 97,
         -1, -1,
-        114, 114,
-        111, 111,
+        102, 102,
         -1, -1,
         111, 111,
         101, 101,
         -1, -1,
         98, 98,
         -1, -1,
-        97, 97,
-        -1, -1,
-        104, 104,
+        114, 114,
+        111, 111,
         -1, -1,
         97, 97,
-        45, 45,
         -1, -1,
         97, 97,
+        45, 45,
         -1, -1,
         116, 116,
         -1, -1,
-        108, 108,
+        104, 104,
         -1, -1,
-        114, 114,
+        117, 117,
+        -1, -1,
+        108, 108,
+        -1, -1,
+        112, 112,
+        -1, -1,
+        114, 114,
         -1, -1,
         102, 102,
         99, 99,
         -1, -1,
-        116, 116,
+        114, 114,
         -1, -1,
         115, 115,
         -1, -1,
-        117, 117,
-        -1, -1,
         109, 109,
         -1, -1,
         117, 117,
         -1, -1,
         32, 32,
         -1, -1,
-        111, 111,
+        116, 116,
+        -1, -1,
+        108, 108,
         -1, -1,
         111, 111,
         -1, -1,
+        32, 32,
+        -1, -1,
         100, 100,
         -1, -1,
+        111, 111,
+        -1, -1,
+        115, 115,
+        -1, -1,
         118, 118,
         -1, -1,
-        121, 121,
+        119, 119,
         -1, -1,
-        112, 112,
+        100, 100,
+        -1, -1,
+        121, 121,
         -1, -1,
         111, 111,
         -1, -1,
@@ -5680,14 +5850,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         115, 115,
         -1, -1,
-        117, 117,
-        -1, -1,
-        32, 32,
-        -1, -1,
         99, 99,
         -1, -1,
-        32, 32,
-        -1, -1,
         99, 99,
         -1, -1,
         118, 118,
@@ -5696,24 +5860,32 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         121, 121,
         -1, -1,
-        112, 112,
-        -1, -1,
         99, 99,
         -1, -1,
         115, 115,
         -1, -1,
         115, 115,
         -1, -1,
+        116, 116,
+        -1, -1,
         115, 115,
         -1, -1,
         109, 109,
         -1, -1,
+        115, 115,
+        -1, -1,
+        116, 116,
+        -1, -1,
+        115, 115,
+        -1, -1,
         121, 121,
         -1, -1,
         115, 115,
         -1, -1,
         115, 115,
         -1, -1,
+        115, 115,
+        -1, -1,
         111, 111,
         -1, -1,
         101, 101,
@@ -5722,67 +5894,73 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         120, 120,
         -1, -1,
-        103, 103,
-        -1, -1,
         110, 110,
         -1, -1,
         102, 102,
         -1, -1,
+        103, 103,
+        -1, -1,
         97, 97,
         -1, -1,
+        104, 104,
+        -1, -1,
+        117, 117,
+        -1, -1,
         108, 108,
         -1, -1,
+        112, 112,
+        -1, -1,
         114, 114,
         -1, -1,
         115, 115,
         -1, -1,
+        32, 32,
+        -1, -1,
         100, 100,
         -1, -1,
         111, 111,
         -1, -1,
         116, 116,
         -1, -1,
-        32, 32,
-        -1, -1,
-        112, 112,
-        -1, -1,
         101, 101,
         -1, -1,
         105, 105,
         -1, -1,
-        103, 103,
+        120, 120,
         -1, -1,
         110, 110,
         -1, -1,
+        103, 103,
+        -1, -1,
         97, 97,
         -1, -1,
+        117, 117,
+        -1, -1,
         108, 108,
         -1, -1,
+        112, 112,
+        -1, -1,
         114, 114,
         -1, -1,
-        115, 115,
+        32, 32,
         -1, -1,
         100, 100,
         -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
         101, 101,
         -1, -1,
         105, 105,
         -1, -1,
-        103, 103,
-        -1, -1,
         110, 110,
         -1, -1,
+        103, 103,
+        -1, -1,
         97, 97,
         -1, -1,
         108, 108,
         -1, -1,
-        114, 114,
+        112, 112,
         -1, -1,
-        116, 116,
+        114, 114,
         -1, -1,
         32, 32,
         -1, -1,
@@ -5790,6 +5968,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         105, 105,
         -1, -1,
+        110, 110,
+        -1, -1,
         103, 103,
         -1, -1,
         97, 97,
@@ -5798,6 +5978,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
+        32, 32,
+        -1, -1,
         101, 101,
         -1, -1,
         105, 105,
@@ -5806,8 +5988,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        108, 108,
+        -1, -1,
         114, 114,
         -1, -1,
+        32, 32,
+        -1, -1,
         101, 101,
         -1, -1,
         105, 105,
@@ -5816,6 +6002,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
+        32, 32,
+        -1, -1,
         101, 101,
         -1, -1,
         105, 105,
@@ -5824,6 +6012,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
+        105, 105,
+        -1, -1,
+        97, 97,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        105, 105,
+        -1, -1,
         100, 100,
         -1, -1,
         115, 115,
@@ -5832,17 +6028,19 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         115, 115,
         -1, -1,
-        112, 112,
-        -1, -1,
         115, 115,
         -1, -1,
+        116, 116,
+        -1, -1,
         101, 101,
         -1, -1,
         110, 110,
         -1, -1,
-        116, 116,
+        112, 112,
         -1, -1,
-        115, 115,
+        110, 110,
+        -1, -1,
+        97, 97,
         -1, -1,
         115, 115,
         -1, -1,
@@ -5876,7 +6074,11 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
-        110, 110,
+        101, 101,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        109, 109,
         -1, -1,
         118, 118,
         -1, -1,
@@ -5892,8 +6094,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         111, 111,
         -1, -1,
-        105, 105,
-        -1, -1,
         116, 116,
         -1, -1,
         101, 101,
@@ -5920,144 +6120,94 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
-        117, 117,
+        101, 101,
         -1, -1,
-        99, 99,
+        101, 101,
         -1, -1,
-        116, 116,
+        101, 101,
         -1, -1,
-        103, 103,
+        101, 101,
         -1, -1,
-        115, 115,
+        101, 101,
         -1, -1,
-        105, 105,
+        99, 99,
+        -1, -1,
+        116, 116,
+        -1, -1,
+        120, 120,
         -1, -1,
         117, 117,
         -1, -1,
-        116, 116,
+        103, 103,
         -1, -1,
-        111, 111,
+        97, 97,
         -1, -1,
-        99, 99,
+        115, 115,
         -1, -1,
-        108, 108,
+        105, 105,
         -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
+        101, 101,
         -1, -1,
+        99, 99,
         -1, -1,
+        116, 116,
         -1, -1,
+        117, 117,
         -1, -1,
+        111, 111,
         -1, -1,
+        99, 99,
         -1, -1,
+        112, 112,
         -1, -1,
+        108, 108,
         -1, -1,
+        108, 108,
         -1, -1,
+        115, 115,
         -1, -1,
+        32, 32,
         -1, -1,
+        101, 101,
         -1, -1,
+        116, 116,
         -1, -1,
+        105, 105,
         -1, -1,
+        65, 90,
+        95, 95,
+        97, 122,
+        91, 91,
+        64, 64,
+        37, 37,
+        35, 35,
         -1, -1,
+        33, 33,
         -1, -1,
-        47, 47,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
         -1, -1,
+        33, 33,
         -1, -1,
+        42, 42,
         -1, -1,
         -1, -1,
+        47, 47,
         -1, -1,
+        10, 10,
         -1, -1,
         -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
+        109, 109,
+        108, 108,
         47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
-        0, 0,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6067,48 +6217,33 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        111, 111,
         -1, -1,
+        97, 97,
         -1, -1,
+        47, 47,
+        42, 42,
         -1, -1,
+        100, 100,
         -1, -1,
+        110, 110,
         -1, -1,
+        101, 101,
         -1, -1,
+        103, 103,
         -1, -1,
+        117, 117,
         -1, -1,
+        101, 101,
         -1, -1,
+        97, 97,
         -1, -1,
+        103, 103,
         -1, -1,
         91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
         64, 64,
-        37, 37,
-        35, 35,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        -1, -1,
-        10, 10,
-        -1, -1,
-        -1, -1,
-        91, 91,
         35, 35,
         37, 37,
-        64, 64,
         65, 90,
         95, 95,
         97, 122,
@@ -6121,23 +6256,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         109, 109,
         108, 108,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
         111, 111,
         -1, -1,
         97, 97,
@@ -6158,67 +6279,26 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         103, 103,
         -1, -1,
-        109, 109,
-        108, 108,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        100, 100,
-        -1, -1,
+        119, 119,
+        115, 115,
+        114, 114,
+        112, 112,
         110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
+        108, 108,
         103, 103,
-        -1, -1,
-        117, 117,
-        -1, -1,
+        102, 102,
         101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        60, 60,
-        58, 58,
-        61, 61,
-        59, 59,
-        64, 64,
-        63, 63,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
+        100, 100,
+        99, 99,
         47, 47,
-        46, 46,
-        45, 45,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        36, 36,
-        34, 34,
-        33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
-        61, 61,
         -1, -1,
-        62, 62,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6226,6 +6306,7 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        32, 32,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6245,272 +6326,220 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
-        42, 42,
+        104, 104,
         -1, -1,
-        62, 62,
+        105, 105,
         -1, -1,
-        42, 42,
+        111, 111,
         -1, -1,
         101, 101,
         -1, -1,
-        114, 114,
-        111, 111,
+        107, 107,
+        104, 104,
         -1, -1,
-        114, 114,
+        97, 97,
         -1, -1,
-        102, 102,
+        105, 105,
+        101, 101,
         -1, -1,
-        111, 111,
+        120, 120,
+        112, 112,
         -1, -1,
         114, 114,
         -1, -1,
-        35, 35,
-        37, 37,
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        124, 124,
-        64, 64,
-        61, 61,
-        59, 59,
-        47, 47,
-        41, 41,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
+        114, 114,
+        99, 99,
         -1, -1,
+        47, 47,
+        42, 42,
         -1, -1,
+        120, 120,
         -1, -1,
+        110, 110,
         -1, -1,
+        102, 102,
         -1, -1,
+        120, 120,
+        102, 102,
         -1, -1,
+        115, 115,
         -1, -1,
+        103, 103,
         -1, -1,
+        115, 115,
+        103, 103,
         -1, -1,
+        116, 116,
         -1, -1,
+        111, 111,
+        101, 101,
         -1, -1,
+        98, 98,
         -1, -1,
+        97, 97,
+        45, 45,
         -1, -1,
+        116, 116,
         -1, -1,
+        112, 112,
         -1, -1,
-        47, 47,
-        42, 42,
+        117, 117,
         -1, -1,
-        42, 42,
+        108, 108,
         -1, -1,
-        59, 59,
+        102, 102,
+        99, 99,
         -1, -1,
+        115, 115,
         -1, -1,
-        119, 119,
-        114, 114,
-        112, 112,
-        110, 110,
-        108, 108,
         103, 103,
-        102, 102,
-        101, 101,
-        100, 100,
-        99, 99,
-        47, 47,
+        -1, -1,
+        109, 109,
+        -1, -1,
         32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
         -1, -1,
+        32, 32,
         -1, -1,
+        116, 116,
         -1, -1,
+        114, 114,
         -1, -1,
+        108, 108,
         -1, -1,
+        100, 100,
         -1, -1,
+        115, 115,
         -1, -1,
+        115, 115,
         -1, -1,
+        108, 108,
         -1, -1,
+        119, 119,
         -1, -1,
+        100, 100,
         -1, -1,
-        32, 32,
+        118, 118,
         -1, -1,
+        100, 100,
         -1, -1,
+        103, 103,
         -1, -1,
+        121, 121,
         -1, -1,
+        120, 120,
         -1, -1,
+        116, 116,
         -1, -1,
+        99, 99,
         -1, -1,
+        99, 99,
         -1, -1,
+        118, 118,
+        101, 101,
+        97, 97,
         -1, -1,
+        121, 121,
         -1, -1,
+        99, 99,
         -1, -1,
+        120, 120,
         -1, -1,
+        116, 116,
         -1, -1,
+        109, 109,
         -1, -1,
+        116, 116,
         -1, -1,
+        121, 121,
         -1, -1,
-        47, 47,
-        42, 42,
+        103, 103,
         -1, -1,
         104, 104,
         -1, -1,
         105, 105,
         -1, -1,
-        105, 105,
-        101, 101,
-        -1, -1,
         111, 111,
         -1, -1,
         101, 101,
         -1, -1,
         97, 97,
         -1, -1,
-        120, 120,
-        112, 112,
-        -1, -1,
-        114, 114,
+        110, 110,
         -1, -1,
-        114, 114,
-        99, 99,
+        112, 112,
         -1, -1,
-        120, 120,
+        117, 117,
         -1, -1,
-        103, 103,
+        108, 108,
         -1, -1,
         115, 115,
         -1, -1,
-        110, 110,
+        32, 32,
         -1, -1,
-        102, 102,
+        114, 114,
         -1, -1,
-        120, 120,
-        102, 102,
+        100, 100,
+        -1, -1,
+        108, 108,
         -1, -1,
         116, 116,
         -1, -1,
+        105, 105,
+        -1, -1,
         111, 111,
-        101, 101,
         -1, -1,
-        98, 98,
+        101, 101,
         -1, -1,
         97, 97,
-        45, 45,
         -1, -1,
-        116, 116,
+        110, 110,
         -1, -1,
-        108, 108,
-        -1, -1,
-        102, 102,
-        99, 99,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        103, 103,
+        112, 112,
         -1, -1,
         117, 117,
         -1, -1,
-        109, 109,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        118, 118,
-        -1, -1,
         115, 115,
         -1, -1,
-        108, 108,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        116, 116,
-        -1, -1,
         32, 32,
         -1, -1,
-        99, 99,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        118, 118,
-        101, 101,
-        97, 97,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
+        114, 114,
         -1, -1,
-        103, 103,
+        100, 100,
         -1, -1,
-        104, 104,
+        108, 108,
         -1, -1,
         105, 105,
         -1, -1,
-        111, 111,
-        -1, -1,
         101, 101,
         -1, -1,
         97, 97,
         -1, -1,
         110, 110,
         -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
+        112, 112,
         -1, -1,
         115, 115,
         -1, -1,
-        117, 117,
+        32, 32,
         -1, -1,
-        100, 100,
+        114, 114,
         -1, -1,
         108, 108,
         -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
         105, 105,
         -1, -1,
-        111, 111,
-        -1, -1,
         101, 101,
         -1, -1,
         97, 97,
         -1, -1,
         110, 110,
         -1, -1,
-        114, 114,
-        -1, -1,
         115, 115,
         -1, -1,
-        100, 100,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        116, 116,
-        -1, -1,
         32, 32,
         -1, -1,
+        114, 114,
+        -1, -1,
         105, 105,
         -1, -1,
         101, 101,
@@ -6519,14 +6548,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         110, 110,
         -1, -1,
-        114, 114,
-        -1, -1,
         115, 115,
         -1, -1,
-        116, 116,
-        -1, -1,
         32, 32,
         -1, -1,
+        114, 114,
+        -1, -1,
         105, 105,
         -1, -1,
         101, 101,
@@ -6537,6 +6564,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         115, 115,
         -1, -1,
+        32, 32,
+        -1, -1,
         105, 105,
         -1, -1,
         101, 101,
@@ -6549,8 +6578,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         105, 105,
         -1, -1,
-        101, 101,
-        -1, -1,
         97, 97,
         -1, -1,
         110, 110,
@@ -6559,8 +6586,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         105, 105,
         -1, -1,
-        101, 101,
-        -1, -1,
         97, 97,
         -1, -1,
         110, 110,
@@ -6573,32 +6598,26 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         110, 110,
         -1, -1,
-        105, 105,
-        -1, -1,
-        110, 110,
+        115, 115,
         -1, -1,
         105, 105,
         -1, -1,
-        110, 110,
-        -1, -1,
         111, 111,
         -1, -1,
         115, 115,
         -1, -1,
         116, 116,
         -1, -1,
-        112, 112,
-        -1, -1,
         116, 116,
         -1, -1,
+        112, 112,
+        -1, -1,
         101, 101,
         -1, -1,
         115, 115,
         -1, -1,
         111, 111,
         -1, -1,
-        115, 115,
-        -1, -1,
         101, 101,
         -1, -1,
         111, 111,
@@ -6617,8 +6636,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
+        101, 101,
+        -1, -1,
         114, 114,
         -1, -1,
+        109, 109,
+        -1, -1,
         118, 118,
         -1, -1,
         105, 105,
@@ -6627,6 +6650,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
+        114, 114,
+        -1, -1,
         105, 105,
         -1, -1,
         116, 116,
@@ -6649,69 +6674,66 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
-        99, 99,
-        -1, -1,
-        117, 117,
+        101, 101,
         -1, -1,
-        116, 116,
+        101, 101,
         -1, -1,
-        115, 115,
+        101, 101,
         -1, -1,
-        117, 117,
+        101, 101,
         -1, -1,
-        116, 116,
+        101, 101,
         -1, -1,
-        103, 103,
+        101, 101,
         -1, -1,
         99, 99,
         -1, -1,
-        111, 111,
+        120, 120,
         -1, -1,
-        108, 108,
+        116, 116,
         -1, -1,
-        61, 61,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        58, 58,
-        47, 47,
-        45, 45,
-        36, 36,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
+        105, 105,
         -1, -1,
+        117, 117,
         -1, -1,
+        97, 97,
         -1, -1,
-        61, 61,
+        115, 115,
         -1, -1,
+        116, 116,
         -1, -1,
+        101, 101,
         -1, -1,
+        99, 99,
         -1, -1,
+        116, 116,
         -1, -1,
+        117, 117,
         -1, -1,
+        104, 104,
         -1, -1,
+        103, 103,
         -1, -1,
+        99, 99,
         -1, -1,
+        111, 111,
         -1, -1,
+        112, 112,
         -1, -1,
-        47, 47,
-        42, 42,
+        108, 108,
         -1, -1,
-        62, 62,
+        108, 108,
         -1, -1,
-        62, 62,
+        32, 32,
         -1, -1,
+        65, 90,
+        95, 95,
+        97, 122,
         47, 47,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6723,17 +6745,19 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         47, 47,
         42, 42,
         -1, -1,
-        60, 60,
-        58, 58,
         61, 61,
-        48, 57,
-        59, 59,
         64, 64,
         63, 63,
         91, 91,
         35, 35,
         37, 37,
         124, 124,
+        65, 90,
+        95, 95,
+        97, 122,
+        60, 60,
+        59, 59,
+        58, 58,
         47, 47,
         46, 46,
         45, 45,
@@ -6750,10 +6774,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6787,13 +6807,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
         62, 62,
         -1, -1,
-        42, 42,
-        -1, -1,
         101, 101,
         -1, -1,
         114, 114,
@@ -6807,45 +6827,22 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        124, 124,
-        92, 92,
         65, 90,
         95, 95,
         97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
+        124, 124,
         91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
         64, 64,
-        63, 63,
-        62, 62,
         61, 61,
-        60, 60,
         59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
+        47, 47,
         41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6861,35 +6858,173 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
         -1, -1,
-        93, 93,
-        -1, -1,
+        47, 47,
+        42, 42,
         -1, -1,
+        59, 59,
         -1, -1,
         -1, -1,
+        61, 61,
+        65, 90,
+        95, 95,
+        97, 122,
+        60, 60,
+        58, 58,
+        47, 47,
+        45, 45,
+        36, 36,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
         -1, -1,
         -1, -1,
         -1, -1,
+        61, 61,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
-        119, 119,
-        114, 114,
-        112, 112,
-        110, 110,
-        108, 108,
-        102, 102,
-        101, 101,
-        100, 100,
-        99, 99,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
-        32, 32,
+        -1, -1,
+        47, 47,
+        42, 42,
+        -1, -1,
+        62, 62,
+        -1, -1,
+        62, 62,
+        -1, -1,
+        60, 60,
+        58, 58,
+        61, 61,
+        48, 57,
+        59, 59,
+        64, 64,
+        63, 63,
+        91, 91,
+        35, 35,
+        37, 37,
+        124, 124,
+        47, 47,
+        46, 46,
+        45, 45,
+        43, 43,
+        42, 42,
+        41, 41,
+        40, 40,
+        39, 39,
+        38, 38,
+        36, 36,
+        34, 34,
+        33, 33,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        65, 90,
+        95, 95,
+        97, 122,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        61, 61,
+        -1, -1,
+        62, 62,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        42, 42,
+        -1, -1,
+        62, 62,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        114, 114,
+        111, 111,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        102, 102,
+        -1, -1,
+        111, 111,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        124, 124,
+        92, 92,
+        65, 90,
+        95, 95,
+        97, 122,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
+        91, 91,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
+        64, 64,
+        63, 63,
+        62, 62,
+        61, 61,
+        60, 60,
+        59, 59,
+        58, 58,
+        48, 57,
+        46, 46,
+        43, 43,
+        42, 42,
+        41, 41,
+        40, 40,
+        39, 39,
+        36, 36,
+        34, 34,
+        33, 33,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -6903,6 +7038,56 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        -1, -1,
+        -1, -1,
+        93, 93,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        119, 119,
+        115, 115,
+        114, 114,
+        112, 112,
+        110, 110,
+        108, 108,
+        102, 102,
+        101, 101,
+        100, 100,
+        99, 99,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        104, 104,
+        -1, -1,
+        107, 107,
         104, 104,
         -1, -1,
         105, 105,
@@ -6925,6 +7110,7 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         103, 103,
         -1, -1,
         115, 115,
+        103, 103,
         -1, -1,
         111, 111,
         101, 101,
@@ -6942,26 +7128,42 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         102, 102,
         -1, -1,
+        115, 115,
+        -1, -1,
+        112, 112,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        117, 117,
+        -1, -1,
         108, 108,
         -1, -1,
         102, 102,
         -1, -1,
         116, 116,
         -1, -1,
+        32, 32,
+        -1, -1,
         116, 116,
         -1, -1,
         114, 114,
         -1, -1,
+        108, 108,
+        -1, -1,
         115, 115,
         -1, -1,
         109, 109,
         -1, -1,
         110, 110,
         -1, -1,
-        117, 117,
-        -1, -1,
         32, 32,
         -1, -1,
+        115, 115,
+        -1, -1,
+        119, 119,
+        -1, -1,
+        100, 100,
+        -1, -1,
         118, 118,
         -1, -1,
         103, 103,
@@ -6974,31 +7176,27 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         108, 108,
         -1, -1,
-        112, 112,
-        -1, -1,
         116, 116,
         -1, -1,
-        32, 32,
-        -1, -1,
         99, 99,
         -1, -1,
-        32, 32,
-        -1, -1,
         99, 99,
         -1, -1,
         118, 118,
         101, 101,
         97, 97,
         -1, -1,
-        112, 112,
+        120, 120,
         -1, -1,
         99, 99,
         -1, -1,
+        116, 116,
+        -1, -1,
         109, 109,
         -1, -1,
-        121, 121,
+        116, 116,
         -1, -1,
-        112, 112,
+        121, 121,
         -1, -1,
         103, 103,
         -1, -1,
@@ -7012,20 +7210,22 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        112, 112,
+        -1, -1,
+        117, 117,
+        -1, -1,
+        32, 32,
+        -1, -1,
         114, 114,
         -1, -1,
         115, 115,
         -1, -1,
         110, 110,
         -1, -1,
-        117, 117,
-        -1, -1,
         108, 108,
         -1, -1,
         116, 116,
         -1, -1,
-        32, 32,
-        -1, -1,
         111, 111,
         -1, -1,
         101, 101,
@@ -7034,6 +7234,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        112, 112,
+        -1, -1,
+        117, 117,
+        -1, -1,
+        32, 32,
+        -1, -1,
         114, 114,
         -1, -1,
         115, 115,
@@ -7042,10 +7248,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         108, 108,
         -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
         111, 111,
         -1, -1,
         101, 101,
@@ -7054,15 +7256,17 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        112, 112,
+        -1, -1,
+        32, 32,
+        -1, -1,
         114, 114,
         -1, -1,
         115, 115,
         -1, -1,
         110, 110,
         -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
+        108, 108,
         -1, -1,
         101, 101,
         -1, -1,
@@ -7070,6 +7274,10 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        32, 32,
+        -1, -1,
+        114, 114,
+        -1, -1,
         115, 115,
         -1, -1,
         110, 110,
@@ -7080,6 +7288,10 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        32, 32,
+        -1, -1,
+        114, 114,
+        -1, -1,
         115, 115,
         -1, -1,
         110, 110,
@@ -7090,6 +7302,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
+        32, 32,
+        -1, -1,
         115, 115,
         -1, -1,
         110, 110,
@@ -7118,16 +7332,22 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         97, 97,
         -1, -1,
-        101, 101,
+        115, 115,
         -1, -1,
         101, 101,
         -1, -1,
-        101, 101,
+        105, 105,
         -1, -1,
-        101, 101,
+        97, 97,
+        -1, -1,
+        115, 115,
         -1, -1,
         101, 101,
         -1, -1,
+        97, 97,
+        -1, -1,
+        115, 115,
+        -1, -1,
         101, 101,
         -1, -1,
         101, 101,
@@ -7136,56 +7356,96 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
-        115, 115,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        101, 101,
         -1, -1,
         110, 110,
         -1, -1,
         116, 116,
         -1, -1,
+        115, 115,
+        -1, -1,
         108, 108,
         -1, -1,
+        109, 109,
+        -1, -1,
         118, 118,
         -1, -1,
-        112, 112,
+        99, 99,
         -1, -1,
-        117, 117,
+        120, 120,
         -1, -1,
         116, 116,
         -1, -1,
-        105, 105,
+        112, 112,
+        -1, -1,
+        117, 117,
         -1, -1,
         111, 111,
         -1, -1,
+        101, 101,
+        -1, -1,
         105, 105,
         -1, -1,
-        115, 115,
+        105, 105,
+        -1, -1,
+        97, 97,
+        -1, -1,
+        101, 101,
         -1, -1,
         116, 116,
         -1, -1,
+        115, 115,
+        -1, -1,
         117, 117,
         -1, -1,
         111, 111,
         -1, -1,
-        115, 115,
-        -1, -1,
         116, 116,
         -1, -1,
         111, 111,
         -1, -1,
+        116, 116,
+        -1, -1,
         103, 103,
         -1, -1,
+        116, 116,
+        -1, -1,
         111, 111,
         -1, -1,
-        116, 116,
+        105, 105,
+        -1, -1,
+        112, 112,
+        -1, -1,
+        108, 108,
         -1, -1,
         105, 105,
         -1, -1,
         116, 116,
         -1, -1,
+        104, 104,
+        -1, -1,
         108, 108,
         -1, -1,
         99, 99,
         -1, -1,
+        32, 32,
+        -1, -1,
         65, 90,
         95, 95,
         97, 122,
@@ -7207,11 +7467,11 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         108, 108,
         -1, -1,
         -1, -1,
+        99, 99,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
-        99, 99,
-        -1, -1,
         97, 97,
         -1, -1,
         110, 110,
@@ -7228,6 +7488,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         101, 101,
         -1, -1,
+        65, 90,
+        95, 95,
+        97, 122,
         47, 47,
         39, 39,
         34, 34,
@@ -7235,9 +7498,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7283,14 +7543,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        91, 91,
+        61, 61,
         65, 90,
         95, 95,
         97, 122,
-        64, 64,
+        60, 60,
+        58, 58,
         47, 47,
-        37, 37,
-        35, 35,
+        45, 45,
         32, 32,
         13, 13,
         10, 10,
@@ -7298,7 +7558,7 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        33, 33,
+        61, 61,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7309,12 +7569,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        62, 62,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
-        33, 33,
-        -1, -1,
-        42, 42,
+        62, 62,
         -1, -1,
         65, 90,
         95, 95,
@@ -7349,39 +7609,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         62, 62,
         -1, -1,
-        60, 60,
-        58, 58,
-        61, 61,
-        47, 47,
-        45, 45,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
         61, 61,
         64, 64,
         63, 63,
@@ -7471,9 +7698,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         93, 93,
         -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
         64, 64,
         60, 60,
         47, 47,
@@ -7485,6 +7709,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        65, 90,
+        95, 95,
+        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7537,12 +7764,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
-        111, 111,
+        60, 60,
         59, 59,
         47, 47,
         32, 32,
@@ -7558,16 +7785,10 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
-        110, 110,
-        102, 102,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        60, 60,
+        111, 111,
         59, 59,
         47, 47,
         32, 32,
@@ -7583,9 +7804,15 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        -1, -1,
+        110, 110,
+        102, 102,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
+        102, 102,
+        -1, -1,
         91, 91,
         47, 47,
         32, 32,
@@ -7600,9 +7827,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         65, 90,
@@ -7712,28 +7939,46 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         47, 47,
         42, 42,
         -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
+        40, 40,
+        41, 41,
+        42, 42,
+        43, 43,
+        46, 46,
+        48, 57,
+        58, 58,
+        59, 59,
+        60, 60,
         61, 61,
+        62, 62,
+        63, 63,
         64, 64,
         65, 90,
         95, 95,
         97, 122,
-        60, 60,
-        59, 59,
-        47, 47,
-        41, 41,
-        40, 40,
+        124, 124,
+        92, 92,
         39, 39,
-        38, 38,
+        36, 36,
         34, 34,
         33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
+        0, 0,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
+        91, 91,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7756,50 +8001,52 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
         -1, -1,
-        114, 114,
-        111, 111,
         -1, -1,
-        114, 114,
         -1, -1,
-        102, 102,
         -1, -1,
-        111, 111,
         -1, -1,
-        114, 114,
         -1, -1,
-        63, 63,
-        91, 91,
+        36, 36,
+        39, 39,
+        40, 40,
+        41, 41,
+        42, 42,
+        43, 43,
+        46, 46,
+        48, 57,
+        58, 58,
+        59, 59,
+        60, 60,
         61, 61,
-        35, 35,
-        37, 37,
-        124, 124,
+        62, 62,
+        63, 63,
         64, 64,
         65, 90,
         95, 95,
         97, 122,
-        60, 60,
-        59, 59,
-        47, 47,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
+        124, 124,
+        92, 92,
         34, 34,
         33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
+        0, 0,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
+        91, 91,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7826,78 +8073,30 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
         -1, -1,
-        111, 111,
         -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        59, 59,
-        41, 41,
-        39, 39,
-        34, 34,
-        35, 35,
-        37, 37,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        63, 63,
         124, 124,
-        64, 64,
-        35, 35,
-        37, 37,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
         91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
+        61, 61,
+        64, 64,
+        60, 60,
         65, 90,
         95, 95,
         97, 122,
-        92, 92,
-        62, 62,
-        61, 61,
-        60, 60,
         59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
+        47, 47,
         41, 41,
         40, 40,
         39, 39,
-        36, 36,
+        38, 38,
         34, 34,
         33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
-        0, 0,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7920,52 +8119,50 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
         -1, -1,
+        47, 47,
+        42, 42,
         -1, -1,
+        101, 101,
         -1, -1,
+        114, 114,
+        111, 111,
         -1, -1,
+        114, 114,
         -1, -1,
+        102, 102,
+        -1, -1,
+        111, 111,
+        -1, -1,
+        114, 114,
         -1, -1,
-        62, 62,
-        60, 60,
-        61, 61,
-        58, 58,
-        59, 59,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
         91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        63, 63,
-        124, 124,
-        64, 64,
         35, 35,
         37, 37,
-        92, 92,
-        48, 57,
+        124, 124,
+        64, 64,
+        65, 90,
+        95, 95,
+        97, 122,
+        63, 63,
+        61, 61,
+        60, 60,
+        59, 59,
+        47, 47,
         46, 46,
         43, 43,
         42, 42,
         41, 41,
         40, 40,
         39, 39,
-        36, 36,
+        38, 38,
         34, 34,
         33, 33,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
-        0, 0,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -7992,6 +8189,36 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
+        -1, -1,
+        47, 47,
+        42, 42,
+        -1, -1,
+        101, 101,
+        -1, -1,
+        114, 114,
+        111, 111,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        102, 102,
+        -1, -1,
+        111, 111,
+        -1, -1,
+        114, 114,
+        -1, -1,
+        124, 124,
+        59, 59,
+        41, 41,
+        39, 39,
+        34, 34,
+        35, 35,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
         -1, -1,
         -1, -1,
         61, 61,
@@ -8023,17 +8250,88 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         62, 62,
         -1, -1,
+        39, 39,
+        -1, -1,
+        -1, -1,
+        63, 63,
         64, 64,
         65, 90,
         95, 95,
         97, 122,
+        92, 92,
+        124, 124,
+        62, 62,
+        61, 61,
         60, 60,
-        63, 63,
+        59, 59,
+        58, 58,
+        48, 57,
+        46, 46,
+        43, 43,
+        42, 42,
+        41, 41,
+        40, 40,
+        39, 39,
+        36, 36,
+        34, 34,
+        33, 33,
+        32, 32,
+        13, 13,
+        10, 10,
+        9, 9,
+        0, 0,
+        1, 8,
+        11, 12,
+        14, 31,
+        38, 38,
+        44, 45,
+        47, 47,
+        91, 91,
+        93, 94,
+        96, 96,
+        123, 123,
+        125, 65535,
+        35, 35,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        65, 90,
+        95, 95,
+        97, 122,
         91, 91,
-        61, 61,
         35, 35,
         37, 37,
         124, 124,
+        64, 64,
+        63, 63,
+        61, 61,
+        60, 60,
         59, 59,
         58, 58,
         47, 47,
@@ -8075,9 +8373,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -8109,12 +8407,12 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         9, 9,
         -1, -1,
         -1, -1,
+        61, 61,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
-        61, 61,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8125,13 +8423,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        62, 62,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
         62, 62,
         -1, -1,
-        62, 62,
-        -1, -1,
         65, 90,
         95, 95,
         97, 122,
@@ -8165,112 +8463,41 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         47, 47,
         42, 42,
         -1, -1,
-        39, 39,
+        40, 40,
         -1, -1,
         -1, -1,
-        124, 124,
-        35, 35,
-        37, 37,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        65, 90,
-        95, 95,
-        97, 122,
-        92, 92,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
         46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
         40, 40,
         39, 39,
-        36, 36,
         34, 34,
         33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        0, 0,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
+        61, 61,
+        58, 58,
+        45, 45,
         -1, -1,
+        61, 61,
         -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
+        62, 62,
         -1, -1,
+        62, 62,
         -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        40, 40,
-        -1, -1,
-        -1, -1,
-        46, 46,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        58, 58,
-        45, 45,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        124, 124,
-        64, 64,
+        35, 35,
+        37, 37,
         65, 90,
         95, 95,
         97, 122,
+        124, 124,
         91, 91,
-        35, 35,
-        37, 37,
+        64, 64,
         61, 61,
         60, 60,
         47, 47,
@@ -8307,13 +8534,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
         101, 101,
         -1, -1,
-        42, 42,
-        -1, -1,
         114, 114,
         111, 111,
         -1, -1,
@@ -8328,8 +8555,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         65, 90,
         95, 95,
         97, 122,
-        35, 35,
-        37, 37,
         124, 124,
         91, 91,
         64, 64,
@@ -8346,6 +8571,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8387,20 +8614,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         35, 35,
         37, 37,
-        91, 91,
-        61, 61,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
         124, 124,
+        91, 91,
         63, 63,
         61, 61,
         59, 59,
@@ -8438,9 +8653,21 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
+        35, 35,
+        37, 37,
+        91, 91,
+        61, 61,
+        59, 59,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
         42, 42,
         -1, -1,
         35, 35,
@@ -8583,10 +8810,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        91, 91,
         35, 35,
         37, 37,
+        65, 90,
+        95, 95,
+        97, 122,
         124, 124,
+        91, 91,
         64, 64,
         61, 61,
         60, 60,
@@ -8601,9 +8831,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8625,9 +8852,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -8643,14 +8870,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
+        35, 35,
+        37, 37,
         124, 124,
-        64, 64,
         65, 90,
         95, 95,
         97, 122,
         91, 91,
-        35, 35,
-        37, 37,
+        64, 64,
         61, 61,
         60, 60,
         59, 59,
@@ -8685,13 +8912,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
+        -1, -1,
         47, 47,
         42, 42,
         -1, -1,
         101, 101,
         -1, -1,
-        42, 42,
-        -1, -1,
         114, 114,
         111, 111,
         -1, -1,
@@ -8703,10 +8930,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        91, 91,
         35, 35,
         37, 37,
         124, 124,
+        65, 90,
+        95, 95,
+        97, 122,
+        91, 91,
         64, 64,
         61, 61,
         60, 60,
@@ -8721,9 +8951,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8745,9 +8972,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -8771,13 +8998,11 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        91, 91,
         64, 64,
         65, 90,
         95, 95,
         97, 122,
-        91, 91,
-        35, 35,
-        37, 37,
         124, 124,
         61, 61,
         60, 60,
@@ -8794,6 +9019,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
+        -1, -1,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8816,14 +9044,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        42, 42,
         -1, -1,
         47, 47,
         42, 42,
         -1, -1,
         101, 101,
         -1, -1,
-        42, 42,
-        -1, -1,
         114, 114,
         111, 111,
         -1, -1,
@@ -8835,8 +9062,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        35, 35,
-        37, 37,
         124, 124,
         91, 91,
         61, 61,
@@ -8852,6 +9077,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8870,9 +9097,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         41, 41,
@@ -8886,13 +9113,10 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
+        91, 91,
         35, 35,
         37, 37,
         124, 124,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
         64, 64,
         61, 61,
         60, 60,
@@ -8908,6 +9132,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        65, 90,
+        95, 95,
+        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -8959,14 +9186,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        91, 91,
         35, 35,
         37, 37,
         124, 124,
-        64, 64,
         65, 90,
         95, 95,
         97, 122,
+        91, 91,
+        64, 64,
         63, 63,
         61, 61,
         60, 60,
@@ -9013,9 +9240,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -9031,10 +9258,13 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        91, 91,
         35, 35,
         37, 37,
         124, 124,
+        65, 90,
+        95, 95,
+        97, 122,
+        91, 91,
         64, 64,
         61, 61,
         60, 60,
@@ -9050,9 +9280,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -9075,9 +9302,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -9093,22 +9320,19 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        91, 91,
         35, 35,
         37, 37,
         124, 124,
-        64, 64,
         65, 90,
         95, 95,
         97, 122,
-        63, 63,
+        91, 91,
+        64, 64,
         61, 61,
         60, 60,
         59, 59,
         58, 58,
         47, 47,
-        43, 43,
-        42, 42,
         41, 41,
         40, 40,
         39, 39,
@@ -9142,12 +9366,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -9163,17 +9384,22 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
+        91, 91,
+        35, 35,
+        37, 37,
         124, 124,
+        64, 64,
         65, 90,
         95, 95,
         97, 122,
-        91, 91,
-        64, 64,
+        63, 63,
         61, 61,
         60, 60,
         59, 59,
         58, 58,
         47, 47,
+        43, 43,
+        42, 42,
         41, 41,
         40, 40,
         39, 39,
@@ -9184,8 +9410,6 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
-        35, 35,
-        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -9209,11 +9433,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        42, 42,
+        -1, -1,
+        -1, -1,
         -1, -1,
         47, 47,
         42, 42,
         -1, -1,
+        42, 42,
+        -1, -1,
         101, 101,
         -1, -1,
         114, 114,
@@ -9227,17 +9454,15 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         114, 114,
         -1, -1,
-        91, 91,
-        61, 61,
-        35, 35,
-        37, 37,
-        59, 59,
         124, 124,
-        64, 64,
         65, 90,
         95, 95,
         97, 122,
+        91, 91,
+        64, 64,
+        61, 61,
         60, 60,
+        59, 59,
         58, 58,
         47, 47,
         41, 41,
@@ -9250,6 +9475,8 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -9273,9 +9500,9 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        47, 47,
         42, 42,
         -1, -1,
+        47, 47,
         42, 42,
         -1, -1,
         101, 101,
@@ -9336,14 +9563,14 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
         -1, -1,
         -1, -1,
         -1, -1,
-        35, 35,
-        37, 37,
         59, 59,
         47, 47,
         32, 32,
         13, 13,
         10, 10,
         9, 9,
+        35, 35,
+        37, 37,
         -1, -1,
         -1, -1,
         -1, -1,
@@ -9422,24 +9649,24 @@ UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
 };
 
 /* DFA transitions */
-UNICC_STATIC int _dfa_trans[ 4003 ] =
+UNICC_INTERN short _dfa_trans[ 4214 ] =
 {
-        15,
-         3,
-         3,
+        13,
+         1,
+         15,
          3,
-         2,
-         13,
          14,
-         1,
          4,
          5,
          6,
          7,
+         2,
+         2,
+         2,
          -1,
-         10,
          -1,
          -1,
+         11,
          -1,
          -1,
          -1,
@@ -9451,69 +9678,58 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          8,
-         9,
-         -1,
-         11,
          -1,
          12,
          -1,
-         62,
+         9,
+         10,
+         -1,
          3,
-         61,
-         63,
-         65,
-         130,
-         67,
-         69,
-         71,
-         73,
-         75,
-         77,
-         17,
-         79,
-         81,
-         83,
-         83,
-         83,
-         83,
-         83,
-         83,
-         83,
-         2,
-         16,
-         7,
-         5,
-         13,
          6,
-         59,
-         8,
-         64,
-         15,
-         14,
-         18,
          9,
-         12,
-         66,
-         60,
-         4,
-         1,
-         11,
+         9,
+         9,
          10,
-         19,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         1,
+         1,
+         2,
+         5,
+         8,
+         4,
+         7,
+         11,
+         12,
+         13,
+         14,
+         15,
+         16,
+         17,
+         18,
+         19,
          20,
          21,
          22,
-         -1,
+         23,
+         24,
          25,
+         26,
+         -1,
          -1,
          -1,
-         68,
          -1,
          -1,
          -1,
-         29,
          -1,
-         30,
          -1,
          -1,
          -1,
@@ -9523,6 +9739,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         27,
+         -1,
          -1,
          -1,
          -1,
@@ -9534,6 +9752,46 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         3,
+         6,
+         9,
+         9,
+         9,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         10,
+         1,
+         1,
+         2,
+         5,
+         8,
+         4,
+         7,
+         11,
+         12,
+         13,
+         14,
+         15,
+         16,
+         17,
+         18,
+         19,
+         20,
+         21,
+         22,
+         23,
+         24,
+         25,
+         26,
+         27,
          -1,
          -1,
          -1,
@@ -9546,13 +9804,11 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         194,
          -1,
          -1,
          -1,
          -1,
          -1,
-         226,
          -1,
          -1,
          -1,
@@ -9564,532 +9820,583 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         63,
+         140,
+         74,
+         78,
+         80,
+         8,
+         84,
+         86,
+         86,
+         86,
+         86,
+         86,
+         86,
+         86,
+         2,
+         70,
+         82,
+         66,
+         76,
+         68,
+         72,
+         62,
+         1,
+         7,
+         5,
+         3,
+         6,
+         4,
+         65,
+         9,
+         67,
+         10,
+         11,
+         12,
+         13,
+         14,
+         69,
+         15,
+         16,
+         64,
+         17,
+         18,
+         19,
+         20,
+         21,
+         22,
          -1,
          -1,
+         71,
          -1,
          -1,
-         23,
          24,
          -1,
-         26,
+         25,
          -1,
-         70,
          -1,
-         27,
          -1,
-         72,
          -1,
-         28,
          -1,
-         74,
-         76,
          -1,
-         88,
          -1,
-         80,
          -1,
-         146,
          -1,
-         82,
-         84,
          -1,
-         187,
+         30,
          -1,
-         186,
          -1,
-         91,
          -1,
-         85,
-         132,
          -1,
-         92,
          -1,
-         86,
          -1,
-         157,
          -1,
-         31,
-         87,
          -1,
-         93,
          -1,
-         131,
          -1,
-         94,
          -1,
-         89,
-         90,
          -1,
-         166,
-         95,
          -1,
          -1,
-         134,
          -1,
-         177,
          -1,
-         135,
          -1,
-         32,
          -1,
-         97,
-         136,
          -1,
-         243,
-         98,
          -1,
-         33,
          -1,
-         216,
          -1,
-         99,
          -1,
-         100,
-         148,
          -1,
-         101,
+         208,
          -1,
-         35,
          -1,
-         105,
          -1,
-         106,
          -1,
-         147,
-         196,
          -1,
-         37,
+         251,
          -1,
-         153,
          -1,
-         138,
          -1,
-         200,
          -1,
-         137,
          -1,
-         158,
          -1,
-         159,
          -1,
-         163,
          -1,
-         109,
          -1,
-         204,
          -1,
-         41,
          -1,
-         150,
          -1,
-         116,
          -1,
-         117,
          -1,
-         43,
          -1,
-         221,
          -1,
-         220,
          -1,
-         45,
          -1,
-         119,
+         23,
          -1,
-         227,
+         73,
          -1,
-         161,
-         121,
-         122,
+         31,
          -1,
-         49,
+         27,
+         28,
          -1,
-         124,
+         75,
          -1,
-         143,
+         29,
          -1,
-         51,
+         79,
          -1,
-         167,
+         94,
          -1,
-         52,
+         81,
+         144,
          -1,
-         214,
+         158,
          -1,
-         145,
+         83,
          -1,
-         54,
+         209,
          -1,
-         58,
+         85,
+         87,
          -1,
-         78,
+         95,
          -1,
-         181,
+         88,
+         142,
          -1,
          96,
          -1,
-         42,
+         159,
+         89,
+         90,
          -1,
-         103,
+         147,
          -1,
-         160,
+         26,
+         91,
          -1,
-         36,
+         170,
+         97,
          -1,
-         168,
+         141,
          -1,
-         112,
+         179,
          -1,
-         108,
+         92,
+         93,
          -1,
-         110,
+         98,
          -1,
-         113,
          -1,
-         203,
+         187,
+         99,
          -1,
-         173,
+         194,
          -1,
-         155,
+         102,
          -1,
-         232,
+         161,
          -1,
-         34,
+         32,
          -1,
-         133,
+         278,
+         103,
          -1,
-         152,
+         33,
          -1,
-         141,
+         104,
+         145,
          -1,
-         118,
+         241,
          -1,
-         239,
+         105,
+         162,
          -1,
-         206,
+         35,
          -1,
-         111,
+         109,
          -1,
-         120,
+         110,
          -1,
-         127,
+         111,
          -1,
-         183,
+         112,
          -1,
-         139,
+         219,
          -1,
-         192,
+         171,
+         221,
          -1,
          114,
          -1,
-         202,
-         -1,
-         151,
+         153,
          -1,
-         213,
+         225,
          -1,
-         40,
+         163,
          -1,
-         184,
+         180,
          -1,
-         195,
+         37,
          -1,
-         102,
+         174,
          -1,
-         162,
+         173,
          -1,
-         217,
+         117,
          -1,
-         180,
+         119,
          -1,
-         128,
+         167,
          -1,
-         44,
+         151,
          -1,
-         104,
+         231,
          -1,
-         142,
+         148,
          -1,
-         129,
+         154,
          -1,
-         235,
+         40,
          -1,
-         126,
+         123,
          -1,
-         149,
+         168,
          -1,
-         193,
+         43,
          -1,
-         170,
+         45,
          -1,
-         175,
+         252,
          -1,
-         107,
+         190,
+         166,
+         127,
          -1,
-         212,
+         49,
          -1,
-         242,
+         130,
          -1,
-         219,
+         51,
          -1,
-         208,
+         188,
          -1,
-         172,
+         195,
          -1,
-         191,
+         52,
          -1,
-         125,
+         239,
          -1,
-         169,
+         53,
          -1,
-         178,
+         136,
          -1,
-         140,
+         55,
          -1,
-         237,
+         176,
          -1,
-         182,
+         56,
          -1,
-         224,
+         58,
          -1,
-         164,
+         61,
          -1,
-         185,
+         77,
          -1,
-         234,
+         199,
          -1,
-         38,
+         100,
          -1,
-         190,
+         41,
          -1,
-         39,
+         146,
          -1,
-         179,
+         36,
          -1,
-         171,
+         107,
          -1,
-         53,
+         149,
          -1,
-         115,
+         283,
          -1,
-         156,
+         150,
          -1,
-         210,
+         121,
          -1,
-         55,
+         183,
          -1,
-         197,
+         116,
          -1,
-         57,
+         120,
          -1,
-         154,
+         165,
          -1,
-         174,
+         122,
          -1,
-         231,
+         224,
          -1,
          205,
          -1,
-         201,
+         34,
          -1,
-         218,
+         101,
          -1,
-         198,
+         255,
          -1,
-         46,
+         181,
          -1,
-         207,
+         235,
          -1,
-         211,
+         182,
          -1,
-         228,
+         245,
          -1,
-         47,
+         250,
          -1,
-         209,
+         129,
          -1,
-         48,
+         42,
          -1,
-         189,
+         125,
          -1,
-         199,
+         126,
          -1,
-         188,
+         106,
          -1,
-         123,
+         143,
          -1,
-         176,
+         155,
          -1,
-         50,
+         164,
          -1,
-         144,
+         177,
          -1,
-         165,
+         273,
          -1,
-         56,
+         261,
          -1,
-         223,
+         280,
          -1,
-         229,
+         244,
          -1,
-         215,
+         108,
          -1,
-         233,
+         216,
          -1,
-         225,
+         227,
          -1,
-         222,
+         242,
          -1,
-         230,
+         124,
          -1,
          238,
          -1,
-         236,
+         44,
          -1,
-         240,
+         134,
          -1,
-         241,
+         152,
          -1,
-         3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
-         1,
-         2,
-         5,
-         8,
-         4,
-         7,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
+         184,
          -1,
+         139,
          -1,
+         175,
          -1,
+         138,
          -1,
+         132,
          -1,
+         204,
          -1,
+         172,
          -1,
+         156,
          -1,
+         263,
          -1,
+         196,
          -1,
+         218,
          -1,
+         113,
          -1,
+         212,
          -1,
+         191,
          -1,
+         133,
          -1,
+         237,
          -1,
-         27,
+         275,
          -1,
+         206,
          -1,
+         214,
          -1,
+         233,
          -1,
+         248,
          -1,
+         213,
          -1,
+         131,
          -1,
+         200,
          -1,
+         203,
          -1,
+         115,
          -1,
+         189,
          -1,
+         217,
          -1,
-         3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
-         1,
-         2,
-         5,
-         8,
-         4,
-         7,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
+         268,
+         -1,
+         197,
+         -1,
+         157,
+         -1,
+         118,
+         -1,
+         262,
+         -1,
+         207,
+         -1,
+         211,
+         -1,
+         38,
+         -1,
+         54,
+         -1,
+         39,
+         -1,
+         201,
+         -1,
+         185,
+         -1,
+         193,
          -1,
+         234,
+         -1,
+         57,
+         -1,
+         178,
+         -1,
+         60,
          -1,
+         220,
          -1,
+         169,
          -1,
+         229,
          -1,
+         258,
          -1,
+         260,
          -1,
+         228,
          -1,
+         226,
          -1,
+         243,
          -1,
+         223,
          -1,
+         46,
          -1,
+         230,
          -1,
+         253,
          -1,
+         47,
          -1,
+         232,
          -1,
+         48,
          -1,
+         215,
          -1,
+         222,
          -1,
+         160,
          -1,
+         210,
          -1,
+         128,
          -1,
+         192,
          -1,
+         50,
          -1,
+         202,
          -1,
+         236,
          -1,
+         186,
          -1,
+         135,
+         -1,
+         137,
+         -1,
+         198,
+         -1,
+         59,
+         -1,
+         254,
+         -1,
+         240,
+         -1,
+         256,
+         -1,
+         247,
+         -1,
+         265,
+         -1,
+         271,
+         -1,
+         249,
+         -1,
+         246,
+         -1,
+         264,
+         -1,
+         259,
+         -1,
+         269,
+         -1,
+         257,
+         -1,
+         266,
+         -1,
+         272,
+         -1,
+         267,
+         -1,
+         270,
+         -1,
+         274,
+         -1,
+         276,
+         -1,
+         277,
+         -1,
+         279,
+         -1,
+         281,
+         -1,
+         282,
          -1,
-         7,
          3,
          3,
          3,
+         7,
          2,
          1,
          8,
@@ -10113,23 +10420,9 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          1,
          -1,
          -1,
-         5,
-         3,
-         3,
-         1,
-         2,
-         2,
-         2,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         4,
-         -1,
+         9,
          10,
          11,
-         9,
          1,
          2,
          3,
@@ -10143,13 +10436,13 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         5,
-         6,
-         -1,
          12,
          -1,
          13,
          -1,
+         5,
+         6,
+         -1,
          14,
          -1,
          15,
@@ -10166,6 +10459,20 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          17,
          -1,
+         5,
+         3,
+         1,
+         1,
+         2,
+         2,
+         2,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         4,
+         -1,
          3,
          4,
          -1,
@@ -10191,48 +10498,34 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          10,
          -1,
-         3,
-         4,
-         5,
-         11,
-         12,
-         15,
-         33,
-         16,
-         16,
-         17,
-         31,
-         6,
-         32,
-         14,
-         13,
-         18,
-         7,
-         10,
+         30,
          34,
+         36,
+         39,
+         32,
+         91,
+         38,
+         31,
+         37,
+         33,
+         35,
+         40,
          1,
-         9,
-         8,
-         19,
-         20,
-         21,
-         22,
-         2,
-         2,
          2,
+         3,
+         4,
          -1,
          -1,
          -1,
          -1,
-         26,
          -1,
-         27,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         163,
          -1,
          -1,
          -1,
@@ -10252,448 +10545,526 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         89,
          -1,
-         23,
-         24,
+         41,
          -1,
-         25,
+         42,
          -1,
-         28,
+         43,
          -1,
-         35,
+         103,
+         92,
          -1,
-         36,
-         37,
+         45,
          -1,
-         38,
+         46,
+         47,
          -1,
-         29,
+         48,
+         115,
          -1,
-         39,
+         105,
          -1,
-         30,
+         49,
+         50,
          -1,
-         2,
-         2,
-         16,
-         3,
-         3,
-         3,
-         6,
-         1,
          5,
-         4,
-         15,
-         7,
-         8,
-         9,
-         10,
-         11,
-         -1,
-         -1,
+         6,
          -1,
+         106,
          -1,
+         51,
          -1,
+         117,
          -1,
+         116,
+         52,
          -1,
+         125,
          -1,
+         88,
          -1,
+         132,
+         54,
          -1,
+         139,
          -1,
+         222,
+         56,
          -1,
+         7,
          -1,
+         57,
+         58,
          -1,
+         8,
          -1,
-         12,
-         13,
+         60,
          -1,
-         14,
+         64,
          -1,
-         1,
+         90,
          -1,
+         124,
+         172,
          -1,
-         28,
-         30,
-         36,
-         31,
-         82,
-         35,
-         29,
-         34,
-         32,
-         33,
-         27,
-         1,
-         2,
-         3,
-         4,
+         67,
          -1,
+         186,
          -1,
+         175,
          -1,
+         69,
          -1,
+         131,
          -1,
+         9,
          -1,
+         71,
          -1,
+         126,
          -1,
+         74,
          -1,
+         94,
          -1,
+         104,
          -1,
-         147,
+         76,
          -1,
+         216,
          -1,
+         98,
          -1,
+         177,
          -1,
+         97,
          -1,
+         109,
          -1,
+         12,
          -1,
+         13,
          -1,
+         111,
          -1,
+         15,
          -1,
+         193,
          -1,
+         140,
+         108,
+         81,
          -1,
+         18,
          -1,
+         83,
          -1,
+         197,
          -1,
+         144,
          -1,
-         5,
-         6,
+         153,
          -1,
-         80,
+         86,
          -1,
-         37,
+         119,
          -1,
-         38,
-         39,
+         160,
          -1,
-         40,
+         62,
          -1,
-         41,
+         164,
          -1,
-         140,
+         73,
          -1,
-         43,
-         93,
+         44,
          -1,
-         95,
+         180,
          -1,
-         44,
-         45,
+         72,
          -1,
-         83,
+         133,
          -1,
-         79,
+         68,
          -1,
-         105,
+         169,
          -1,
-         46,
+         14,
          -1,
-         96,
+         101,
          -1,
-         113,
-         47,
+         223,
          -1,
-         123,
+         178,
          -1,
-         182,
-         49,
+         191,
          -1,
-         7,
+         137,
          -1,
-         52,
          53,
          -1,
-         8,
+         77,
          -1,
-         81,
+         145,
          -1,
-         104,
-         148,
+         184,
          -1,
-         9,
+         210,
          -1,
-         58,
+         120,
          -1,
-         59,
+         185,
          -1,
-         157,
+         20,
          -1,
-         60,
+         79,
          -1,
-         152,
+         84,
          -1,
-         112,
+         80,
          -1,
-         63,
+         215,
          -1,
-         153,
+         55,
          -1,
-         94,
+         59,
          -1,
-         66,
+         95,
          -1,
-         99,
+         204,
          -1,
-         88,
+         203,
          -1,
-         12,
+         138,
          -1,
-         13,
+         211,
          -1,
-         106,
+         150,
          -1,
-         69,
+         152,
          -1,
-         163,
+         75,
          -1,
-         15,
+         61,
          -1,
-         71,
+         99,
          -1,
-         167,
+         168,
          -1,
-         114,
-         73,
-         74,
+         220,
          -1,
-         18,
+         85,
          -1,
-         116,
+         135,
          -1,
-         91,
+         107,
          -1,
-         132,
+         63,
          -1,
-         77,
+         78,
          -1,
-         172,
+         22,
          -1,
-         131,
+         21,
          -1,
-         50,
+         158,
          -1,
-         141,
+         161,
          -1,
-         62,
+         96,
          -1,
-         42,
+         93,
          -1,
-         160,
+         114,
          -1,
-         61,
+         154,
          -1,
-         146,
+         23,
          -1,
-         75,
+         156,
+         -1,
+         162,
          -1,
          65,
          -1,
-         161,
+         122,
          -1,
-         155,
+         136,
          -1,
-         177,
+         24,
          -1,
-         122,
+         165,
          -1,
-         102,
+         206,
          -1,
-         48,
+         25,
          -1,
-         68,
+         26,
          -1,
-         128,
+         141,
          -1,
-         54,
+         123,
          -1,
-         176,
+         28,
          -1,
-         124,
+         102,
          -1,
-         14,
+         182,
          -1,
-         72,
+         218,
          -1,
-         121,
+         87,
          -1,
-         76,
+         29,
          -1,
-         133,
+         159,
          -1,
-         64,
+         134,
          -1,
-         51,
+         190,
          -1,
-         70,
+         167,
          -1,
-         173,
+         157,
          -1,
-         137,
+         146,
          -1,
-         20,
+         66,
          -1,
-         108,
+         149,
          -1,
-         126,
+         147,
          -1,
-         97,
+         70,
          -1,
-         55,
+         151,
          -1,
-         90,
+         100,
          -1,
-         145,
+         155,
          -1,
-         117,
+         10,
          -1,
-         85,
+         11,
          -1,
-         56,
+         179,
          -1,
-         98,
+         121,
          -1,
-         129,
+         118,
          -1,
-         22,
+         113,
          -1,
-         139,
+         170,
          -1,
-         84,
+         200,
          -1,
-         175,
+         202,
          -1,
-         21,
+         171,
+         -1,
+         174,
+         -1,
+         16,
+         -1,
+         176,
+         -1,
+         173,
+         -1,
+         194,
+         -1,
+         17,
+         -1,
+         166,
+         -1,
+         82,
+         -1,
+         127,
          -1,
          110,
          -1,
+         128,
+         -1,
+         112,
+         -1,
+         19,
+         -1,
+         130,
+         -1,
+         181,
+         -1,
+         129,
+         -1,
+         142,
+         -1,
+         148,
+         -1,
          143,
          -1,
-         57,
+         27,
          -1,
-         101,
+         196,
          -1,
-         103,
+         198,
          -1,
-         26,
+         183,
          -1,
-         120,
+         188,
          -1,
-         180,
+         189,
          -1,
-         23,
+         213,
          -1,
-         158,
+         192,
          -1,
-         25,
+         195,
          -1,
-         138,
+         205,
          -1,
-         78,
+         201,
          -1,
-         125,
+         187,
          -1,
-         118,
+         199,
          -1,
-         144,
+         207,
          -1,
-         119,
+         208,
          -1,
-         135,
+         214,
          -1,
-         87,
+         217,
          -1,
-         127,
+         209,
          -1,
-         130,
+         212,
          -1,
-         165,
+         219,
          -1,
-         89,
+         221,
          -1,
-         134,
+         1,
+         1,
+         1,
+         8,
+         2,
+         3,
+         4,
+         5,
          -1,
-         10,
          -1,
-         136,
          -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         6,
+         7,
+         -1,
+         4,
+         6,
+         7,
+         31,
+         8,
+         8,
+         9,
+         1,
+         1,
+         1,
+         2,
+         5,
+         3,
+         32,
+         10,
+         33,
          11,
+         12,
+         13,
+         14,
+         15,
+         34,
+         16,
+         17,
+         18,
+         19,
+         20,
+         21,
+         22,
          -1,
-         67,
          -1,
-         156,
          -1,
-         107,
+         23,
          -1,
-         100,
+         24,
          -1,
-         154,
          -1,
-         171,
          -1,
-         149,
          -1,
-         150,
          -1,
-         16,
          -1,
-         151,
          -1,
-         168,
          -1,
-         17,
          -1,
-         142,
          -1,
-         115,
          -1,
-         109,
          -1,
-         86,
          -1,
-         19,
          -1,
-         92,
          -1,
-         111,
          -1,
-         24,
          -1,
-         169,
          -1,
-         164,
          -1,
-         159,
          -1,
-         166,
          -1,
-         170,
          -1,
-         162,
          -1,
-         174,
          -1,
-         178,
          -1,
-         179,
          -1,
-         181,
          -1,
-         16,
-         1,
-         1,
-         1,
-         2,
+         25,
+         -1,
+         26,
+         27,
+         -1,
+         28,
+         -1,
+         35,
+         -1,
+         36,
+         37,
+         -1,
+         38,
+         -1,
+         29,
+         -1,
+         39,
+         -1,
+         30,
+         -1,
          3,
-         14,
+         3,
+         3,
+         6,
          15,
-         4,
+         1,
          5,
-         6,
+         4,
+         16,
          7,
          8,
+         9,
+         10,
+         11,
+         2,
+         2,
          -1,
          -1,
          -1,
-         12,
          -1,
          -1,
          -1,
@@ -10705,31 +11076,49 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         9,
-         10,
          -1,
-         11,
+         12,
          -1,
          13,
+         14,
          -1,
-         8,
+         1,
+         -1,
+         -1,
+         16,
+         1,
+         1,
+         1,
          2,
          3,
+         14,
+         15,
          4,
          5,
-         1,
-         1,
-         1,
+         6,
+         7,
+         8,
          -1,
          -1,
          -1,
+         12,
          -1,
          -1,
          -1,
          -1,
          -1,
-         6,
-         7,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         9,
+         10,
+         -1,
+         11,
+         -1,
+         13,
          -1,
          3,
          4,
@@ -10743,17 +11132,17 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          17,
          18,
          32,
-         7,
+         10,
          33,
          15,
          14,
          19,
-         8,
          11,
+         7,
          35,
          1,
-         10,
          9,
+         8,
          20,
          21,
          22,
@@ -10883,21 +11272,22 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         18,
-         19,
-         20,
          21,
          22,
          23,
          24,
-         66,
          25,
+         26,
+         27,
+         28,
+         76,
+         29,
          -1,
          -1,
          -1,
          -1,
          -1,
-         142,
+         163,
          -1,
          -1,
          -1,
@@ -10911,296 +11301,377 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         67,
          -1,
-         26,
-         27,
          -1,
-         28,
-         29,
          -1,
-         30,
+         77,
+         -1,
+         89,
+         78,
          -1,
+         30,
          31,
          -1,
          32,
-         -1,
          33,
-         78,
-         -1,
-         131,
-         -1,
-         64,
          -1,
-         77,
+         34,
          -1,
          35,
-         36,
-         -1,
-         1,
          -1,
-         68,
+         36,
          -1,
-         87,
          37,
+         100,
          -1,
-         79,
-         -1,
-         95,
-         -1,
-         89,
+         39,
          -1,
-         65,
+         74,
          -1,
          88,
+         42,
          -1,
-         2,
+         43,
+         44,
          -1,
-         3,
+         1,
+         -1,
+         90,
          -1,
+         99,
          45,
          -1,
-         48,
+         101,
+         -1,
+         108,
          -1,
          110,
          -1,
-         49,
+         115,
          -1,
-         50,
+         46,
          -1,
-         96,
+         128,
          -1,
-         119,
+         49,
          -1,
-         72,
+         75,
          -1,
-         4,
+         109,
          -1,
-         76,
+         2,
          -1,
-         81,
+         55,
          -1,
-         52,
+         3,
          -1,
-         97,
+         57,
          -1,
-         55,
+         117,
          -1,
-         147,
+         60,
          -1,
-         9,
+         133,
          -1,
-         57,
+         61,
          -1,
-         126,
+         116,
          -1,
-         102,
-         58,
-         59,
+         79,
          -1,
-         98,
+         193,
          -1,
-         74,
+         81,
          -1,
-         111,
+         141,
          -1,
-         62,
+         92,
          -1,
-         130,
+         4,
          -1,
-         118,
+         87,
          -1,
-         38,
+         83,
          -1,
-         46,
+         63,
          -1,
-         34,
+         103,
          -1,
-         133,
+         9,
          -1,
-         40,
+         152,
          -1,
-         60,
+         130,
+         91,
+         68,
          -1,
-         51,
+         155,
          -1,
-         146,
+         69,
          -1,
-         122,
+         123,
          -1,
-         144,
+         134,
          -1,
-         101,
+         72,
          -1,
-         84,
+         102,
          -1,
-         54,
+         147,
          -1,
-         39,
+         47,
          -1,
-         154,
+         58,
          -1,
-         143,
+         38,
          -1,
-         112,
+         162,
          -1,
-         7,
+         41,
          -1,
-         103,
+         124,
          -1,
-         108,
+         62,
          -1,
-         61,
+         85,
          -1,
-         121,
+         196,
          -1,
-         92,
+         7,
          -1,
-         41,
+         179,
          -1,
-         47,
+         149,
          -1,
-         43,
+         119,
          -1,
-         120,
+         64,
          -1,
-         11,
+         48,
          -1,
-         12,
+         40,
          -1,
-         90,
+         50,
          -1,
          113,
          -1,
-         42,
-         -1,
-         71,
-         -1,
-         56,
+         145,
          -1,
-         139,
+         184,
          -1,
-         85,
+         70,
          -1,
-         44,
+         11,
          -1,
-         86,
+         120,
          -1,
-         73,
+         180,
          -1,
          106,
          -1,
-         14,
+         51,
          -1,
-         70,
+         194,
          -1,
-         138,
+         178,
          -1,
-         80,
+         160,
          -1,
-         13,
+         66,
          -1,
-         16,
+         126,
          -1,
-         5,
+         189,
          -1,
-         132,
+         13,
          -1,
-         151,
+         140,
          -1,
-         93,
+         52,
          -1,
-         63,
+         59,
          -1,
-         6,
+         80,
          -1,
-         135,
+         71,
          -1,
-         83,
+         139,
          -1,
-         17,
+         174,
+         -1,
+         118,
          -1,
          53,
          -1,
-         114,
+         84,
          -1,
-         155,
+         82,
          -1,
-         8,
+         146,
          -1,
-         10,
+         142,
          -1,
-         136,
+         129,
          -1,
-         82,
+         17,
          -1,
-         91,
+         54,
          -1,
-         69,
+         98,
          -1,
-         75,
+         65,
          -1,
-         94,
+         144,
          -1,
-         15,
+         12,
          -1,
-         100,
+         19,
          -1,
-         117,
+         56,
          -1,
-         105,
+         169,
          -1,
-         140,
+         97,
          -1,
-         129,
+         14,
          -1,
-         107,
+         73,
          -1,
-         123,
+         5,
          -1,
-         116,
+         161,
          -1,
-         134,
+         112,
          -1,
-         99,
+         15,
          -1,
-         145,
+         6,
          -1,
-         124,
+         166,
          -1,
-         115,
+         186,
          -1,
-         128,
+         16,
          -1,
-         104,
+         93,
+         -1,
+         132,
+         -1,
+         107,
+         -1,
+         86,
+         -1,
+         8,
+         -1,
+         195,
+         -1,
+         20,
+         -1,
+         10,
+         -1,
+         67,
+         -1,
+         170,
+         -1,
+         96,
+         -1,
+         95,
+         -1,
+         105,
+         -1,
+         94,
+         -1,
+         104,
+         -1,
+         111,
+         -1,
+         131,
+         -1,
+         136,
          -1,
          125,
          -1,
-         127,
+         18,
          -1,
-         109,
+         143,
          -1,
-         137,
+         122,
          -1,
-         149,
+         150,
          -1,
-         141,
+         172,
+         -1,
+         157,
+         -1,
+         159,
+         -1,
+         158,
+         -1,
+         173,
+         -1,
+         138,
+         -1,
+         135,
          -1,
          148,
          -1,
-         152,
+         114,
          -1,
-         150,
+         165,
+         -1,
+         164,
+         -1,
+         181,
+         -1,
+         167,
+         -1,
+         168,
+         -1,
+         137,
+         -1,
+         151,
+         -1,
+         156,
+         -1,
+         121,
          -1,
          153,
          -1,
+         127,
+         -1,
+         154,
+         -1,
+         171,
+         -1,
+         175,
+         -1,
+         185,
+         -1,
+         182,
+         -1,
+         176,
+         -1,
+         177,
+         -1,
+         183,
+         -1,
+         191,
+         -1,
+         188,
+         -1,
+         187,
+         -1,
+         192,
+         -1,
+         190,
+         -1,
          1,
          1,
          1,
          -1,
          -1,
-         10,
          9,
+         10,
          1,
          2,
          3,
@@ -11215,11 +11686,11 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          18,
          -1,
          -1,
+         11,
+         -1,
          5,
          6,
          -1,
-         11,
-         -1,
          12,
          -1,
          17,
@@ -11236,6 +11707,9 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          15,
          -1,
+         1,
+         1,
+         1,
          10,
          2,
          3,
@@ -11243,9 +11717,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          5,
          6,
          7,
-         1,
-         1,
-         1,
          -1,
          -1,
          -1,
@@ -11291,14 +11762,14 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         15,
-         2,
-         2,
-         2,
-         1,
          13,
-         14,
+         1,
+         1,
+         1,
+         2,
          3,
+         14,
+         15,
          4,
          5,
          6,
@@ -11306,7 +11777,7 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         11,
+         8,
          -1,
          -1,
          -1,
@@ -11317,12 +11788,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         8,
          9,
          -1,
-         12,
-         -1,
          10,
+         11,
+         -1,
+         12,
          -1,
          7,
          7,
@@ -11357,39 +11828,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          12,
          -1,
-         2,
-         3,
-         15,
-         13,
-         14,
-         4,
-         5,
-         6,
-         7,
-         1,
-         1,
-         1,
-         -1,
-         -1,
-         -1,
-         11,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         8,
-         9,
-         -1,
-         10,
-         -1,
-         12,
-         -1,
          9,
          16,
          19,
@@ -11405,17 +11843,17 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          8,
          1,
          32,
-         10,
+         13,
          33,
          18,
          17,
          22,
-         11,
          14,
+         10,
          35,
          6,
-         13,
          12,
+         11,
          2,
          4,
          5,
@@ -11479,20 +11917,20 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          1,
          -1,
+         1,
+         2,
+         14,
          4,
-         4,
-         4,
-         3,
          5,
-         14,
          6,
          7,
-         2,
-         1,
          8,
          9,
          10,
          11,
+         3,
+         3,
+         3,
          -1,
          -1,
          -1,
@@ -11529,9 +11967,9 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          7,
          8,
          -1,
-         10,
-         1,
          9,
+         1,
+         10,
          2,
          3,
          4,
@@ -11546,17 +11984,17 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          6,
-         7,
          -1,
+         7,
          8,
          -1,
-         11,
          1,
-         10,
          2,
+         9,
          3,
          4,
          5,
+         6,
          -1,
          -1,
          -1,
@@ -11566,22 +12004,16 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         -1,
-         6,
          7,
-         -1,
          8,
-         12,
-         -1,
-         9,
          -1,
+         10,
          1,
+         11,
          2,
-         9,
          3,
          4,
          5,
-         6,
          -1,
          -1,
          -1,
@@ -11591,11 +12023,17 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         -1,
+         6,
+         12,
+         -1,
          7,
          8,
          -1,
          9,
+         -1,
          8,
+         9,
          1,
          2,
          3,
@@ -11609,8 +12047,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          5,
-         6,
          -1,
+         6,
          7,
          -1,
          1,
@@ -11720,28 +12158,46 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          6,
          7,
          -1,
-         4,
+         3,
          4,
          5,
-         23,
+         6,
          7,
+         8,
          9,
          10,
-         10,
-         10,
          11,
-         1,
-         22,
-         6,
          12,
-         2,
-         24,
-         3,
-         8,
          13,
          14,
          15,
          16,
+         16,
+         16,
+         17,
+         18,
+         19,
+         20,
+         21,
+         22,
+         23,
+         24,
+         25,
+         26,
+         27,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -11764,50 +12220,52 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         17,
-         18,
-         -1,
-         19,
          -1,
-         25,
-         -1,
-         26,
-         27,
          -1,
-         28,
          -1,
-         20,
          -1,
-         29,
          -1,
-         21,
          -1,
+         3,
+         4,
+         5,
          6,
-         27,
          7,
          8,
-         8,
          9,
-         14,
-         15,
-         15,
-         15,
-         16,
-         1,
-         26,
          10,
-         5,
-         4,
-         13,
          11,
-         2,
-         28,
-         3,
          12,
+         13,
+         14,
+         15,
+         16,
          17,
          18,
+         18,
+         18,
          19,
          20,
+         21,
+         22,
+         23,
+         24,
+         25,
+         26,
+         27,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -11834,78 +12292,30 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         21,
-         22,
-         -1,
-         23,
-         -1,
-         29,
-         -1,
-         30,
-         31,
-         -1,
-         32,
-         -1,
-         24,
-         -1,
-         33,
          -1,
-         25,
          -1,
          3,
-         1,
+         22,
          4,
          5,
          6,
-         2,
-         2,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         3,
-         6,
          7,
+         7,
+         7,
+         1,
+         23,
          8,
-         8,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
          9,
          10,
-         10,
-         10,
-         18,
-         2,
-         15,
+         24,
          11,
-         17,
-         16,
-         1,
          12,
          13,
-         4,
          14,
-         5,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
+         15,
+         16,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -11928,52 +12338,50 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         17,
+         -1,
+         18,
+         19,
+         -1,
+         25,
          -1,
+         26,
+         27,
          -1,
+         28,
          -1,
+         20,
          -1,
+         29,
          -1,
+         21,
          -1,
-         3,
+         26,
          4,
+         4,
+         5,
+         6,
+         8,
+         8,
+         8,
+         2,
+         3,
+         7,
+         1,
+         27,
          9,
+         10,
          11,
          12,
          13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
          14,
+         28,
+         15,
+         16,
          17,
          18,
          19,
-         19,
          20,
-         1,
-         6,
-         7,
-         15,
-         8,
-         16,
-         5,
-         10,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
-         2,
-         2,
-         2,
          -1,
          -1,
          -1,
@@ -12000,6 +12408,36 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         21,
+         -1,
+         22,
+         23,
+         -1,
+         29,
+         -1,
+         30,
+         31,
+         -1,
+         32,
+         -1,
+         24,
+         -1,
+         33,
+         -1,
+         25,
+         -1,
+         3,
+         1,
+         4,
+         5,
+         6,
+         2,
+         2,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
          -1,
          -1,
          12,
@@ -12031,32 +12469,49 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          11,
          -1,
+         1,
+         -1,
+         -1,
+         3,
          4,
          5,
          5,
          5,
          6,
+         7,
+         8,
+         9,
+         10,
          11,
-         27,
+         12,
          13,
          14,
-         14,
          15,
-         1,
-         12,
-         26,
-         10,
-         9,
          16,
-         7,
-         8,
-         28,
-         3,
-         2,
          17,
          18,
          19,
          20,
+         21,
+         22,
+         23,
+         24,
+         25,
+         26,
+         27,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         1,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -12083,38 +12538,34 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         21,
-         22,
          -1,
-         23,
          -1,
-         29,
-         -1,
-         30,
-         31,
-         -1,
-         32,
-         -1,
-         24,
-         -1,
-         33,
-         -1,
-         25,
-         -1,
-         19,
+         4,
+         4,
+         4,
+         26,
+         8,
+         8,
+         9,
          2,
+         5,
          7,
-         17,
          3,
-         18,
          1,
          6,
-         5,
-         4,
-         8,
-         9,
+         27,
          10,
          11,
+         12,
+         13,
+         14,
+         28,
+         15,
+         16,
+         17,
+         18,
+         19,
+         20,
          -1,
          -1,
          -1,
@@ -12122,7 +12573,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         15,
          -1,
          -1,
          -1,
@@ -12133,20 +12583,40 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         12,
-         13,
          -1,
-         14,
          -1,
-         16,
          -1,
-         1,
-         1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         21,
+         -1,
+         22,
+         23,
+         -1,
+         29,
+         -1,
+         30,
+         31,
+         -1,
+         32,
+         -1,
+         24,
+         -1,
+         33,
+         -1,
+         25,
+         -1,
+         17,
          1,
          2,
+         18,
          3,
+         19,
          4,
-         15,
          5,
          6,
          7,
@@ -12154,6 +12624,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          9,
          10,
          11,
+         -1,
+         -1,
          12,
          -1,
          -1,
@@ -12171,63 +12643,27 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          13,
-         14,
          -1,
-         1,
+         14,
+         15,
          -1,
+         16,
          -1,
-         4,
-         6,
-         6,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
          1,
          1,
          1,
          2,
-         5,
          3,
+         4,
+         15,
+         5,
+         6,
+         7,
          8,
          9,
          10,
          11,
          12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
          -1,
          -1,
          -1,
@@ -12243,6 +12679,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         13,
+         14,
          -1,
          1,
          -1,
@@ -12262,33 +12700,33 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          1,
          6,
          -1,
-         2,
+         3,
          -1,
          -1,
          -1,
          -1,
-         3,
+         2,
          -1,
          4,
          -1,
-         2,
-         5,
+         3,
+         3,
          6,
          6,
          6,
-         24,
-         9,
-         9,
+         2,
+         22,
+         4,
          1,
+         5,
+         23,
          7,
-         22,
-         12,
-         11,
          8,
+         9,
          10,
-         23,
-         4,
-         3,
+         24,
+         11,
+         12,
          13,
          14,
          15,
@@ -12316,12 +12754,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          17,
+         -1,
          18,
+         19,
          -1,
          25,
          -1,
-         19,
-         -1,
          26,
          27,
          -1,
@@ -12336,17 +12774,15 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          4,
          4,
          4,
-         7,
-         7,
-         2,
+         1,
          21,
          3,
-         1,
          5,
-         22,
-         9,
          6,
+         22,
+         7,
          8,
+         9,
          23,
          10,
          11,
@@ -12354,6 +12790,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          13,
          14,
          15,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -12393,34 +12831,22 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          20,
          -1,
-         1,
-         1,
+         3,
+         3,
          5,
+         21,
+         1,
          2,
-         3,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
          4,
-         -1,
          22,
-         5,
-         5,
-         7,
-         3,
-         4,
          6,
-         21,
+         7,
          8,
-         2,
-         1,
-         13,
          9,
-         12,
-         11,
          10,
+         11,
+         12,
+         13,
          14,
          15,
          16,
@@ -12447,12 +12873,24 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          18,
-         19,
          -1,
+         19,
          20,
          -1,
          1,
          1,
+         5,
+         2,
+         3,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         4,
+         -1,
+         1,
+         1,
          2,
          7,
          3,
@@ -12591,17 +13029,20 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         22,
-         7,
-         7,
-         9,
-         1,
-         6,
          3,
-         8,
+         3,
+         6,
+         6,
+         6,
+         2,
          21,
          4,
+         1,
          5,
+         7,
+         22,
+         8,
+         9,
          23,
          10,
          11,
@@ -12609,9 +13050,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          13,
          14,
          15,
-         2,
-         2,
-         2,
          -1,
          -1,
          -1,
@@ -12634,8 +13072,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          16,
-         17,
          -1,
+         17,
          18,
          -1,
          24,
@@ -12652,22 +13090,22 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          20,
          -1,
          2,
+         2,
+         3,
+         1,
+         1,
+         1,
+         21,
+         4,
          5,
          6,
-         6,
-         6,
-         23,
-         9,
-         9,
-         1,
          7,
-         11,
-         21,
+         22,
          8,
+         9,
+         23,
          10,
-         22,
-         4,
-         3,
+         11,
          12,
          13,
          14,
@@ -12694,12 +13132,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          16,
+         -1,
          17,
+         18,
          -1,
          24,
          -1,
-         18,
-         -1,
          25,
          26,
          -1,
@@ -12711,17 +13149,20 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          20,
          -1,
-         22,
-         7,
-         7,
-         9,
-         1,
-         6,
+         2,
+         2,
          3,
+         1,
+         1,
+         1,
          21,
-         8,
          4,
          5,
+         6,
+         22,
+         7,
+         8,
+         9,
          23,
          10,
          11,
@@ -12729,9 +13170,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          13,
          14,
          15,
-         2,
-         2,
-         2,
          -1,
          -1,
          -1,
@@ -12754,8 +13192,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          16,
-         17,
          -1,
+         17,
          18,
          -1,
          24,
@@ -12779,29 +13217,29 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         23,
+         3,
+         5,
+         5,
+         5,
          7,
-         8,
-         8,
-         8,
-         25,
-         10,
-         10,
-         12,
+         1,
+         4,
          6,
+         24,
+         8,
          9,
+         10,
          11,
-         23,
-         1,
+         25,
+         12,
          13,
-         2,
-         5,
-         24,
-         4,
-         3,
          14,
          15,
          16,
          17,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -12826,12 +13264,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          18,
+         -1,
          19,
+         20,
          -1,
          26,
          -1,
-         20,
-         -1,
          27,
          28,
          -1,
@@ -12843,23 +13281,23 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          22,
          -1,
-         2,
-         2,
          4,
-         19,
+         18,
          1,
          3,
-         18,
+         19,
          5,
-         10,
          6,
-         9,
-         8,
          7,
+         8,
+         9,
+         10,
          11,
          12,
          13,
          14,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -12879,8 +13317,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          15,
-         16,
          -1,
+         16,
          17,
          -1,
          1,
@@ -12894,21 +13332,18 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         2,
-         2,
-         3,
-         1,
-         1,
-         1,
          22,
-         4,
-         5,
          6,
+         6,
+         8,
+         1,
+         5,
+         3,
          7,
          23,
-         8,
          9,
          10,
+         2,
          24,
          11,
          12,
@@ -12916,6 +13351,9 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          14,
          15,
          16,
+         4,
+         4,
+         4,
          -1,
          -1,
          -1,
@@ -12967,29 +13405,29 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         28,
-         5,
-         5,
-         7,
-         14,
-         15,
-         15,
-         15,
          3,
-         4,
-         16,
-         6,
-         17,
-         27,
+         3,
+         5,
          8,
-         2,
+         8,
+         8,
+         27,
+         6,
          1,
-         13,
+         2,
+         7,
+         4,
          9,
+         28,
+         10,
+         11,
          12,
+         13,
+         14,
+         15,
          29,
-         11,
-         10,
+         16,
+         17,
          18,
          19,
          20,
@@ -13022,8 +13460,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          22,
-         23,
          -1,
+         23,
          24,
          -1,
          30,
@@ -13039,18 +13477,21 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          26,
          -1,
-         23,
-         7,
-         7,
-         9,
-         1,
-         6,
+         2,
+         2,
          3,
-         8,
+         1,
+         1,
+         1,
          22,
-         10,
          4,
          5,
+         6,
+         7,
+         23,
+         8,
+         9,
+         10,
          24,
          11,
          12,
@@ -13058,9 +13499,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          14,
          15,
          16,
-         2,
-         2,
-         2,
          -1,
          -1,
          -1,
@@ -13084,8 +13522,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          17,
-         18,
          -1,
+         18,
          19,
          -1,
          25,
@@ -13101,17 +13539,81 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          21,
          -1,
+         3,
+         3,
+         5,
+         8,
+         8,
+         8,
+         23,
+         6,
+         2,
+         7,
+         4,
+         1,
+         24,
+         9,
+         10,
+         11,
+         25,
+         12,
+         13,
+         14,
+         15,
+         16,
+         17,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         18,
+         -1,
+         19,
+         20,
+         -1,
+         26,
+         -1,
+         27,
+         28,
+         -1,
+         29,
+         -1,
+         21,
+         -1,
+         30,
+         -1,
+         22,
+         -1,
          27,
          5,
          5,
          7,
          8,
-         9,
-         9,
-         9,
+         10,
+         10,
+         10,
          2,
          4,
-         10,
+         9,
          6,
          3,
          26,
@@ -13172,13 +13674,13 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          25,
          -1,
          4,
-         6,
-         6,
-         6,
+         7,
+         7,
+         7,
          23,
          5,
          1,
-         7,
+         6,
          3,
          8,
          24,
@@ -13235,76 +13737,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          22,
          -1,
-         24,
-         2,
-         3,
          3,
          4,
-         5,
-         9,
-         10,
-         10,
-         10,
-         11,
-         1,
-         23,
-         6,
-         12,
-         13,
-         25,
-         8,
-         7,
-         14,
-         15,
-         16,
-         17,
          -1,
          -1,
          -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         18,
-         19,
-         -1,
-         20,
-         -1,
-         26,
-         -1,
-         27,
-         28,
-         -1,
-         29,
-         -1,
-         21,
-         -1,
-         30,
-         -1,
-         22,
-         -1,
-         3,
-         4,
-         -1,
-         -1,
-         -1,
-         5,
+         5,
          -1,
          6,
          -1,
@@ -13344,14 +13782,14 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         2,
-         2,
          1,
          9,
          3,
          4,
          5,
          6,
+         2,
+         2,
          -1,
          -1,
          -1,
@@ -13395,11 +13833,11 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          9,
          -1,
-         3,
+         1,
          11,
-         4,
          2,
-         1,
+         3,
+         4,
          5,
          6,
          7,
@@ -13430,111 +13868,174 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
 };
 
 /* DFA acception states */
-UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
+UNICC_INTERN unsigned char _dfa_accept[ 87 ][ 284 ] =
 {
     {
         0,
+        46,
+        62,
+        44,
+        64,
+        67,
+        66,
         65,
-        63,
-        47,
-        45,
+        39,
         42,
-        43,
-        44,
+        40,
+        3,
         2,
-        4,
-        39,
-        38,
-        5,
         0,
-        65,
+        44,
         0
     },
     {
         0,
-        65,
+        44,
+        46,
+        48,
+        49,
+        54,
+        58,
+        60,
+        61,
+        62,
+        69,
+        43,
+        45,
         63,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
         47,
-        62,
-        49,
+        59,
+        56,
         64,
-        60,
+        67,
+        66,
+        65,
+        41
+    },
+    {
+        0,
+        44,
+        46,
+        48,
+        49,
         54,
-        59,
+        58,
+        60,
+        61,
+        62,
+        69,
+        43,
+        45,
+        63,
+        55,
         53,
-        50,
         52,
-        66,
+        51,
+        50,
         57,
+        47,
+        59,
         56,
-        55,
-        61,
-        58,
+        64,
+        67,
+        66,
+        65,
+        68
+    },
+    {
+        0,
+        46,
+        62,
+        60,
         45,
-        42,
+        49,
         43,
+        54,
+        48,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
         44,
-        2,
-        4,
+        47,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         39,
-        38,
-        5,
-        14,
-        12,
-        13,
-        16,
-        15,
-        18,
-        37,
+        32,
+        31,
+        28,
+        42,
+        40,
         30,
-        7,
+        3,
+        2,
         29,
-        31,
-        32,
-        8,
+        26,
+        4,
         11,
-        27,
-        17,
-        34,
-        28,
-        36,
-        19,
-        20,
+        37,
+        12,
         10,
         9,
         33,
+        14,
+        36,
+        27,
+        7,
+        13,
+        5,
+        25,
+        24,
+        34,
         35,
-        26,
+        8,
+        6,
+        20,
+        15,
         21,
+        19,
+        18,
         23,
-        24,
-        25,
+        17,
+        16,
         22,
         0,
-        65,
-        47,
+        62,
+        44,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
-        47,
+        62,
         0,
         0,
         0,
@@ -13581,7 +14082,16 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        47,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        62,
+        0,
+        0,
         0,
         0,
         0,
@@ -13694,106 +14204,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
-        48,
-        47,
-        41,
-        66,
-        64,
-        46,
-        54,
-        56,
-        57,
-        58,
-        59,
-        52,
-        62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        3
-    },
-    {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
-        48,
-        47,
-        41,
-        66,
-        64,
-        46,
-        54,
-        56,
-        57,
-        58,
-        59,
-        52,
-        62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
-    },
-    {
         0,
-        65,
-        63,
-        47,
-        38,
-        5,
-        39,
         0,
-        65
-    },
-    {
         0,
-        3,
-        0
-    },
-    {
         0,
-        43
-    },
-    {
         0,
-        63,
-        47,
-        65,
-        5,
-        0
-    },
-    {
         0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        37,
-        36,
         0,
         0,
         0,
@@ -13804,12 +14222,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        37,
-        36,
         0,
         0,
         0,
@@ -13823,36 +14236,36 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
+        44,
+        46,
         62,
-        47,
-        49,
+        3,
+        39,
+        2,
+        0,
+        44
+    },
+    {
+        0,
+        41,
+        0
+    },
+    {
+        0,
+        66
+    },
+    {
+        0,
         64,
-        60,
-        54,
-        59,
-        53,
-        50,
-        52,
+        67,
         66,
-        63,
-        57,
-        56,
-        55,
         65,
-        61,
-        58,
-        45,
         42,
-        43,
-        44,
-        2,
+        40,
         4,
-        14,
-        12,
-        13,
         5,
-        7,
-        8,
+        0,
+        0,
         0,
         0,
         0,
@@ -13865,54 +14278,57 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        63,
-        65,
-        47,
-        66,
-        60,
-        61,
-        58,
-        45,
-        42,
-        43,
         44,
-        2,
-        4,
-        5,
-        0,
+        62,
+        46,
+        39,
         0
     },
     {
         0,
-        66
+        4,
+        5,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0
     },
     {
         0,
-        45,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
-        18,
-        30,
-        29,
-        31,
-        32,
+        40,
+        26,
         11,
-        27,
-        17,
-        28,
-        19,
-        20,
+        12,
         10,
         9,
         33,
-        26,
+        14,
+        27,
+        13,
+        25,
+        24,
+        34,
+        35,
+        8,
+        20,
+        15,
         21,
+        19,
+        18,
         23,
-        24,
-        25,
+        17,
+        16,
         22,
         0,
         0,
@@ -14069,71 +14485,174 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
         0
     },
     {
         0,
-        47,
-        49,
-        64,
         62,
-        45,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
-        14,
-        12,
-        13,
-        0,
-        0,
+        40,
         0
     },
     {
         0,
-        47,
-        45,
-        42,
+        62,
+        60,
+        45,
+        49,
         43,
+        46,
+        54,
         44,
-        2,
-        4,
+        48,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
+        47,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        32,
+        31,
+        39,
+        42,
+        40,
+        30,
+        37,
+        36,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
         0
     },
     {
         0,
+        46,
+        44,
         62,
-        47,
+        43,
         49,
+        48,
+        51,
         64,
+        67,
+        66,
+        65,
+        39,
+        42,
+        40,
+        0,
+        0
+    },
+    {
+        0,
+        43
+    },
+    {
+        0,
+        62,
         60,
-        46,
-        54,
-        59,
-        53,
-        50,
-        52,
+        45,
+        47,
+        64,
+        67,
         66,
+        65,
+        42,
+        40,
+        30,
+        32,
+        31,
+        0,
+        0,
+        0
+    },
+    {
+        0,
+        47,
+        62,
+        60,
+        45,
+        49,
         63,
         57,
         56,
+        59,
         55,
-        65,
-        61,
-        58,
-        45,
-        42,
+        50,
         43,
+        46,
+        52,
+        53,
+        54,
         44,
-        2,
-        4,
-        14,
-        12,
-        13,
-        5,
-        7,
-        8,
+        48,
+        51,
+        64,
+        67,
+        66,
+        65,
+        42,
+        40,
+        30,
+        32,
+        31,
+        39,
+        37,
+        36,
         0,
         0,
         0,
@@ -14146,52 +14665,55 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
-        48,
-        47,
-        41,
-        66,
-        64,
+        44,
         46,
+        48,
+        49,
         54,
-        56,
-        57,
         58,
-        59,
-        52,
+        60,
+        61,
         62,
-        50,
-        53,
-        45,
-        42,
+        69,
         43,
-        44,
-        6
+        45,
+        63,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
+        47,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        38
     },
     {
         0,
-        18,
-        30,
-        29,
+        26,
+        11,
+        12,
+        14,
+        9,
+        10,
         27,
-        32,
-        31,
-        17,
+        24,
+        13,
+        25,
+        8,
         20,
-        28,
-        19,
-        33,
-        26,
+        15,
         21,
+        19,
         23,
-        24,
-        25,
+        18,
+        17,
+        16,
         22,
         0,
         0,
@@ -14330,22 +14852,8 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        47
-    },
-    {
         0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        34,
-        35,
         0,
         0,
         0,
@@ -14355,25 +14863,25 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        47,
-        52,
-        50,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        34,
-        35,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
         0,
         0,
         0,
@@ -14386,97 +14894,131 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        47,
-        52,
-        50
+        62
     },
     {
         0,
-        63,
-        47,
+        64,
+        67,
+        66,
         65,
-        45,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        39,
-        38,
+        40,
+        7,
+        6,
         0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0
+    },
+    {
+        0,
+        62,
+        57,
+        59,
+        64,
+        67,
+        66,
         65,
+        42,
+        40,
         0
     },
     {
         0,
-        49,
+        7,
+        6,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0
+    },
+    {
+        0,
+        62,
+        57,
+        59
+    },
+    {
+        0,
+        62,
+        60,
         45,
-        44,
-        42,
-        43,
         64,
-        47,
-        2,
-        4,
-        14,
-        12,
-        13,
+        67,
+        66,
+        65,
+        32,
+        31,
+        42,
+        40,
+        30,
         0,
         0,
         0
     },
     {
         0,
-        47,
-        49,
+        60,
         64,
+        65,
+        67,
+        66,
         45,
+        62,
         42,
-        43,
-        44,
-        2,
-        4,
-        14,
-        12,
-        13,
+        40,
+        30,
+        32,
+        31,
         0,
         0,
         0
     },
     {
         0,
-        46,
-        45,
-        44,
-        42,
-        43,
-        62,
-        49,
+        63,
         64,
-        60,
-        54,
-        59,
-        53,
-        50,
-        52,
+        65,
+        67,
         66,
-        63,
+        47,
+        60,
+        45,
+        49,
         57,
         56,
+        59,
         55,
-        65,
-        61,
-        58,
-        47,
-        2,
-        4,
-        14,
-        12,
-        13,
-        5,
-        7,
-        8,
+        50,
+        43,
+        46,
+        52,
+        53,
+        54,
+        44,
+        48,
+        51,
+        62,
+        42,
+        40,
+        30,
+        32,
+        31,
+        39,
+        37,
+        36,
         0,
         0,
         0,
@@ -14489,340 +15031,278 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        6,
+        38,
         0
     },
     {
         0,
-        53,
+        46,
+        60,
+        62,
         50,
-        63,
-        47,
-        49,
+        57,
         59,
-        52,
-        45,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
-        52,
-        50,
-        45,
+        57,
+        59,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
+        43,
+        64,
+        67,
         66,
-        45,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
+        40,
         0,
         0
     },
     {
         0,
+        60,
+        43,
+        64,
+        67,
         66,
-        45,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
-        16,
-        15,
-        0,
-        0,
+        40,
         0
     },
     {
         0,
-        49,
+        43,
+        64,
+        67,
         66,
-        45,
+        65,
+        28,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
+        29,
+        0,
+        0,
         0
     },
     {
         0,
-        45,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
+        40,
         0,
         0
     },
     {
         0,
-        47,
-        63,
-        49,
-        59,
-        52,
+        62,
+        46,
+        60,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
-        52,
-        50
+        57,
+        59
     },
     {
         0,
-        66,
-        5,
+        43,
+        39,
         0
     },
     {
         0,
-        66,
-        16,
-        15,
+        43,
+        28,
+        29,
         0,
         0
     },
     {
         0,
-        5,
+        39,
         0
     },
     {
         0,
-        47,
-        49,
-        54,
-        59,
-        52,
+        62,
+        60,
+        55,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
+        43,
+        64,
+        67,
         66,
-        45,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
-        66,
-        52,
+        69,
+        44,
         50,
-        65,
-        61,
-        58,
-        60,
+        51,
+        52,
         53,
+        55,
         63,
-        47,
-        49,
-        59,
         45,
-        42,
         43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        0,
-        66,
-        52,
-        50,
-        57,
-        56,
-        55,
         60,
-        65,
+        49,
         61,
         54,
-        59,
-        53,
+        46,
+        62,
+        48,
         58,
-        63,
+        57,
         47,
-        49,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        0,
+        59,
+        56,
+        64,
+        67,
         66,
         65,
-        61,
-        58,
-        52,
-        50
+        68
     },
     {
         0,
-        46,
-        48,
-        55,
+        69,
+        44,
+        47,
         57,
-        59,
-        61,
+        50,
+        51,
+        52,
+        53,
+        55,
         63,
-        65,
-        41,
-        47,
+        45,
+        43,
+        60,
         49,
+        61,
         54,
-        56,
+        46,
+        62,
+        48,
         58,
-        60,
+        59,
+        56,
         64,
+        67,
         66,
-        51,
-        52,
-        62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
+        65,
+        68
     },
     {
         0,
-        46,
-        47,
+        43,
+        44,
         48,
         49,
-        52,
-        54,
-        56,
-        58,
+        46,
         60,
         62,
-        64,
-        66,
-        41,
-        55,
+        51,
+        50,
         57,
         59,
-        61,
-        63,
+        56,
+        64,
+        67,
+        66,
         65,
-        51,
-        50,
-        53,
-        45,
+        39,
         42,
-        43,
-        44,
-        40
-    },
-    {
+        40,
+        37,
+        36,
+        0,
+        0,
+        0,
+        0,
         0,
-        49,
-        64,
-        45,
-        42,
-        43,
-        44,
-        13,
-        12,
-        2,
-        4,
-        14,
         0,
         0,
         0
     },
     {
         0,
-        66,
-        53,
-        50,
-        63,
-        47,
+        43,
+        54,
         49,
-        59,
+        44,
+        48,
+        46,
+        60,
+        62,
+        55,
+        53,
         52,
+        51,
+        50,
         57,
+        59,
         56,
-        55,
         64,
-        60,
+        67,
+        66,
         65,
-        61,
-        58,
-        45,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -14834,122 +15314,184 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        59,
-        66,
-        54,
-        53,
-        50,
-        52,
-        64,
-        45,
-        42,
         43,
         44,
-        2,
-        4,
-        14,
-        12,
-        13,
-        0,
-        0,
-        0
+        48,
+        51,
+        57,
+        59
     },
     {
         0,
-        47,
-        63,
-        49,
-        66,
-        59,
-        52,
-        50,
-        53,
+        60,
         45,
+        64,
+        67,
+        66,
+        65,
+        31,
+        32,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
+        30,
+        0,
+        0,
         0
     },
     {
         0,
-        52
+        57
     },
     {
         0,
-        47,
-        51,
-        55,
-        61,
-        63,
-        65,
-        41,
+        69,
+        44,
+        54,
+        46,
+        62,
+        58,
         48,
-        60,
+        61,
         49,
-        66,
+        60,
+        43,
+        45,
+        63,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
+        47,
+        59,
+        56,
         64,
+        67,
+        66,
+        65,
+        68
+    },
+    {
+        0,
+        43,
         46,
+        60,
+        62,
         54,
+        45,
+        49,
+        44,
+        48,
+        53,
+        52,
+        51,
+        50,
+        57,
+        59,
         56,
+        64,
+        67,
+        66,
+        65,
+        39,
+        42,
+        40,
+        37,
+        36,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0
+    },
+    {
+        0,
+        43,
+        45,
+        55,
+        50,
         57,
-        58,
         59,
-        52,
+        56,
+        64,
+        67,
+        66,
+        65,
+        32,
+        31,
+        42,
+        40,
+        30,
+        0,
+        0,
+        0
+    },
+    {
+        0,
         62,
+        46,
+        60,
+        43,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        40
+        40,
+        0
     },
     {
         0,
-        59
+        50
     },
     {
         0,
-        54,
-        59,
-        52,
+        55,
         50,
-        53
+        57,
+        59,
+        56
     },
     {
         0,
-        64,
-        12,
-        13,
-        14,
+        45,
+        31,
+        32,
+        30,
         0,
         0
     },
     {
         0,
+        49,
+        48,
+        44,
+        46,
         60,
-        61,
-        53,
+        62,
+        55,
+        51,
         50,
-        63,
-        47,
-        49,
+        57,
         59,
+        56,
+        64,
+        67,
+        66,
         65,
-        52,
-        58,
-        54,
-        45,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -14961,162 +15503,162 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        60,
-        61,
-        63,
-        47,
+        48,
+        44,
+        46,
+        62,
         49,
+        60,
+        51,
+        50,
+        57,
         59,
+        56,
+        64,
+        67,
+        66,
         65,
-        52,
-        58,
-        50,
-        53,
-        45,
+        39,
         42,
-        43,
-        44,
-        5,
-        2,
-        4,
-        7,
-        8,
-        0,
+        40,
+        37,
+        36,
         0,
         0,
         0,
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        65,
-        60,
-        66,
-        5,
         0
     },
     {
         0,
-        57,
-        56,
-        55,
-        60,
-        65,
-        66,
-        61,
         54,
-        59,
+        49,
+        44,
+        43,
+        48,
+        55,
         53,
-        50,
         52,
-        58,
-        45,
+        51,
+        50,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
+        40,
         0,
         0
     },
     {
         0,
-        65,
-        61,
-        60,
-        66,
-        58,
-        5,
+        44,
+        49,
+        43,
+        39,
         0
     },
     {
         0,
-        54,
-        60,
-        65,
-        66,
-        61,
-        58,
-        59,
-        52,
-        50,
-        53,
-        5,
+        44,
+        48,
+        49,
+        43,
+        51,
+        39,
         0
     },
     {
         0,
-        56,
         55,
-        60,
-        65,
-        66,
-        61,
-        54,
+        49,
+        44,
+        43,
+        48,
+        51,
+        50,
         57,
-        58,
         59,
-        52,
-        50,
-        53,
-        5,
+        56,
+        39,
         0
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
+        53,
+        54,
         49,
+        44,
+        43,
         48,
-        47,
-        41,
-        66,
-        64,
+        55,
+        52,
+        51,
+        50,
+        57,
+        59,
+        56,
+        39,
+        0
+    },
+    {
+        0,
+        44,
         46,
+        48,
+        49,
         54,
-        56,
-        57,
         58,
-        59,
-        52,
+        60,
+        61,
         62,
-        50,
-        53,
-        45,
-        42,
+        69,
         43,
-        44
+        45,
+        63,
+        55,
+        53,
+        52,
+        51,
+        50,
+        57,
+        47,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65
     },
     {
         0,
-        63,
-        47,
         49,
-        59,
-        52,
+        48,
+        44,
+        46,
         60,
-        65,
-        66,
-        61,
+        62,
+        43,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15128,26 +15670,26 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
+        62,
+        44,
+        48,
+        46,
+        49,
         60,
-        61,
-        53,
+        43,
         50,
-        63,
-        47,
-        49,
+        57,
         59,
-        65,
-        52,
+        56,
+        64,
+        67,
         66,
-        45,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15159,26 +15701,26 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        63,
-        47,
+        62,
+        44,
+        48,
+        46,
         49,
-        59,
-        52,
         60,
-        65,
-        58,
-        61,
+        51,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15190,34 +15732,34 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        65,
-        60,
-        66
+        44,
+        49,
+        43
     },
     {
         0,
-        54,
-        59,
-        53,
-        50,
-        52,
-        60,
-        63,
-        47,
         49,
-        65,
+        44,
+        46,
+        60,
+        62,
+        43,
+        48,
+        55,
+        51,
+        50,
+        57,
+        59,
+        56,
+        64,
+        67,
         66,
-        61,
-        58,
-        45,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15229,62 +15771,62 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        60,
-        65,
-        66,
-        61,
-        54,
-        59,
-        53,
+        49,
+        44,
+        43,
+        48,
+        55,
+        51,
         50,
-        52,
-        58,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
+        40,
         0,
         0
     },
     {
         0,
-        58
+        51
     },
     {
         0,
-        50
+        59
     },
     {
         0,
-        61,
-        66
+        48,
+        43
     },
     {
         0,
-        47,
-        65,
-        61,
-        63,
+        46,
+        57,
         60,
+        62,
         49,
-        66,
-        58,
-        59,
-        52,
+        44,
+        43,
+        48,
+        51,
         50,
-        53,
-        45,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        5,
-        2,
-        4,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15296,42 +15838,42 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        61,
-        58
+        48,
+        51
     },
     {
         0,
-        66,
-        65
+        43,
+        44
     },
     {
         0,
-        57,
-        56,
-        55,
-        60,
-        65,
-        66,
-        61,
         54,
-        59,
+        49,
+        44,
+        43,
+        48,
+        46,
+        60,
+        62,
+        45,
+        55,
         53,
-        50,
         52,
-        58,
-        63,
-        47,
-        49,
+        51,
+        50,
+        57,
+        59,
+        56,
         64,
-        45,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15343,27 +15885,27 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        63,
-        47,
+        62,
+        44,
+        48,
+        46,
         49,
-        59,
-        52,
         60,
-        65,
-        66,
-        61,
-        58,
+        43,
+        51,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15375,31 +15917,28 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        56,
-        55,
-        64,
-        60,
-        65,
-        66,
-        61,
-        63,
-        47,
+        45,
         49,
+        44,
+        43,
+        48,
+        46,
+        60,
+        62,
+        51,
+        50,
         57,
-        58,
         59,
-        52,
-        50,
-        53,
-        45,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15411,28 +15950,31 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        60,
-        65,
-        66,
-        61,
-        63,
-        47,
+        53,
+        54,
+        45,
         49,
-        64,
-        58,
-        59,
+        44,
+        43,
+        48,
+        46,
+        60,
+        62,
         52,
+        51,
         50,
-        53,
-        45,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        5,
-        2,
-        4,
-        7,
-        8,
+        40,
+        39,
+        37,
+        36,
         0,
         0,
         0,
@@ -15444,28 +15986,28 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        64,
+        49,
+        44,
+        43,
+        48,
+        46,
         60,
-        65,
-        66,
-        61,
-        58,
-        53,
+        62,
+        45,
+        51,
         50,
-        63,
-        47,
-        49,
+        57,
         59,
-        52,
-        45,
+        56,
+        64,
+        67,
+        66,
+        65,
+        39,
         42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
+        40,
+        37,
+        36,
         0,
         0,
         0,
@@ -15477,8 +16019,8 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        11,
-        10,
+        33,
+        34,
         0,
         0,
         0,
@@ -15496,34 +16038,34 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        65,
-        61,
-        60,
-        66,
-        58
+        44,
+        48,
+        49,
+        43,
+        51
     },
     {
         0,
-        66,
-        65,
-        45,
-        42,
         43,
         44,
-        2,
-        4,
+        64,
+        67,
+        66,
+        65,
+        42,
+        40,
         0
     },
     {
         0,
-        66,
-        61,
-        58,
-        65
+        43,
+        48,
+        51,
+        44
     },
     {
         0,
-        9,
+        35,
         0,
         0,
         0,
@@ -15536,830 +16078,711 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
     },
     {
         0,
-        53,
-        50,
-        63,
-        52,
-        45,
+        46,
+        57,
+        59,
+        56,
+        64,
+        67,
+        66,
+        65,
         42,
-        43,
-        44,
-        2,
-        4,
+        40,
         0
     },
     {
         0,
-        63,
-        52,
-        50,
-        53
+        46,
+        57,
+        59,
+        56
     }
 };
 
+#if 0
+/* DFA case-folding flags */
+UNICC_INTERN unsigned char _dfa_fold[ 87 ] =
+{
+
+};
+#endif
+
+#if 0
+/* Accept masks of the states using a shared DFA */
+UNICC_INTERN unsigned char _dfa_mask[ 164 ][ 0 ] =
+{
+
+};
+#endif
+
+#endif
 #endif
 
 /* Symbol information table */
-UNICC_STATIC _syminfo _symbols[] =
+UNICC_INTERN _syminfo _symbols[] =
 {
 	{ /* 0 */ "&eof", "", 3, 0, 0, 1 },
-	{ /* 1 */ "//", "", 2, 0, 0, 1 },
-	{ /* 2 */ "*/", "", 2, 0, 0, 1 },
-	{ /* 3 */ "/*", "", 2, 0, 0, 1 },
-	{ /* 4 */ "[*", "", 2, 0, 0, 1 },
-	{ /* 5 */ "*]", "", 2, 0, 0, 1 },
-	{ /* 6 */ "&eof", "", 2, 0, 0, 1 },
-	{ /* 7 */ "&error", "", 2, 0, 0, 1 },
-	{ /* 8 */ "precedence", "", 2, 0, 0, 1 },
-	{ /* 9 */ "non-greedy", "", 2, 0, 0, 1 },
-	{ /* 10 */ "greedy", "", 2, 0, 0, 1 },
-	{ /* 11 */ ":=", "", 2, 0, 0, 1 },
-	{ /* 12 */ "=>", "", 2, 0, 0, 1 },
-	{ /* 13 */ "->", "", 2, 0, 0, 1 },
-	{ /* 14 */ "off", "", 2, 0, 0, 1 },
-	{ /* 15 */ "on", "", 2, 0, 0, 1 },
-	{ /* 16 */ "extends", "", 2, 0, 0, 1 },
-	{ /* 17 */ "pcb", "", 2, 0, 0, 1 },
-	{ /* 18 */ "epilogue", "", 2, 0, 0, 1 },
-	{ /* 19 */ "prologue", "", 2, 0, 0, 1 },
-	{ /* 20 */ "reserve terminals", "", 2, 0, 0, 1 },
+	{ /* 1 */ "#!", "", 2, 0, 0, 1 },
+	{ /* 2 */ "%!", "", 2, 0, 0, 1 },
+	{ /* 3 */ "mode", "", 2, 0, 0, 1 },
+	{ /* 4 */ "language", "", 2, 0, 0, 1 },
+	{ /* 5 */ "scannerless", "", 2, 0, 0, 1 },
+	{ /* 6 */ "scanner", "", 2, 0, 0, 1 },
+	{ /* 7 */ "whitespaces", "", 2, 0, 0, 1 },
+	{ /* 8 */ "lexeme", "", 2, 0, 0, 1 },
+	{ /* 9 */ "fixate", "", 2, 0, 0, 1 },
+	{ /* 10 */ "left", "", 2, 0, 0, 1 },
+	{ /* 11 */ "right", "", 2, 0, 0, 1 },
+	{ /* 12 */ "nonassoc", "", 2, 0, 0, 1 },
+	{ /* 13 */ "prefix", "", 2, 0, 0, 1 },
+	{ /* 14 */ "default action", "", 2, 0, 0, 1 },
+	{ /* 15 */ "default epsilon action", "", 2, 0, 0, 1 },
+	{ /* 16 */ "default value type", "", 2, 0, 0, 1 },
+	{ /* 17 */ "lexeme separation", "", 2, 0, 0, 1 },
+	{ /* 18 */ "skip whitespaces", "", 2, 0, 0, 1 },
+	{ /* 19 */ "shared lexers", "", 2, 0, 0, 1 },
+	{ /* 20 */ "regular lexemes", "", 2, 0, 0, 1 },
 	{ /* 21 */ "case insensitive strings", "", 2, 0, 0, 1 },
-	{ /* 22 */ "lexeme separation", "", 2, 0, 0, 1 },
-	{ /* 23 */ "default value type", "", 2, 0, 0, 1 },
-	{ /* 24 */ "default epsilon action", "", 2, 0, 0, 1 },
-	{ /* 25 */ "default action", "", 2, 0, 0, 1 },
-	{ /* 26 */ "prefix", "", 2, 0, 0, 1 },
-	{ /* 27 */ "nonassoc", "", 2, 0, 0, 1 },
-	{ /* 28 */ "right", "", 2, 0, 0, 1 },
-	{ /* 29 */ "left", "", 2, 0, 0, 1 },
-	{ /* 30 */ "fixate", "", 2, 0, 0, 1 },
-	{ /* 31 */ "lexeme", "", 2, 0, 0, 1 },
-	{ /* 32 */ "whitespaces", "", 2, 0, 0, 1 },
-	{ /* 33 */ "scanner", "", 2, 0, 0, 1 },
-	{ /* 34 */ "scannerless", "", 2, 0, 0, 1 },
-	{ /* 35 */ "language", "", 2, 0, 0, 1 },
-	{ /* 36 */ "mode", "", 2, 0, 0, 1 },
-	{ /* 37 */ "%!", "", 2, 0, 0, 1 },
-	{ /* 38 */ "#!", "", 2, 0, 0, 1 },
-	{ /* 39 */ "\\x0", "", 1, 0, 0, 1 },
-	{ /* 40 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF", "", 1, 0, 0, 1 },
-	{ /* 41 */ "\\r", "", 1, 0, 0, 1 },
-	{ /* 42 */ "\\n", "", 1, 0, 0, 1 },
-	{ /* 43 */ "\\t", "", 1, 0, 0, 1 },
-	{ /* 44 */ " ", "", 1, 0, 0, 1 },
-	{ /* 45 */ "0-9", "", 1, 0, 0, 1 },
-	{ /* 46 */ "A-Z_a-z", "", 1, 0, 0, 1 },
-	{ /* 47 */ ">", "", 1, 0, 0, 1 },
-	{ /* 48 */ "<", "", 1, 0, 0, 1 },
-	{ /* 49 */ "\"", "", 1, 0, 0, 1 },
-	{ /* 50 */ "\\\\", "", 1, 0, 0, 1 },
-	{ /* 51 */ "'", "", 1, 0, 0, 1 },
-	{ /* 52 */ "!", "", 1, 0, 0, 1 },
-	{ /* 53 */ ".", "", 1, 0, 0, 1 },
-	{ /* 54 */ "?", "", 1, 0, 0, 1 },
-	{ /* 55 */ "+", "", 1, 0, 0, 1 },
-	{ /* 56 */ "*", "", 1, 0, 0, 1 },
-	{ /* 57 */ ")", "", 1, 0, 0, 1 },
-	{ /* 58 */ "(", "", 1, 0, 0, 1 },
-	{ /* 59 */ "=", "", 1, 0, 0, 1 },
-	{ /* 60 */ "|", "", 1, 0, 0, 1 },
-	{ /* 61 */ "$", "", 1, 0, 0, 1 },
-	{ /* 62 */ "@", "", 1, 0, 0, 1 },
-	{ /* 63 */ ":", "", 1, 0, 0, 1 },
-	{ /* 64 */ "#%", "", 1, 0, 0, 1 },
-	{ /* 65 */ ";", "", 1, 0, 0, 1 },
-	{ /* 66 */ "\\x0#%#", "", 0, 0, 0, 1 },
-	{ /* 67 */ ":-;#", "", 0, 0, 0, 1 },
-	{ /* 68 */ "\\x0#%@#", "", 0, 0, 0, 1 },
-	{ /* 69 */ "$:-;#", "", 0, 0, 0, 1 },
-	{ /* 70 */ "\\x0#%@|#", "", 0, 0, 0, 1 },
-	{ /* 71 */ "$:-;=#", "", 0, 0, 0, 1 },
-	{ /* 72 */ "\\x0#%(@|#", "", 0, 0, 0, 1 },
-	{ /* 73 */ "$):-;=#", "", 0, 0, 0, 1 },
-	{ /* 74 */ "\\x0#%(*@|#", "", 0, 0, 0, 1 },
-	{ /* 75 */ "$)+:-;=#", "", 0, 0, 0, 1 },
-	{ /* 76 */ "\\x0#%(*?-@|#", "", 0, 0, 0, 1 },
-	{ /* 77 */ "$)+.:-;=#", "", 0, 0, 0, 1 },
-	{ /* 78 */ "$)+.:-=#", "", 0, 0, 0, 1 },
-	{ /* 79 */ "$)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 80 */ "0-9>#", "", 0, 0, 0, 1 },
-	{ /* 81 */ " $)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 82 */ "\\x0!#%(*?-@|#", "", 0, 0, 0, 1 },
-	{ /* 83 */ "\\r $)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 84 */ "\"'#", "", 0, 0, 0, 1 },
-	{ /* 85 */ "\\t0-9>#", "", 0, 0, 0, 1 },
-	{ /* 86 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 87 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 88 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 89 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 90 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 91 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 92 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 93 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 94 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 95 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 96 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 97 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 98 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 99 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 100 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 101 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 102 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 103 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 104 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 105 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 106 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 107 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 108 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 109 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 110 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 111 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 112 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 113 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 114 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 115 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 116 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 117 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 118 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 119 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 120 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 121 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 122 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 123 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 124 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 125 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 126 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 127 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 128 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 129 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 130 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 131 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 132 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 133 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 134 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 135 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 136 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 137 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 138 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 139 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 140 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 141 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 142 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 143 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 144 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 145 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 146 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 147 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 148 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 149 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 150 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 151 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 152 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 153 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 154 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 155 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 156 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 157 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 158 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 159 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 160 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 161 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 162 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 163 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 164 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 165 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 166 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 167 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 168 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 169 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 170 */ "\\x0-\\b\\v-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 171 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 172 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 173 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 174 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 175 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 176 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 177 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 178 */ "\\x0-\\t\\v-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 179 */ "\\x1-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 180 */ "\\x0-\\t\\v-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 181 */ "\\x0-\\t\\v-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 182 */ "grammar_spec''", "", 0, 0, 0, 1 },
-	{ /* 183 */ "scanner'", "", 0, 0, 0, 1 },
-	{ /* 184 */ "scannerless'", "", 0, 0, 0, 1 },
-	{ /* 185 */ "language'", "", 0, 0, 0, 1 },
-	{ /* 186 */ "mode'", "", 0, 0, 0, 1 },
-	{ /* 187 */ "%!'", "", 0, 0, 0, 1 },
-	{ /* 188 */ "#!'", "", 0, 0, 0, 1 },
-	{ /* 189 */ "$'", "", 0, 0, 0, 1 },
-	{ /* 190 */ ":='", "", 0, 0, 0, 1 },
-	{ /* 191 */ "=>'", "", 0, 0, 0, 1 },
-	{ /* 192 */ "->'", "", 0, 0, 0, 1 },
-	{ /* 193 */ ".'", "", 0, 0, 0, 1 },
-	{ /* 194 */ "ccl'", "", 0, 0, 0, 1 },
+	{ /* 22 */ "reserve terminals", "", 2, 0, 0, 1 },
+	{ /* 23 */ "prologue", "", 2, 0, 0, 1 },
+	{ /* 24 */ "epilogue", "", 2, 0, 0, 1 },
+	{ /* 25 */ "pcb", "", 2, 0, 0, 1 },
+	{ /* 26 */ "extends", "", 2, 0, 0, 1 },
+	{ /* 27 */ "on", "", 2, 0, 0, 1 },
+	{ /* 28 */ "off", "", 2, 0, 0, 1 },
+	{ /* 29 */ "->", "", 2, 0, 0, 1 },
+	{ /* 30 */ "=>", "", 2, 0, 0, 1 },
+	{ /* 31 */ ":=", "", 2, 0, 0, 1 },
+	{ /* 32 */ "greedy", "", 2, 0, 0, 1 },
+	{ /* 33 */ "non-greedy", "", 2, 0, 0, 1 },
+	{ /* 34 */ "precedence", "", 2, 0, 0, 1 },
+	{ /* 35 */ "&error", "", 2, 0, 0, 1 },
+	{ /* 36 */ "&eof", "", 2, 0, 0, 1 },
+	{ /* 37 */ "*]", "", 2, 0, 0, 1 },
+	{ /* 38 */ "[*", "", 2, 0, 0, 1 },
+	{ /* 39 */ "/*", "", 2, 0, 0, 1 },
+	{ /* 40 */ "*/", "", 2, 0, 0, 1 },
+	{ /* 41 */ "//", "", 2, 0, 0, 1 },
+	{ /* 42 */ ";", "", 1, 0, 0, 1 },
+	{ /* 43 */ "#%", "", 1, 0, 0, 1 },
+	{ /* 44 */ ":", "", 1, 0, 0, 1 },
+	{ /* 45 */ "@", "", 1, 0, 0, 1 },
+	{ /* 46 */ "$", "", 1, 0, 0, 1 },
+	{ /* 47 */ "|", "", 1, 0, 0, 1 },
+	{ /* 48 */ "=", "", 1, 0, 0, 1 },
+	{ /* 49 */ "(", "", 1, 0, 0, 1 },
+	{ /* 50 */ ")", "", 1, 0, 0, 1 },
+	{ /* 51 */ "*", "", 1, 0, 0, 1 },
+	{ /* 52 */ "+", "", 1, 0, 0, 1 },
+	{ /* 53 */ "?", "", 1, 0, 0, 1 },
+	{ /* 54 */ ".", "", 1, 0, 0, 1 },
+	{ /* 55 */ "!", "", 1, 0, 0, 1 },
+	{ /* 56 */ "'", "", 1, 0, 0, 1 },
+	{ /* 57 */ "\\\\", "", 1, 0, 0, 1 },
+	{ /* 58 */ "\"", "", 1, 0, 0, 1 },
+	{ /* 59 */ "<", "", 1, 0, 0, 1 },
+	{ /* 60 */ ">", "", 1, 0, 0, 1 },
+	{ /* 61 */ "A-Z_a-z", "", 1, 0, 0, 1 },
+	{ /* 62 */ "0-9", "", 1, 0, 0, 1 },
+	{ /* 63 */ " ", "", 1, 0, 0, 1 },
+	{ /* 64 */ "\\t", "", 1, 0, 0, 1 },
+	{ /* 65 */ "\\n", "", 1, 0, 0, 1 },
+	{ /* 66 */ "\\r", "", 1, 0, 0, 1 },
+	{ /* 67 */ "\\x0", "", 1, 0, 0, 1 },
+	{ /* 68 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF", "", 1, 0, 0, 1 },
+	{ /* 69 */ "\\x0-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 70 */ "\\x1-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 71 */ "\\x0-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 72 */ "\\x0-=?-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 73 */ "0-9A-Z_a-z#", "", 0, 0, 0, 1 },
+	{ /* 74 */ "\\x0-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 75 */ "terminal", "", 0, 1, 0, 1 },
+	{ /* 76 */ "identifier", "", 0, 1, 0, 1 },
+	{ /* 77 */ "modifier", "", 0, 1, 0, 1 },
+	{ /* 78 */ "code", "", 0, 1, 0, 1 },
+	{ /* 79 */ "ccl_string", "", 0, 1, 0, 1 },
+	{ /* 80 */ "kw", "", 0, 1, 0, 1 },
+	{ /* 81 */ "type", "", 0, 1, 0, 1 },
+	{ /* 82 */ "grammar_spec", "", 0, 0, 0, 1 },
+	{ /* 83 */ "fixed_directive_def", "", 0, 0, 0, 1 },
+	{ /* 84 */ "fixed_directive_def+", "", 0, 0, 0, 1 },
+	{ /* 85 */ "fixed_directive_def*", "", 0, 0, 0, 1 },
+	{ /* 86 */ "segment", "", 0, 0, 0, 1 },
+	{ /* 87 */ "segment+", "", 0, 0, 0, 1 },
+	{ /* 88 */ "segment*", "", 0, 0, 0, 1 },
+	{ /* 89 */ "fixed_directive", "", 0, 0, 0, 1 },
+	{ /* 90 */ "mode_type", "", 0, 0, 0, 1 },
+	{ /* 91 */ "string_or_ident", "", 0, 0, 0, 1 },
+	{ /* 92 */ "definition", "", 0, 0, 0, 1 },
+	{ /* 93 */ "unfixed_directive", "", 0, 0, 0, 1 },
+	{ /* 94 */ "directive_parms", "", 0, 0, 0, 1 },
+	{ /* 95 */ "symbol_list", "", 0, 0, 0, 1 },
+	{ /* 96 */ "string", "", 0, 0, 0, 1 },
+	{ /* 97 */ "code_opt", "", 0, 0, 0, 1 },
+	{ /* 98 */ "boolean_opt", "", 0, 0, 0, 1 },
+	{ /* 99 */ "boolean", "", 0, 0, 0, 1 },
+	{ /* 100 */ "sym", "", 0, 0, 0, 1 },
+	{ /* 101 */ "lhs", "", 0, 0, 0, 1 },
+	{ /* 102 */ "alt_lhs_list", "", 0, 0, 0, 1 },
+	{ /* 103 */ "alt_regex_sym", "", 0, 0, 0, 1 },
+	{ /* 104 */ "regex_sym", "", 0, 0, 0, 1 },
+	{ /* 105 */ "defines", "", 0, 0, 0, 1 },
+	{ /* 106 */ "goal_mark", "", 0, 0, 0, 1 },
+	{ /* 107 */ "alt_lhs_list?", "", 0, 0, 0, 1 },
+	{ /* 108 */ "productions", "", 0, 0, 0, 1 },
+	{ /* 109 */ "regex", "", 0, 0, 0, 1 },
+	{ /* 110 */ "ast_node", "", 0, 0, 0, 1 },
+	{ /* 111 */ "sym_option", "", 0, 0, 0, 1 },
+	{ /* 112 */ "sym_option+", "", 0, 0, 0, 1 },
+	{ /* 113 */ "sym_option*", "", 0, 0, 0, 1 },
+	{ /* 114 */ "production", "", 0, 0, 0, 1 },
+	{ /* 115 */ "line_number", "", 0, 0, 0, 1 },
+	{ /* 116 */ "rhs_opt", "", 0, 0, 0, 1 },
+	{ /* 117 */ "code_opt_dup", "", 0, 0, 0, 1 },
+	{ /* 118 */ "prod_directives", "", 0, 0, 0, 1 },
+	{ /* 119 */ "prod_directives+", "", 0, 0, 0, 1 },
+	{ /* 120 */ "prod_directives*", "", 0, 0, 0, 1 },
+	{ /* 121 */ "rhs", "", 0, 0, 0, 1 },
+	{ /* 122 */ "symbol", "", 0, 0, 0, 1 },
+	{ /* 123 */ "access_name", "", 0, 0, 0, 1 },
+	{ /* 124 */ "stack_cur_prod", "", 0, 0, 0, 1 },
+	{ /* 125 */ "ccl", "", 0, 1, 0, 1 },
+	{ /* 126 */ "string_single", "", 0, 0, 0, 1 },
+	{ /* 127 */ "re_alt", "", 0, 0, 0, 1 },
+	{ /* 128 */ "re_expr", "", 0, 0, 0, 1 },
+	{ /* 129 */ "re_modifier", "", 0, 0, 0, 1 },
+	{ /* 130 */ "re_factor", "", 0, 0, 0, 1 },
+	{ /* 131 */ "string_single+", "", 0, 0, 0, 1 },
+	{ /* 132 */ "ccl_str", "", 0, 1, 0, 1 },
+	{ /* 133 */ "ccl_char", "", 0, 1, 0, 1 },
+	{ /* 134 */ "kw_str", "", 0, 1, 0, 1 },
+	{ /* 135 */ "kw_char", "", 0, 1, 0, 1 },
+	{ /* 136 */ "type_str", "", 0, 1, 0, 1 },
+	{ /* 137 */ "identifier_start", "", 0, 1, 0, 1 },
+	{ /* 138 */ "identifier_follow", "", 0, 1, 0, 1 },
+	{ /* 139 */ "code_begin", "", 0, 1, 0, 1 },
+	{ /* 140 */ "inner_code_opt", "", 0, 1, 0, 1 },
+	{ /* 141 */ "inner_code", "", 0, 1, 0, 1 },
+	{ /* 142 */ "anychar", "", 0, 1, 0, 1 },
+	{ /* 143 */ "comment", "", 0, 1, 0, 1 },
+	{ /* 144 */ "comment?", "", 0, 1, 0, 1 },
+	{ /* 145 */ "scomment", "", 0, 1, 0, 1 },
+	{ /* 146 */ "scomment?", "", 0, 1, 0, 1 },
+	{ /* 147 */ "grammar_spec'", "", 0, 0, 0, 1 },
+	{ /* 148 */ "&whitespace", "", 0, 1, 1, 1 },
+	{ /* 149 */ "&whitespace+", "", 0, 1, 1, 1 },
+	{ /* 150 */ "&whitespace*", "", 0, 1, 1, 1 },
+	{ /* 151 */ "code'", "", 0, 0, 0, 1 },
+	{ /* 152 */ ";'", "", 0, 0, 0, 1 },
+	{ /* 153 */ "#%'", "", 0, 0, 0, 1 },
+	{ /* 154 */ "whitespaces'", "", 0, 0, 0, 1 },
+	{ /* 155 */ "lexeme'", "", 0, 0, 0, 1 },
+	{ /* 156 */ "fixate'", "", 0, 0, 0, 1 },
+	{ /* 157 */ "left'", "", 0, 0, 0, 1 },
+	{ /* 158 */ "right'", "", 0, 0, 0, 1 },
+	{ /* 159 */ "nonassoc'", "", 0, 0, 0, 1 },
+	{ /* 160 */ "prefix'", "", 0, 0, 0, 1 },
+	{ /* 161 */ "default action'", "", 0, 0, 0, 1 },
+	{ /* 162 */ "default epsilon action'", "", 0, 0, 0, 1 },
+	{ /* 163 */ "default value type'", "", 0, 0, 0, 1 },
+	{ /* 164 */ "type'", "", 0, 0, 0, 1 },
+	{ /* 165 */ "lexeme separation'", "", 0, 0, 0, 1 },
+	{ /* 166 */ "skip whitespaces'", "", 0, 0, 0, 1 },
+	{ /* 167 */ "shared lexers'", "", 0, 0, 0, 1 },
+	{ /* 168 */ "regular lexemes'", "", 0, 0, 0, 1 },
+	{ /* 169 */ "case insensitive strings'", "", 0, 0, 0, 1 },
+	{ /* 170 */ "reserve terminals'", "", 0, 0, 0, 1 },
+	{ /* 171 */ "prologue'", "", 0, 0, 0, 1 },
+	{ /* 172 */ "epilogue'", "", 0, 0, 0, 1 },
+	{ /* 173 */ "pcb'", "", 0, 0, 0, 1 },
+	{ /* 174 */ "extends'", "", 0, 0, 0, 1 },
+	{ /* 175 */ "on'", "", 0, 0, 0, 1 },
+	{ /* 176 */ "off'", "", 0, 0, 0, 1 },
+	{ /* 177 */ "ccl_string'", "", 0, 0, 0, 1 },
+	{ /* 178 */ "kw'", "", 0, 0, 0, 1 },
+	{ /* 179 */ "terminal'", "", 0, 0, 0, 1 },
+	{ /* 180 */ "identifier'", "", 0, 0, 0, 1 },
+	{ /* 181 */ "('", "", 0, 0, 0, 1 },
+	{ /* 182 */ ")'", "", 0, 0, 0, 1 },
+	{ /* 183 */ "|'", "", 0, 0, 0, 1 },
+	{ /* 184 */ "precedence'", "", 0, 0, 0, 1 },
+	{ /* 185 */ "='", "", 0, 0, 0, 1 },
+	{ /* 186 */ ":'", "", 0, 0, 0, 1 },
+	{ /* 187 */ "modifier'", "", 0, 0, 0, 1 },
+	{ /* 188 */ "&error'", "", 0, 0, 0, 1 },
+	{ /* 189 */ "&eof'", "", 0, 0, 0, 1 },
+	{ /* 190 */ "@'", "", 0, 0, 0, 1 },
+	{ /* 191 */ "greedy'", "", 0, 0, 0, 1 },
+	{ /* 192 */ "non-greedy'", "", 0, 0, 0, 1 },
+	{ /* 193 */ "*'", "", 0, 0, 0, 1 },
+	{ /* 194 */ "+'", "", 0, 0, 0, 1 },
 	{ /* 195 */ "?'", "", 0, 0, 0, 1 },
-	{ /* 196 */ "+'", "", 0, 0, 0, 1 },
-	{ /* 197 */ "*'", "", 0, 0, 0, 1 },
-	{ /* 198 */ "non-greedy'", "", 0, 0, 0, 1 },
-	{ /* 199 */ "greedy'", "", 0, 0, 0, 1 },
-	{ /* 200 */ "@'", "", 0, 0, 0, 1 },
-	{ /* 201 */ "&eof'", "", 0, 0, 0, 1 },
-	{ /* 202 */ "&error'", "", 0, 0, 0, 1 },
-	{ /* 203 */ "modifier'", "", 0, 0, 0, 1 },
-	{ /* 204 */ ":'", "", 0, 0, 0, 1 },
-	{ /* 205 */ "='", "", 0, 0, 0, 1 },
-	{ /* 206 */ "precedence'", "", 0, 0, 0, 1 },
-	{ /* 207 */ "|'", "", 0, 0, 0, 1 },
-	{ /* 208 */ ")'", "", 0, 0, 0, 1 },
-	{ /* 209 */ "('", "", 0, 0, 0, 1 },
-	{ /* 210 */ "identifier'", "", 0, 0, 0, 1 },
-	{ /* 211 */ "terminal'", "", 0, 0, 0, 1 },
-	{ /* 212 */ "kw'", "", 0, 0, 0, 1 },
-	{ /* 213 */ "ccl_string'", "", 0, 0, 0, 1 },
-	{ /* 214 */ "off'", "", 0, 0, 0, 1 },
-	{ /* 215 */ "on'", "", 0, 0, 0, 1 },
-	{ /* 216 */ "extends'", "", 0, 0, 0, 1 },
-	{ /* 217 */ "pcb'", "", 0, 0, 0, 1 },
-	{ /* 218 */ "epilogue'", "", 0, 0, 0, 1 },
-	{ /* 219 */ "prologue'", "", 0, 0, 0, 1 },
-	{ /* 220 */ "reserve terminals'", "", 0, 0, 0, 1 },
-	{ /* 221 */ "case insensitive strings'", "", 0, 0, 0, 1 },
-	{ /* 222 */ "lexeme separation'", "", 0, 0, 0, 1 },
-	{ /* 223 */ "type'", "", 0, 0, 0, 1 },
-	{ /* 224 */ "default value type'", "", 0, 0, 0, 1 },
-	{ /* 225 */ "default epsilon action'", "", 0, 0, 0, 1 },
-	{ /* 226 */ "default action'", "", 0, 0, 0, 1 },
-	{ /* 227 */ "prefix'", "", 0, 0, 0, 1 },
-	{ /* 228 */ "nonassoc'", "", 0, 0, 0, 1 },
-	{ /* 229 */ "right'", "", 0, 0, 0, 1 },
-	{ /* 230 */ "left'", "", 0, 0, 0, 1 },
-	{ /* 231 */ "fixate'", "", 0, 0, 0, 1 },
-	{ /* 232 */ "lexeme'", "", 0, 0, 0, 1 },
-	{ /* 233 */ "whitespaces'", "", 0, 0, 0, 1 },
-	{ /* 234 */ "#%'", "", 0, 0, 0, 1 },
-	{ /* 235 */ ";'", "", 0, 0, 0, 1 },
-	{ /* 236 */ "code'", "", 0, 0, 0, 1 },
-	{ /* 237 */ "&whitespace*", "", 0, 1, 1, 1 },
-	{ /* 238 */ "&whitespace+", "", 0, 1, 1, 1 },
-	{ /* 239 */ "&whitespace", "", 0, 1, 1, 1 },
-	{ /* 240 */ "grammar_spec'", "", 0, 0, 0, 1 },
-	{ /* 241 */ "\\x0-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 242 */ "scomment?", "", 0, 1, 0, 1 },
-	{ /* 243 */ "scomment", "", 0, 1, 0, 1 },
-	{ /* 244 */ "comment?", "", 0, 1, 0, 1 },
-	{ /* 245 */ "comment", "", 0, 1, 0, 1 },
-	{ /* 246 */ "anychar", "", 0, 1, 0, 1 },
-	{ /* 247 */ "inner_code", "", 0, 1, 0, 1 },
-	{ /* 248 */ "inner_code_opt", "", 0, 1, 0, 1 },
-	{ /* 249 */ "code_begin", "", 0, 1, 0, 1 },
-	{ /* 250 */ "integer", "", 0, 0, 0, 1 },
-	{ /* 251 */ "0-9A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 252 */ "identifier_follow", "", 0, 1, 0, 1 },
-	{ /* 253 */ "identifier_start", "", 0, 1, 0, 1 },
-	{ /* 254 */ "\\x0-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 255 */ "type_str", "", 0, 1, 0, 1 },
-	{ /* 256 */ "\\x0-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 257 */ "kw_char", "", 0, 1, 0, 1 },
-	{ /* 258 */ "kw_str", "", 0, 1, 0, 1 },
-	{ /* 259 */ "\\x1-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 260 */ "\\x0-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 261 */ "ccl_char", "", 0, 1, 0, 1 },
-	{ /* 262 */ "ccl_str", "", 0, 1, 0, 1 },
-	{ /* 263 */ "string_single+", "", 0, 0, 0, 1 },
-	{ /* 264 */ "re_factor", "", 0, 0, 0, 1 },
-	{ /* 265 */ "re_modifier", "", 0, 0, 0, 1 },
-	{ /* 266 */ "re_expr", "", 0, 0, 0, 1 },
-	{ /* 267 */ "re_alt", "", 0, 0, 0, 1 },
-	{ /* 268 */ "string_single", "", 0, 0, 0, 1 },
-	{ /* 269 */ "ccl", "", 0, 1, 0, 1 },
-	{ /* 270 */ "stack_cur_prod", "", 0, 0, 0, 1 },
-	{ /* 271 */ "access_name", "", 0, 0, 0, 1 },
-	{ /* 272 */ "symbol", "", 0, 0, 0, 1 },
-	{ /* 273 */ "rhs", "", 0, 0, 0, 1 },
-	{ /* 274 */ "prod_directives*", "", 0, 0, 0, 1 },
-	{ /* 275 */ "prod_directives+", "", 0, 0, 0, 1 },
-	{ /* 276 */ "prod_directives", "", 0, 0, 0, 1 },
-	{ /* 277 */ "code_opt_dup", "", 0, 0, 0, 1 },
-	{ /* 278 */ "rhs_opt", "", 0, 0, 0, 1 },
-	{ /* 279 */ "line_number", "", 0, 0, 0, 1 },
-	{ /* 280 */ "production", "", 0, 0, 0, 1 },
-	{ /* 281 */ "sym_option*", "", 0, 0, 0, 1 },
-	{ /* 282 */ "sym_option+", "", 0, 0, 0, 1 },
-	{ /* 283 */ "sym_option", "", 0, 0, 0, 1 },
-	{ /* 284 */ "ast_node", "", 0, 0, 0, 1 },
-	{ /* 285 */ "regex", "", 0, 0, 0, 1 },
-	{ /* 286 */ "productions", "", 0, 0, 0, 1 },
-	{ /* 287 */ "alt_lhs_list?", "", 0, 0, 0, 1 },
-	{ /* 288 */ "goal_mark", "", 0, 0, 0, 1 },
-	{ /* 289 */ "defines", "", 0, 0, 0, 1 },
-	{ /* 290 */ "regex_sym", "", 0, 0, 0, 1 },
-	{ /* 291 */ "alt_regex_sym", "", 0, 0, 0, 1 },
-	{ /* 292 */ "alt_lhs_list", "", 0, 0, 0, 1 },
-	{ /* 293 */ "lhs", "", 0, 0, 0, 1 },
-	{ /* 294 */ "sym", "", 0, 0, 0, 1 },
-	{ /* 295 */ "boolean", "", 0, 0, 0, 1 },
-	{ /* 296 */ "boolean_opt", "", 0, 0, 0, 1 },
-	{ /* 297 */ "code_opt", "", 0, 0, 0, 1 },
-	{ /* 298 */ "string", "", 0, 0, 0, 1 },
-	{ /* 299 */ "symbol_list", "", 0, 0, 0, 1 },
-	{ /* 300 */ "directive_parms", "", 0, 0, 0, 1 },
-	{ /* 301 */ "unfixed_directive", "", 0, 0, 0, 1 },
-	{ /* 302 */ "definition", "", 0, 0, 0, 1 },
-	{ /* 303 */ "string_or_ident", "", 0, 0, 0, 1 },
-	{ /* 304 */ "mode_type", "", 0, 0, 0, 1 },
-	{ /* 305 */ "fixed_directive", "", 0, 0, 0, 1 },
-	{ /* 306 */ "segment*", "", 0, 0, 0, 1 },
-	{ /* 307 */ "segment+", "", 0, 0, 0, 1 },
-	{ /* 308 */ "segment", "", 0, 0, 0, 1 },
-	{ /* 309 */ "fixed_directive_def*", "", 0, 0, 0, 1 },
-	{ /* 310 */ "fixed_directive_def+", "", 0, 0, 0, 1 },
-	{ /* 311 */ "fixed_directive_def", "", 0, 0, 0, 1 },
-	{ /* 312 */ "grammar_spec", "", 0, 0, 0, 1 },
-	{ /* 313 */ "type", "", 0, 1, 0, 1 },
-	{ /* 314 */ "kw", "", 0, 1, 0, 1 },
-	{ /* 315 */ "ccl_string", "", 0, 1, 0, 1 },
-	{ /* 316 */ "code", "", 0, 1, 0, 1 },
-	{ /* 317 */ "modifier", "", 0, 1, 0, 1 },
-	{ /* 318 */ "identifier", "", 0, 1, 0, 1 },
-	{ /* 319 */ "terminal", "", 0, 1, 0, 1 },
-	{ /* 320 */ "whitespace", "", 0, 1, 1, 1 }
+	{ /* 196 */ "ccl'", "", 0, 0, 0, 1 },
+	{ /* 197 */ ".'", "", 0, 0, 0, 1 },
+	{ /* 198 */ "->'", "", 0, 0, 0, 1 },
+	{ /* 199 */ "=>'", "", 0, 0, 0, 1 },
+	{ /* 200 */ ":='", "", 0, 0, 0, 1 },
+	{ /* 201 */ "$'", "", 0, 0, 0, 1 },
+	{ /* 202 */ "#!'", "", 0, 0, 0, 1 },
+	{ /* 203 */ "%!'", "", 0, 0, 0, 1 },
+	{ /* 204 */ "mode'", "", 0, 0, 0, 1 },
+	{ /* 205 */ "language'", "", 0, 0, 0, 1 },
+	{ /* 206 */ "scannerless'", "", 0, 0, 0, 1 },
+	{ /* 207 */ "scanner'", "", 0, 0, 0, 1 },
+	{ /* 208 */ "grammar_spec''", "", 0, 0, 0, 1 },
+	{ /* 209 */ "whitespace", "", 0, 1, 1, 1 }
 };
 
 /* Production information table */
-UNICC_STATIC _prodinfo _productions[] =
+UNICC_INTERN _prodinfo _productions[] =
 {
-	{ /* 0 */ "fixed_directive_def+ : fixed_directive_def+ fixed_directive_def", "", 2, 310 },
-	{ /* 1 */ "fixed_directive_def+ : fixed_directive_def", "", 1, 310 },
-	{ /* 2 */ "fixed_directive_def* : fixed_directive_def+", "", 1, 309 },
-	{ /* 3 */ "fixed_directive_def* : ", "", 0, 309 },
-	{ /* 4 */ "grammar_spec : fixed_directive_def* segment*", "", 2, 312 },
-	{ /* 5 */ "segment+ : segment+ segment", "", 2, 307 },
-	{ /* 6 */ "segment+ : segment", "", 1, 307 },
-	{ /* 7 */ "segment* : segment+", "", 1, 306 },
-	{ /* 8 */ "segment* : ", "", 0, 306 },
-	{ /* 9 */ "fixed_directive_def : #!' fixed_directive ;'", "", 3, 311 },
-	{ /* 10 */ "fixed_directive_def : %!' fixed_directive ;'", "", 3, 311 },
-	{ /* 11 */ "fixed_directive : mode' mode_type", "", 2, 305 },
-	{ /* 12 */ "fixed_directive : language' string_or_ident", "", 2, 305 },
-	{ /* 13 */ "mode_type : scannerless'", "", 1, 304 },
-	{ /* 14 */ "mode_type : scanner'", "", 1, 304 },
-	{ /* 15 */ "segment : code'", "", 1, 308 },
-	{ /* 16 */ "segment : definition ;'", "", 2, 308 },
-	{ /* 17 */ "segment : unfixed_directive ;'", "", 2, 308 },
-	{ /* 18 */ "unfixed_directive : #%' directive_parms", "", 2, 301 },
-	{ /* 19 */ "directive_parms : whitespaces' symbol_list", "", 2, 300 },
-	{ /* 20 */ "directive_parms : lexeme' symbol_list", "", 2, 300 },
-	{ /* 21 */ "directive_parms : fixate' symbol_list", "", 2, 300 },
-	{ /* 22 */ "directive_parms : left' symbol_list", "", 2, 300 },
-	{ /* 23 */ "directive_parms : right' symbol_list", "", 2, 300 },
-	{ /* 24 */ "directive_parms : nonassoc' symbol_list", "", 2, 300 },
-	{ /* 25 */ "directive_parms : prefix' string", "", 2, 300 },
-	{ /* 26 */ "directive_parms : default action' code_opt", "", 2, 300 },
-	{ /* 27 */ "directive_parms : default epsilon action' code_opt", "", 2, 300 },
-	{ /* 28 */ "directive_parms : default value type' type'", "", 2, 300 },
-	{ /* 29 */ "directive_parms : lexeme separation' boolean_opt", "", 2, 300 },
-	{ /* 30 */ "directive_parms : case insensitive strings' boolean_opt", "", 2, 300 },
-	{ /* 31 */ "directive_parms : reserve terminals' boolean_opt", "", 2, 300 },
-	{ /* 32 */ "directive_parms : prologue' code'", "", 2, 300 },
-	{ /* 33 */ "directive_parms : epilogue' code'", "", 2, 300 },
-	{ /* 34 */ "directive_parms : pcb' code'", "", 2, 300 },
-	{ /* 35 */ "directive_parms : extends' string", "", 2, 300 },
-	{ /* 36 */ "boolean_opt : boolean", "", 1, 296 },
-	{ /* 37 */ "boolean_opt : ", "", 0, 296 },
-	{ /* 38 */ "boolean : on'", "", 1, 295 },
-	{ /* 39 */ "boolean : off'", "", 1, 295 },
-	{ /* 40 */ "symbol_list : symbol_list sym", "", 2, 299 },
-	{ /* 41 */ "symbol_list : sym", "", 1, 299 },
-	{ /* 42 */ "lhs : identifier'", "", 1, 293 },
-	{ /* 43 */ "alt_lhs_list : alt_lhs_list lhs", "", 2, 292 },
-	{ /* 44 */ "alt_lhs_list : lhs", "", 1, 292 },
-	{ /* 45 */ "alt_regex_sym : alt_regex_sym regex_sym", "", 2, 291 },
-	{ /* 46 */ "alt_regex_sym : regex_sym", "", 1, 291 },
-	{ /* 47 */ "regex_sym : identifier'", "", 1, 290 },
-	{ /* 48 */ "defines : ->'", "", 1, 289 },
-	{ /* 49 */ "defines : :'", "", 1, 289 },
-	{ /* 50 */ "defines : =>'", "", 1, 289 },
-	{ /* 51 */ "defines : :='", "", 1, 289 },
-	{ /* 52 */ "definition : lhs goal_mark alt_lhs_list? type' defines productions", "", 6, 302 },
-	{ /* 53 */ "alt_lhs_list? : alt_lhs_list", "", 1, 287 },
-	{ /* 54 */ "alt_lhs_list? : ", "", 0, 287 },
-	{ /* 55 */ "definition : @' alt_regex_sym type' regex code_opt ast_node sym_option*", "", 7, 302 },
-	{ /* 56 */ "sym_option+ : sym_option+ sym_option", "", 2, 282 },
-	{ /* 57 */ "sym_option+ : sym_option", "", 1, 282 },
-	{ /* 58 */ "sym_option* : sym_option+", "", 1, 281 },
-	{ /* 59 */ "sym_option* : ", "", 0, 281 },
-	{ /* 60 */ "sym_option : #%' greedy'", "", 2, 283 },
-	{ /* 61 */ "sym_option : #%' non-greedy'", "", 2, 283 },
-	{ /* 62 */ "goal_mark : $'", "", 1, 288 },
-	{ /* 63 */ "goal_mark : ", "", 0, 288 },
-	{ /* 64 */ "productions : productions |' production", "", 3, 286 },
-	{ /* 65 */ "productions : production", "", 1, 286 },
-	{ /* 66 */ "ast_node : =' identifier'", "", 2, 284 },
-	{ /* 67 */ "ast_node : =' string", "", 2, 284 },
-	{ /* 68 */ "ast_node : ", "", 0, 284 },
-	{ /* 69 */ "production : line_number rhs_opt code_opt_dup ast_node prod_directives*", "", 5, 280 },
-	{ /* 70 */ "prod_directives+ : prod_directives+ prod_directives", "", 2, 275 },
-	{ /* 71 */ "prod_directives+ : prod_directives", "", 1, 275 },
-	{ /* 72 */ "prod_directives* : prod_directives+", "", 1, 274 },
-	{ /* 73 */ "prod_directives* : ", "", 0, 274 },
-	{ /* 74 */ "rhs_opt : rhs", "", 1, 278 },
-	{ /* 75 */ "rhs_opt : ", "", 0, 278 },
-	{ /* 76 */ "prod_directives : #%' precedence' terminal'", "", 3, 276 },
-	{ /* 77 */ "rhs : rhs symbol access_name", "", 3, 273 },
-	{ /* 78 */ "rhs : symbol access_name", "", 2, 273 },
-	{ /* 79 */ "symbol : sym modifier'", "", 2, 272 },
-	{ /* 80 */ "symbol : &error'", "", 1, 272 },
-	{ /* 81 */ "symbol : &eof'", "", 1, 272 },
-	{ /* 82 */ "sym : terminal'", "", 1, 294 },
-	{ /* 83 */ "sym : identifier'", "", 1, 294 },
-	{ /* 84 */ "sym : type' (' stack_cur_prod productions )'", "", 5, 294 },
-	{ /* 85 */ "stack_cur_prod : ", "", 0, 270 },
-	{ /* 86 */ "terminal : ccl", "", 1, 319 },
-	{ /* 87 */ "terminal : kw", "", 1, 319 },
-	{ /* 88 */ "terminal : '@' identifier", "", 2, 319 },
-	{ /* 89 */ "modifier : '*'", "", 1, 317 },
-	{ /* 90 */ "modifier : '+'", "", 1, 317 },
-	{ /* 91 */ "modifier : '?'", "", 1, 317 },
-	{ /* 92 */ "modifier : ", "", 0, 317 },
-	{ /* 93 */ "access_name : :' identifier'", "", 2, 271 },
-	{ /* 94 */ "access_name : :' string_single", "", 2, 271 },
-	{ /* 95 */ "access_name : ", "", 0, 271 },
-	{ /* 96 */ "regex : re_alt", "", 1, 285 },
-	{ /* 97 */ "re_alt : re_alt |' re_expr", "", 3, 267 },
-	{ /* 98 */ "re_alt : re_expr", "", 1, 267 },
-	{ /* 99 */ "re_expr : re_expr re_modifier", "", 2, 266 },
-	{ /* 100 */ "re_expr : re_modifier", "", 1, 266 },
-	{ /* 101 */ "re_modifier : re_factor *'", "", 2, 265 },
-	{ /* 102 */ "re_modifier : re_factor +'", "", 2, 265 },
-	{ /* 103 */ "re_modifier : re_factor ?'", "", 2, 265 },
-	{ /* 104 */ "re_modifier : re_factor", "", 1, 265 },
-	{ /* 105 */ "re_factor : ccl'", "", 1, 264 },
-	{ /* 106 */ "re_factor : kw'", "", 1, 264 },
-	{ /* 107 */ "re_factor : .'", "", 1, 264 },
-	{ /* 108 */ "re_factor : (' regex )'", "", 3, 264 },
-	{ /* 109 */ "string_single+ : string_single+ string_single", "", 2, 263 },
-	{ /* 110 */ "string_single+ : string_single", "", 1, 263 },
-	{ /* 111 */ "string : string_single+", "", 1, 298 },
-	{ /* 112 */ "string_single : ccl_string'", "", 1, 268 },
-	{ /* 113 */ "string_single : kw'", "", 1, 268 },
-	{ /* 114 */ "ccl : ccl_string", "", 1, 269 },
-	{ /* 115 */ "ccl : '!' ccl_string", "", 2, 269 },
-	{ /* 116 */ "ccl_string : ''' ccl_str '''", "", 3, 315 },
-	{ /* 117 */ "ccl_str : ccl_str ccl_char", "", 2, 262 },
-	{ /* 118 */ "ccl_str : ", "", 0, 262 },
-	{ /* 119 */ "ccl_char : \\x0-&(-[]-\\uFFFF#", "", 1, 261 },
-	{ /* 120 */ "ccl_char : '\\\\' \\x1-\\uFFFF#", "", 2, 261 },
-	{ /* 121 */ "kw : '\"' '\"' kw_str '\"' '\"'", "", 5, 314 },
-	{ /* 122 */ "kw : '\"' kw_str '\"'", "", 3, 314 },
-	{ /* 123 */ "kw_str : kw_str kw_char", "", 2, 258 },
-	{ /* 124 */ "kw_str : ", "", 0, 258 },
-	{ /* 125 */ "kw_char : \\x0-!#-[]-\\uFFFF#", "", 1, 257 },
-	{ /* 126 */ "kw_char : '\\\\' \\x1-\\uFFFF#", "", 2, 257 },
-	{ /* 127 */ "type : '<' type_str '>'", "", 3, 313 },
-	{ /* 128 */ "type : ", "", 0, 313 },
-	{ /* 129 */ "type_str : type_str \\x0-=?-\\uFFFF#", "", 2, 255 },
-	{ /* 130 */ "type_str : ", "", 0, 255 },
-	{ /* 131 */ "identifier : identifier_start identifier_follow", "", 2, 318 },
-	{ /* 132 */ "identifier_start : 'A-Z_a-z'", "", 1, 253 },
-	{ /* 133 */ "identifier_follow : identifier_follow 0-9A-Z_a-z#", "", 2, 252 },
-	{ /* 134 */ "identifier_follow : ", "", 0, 252 },
-	{ /* 135 */ "string_or_ident : string", "", 1, 303 },
-	{ /* 136 */ "string_or_ident : identifier'", "", 1, 303 },
-	{ /* 137 */ "integer : integer '0-9'", "", 2, 250 },
-	{ /* 138 */ "integer : '0-9'", "", 1, 250 },
-	{ /* 139 */ "code_opt_dup : code_opt", "", 1, 277 },
-	{ /* 140 */ "code_opt : code'", "", 1, 297 },
-	{ /* 141 */ "code_opt : ", "", 0, 297 },
-	{ /* 142 */ "code : code_begin inner_code_opt \"*]\"", "", 3, 316 },
-	{ /* 143 */ "code_begin : \"[*\"", "", 1, 249 },
-	{ /* 144 */ "inner_code_opt : inner_code", "", 1, 248 },
-	{ /* 145 */ "inner_code_opt : ", "", 0, 248 },
-	{ /* 146 */ "inner_code : inner_code anychar", "", 2, 247 },
-	{ /* 147 */ "inner_code : anychar", "", 1, 247 },
-	{ /* 148 */ "whitespace : ' '", "", 1, 320 },
-	{ /* 149 */ "whitespace : '\\t'", "", 1, 320 },
-	{ /* 150 */ "whitespace : \"/*\" comment? \"*/\"", "", 3, 320 },
-	{ /* 151 */ "comment? : comment", "", 1, 244 },
-	{ /* 152 */ "comment? : ", "", 0, 244 },
-	{ /* 153 */ "whitespace : \"//\" scomment? '\\n'", "", 3, 320 },
-	{ /* 154 */ "scomment? : scomment", "", 1, 242 },
-	{ /* 155 */ "scomment? : ", "", 0, 242 },
-	{ /* 156 */ "whitespace : '\\r'", "", 1, 320 },
-	{ /* 157 */ "whitespace : '\\n'", "", 1, 320 },
-	{ /* 158 */ "comment : comment anychar", "", 2, 245 },
-	{ /* 159 */ "comment : anychar", "", 1, 245 },
-	{ /* 160 */ "anychar : \\x1-\\uFFFF#", "", 1, 246 },
-	{ /* 161 */ "scomment : scomment \\x0-\\t\\v-\\uFFFF#", "", 2, 243 },
-	{ /* 162 */ "scomment : \\x0-\\t\\v-\\uFFFF#", "", 1, 243 },
-	{ /* 163 */ "line_number : ", "", 0, 279 },
-	{ /* 164 */ "grammar_spec' : grammar_spec ~&eof", "", 2, 240 },
-	{ /* 165 */ "&whitespace : whitespace", "", 1, 239 },
-	{ /* 166 */ "&whitespace+ : &whitespace+ &whitespace", "", 2, 238 },
-	{ /* 167 */ "&whitespace+ : &whitespace", "", 1, 238 },
-	{ /* 168 */ "&whitespace* : &whitespace+", "", 1, 237 },
-	{ /* 169 */ "&whitespace* : ", "", 0, 237 },
-	{ /* 170 */ "code' : code &whitespace*", "", 2, 236 },
-	{ /* 171 */ ";' : ';' &whitespace*", "", 2, 235 },
-	{ /* 172 */ "#%' : '#%' &whitespace*", "", 2, 234 },
-	{ /* 173 */ "whitespaces' : \"whitespaces\" &whitespace*", "", 2, 233 },
-	{ /* 174 */ "lexeme' : \"lexeme\" &whitespace*", "", 2, 232 },
-	{ /* 175 */ "fixate' : \"fixate\" &whitespace*", "", 2, 231 },
-	{ /* 176 */ "left' : \"left\" &whitespace*", "", 2, 230 },
-	{ /* 177 */ "right' : \"right\" &whitespace*", "", 2, 229 },
-	{ /* 178 */ "nonassoc' : \"nonassoc\" &whitespace*", "", 2, 228 },
-	{ /* 179 */ "prefix' : \"prefix\" &whitespace*", "", 2, 227 },
-	{ /* 180 */ "default action' : \"default action\" &whitespace*", "", 2, 226 },
-	{ /* 181 */ "default epsilon action' : \"default epsilon action\" &whitespace*", "", 2, 225 },
-	{ /* 182 */ "default value type' : \"default value type\" &whitespace*", "", 2, 224 },
-	{ /* 183 */ "type' : type &whitespace*", "", 2, 223 },
-	{ /* 184 */ "lexeme separation' : \"lexeme separation\" &whitespace*", "", 2, 222 },
-	{ /* 185 */ "case insensitive strings' : \"case insensitive strings\" &whitespace*", "", 2, 221 },
-	{ /* 186 */ "reserve terminals' : \"reserve terminals\" &whitespace*", "", 2, 220 },
-	{ /* 187 */ "prologue' : \"prologue\" &whitespace*", "", 2, 219 },
-	{ /* 188 */ "epilogue' : \"epilogue\" &whitespace*", "", 2, 218 },
-	{ /* 189 */ "pcb' : \"pcb\" &whitespace*", "", 2, 217 },
-	{ /* 190 */ "extends' : \"extends\" &whitespace*", "", 2, 216 },
-	{ /* 191 */ "on' : \"on\" &whitespace*", "", 2, 215 },
-	{ /* 192 */ "off' : \"off\" &whitespace*", "", 2, 214 },
-	{ /* 193 */ "ccl_string' : ccl_string &whitespace*", "", 2, 213 },
-	{ /* 194 */ "kw' : kw &whitespace*", "", 2, 212 },
-	{ /* 195 */ "terminal' : terminal &whitespace*", "", 2, 211 },
-	{ /* 196 */ "identifier' : identifier &whitespace*", "", 2, 210 },
-	{ /* 197 */ "(' : '(' &whitespace*", "", 2, 209 },
-	{ /* 198 */ ")' : ')' &whitespace*", "", 2, 208 },
-	{ /* 199 */ "|' : '|' &whitespace*", "", 2, 207 },
-	{ /* 200 */ "precedence' : \"precedence\" &whitespace*", "", 2, 206 },
-	{ /* 201 */ "=' : '=' &whitespace*", "", 2, 205 },
-	{ /* 202 */ ":' : ':' &whitespace*", "", 2, 204 },
-	{ /* 203 */ "modifier' : modifier &whitespace*", "", 2, 203 },
-	{ /* 204 */ "&error' : \"&error\" &whitespace*", "", 2, 202 },
-	{ /* 205 */ "&eof' : \"&eof\" &whitespace*", "", 2, 201 },
-	{ /* 206 */ "@' : '@' &whitespace*", "", 2, 200 },
-	{ /* 207 */ "greedy' : \"greedy\" &whitespace*", "", 2, 199 },
-	{ /* 208 */ "non-greedy' : \"non-greedy\" &whitespace*", "", 2, 198 },
-	{ /* 209 */ "*' : '*' &whitespace*", "", 2, 197 },
-	{ /* 210 */ "+' : '+' &whitespace*", "", 2, 196 },
-	{ /* 211 */ "?' : '?' &whitespace*", "", 2, 195 },
-	{ /* 212 */ "ccl' : ccl &whitespace*", "", 2, 194 },
-	{ /* 213 */ ".' : '.' &whitespace*", "", 2, 193 },
-	{ /* 214 */ "->' : \"->\" &whitespace*", "", 2, 192 },
-	{ /* 215 */ "=>' : \"=>\" &whitespace*", "", 2, 191 },
-	{ /* 216 */ ":=' : \":=\" &whitespace*", "", 2, 190 },
-	{ /* 217 */ "$' : '$' &whitespace*", "", 2, 189 },
-	{ /* 218 */ "#!' : \"#!\" &whitespace*", "", 2, 188 },
-	{ /* 219 */ "%!' : \"%!\" &whitespace*", "", 2, 187 },
-	{ /* 220 */ "mode' : \"mode\" &whitespace*", "", 2, 186 },
-	{ /* 221 */ "language' : \"language\" &whitespace*", "", 2, 185 },
-	{ /* 222 */ "scannerless' : \"scannerless\" &whitespace*", "", 2, 184 },
-	{ /* 223 */ "scanner' : \"scanner\" &whitespace*", "", 2, 183 },
-	{ /* 224 */ "grammar_spec'' : &whitespace* grammar_spec'", "", 2, 182 },
-	{ /* 225 */ "\\x0-=?-\\uFFFF# : \\x0-\\t\\v-=?-\\uFFFF#", "", 1, 254 },
-	{ /* 226 */ "\\x0-=?-\\uFFFF# : '\\n'", "", 1, 254 },
-	{ /* 227 */ "\\x0-!#-[]-\\uFFFF# : \\x0-\\t\\v-!#-[]-\\uFFFF#", "", 1, 256 },
-	{ /* 228 */ "\\x0-!#-[]-\\uFFFF# : '\\n'", "", 1, 256 },
-	{ /* 229 */ "\\x1-\\uFFFF# : \\x1-\\t\\v-\\uFFFF#", "", 1, 259 },
-	{ /* 230 */ "\\x1-\\uFFFF# : '\\n'", "", 1, 259 },
-	{ /* 231 */ "\\x0-&(-[]-\\uFFFF# : \\x0-\\t\\v-&(-[]-\\uFFFF#", "", 1, 260 },
-	{ /* 232 */ "\\x0-&(-[]-\\uFFFF# : '\\n'", "", 1, 260 },
-	{ /* 233 */ "\\x1-\\t\\v-\\uFFFF# : '\\r'", "", 1, 179 },
-	{ /* 234 */ "\\x1-\\t\\v-\\uFFFF# : \\x1-\\t\\v-\\f\\xE-\\uFFFF#", "", 1, 179 },
-	{ /* 235 */ "\\x0-\\t\\v-!#-[]-\\uFFFF# : '\\r'", "", 1, 180 },
-	{ /* 236 */ "\\x0-\\t\\v-!#-[]-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 1, 180 },
-	{ /* 237 */ "\\x0-\\t\\v-=?-\\uFFFF# : '\\r'", "", 1, 181 },
-	{ /* 238 */ "\\x0-\\t\\v-=?-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-=?-\\uFFFF#", "", 1, 181 },
-	{ /* 239 */ "\\x0-\\t\\v-\\uFFFF# : '\\r'", "", 1, 241 },
-	{ /* 240 */ "\\x0-\\t\\v-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\uFFFF#", "", 1, 241 },
-	{ /* 241 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF# : '\\t'", "", 1, 175 },
-	{ /* 242 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-=?-\\uFFFF#", "", 1, 175 },
-	{ /* 243 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF# : '\\t'", "", 1, 176 },
-	{ /* 244 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 1, 176 },
-	{ /* 245 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF# : '\\t'", "", 1, 177 },
-	{ /* 246 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\uFFFF#", "", 1, 177 },
-	{ /* 247 */ "\\x0-\\t\\v-&(-[]-\\uFFFF# : '\\t'", "", 1, 178 },
-	{ /* 248 */ "\\x0-\\t\\v-&(-[]-\\uFFFF# : \\x0-\\b\\v-&(-[]-\\uFFFF#", "", 1, 178 },
-	{ /* 249 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF# : ' '", "", 1, 171 },
-	{ /* 250 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 1, 171 },
-	{ /* 251 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF# : ' '", "", 1, 172 },
-	{ /* 252 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF#", "", 1, 172 },
-	{ /* 253 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF# : ' '", "", 1, 173 },
-	{ /* 254 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF#", "", 1, 173 },
-	{ /* 255 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF# : ' '", "", 1, 174 },
-	{ /* 256 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 1, 174 },
-	{ /* 257 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF# : '0-9'", "", 1, 167 },
-	{ /* 258 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF#", "", 1, 167 },
-	{ /* 259 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF# : '0-9'", "", 1, 168 },
-	{ /* 260 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF#", "", 1, 168 },
-	{ /* 261 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF# : '0-9'", "", 1, 169 },
-	{ /* 262 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF#", "", 1, 169 },
-	{ /* 263 */ "\\x0-\\b\\v-&(-[]-\\uFFFF# : '0-9'", "", 1, 170 },
-	{ /* 264 */ "\\x0-\\b\\v-&(-[]-\\uFFFF# : \\x0-\\b\\v-&(-/:-[]-\\uFFFF#", "", 1, 170 },
-	{ /* 265 */ "0-9A-Z_a-z# : '0-9'", "", 1, 251 },
-	{ /* 266 */ "0-9A-Z_a-z# : 'A-Z_a-z'", "", 1, 251 },
-	{ /* 267 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF# : 'A-Z_a-z'", "", 1, 163 },
-	{ /* 268 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF#", "", 1, 163 },
-	{ /* 269 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 164 },
-	{ /* 270 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF#", "", 1, 164 },
-	{ /* 271 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF# : 'A-Z_a-z'", "", 1, 165 },
-	{ /* 272 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 1, 165 },
-	{ /* 273 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF# : 'A-Z_a-z'", "", 1, 166 },
-	{ /* 274 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF#", "", 1, 166 },
-	{ /* 275 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF# : '>'", "", 1, 160 },
-	{ /* 276 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF#", "", 1, 160 },
-	{ /* 277 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF# : '>'", "", 1, 161 },
-	{ /* 278 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 1, 161 },
-	{ /* 279 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF# : '>'", "", 1, 162 },
-	{ /* 280 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF# : \\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF#", "", 1, 162 },
-	{ /* 281 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : '<'", "", 1, 156 },
-	{ /* 282 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 156 },
-	{ /* 283 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF# : '<'", "", 1, 157 },
-	{ /* 284 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 157 },
-	{ /* 285 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF# : '<'", "", 1, 158 },
-	{ /* 286 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF#", "", 1, 158 },
-	{ /* 287 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : '<'", "", 1, 159 },
-	{ /* 288 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 159 },
-	{ /* 289 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF# : '\"'", "", 1, 152 },
-	{ /* 290 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF#", "", 1, 152 },
-	{ /* 291 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : '\"'", "", 1, 154 },
-	{ /* 292 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 154 },
-	{ /* 293 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF# : '\"'", "", 1, 155 },
-	{ /* 294 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF#", "", 1, 155 },
-	{ /* 295 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 149 },
-	{ /* 296 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 149 },
-	{ /* 297 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 150 },
-	{ /* 298 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF#", "", 1, 150 },
-	{ /* 299 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 151 },
-	{ /* 300 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 151 },
-	{ /* 301 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF# : '''", "", 1, 146 },
-	{ /* 302 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF#", "", 1, 146 },
-	{ /* 303 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : '''", "", 1, 147 },
-	{ /* 304 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 147 },
-	{ /* 305 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : '''", "", 1, 153 },
-	{ /* 306 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 153 },
-	{ /* 307 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '!'", "", 1, 143 },
-	{ /* 308 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 143 },
-	{ /* 309 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF# : '!'", "", 1, 144 },
-	{ /* 310 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF#", "", 1, 144 },
-	{ /* 311 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF# : '!'", "", 1, 145 },
-	{ /* 312 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 145 },
-	{ /* 313 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF# : '!'", "", 1, 148 },
-	{ /* 314 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF#", "", 1, 148 },
-	{ /* 315 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 139 },
-	{ /* 316 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 139 },
-	{ /* 317 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF# : '.'", "", 1, 140 },
-	{ /* 318 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF#", "", 1, 140 },
-	{ /* 319 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 141 },
-	{ /* 320 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 141 },
-	{ /* 321 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 142 },
-	{ /* 322 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 142 },
-	{ /* 323 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF# : '?'", "", 1, 135 },
-	{ /* 324 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF#", "", 1, 135 },
-	{ /* 325 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF# : '?'", "", 1, 136 },
-	{ /* 326 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF#", "", 1, 136 },
-	{ /* 327 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF# : '?'", "", 1, 137 },
-	{ /* 328 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF#", "", 1, 137 },
-	{ /* 329 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF# : '?'", "", 1, 138 },
-	{ /* 330 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF#", "", 1, 138 },
-	{ /* 331 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF# : '+'", "", 1, 131 },
-	{ /* 332 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 131 },
-	{ /* 333 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF# : '+'", "", 1, 132 },
-	{ /* 334 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 132 },
-	{ /* 335 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF# : '+'", "", 1, 133 },
-	{ /* 336 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 133 },
-	{ /* 337 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF# : '+'", "", 1, 134 },
-	{ /* 338 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 134 },
-	{ /* 339 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF# : '*'", "", 1, 127 },
-	{ /* 340 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF#", "", 1, 127 },
-	{ /* 341 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF# : '*'", "", 1, 128 },
-	{ /* 342 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF#", "", 1, 128 },
-	{ /* 343 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF# : '*'", "", 1, 129 },
-	{ /* 344 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF#", "", 1, 129 },
-	{ /* 345 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF# : '*'", "", 1, 130 },
-	{ /* 346 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF#", "", 1, 130 },
-	{ /* 347 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF# : ')'", "", 1, 123 },
-	{ /* 348 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 123 },
-	{ /* 349 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF# : ')'", "", 1, 124 },
-	{ /* 350 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 124 },
-	{ /* 351 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF# : ')'", "", 1, 125 },
-	{ /* 352 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 125 },
-	{ /* 353 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF# : ')'", "", 1, 126 },
-	{ /* 354 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 126 },
-	{ /* 355 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF# : '('", "", 1, 119 },
-	{ /* 356 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 119 },
-	{ /* 357 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF# : '('", "", 1, 120 },
-	{ /* 358 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 120 },
-	{ /* 359 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF# : '('", "", 1, 121 },
-	{ /* 360 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF#", "", 1, 121 },
-	{ /* 361 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF# : '('", "", 1, 122 },
-	{ /* 362 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF#", "", 1, 122 },
-	{ /* 363 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF# : '='", "", 1, 115 },
-	{ /* 364 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF#", "", 1, 115 },
-	{ /* 365 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF# : '='", "", 1, 116 },
-	{ /* 366 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF#", "", 1, 116 },
-	{ /* 367 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF# : '='", "", 1, 117 },
-	{ /* 368 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF#", "", 1, 117 },
-	{ /* 369 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF# : '='", "", 1, 118 },
-	{ /* 370 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 1, 118 },
-	{ /* 371 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF# : '|'", "", 1, 111 },
-	{ /* 372 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF#", "", 1, 111 },
-	{ /* 373 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF# : '|'", "", 1, 112 },
-	{ /* 374 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF#", "", 1, 112 },
-	{ /* 375 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF# : '|'", "", 1, 113 },
-	{ /* 376 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF#", "", 1, 113 },
-	{ /* 377 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF# : '|'", "", 1, 114 },
-	{ /* 378 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF#", "", 1, 114 },
-	{ /* 379 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF# : '$'", "", 1, 107 },
-	{ /* 380 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF#", "", 1, 107 },
-	{ /* 381 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF# : '$'", "", 1, 108 },
-	{ /* 382 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF#", "", 1, 108 },
-	{ /* 383 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF# : '$'", "", 1, 109 },
-	{ /* 384 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF#", "", 1, 109 },
-	{ /* 385 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF# : '$'", "", 1, 110 },
-	{ /* 386 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 1, 110 },
-	{ /* 387 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF# : '@'", "", 1, 103 },
-	{ /* 388 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF#", "", 1, 103 },
-	{ /* 389 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF# : '@'", "", 1, 104 },
-	{ /* 390 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF#", "", 1, 104 },
-	{ /* 391 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF# : '@'", "", 1, 105 },
-	{ /* 392 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF#", "", 1, 105 },
-	{ /* 393 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF# : '@'", "", 1, 106 },
-	{ /* 394 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF#", "", 1, 106 },
-	{ /* 395 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF# : ':'", "", 1, 99 },
-	{ /* 396 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF#", "", 1, 99 },
-	{ /* 397 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF# : ':'", "", 1, 100 },
-	{ /* 398 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF#", "", 1, 100 },
-	{ /* 399 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF# : ':'", "", 1, 101 },
-	{ /* 400 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF#", "", 1, 101 },
-	{ /* 401 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF# : ':'", "", 1, 102 },
-	{ /* 402 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF#", "", 1, 102 },
-	{ /* 403 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF# : '#%'", "", 1, 95 },
-	{ /* 404 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF#", "", 1, 95 },
-	{ /* 405 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF# : '#%'", "", 1, 96 },
-	{ /* 406 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF#", "", 1, 96 },
-	{ /* 407 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF# : '#%'", "", 1, 97 },
-	{ /* 408 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF#", "", 1, 97 },
-	{ /* 409 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF# : '#%'", "", 1, 98 },
-	{ /* 410 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF# : \\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF#", "", 1, 98 },
-	{ /* 411 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF# : ';'", "", 1, 91 },
-	{ /* 412 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF#", "", 1, 91 },
-	{ /* 413 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF# : ';'", "", 1, 92 },
-	{ /* 414 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF#", "", 1, 92 },
-	{ /* 415 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF# : ';'", "", 1, 93 },
-	{ /* 416 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 93 },
-	{ /* 417 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF# : ';'", "", 1, 94 },
-	{ /* 418 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF#", "", 1, 94 },
-	{ /* 419 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 88 },
-	{ /* 420 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF# : \\t0-9>#", "", 1, 88 },
-	{ /* 421 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 89 },
-	{ /* 422 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF# : \"'#", "", 1, 89 },
-	{ /* 423 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 90 },
-	{ /* 424 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF# : \\r $)+.:-=A-Z_a-z#", "", 1, 90 },
-	{ /* 425 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 86 },
-	{ /* 426 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF# : '\\x0'", "", 1, 86 },
-	{ /* 427 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 87 },
-	{ /* 428 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF# : \\x0!#%(*?-@|#", "", 1, 87 },
-	{ /* 429 */ "\\r $)+.:-=A-Z_a-z# : '\\r'", "", 1, 83 },
-	{ /* 430 */ "\\r $)+.:-=A-Z_a-z# :  $)+.:-=A-Z_a-z#", "", 1, 83 },
-	{ /* 431 */ "\\t0-9># : '\\t'", "", 1, 85 },
-	{ /* 432 */ "\\t0-9># : 0-9>#", "", 1, 85 },
-	{ /* 433 */ " $)+.:-=A-Z_a-z# : ' '", "", 1, 81 },
-	{ /* 434 */ " $)+.:-=A-Z_a-z# : $)+.:-=A-Z_a-z#", "", 1, 81 },
-	{ /* 435 */ "0-9># : '0-9'", "", 1, 80 },
-	{ /* 436 */ "0-9># : '>'", "", 1, 80 },
-	{ /* 437 */ "$)+.:-=A-Z_a-z# : 'A-Z_a-z'", "", 1, 79 },
-	{ /* 438 */ "$)+.:-=A-Z_a-z# : $)+.:-=#", "", 1, 79 },
-	{ /* 439 */ "$)+.:-=# : '<'", "", 1, 78 },
-	{ /* 440 */ "$)+.:-=# : $)+.:-;=#", "", 1, 78 },
-	{ /* 441 */ "\"'# : '\"'", "", 1, 84 },
-	{ /* 442 */ "\"'# : '''", "", 1, 84 },
-	{ /* 443 */ "\\x0!#%(*?-@|# : '!'", "", 1, 82 },
-	{ /* 444 */ "\\x0!#%(*?-@|# : \\x0#%(*?-@|#", "", 1, 82 },
-	{ /* 445 */ "$)+.:-;=# : '.'", "", 1, 77 },
-	{ /* 446 */ "$)+.:-;=# : $)+:-;=#", "", 1, 77 },
-	{ /* 447 */ "\\x0#%(*?-@|# : '?'", "", 1, 76 },
-	{ /* 448 */ "\\x0#%(*?-@|# : \\x0#%(*@|#", "", 1, 76 },
-	{ /* 449 */ "$)+:-;=# : '+'", "", 1, 75 },
-	{ /* 450 */ "$)+:-;=# : $):-;=#", "", 1, 75 },
-	{ /* 451 */ "\\x0#%(*@|# : '*'", "", 1, 74 },
-	{ /* 452 */ "\\x0#%(*@|# : \\x0#%(@|#", "", 1, 74 },
-	{ /* 453 */ "$):-;=# : ')'", "", 1, 73 },
-	{ /* 454 */ "$):-;=# : $:-;=#", "", 1, 73 },
-	{ /* 455 */ "\\x0#%(@|# : '('", "", 1, 72 },
-	{ /* 456 */ "\\x0#%(@|# : \\x0#%@|#", "", 1, 72 },
-	{ /* 457 */ "$:-;=# : '='", "", 1, 71 },
-	{ /* 458 */ "$:-;=# : $:-;#", "", 1, 71 },
-	{ /* 459 */ "\\x0#%@|# : '|'", "", 1, 70 },
-	{ /* 460 */ "\\x0#%@|# : \\x0#%@#", "", 1, 70 },
-	{ /* 461 */ "$:-;# : '$'", "", 1, 69 },
-	{ /* 462 */ "$:-;# : :-;#", "", 1, 69 },
-	{ /* 463 */ "\\x0#%@# : '@'", "", 1, 68 },
-	{ /* 464 */ "\\x0#%@# : \\x0#%#", "", 1, 68 },
-	{ /* 465 */ ":-;# : ':'", "", 1, 67 },
-	{ /* 466 */ ":-;# : ';'", "", 1, 67 },
-	{ /* 467 */ "\\x0#%# : '#%'", "", 1, 66 },
-	{ /* 468 */ "\\x0#%# : '\\x0'", "", 1, 66 }
+	{ /* 0 */ "fixed_directive_def+ : fixed_directive_def+ fixed_directive_def", "", 2, 84 },
+	{ /* 1 */ "fixed_directive_def+ : fixed_directive_def", "", 1, 84 },
+	{ /* 2 */ "fixed_directive_def* : fixed_directive_def+", "", 1, 85 },
+	{ /* 3 */ "fixed_directive_def* : ", "", 0, 85 },
+	{ /* 4 */ "grammar_spec : fixed_directive_def* segment*", "", 2, 82 },
+	{ /* 5 */ "segment+ : segment+ segment", "", 2, 87 },
+	{ /* 6 */ "segment+ : segment", "", 1, 87 },
+	{ /* 7 */ "segment* : segment+", "", 1, 88 },
+	{ /* 8 */ "segment* : ", "", 0, 88 },
+	{ /* 9 */ "fixed_directive_def : #!' fixed_directive ;'", "", 3, 83 },
+	{ /* 10 */ "fixed_directive_def : %!' fixed_directive ;'", "", 3, 83 },
+	{ /* 11 */ "fixed_directive : mode' mode_type", "", 2, 89 },
+	{ /* 12 */ "fixed_directive : language' string_or_ident", "", 2, 89 },
+	{ /* 13 */ "mode_type : scannerless'", "", 1, 90 },
+	{ /* 14 */ "mode_type : scanner'", "", 1, 90 },
+	{ /* 15 */ "segment : code'", "", 1, 86 },
+	{ /* 16 */ "segment : definition ;'", "", 2, 86 },
+	{ /* 17 */ "segment : unfixed_directive ;'", "", 2, 86 },
+	{ /* 18 */ "unfixed_directive : #%' directive_parms", "", 2, 93 },
+	{ /* 19 */ "directive_parms : whitespaces' symbol_list", "", 2, 94 },
+	{ /* 20 */ "directive_parms : lexeme' symbol_list", "", 2, 94 },
+	{ /* 21 */ "directive_parms : fixate' symbol_list", "", 2, 94 },
+	{ /* 22 */ "directive_parms : left' symbol_list", "", 2, 94 },
+	{ /* 23 */ "directive_parms : right' symbol_list", "", 2, 94 },
+	{ /* 24 */ "directive_parms : nonassoc' symbol_list", "", 2, 94 },
+	{ /* 25 */ "directive_parms : prefix' string", "", 2, 94 },
+	{ /* 26 */ "directive_parms : default action' code_opt", "", 2, 94 },
+	{ /* 27 */ "directive_parms : default epsilon action' code_opt", "", 2, 94 },
+	{ /* 28 */ "directive_parms : default value type' type'", "", 2, 94 },
+	{ /* 29 */ "directive_parms : lexeme separation' boolean_opt", "", 2, 94 },
+	{ /* 30 */ "directive_parms : skip whitespaces' boolean_opt", "", 2, 94 },
+	{ /* 31 */ "directive_parms : shared lexers' boolean_opt", "", 2, 94 },
+	{ /* 32 */ "directive_parms : regular lexemes' boolean_opt", "", 2, 94 },
+	{ /* 33 */ "directive_parms : case insensitive strings' boolean_opt", "", 2, 94 },
+	{ /* 34 */ "directive_parms : reserve terminals' boolean_opt", "", 2, 94 },
+	{ /* 35 */ "directive_parms : prologue' code'", "", 2, 94 },
+	{ /* 36 */ "directive_parms : epilogue' code'", "", 2, 94 },
+	{ /* 37 */ "directive_parms : pcb' code'", "", 2, 94 },
+	{ /* 38 */ "directive_parms : extends' string", "", 2, 94 },
+	{ /* 39 */ "boolean_opt : boolean", "", 1, 98 },
+	{ /* 40 */ "boolean_opt : ", "", 0, 98 },
+	{ /* 41 */ "boolean : on'", "", 1, 99 },
+	{ /* 42 */ "boolean : off'", "", 1, 99 },
+	{ /* 43 */ "symbol_list : symbol_list sym", "", 2, 95 },
+	{ /* 44 */ "symbol_list : sym", "", 1, 95 },
+	{ /* 45 */ "lhs : identifier'", "", 1, 101 },
+	{ /* 46 */ "alt_lhs_list : alt_lhs_list lhs", "", 2, 102 },
+	{ /* 47 */ "alt_lhs_list : lhs", "", 1, 102 },
+	{ /* 48 */ "alt_regex_sym : alt_regex_sym regex_sym", "", 2, 103 },
+	{ /* 49 */ "alt_regex_sym : regex_sym", "", 1, 103 },
+	{ /* 50 */ "regex_sym : identifier'", "", 1, 104 },
+	{ /* 51 */ "defines : ->'", "", 1, 105 },
+	{ /* 52 */ "defines : :'", "", 1, 105 },
+	{ /* 53 */ "defines : =>'", "", 1, 105 },
+	{ /* 54 */ "defines : :='", "", 1, 105 },
+	{ /* 55 */ "definition : lhs goal_mark alt_lhs_list? type' defines productions", "", 6, 92 },
+	{ /* 56 */ "alt_lhs_list? : alt_lhs_list", "", 1, 107 },
+	{ /* 57 */ "alt_lhs_list? : ", "", 0, 107 },
+	{ /* 58 */ "definition : @' alt_regex_sym type' regex code_opt ast_node sym_option*", "", 7, 92 },
+	{ /* 59 */ "sym_option+ : sym_option+ sym_option", "", 2, 112 },
+	{ /* 60 */ "sym_option+ : sym_option", "", 1, 112 },
+	{ /* 61 */ "sym_option* : sym_option+", "", 1, 113 },
+	{ /* 62 */ "sym_option* : ", "", 0, 113 },
+	{ /* 63 */ "sym_option : #%' greedy'", "", 2, 111 },
+	{ /* 64 */ "sym_option : #%' non-greedy'", "", 2, 111 },
+	{ /* 65 */ "goal_mark : $'", "", 1, 106 },
+	{ /* 66 */ "goal_mark : ", "", 0, 106 },
+	{ /* 67 */ "productions : productions |' production", "", 3, 108 },
+	{ /* 68 */ "productions : production", "", 1, 108 },
+	{ /* 69 */ "ast_node : =' identifier'", "", 2, 110 },
+	{ /* 70 */ "ast_node : =' string", "", 2, 110 },
+	{ /* 71 */ "ast_node : ", "", 0, 110 },
+	{ /* 72 */ "production : line_number rhs_opt code_opt_dup ast_node prod_directives*", "", 5, 114 },
+	{ /* 73 */ "prod_directives+ : prod_directives+ prod_directives", "", 2, 119 },
+	{ /* 74 */ "prod_directives+ : prod_directives", "", 1, 119 },
+	{ /* 75 */ "prod_directives* : prod_directives+", "", 1, 120 },
+	{ /* 76 */ "prod_directives* : ", "", 0, 120 },
+	{ /* 77 */ "rhs_opt : rhs", "", 1, 116 },
+	{ /* 78 */ "rhs_opt : ", "", 0, 116 },
+	{ /* 79 */ "prod_directives : #%' precedence' terminal'", "", 3, 118 },
+	{ /* 80 */ "rhs : rhs symbol access_name", "", 3, 121 },
+	{ /* 81 */ "rhs : symbol access_name", "", 2, 121 },
+	{ /* 82 */ "symbol : sym modifier'", "", 2, 122 },
+	{ /* 83 */ "symbol : &error'", "", 1, 122 },
+	{ /* 84 */ "symbol : &eof'", "", 1, 122 },
+	{ /* 85 */ "sym : terminal'", "", 1, 100 },
+	{ /* 86 */ "sym : identifier'", "", 1, 100 },
+	{ /* 87 */ "sym : type' (' stack_cur_prod productions )'", "", 5, 100 },
+	{ /* 88 */ "stack_cur_prod : ", "", 0, 124 },
+	{ /* 89 */ "terminal : ccl", "", 1, 75 },
+	{ /* 90 */ "terminal : kw", "", 1, 75 },
+	{ /* 91 */ "terminal : '@' identifier", "", 2, 75 },
+	{ /* 92 */ "modifier : '*'", "", 1, 77 },
+	{ /* 93 */ "modifier : '+'", "", 1, 77 },
+	{ /* 94 */ "modifier : '?'", "", 1, 77 },
+	{ /* 95 */ "modifier : ", "", 0, 77 },
+	{ /* 96 */ "access_name : :' identifier'", "", 2, 123 },
+	{ /* 97 */ "access_name : :' string_single", "", 2, 123 },
+	{ /* 98 */ "access_name : ", "", 0, 123 },
+	{ /* 99 */ "regex : re_alt", "", 1, 109 },
+	{ /* 100 */ "re_alt : re_alt |' re_expr", "", 3, 127 },
+	{ /* 101 */ "re_alt : re_expr", "", 1, 127 },
+	{ /* 102 */ "re_expr : re_expr re_modifier", "", 2, 128 },
+	{ /* 103 */ "re_expr : re_modifier", "", 1, 128 },
+	{ /* 104 */ "re_modifier : re_factor *'", "", 2, 129 },
+	{ /* 105 */ "re_modifier : re_factor +'", "", 2, 129 },
+	{ /* 106 */ "re_modifier : re_factor ?'", "", 2, 129 },
+	{ /* 107 */ "re_modifier : re_factor", "", 1, 129 },
+	{ /* 108 */ "re_factor : ccl'", "", 1, 130 },
+	{ /* 109 */ "re_factor : kw'", "", 1, 130 },
+	{ /* 110 */ "re_factor : .'", "", 1, 130 },
+	{ /* 111 */ "re_factor : (' regex )'", "", 3, 130 },
+	{ /* 112 */ "string_single+ : string_single+ string_single", "", 2, 131 },
+	{ /* 113 */ "string_single+ : string_single", "", 1, 131 },
+	{ /* 114 */ "string : string_single+", "", 1, 96 },
+	{ /* 115 */ "string_single : ccl_string'", "", 1, 126 },
+	{ /* 116 */ "string_single : kw'", "", 1, 126 },
+	{ /* 117 */ "ccl : ccl_string", "", 1, 125 },
+	{ /* 118 */ "ccl : '!' ccl_string", "", 2, 125 },
+	{ /* 119 */ "ccl_string : ''' ccl_str '''", "", 3, 79 },
+	{ /* 120 */ "ccl_str : ccl_str ccl_char", "", 2, 132 },
+	{ /* 121 */ "ccl_str : ", "", 0, 132 },
+	{ /* 122 */ "ccl_char : \\x0-&(-[]-\\uFFFF#", "", 1, 133 },
+	{ /* 123 */ "ccl_char : '\\\\' \\x1-\\uFFFF#", "", 2, 133 },
+	{ /* 124 */ "kw : '\"' '\"' kw_str '\"' '\"'", "", 5, 80 },
+	{ /* 125 */ "kw : '\"' kw_str '\"'", "", 3, 80 },
+	{ /* 126 */ "kw_str : kw_str kw_char", "", 2, 134 },
+	{ /* 127 */ "kw_str : ", "", 0, 134 },
+	{ /* 128 */ "kw_char : \\x0-!#-[]-\\uFFFF#", "", 1, 135 },
+	{ /* 129 */ "kw_char : '\\\\' \\x1-\\uFFFF#", "", 2, 135 },
+	{ /* 130 */ "type : '<' type_str '>'", "", 3, 81 },
+	{ /* 131 */ "type : ", "", 0, 81 },
+	{ /* 132 */ "type_str : type_str \\x0-=?-\\uFFFF#", "", 2, 136 },
+	{ /* 133 */ "type_str : ", "", 0, 136 },
+	{ /* 134 */ "identifier : identifier_start identifier_follow", "", 2, 76 },
+	{ /* 135 */ "identifier_start : 'A-Z_a-z'", "", 1, 137 },
+	{ /* 136 */ "identifier_follow : identifier_follow 0-9A-Z_a-z#", "", 2, 138 },
+	{ /* 137 */ "identifier_follow : ", "", 0, 138 },
+	{ /* 138 */ "string_or_ident : string", "", 1, 91 },
+	{ /* 139 */ "string_or_ident : identifier'", "", 1, 91 },
+	{ /* 140 */ "code_opt_dup : code_opt", "", 1, 117 },
+	{ /* 141 */ "code_opt : code'", "", 1, 97 },
+	{ /* 142 */ "code_opt : ", "", 0, 97 },
+	{ /* 143 */ "code : code_begin inner_code_opt \"*]\"", "", 3, 78 },
+	{ /* 144 */ "code_begin : \"[*\"", "", 1, 139 },
+	{ /* 145 */ "inner_code_opt : inner_code", "", 1, 140 },
+	{ /* 146 */ "inner_code_opt : ", "", 0, 140 },
+	{ /* 147 */ "inner_code : inner_code anychar", "", 2, 141 },
+	{ /* 148 */ "inner_code : anychar", "", 1, 141 },
+	{ /* 149 */ "whitespace : ' '", "", 1, 209 },
+	{ /* 150 */ "whitespace : '\\t'", "", 1, 209 },
+	{ /* 151 */ "whitespace : \"/*\" comment? \"*/\"", "", 3, 209 },
+	{ /* 152 */ "comment? : comment", "", 1, 144 },
+	{ /* 153 */ "comment? : ", "", 0, 144 },
+	{ /* 154 */ "whitespace : \"//\" scomment? '\\n'", "", 3, 209 },
+	{ /* 155 */ "scomment? : scomment", "", 1, 146 },
+	{ /* 156 */ "scomment? : ", "", 0, 146 },
+	{ /* 157 */ "whitespace : '\\r'", "", 1, 209 },
+	{ /* 158 */ "whitespace : '\\n'", "", 1, 209 },
+	{ /* 159 */ "comment : comment anychar", "", 2, 143 },
+	{ /* 160 */ "comment : anychar", "", 1, 143 },
+	{ /* 161 */ "anychar : \\x1-\\uFFFF#", "", 1, 142 },
+	{ /* 162 */ "scomment : scomment \\x0-\\t\\v-\\uFFFF#", "", 2, 145 },
+	{ /* 163 */ "scomment : \\x0-\\t\\v-\\uFFFF#", "", 1, 145 },
+	{ /* 164 */ "line_number : ", "", 0, 115 },
+	{ /* 165 */ "grammar_spec' : grammar_spec ~&eof", "", 2, 147 },
+	{ /* 166 */ "&whitespace : whitespace", "", 1, 148 },
+	{ /* 167 */ "&whitespace+ : &whitespace+ &whitespace", "", 2, 149 },
+	{ /* 168 */ "&whitespace+ : &whitespace", "", 1, 149 },
+	{ /* 169 */ "&whitespace* : &whitespace+", "", 1, 150 },
+	{ /* 170 */ "&whitespace* : ", "", 0, 150 },
+	{ /* 171 */ "code' : code &whitespace*", "", 2, 151 },
+	{ /* 172 */ ";' : ';' &whitespace*", "", 2, 152 },
+	{ /* 173 */ "#%' : '#%' &whitespace*", "", 2, 153 },
+	{ /* 174 */ "whitespaces' : \"whitespaces\" &whitespace*", "", 2, 154 },
+	{ /* 175 */ "lexeme' : \"lexeme\" &whitespace*", "", 2, 155 },
+	{ /* 176 */ "fixate' : \"fixate\" &whitespace*", "", 2, 156 },
+	{ /* 177 */ "left' : \"left\" &whitespace*", "", 2, 157 },
+	{ /* 178 */ "right' : \"right\" &whitespace*", "", 2, 158 },
+	{ /* 179 */ "nonassoc' : \"nonassoc\" &whitespace*", "", 2, 159 },
+	{ /* 180 */ "prefix' : \"prefix\" &whitespace*", "", 2, 160 },
+	{ /* 181 */ "default action' : \"default action\" &whitespace*", "", 2, 161 },
+	{ /* 182 */ "default epsilon action' : \"default epsilon action\" &whitespace*", "", 2, 162 },
+	{ /* 183 */ "default value type' : \"default value type\" &whitespace*", "", 2, 163 },
+	{ /* 184 */ "type' : type &whitespace*", "", 2, 164 },
+	{ /* 185 */ "lexeme separation' : \"lexeme separation\" &whitespace*", "", 2, 165 },
+	{ /* 186 */ "skip whitespaces' : \"skip whitespaces\" &whitespace*", "", 2, 166 },
+	{ /* 187 */ "shared lexers' : \"shared lexers\" &whitespace*", "", 2, 167 },
+	{ /* 188 */ "regular lexemes' : \"regular lexemes\" &whitespace*", "", 2, 168 },
+	{ /* 189 */ "case insensitive strings' : \"case insensitive strings\" &whitespace*", "", 2, 169 },
+	{ /* 190 */ "reserve terminals' : \"reserve terminals\" &whitespace*", "", 2, 170 },
+	{ /* 191 */ "prologue' : \"prologue\" &whitespace*", "", 2, 171 },
+	{ /* 192 */ "epilogue' : \"epilogue\" &whitespace*", "", 2, 172 },
+	{ /* 193 */ "pcb' : \"pcb\" &whitespace*", "", 2, 173 },
+	{ /* 194 */ "extends' : \"extends\" &whitespace*", "", 2, 174 },
+	{ /* 195 */ "on' : \"on\" &whitespace*", "", 2, 175 },
+	{ /* 196 */ "off' : \"off\" &whitespace*", "", 2, 176 },
+	{ /* 197 */ "ccl_string' : ccl_string &whitespace*", "", 2, 177 },
+	{ /* 198 */ "kw' : kw &whitespace*", "", 2, 178 },
+	{ /* 199 */ "terminal' : terminal &whitespace*", "", 2, 179 },
+	{ /* 200 */ "identifier' : identifier &whitespace*", "", 2, 180 },
+	{ /* 201 */ "(' : '(' &whitespace*", "", 2, 181 },
+	{ /* 202 */ ")' : ')' &whitespace*", "", 2, 182 },
+	{ /* 203 */ "|' : '|' &whitespace*", "", 2, 183 },
+	{ /* 204 */ "precedence' : \"precedence\" &whitespace*", "", 2, 184 },
+	{ /* 205 */ "=' : '=' &whitespace*", "", 2, 185 },
+	{ /* 206 */ ":' : ':' &whitespace*", "", 2, 186 },
+	{ /* 207 */ "modifier' : modifier &whitespace*", "", 2, 187 },
+	{ /* 208 */ "&error' : \"&error\" &whitespace*", "", 2, 188 },
+	{ /* 209 */ "&eof' : \"&eof\" &whitespace*", "", 2, 189 },
+	{ /* 210 */ "@' : '@' &whitespace*", "", 2, 190 },
+	{ /* 211 */ "greedy' : \"greedy\" &whitespace*", "", 2, 191 },
+	{ /* 212 */ "non-greedy' : \"non-greedy\" &whitespace*", "", 2, 192 },
+	{ /* 213 */ "*' : '*' &whitespace*", "", 2, 193 },
+	{ /* 214 */ "+' : '+' &whitespace*", "", 2, 194 },
+	{ /* 215 */ "?' : '?' &whitespace*", "", 2, 195 },
+	{ /* 216 */ "ccl' : ccl &whitespace*", "", 2, 196 },
+	{ /* 217 */ ".' : '.' &whitespace*", "", 2, 197 },
+	{ /* 218 */ "->' : \"->\" &whitespace*", "", 2, 198 },
+	{ /* 219 */ "=>' : \"=>\" &whitespace*", "", 2, 199 },
+	{ /* 220 */ ":=' : \":=\" &whitespace*", "", 2, 200 },
+	{ /* 221 */ "$' : '$' &whitespace*", "", 2, 201 },
+	{ /* 222 */ "#!' : \"#!\" &whitespace*", "", 2, 202 },
+	{ /* 223 */ "%!' : \"%!\" &whitespace*", "", 2, 203 },
+	{ /* 224 */ "mode' : \"mode\" &whitespace*", "", 2, 204 },
+	{ /* 225 */ "language' : \"language\" &whitespace*", "", 2, 205 },
+	{ /* 226 */ "scannerless' : \"scannerless\" &whitespace*", "", 2, 206 },
+	{ /* 227 */ "scanner' : \"scanner\" &whitespace*", "", 2, 207 },
+	{ /* 228 */ "grammar_spec'' : &whitespace* grammar_spec'", "", 2, 208 },
+	{ /* 229 */ "\\x0-&(-[]-\\uFFFF# : '\\x0'", "", 1, 69 },
+	{ /* 230 */ "\\x0-&(-[]-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 69 },
+	{ /* 231 */ "\\x0-&(-[]-\\uFFFF# : '\\t'", "", 1, 69 },
+	{ /* 232 */ "\\x0-&(-[]-\\uFFFF# : '\\n'", "", 1, 69 },
+	{ /* 233 */ "\\x0-&(-[]-\\uFFFF# : '\\r'", "", 1, 69 },
+	{ /* 234 */ "\\x0-&(-[]-\\uFFFF# : ' '", "", 1, 69 },
+	{ /* 235 */ "\\x0-&(-[]-\\uFFFF# : '!'", "", 1, 69 },
+	{ /* 236 */ "\\x0-&(-[]-\\uFFFF# : '\"'", "", 1, 69 },
+	{ /* 237 */ "\\x0-&(-[]-\\uFFFF# : '#%'", "", 1, 69 },
+	{ /* 238 */ "\\x0-&(-[]-\\uFFFF# : '$'", "", 1, 69 },
+	{ /* 239 */ "\\x0-&(-[]-\\uFFFF# : '('", "", 1, 69 },
+	{ /* 240 */ "\\x0-&(-[]-\\uFFFF# : ')'", "", 1, 69 },
+	{ /* 241 */ "\\x0-&(-[]-\\uFFFF# : '*'", "", 1, 69 },
+	{ /* 242 */ "\\x0-&(-[]-\\uFFFF# : '+'", "", 1, 69 },
+	{ /* 243 */ "\\x0-&(-[]-\\uFFFF# : '.'", "", 1, 69 },
+	{ /* 244 */ "\\x0-&(-[]-\\uFFFF# : '0-9'", "", 1, 69 },
+	{ /* 245 */ "\\x0-&(-[]-\\uFFFF# : ':'", "", 1, 69 },
+	{ /* 246 */ "\\x0-&(-[]-\\uFFFF# : ';'", "", 1, 69 },
+	{ /* 247 */ "\\x0-&(-[]-\\uFFFF# : '<'", "", 1, 69 },
+	{ /* 248 */ "\\x0-&(-[]-\\uFFFF# : '='", "", 1, 69 },
+	{ /* 249 */ "\\x0-&(-[]-\\uFFFF# : '>'", "", 1, 69 },
+	{ /* 250 */ "\\x0-&(-[]-\\uFFFF# : '?'", "", 1, 69 },
+	{ /* 251 */ "\\x0-&(-[]-\\uFFFF# : '@'", "", 1, 69 },
+	{ /* 252 */ "\\x0-&(-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 69 },
+	{ /* 253 */ "\\x0-&(-[]-\\uFFFF# : '|'", "", 1, 69 },
+	{ /* 254 */ "\\x1-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 70 },
+	{ /* 255 */ "\\x1-\\uFFFF# : '\\t'", "", 1, 70 },
+	{ /* 256 */ "\\x1-\\uFFFF# : '\\n'", "", 1, 70 },
+	{ /* 257 */ "\\x1-\\uFFFF# : '\\r'", "", 1, 70 },
+	{ /* 258 */ "\\x1-\\uFFFF# : ' '", "", 1, 70 },
+	{ /* 259 */ "\\x1-\\uFFFF# : '!'", "", 1, 70 },
+	{ /* 260 */ "\\x1-\\uFFFF# : '\"'", "", 1, 70 },
+	{ /* 261 */ "\\x1-\\uFFFF# : '#%'", "", 1, 70 },
+	{ /* 262 */ "\\x1-\\uFFFF# : '$'", "", 1, 70 },
+	{ /* 263 */ "\\x1-\\uFFFF# : '''", "", 1, 70 },
+	{ /* 264 */ "\\x1-\\uFFFF# : '('", "", 1, 70 },
+	{ /* 265 */ "\\x1-\\uFFFF# : ')'", "", 1, 70 },
+	{ /* 266 */ "\\x1-\\uFFFF# : '*'", "", 1, 70 },
+	{ /* 267 */ "\\x1-\\uFFFF# : '+'", "", 1, 70 },
+	{ /* 268 */ "\\x1-\\uFFFF# : '.'", "", 1, 70 },
+	{ /* 269 */ "\\x1-\\uFFFF# : '0-9'", "", 1, 70 },
+	{ /* 270 */ "\\x1-\\uFFFF# : ':'", "", 1, 70 },
+	{ /* 271 */ "\\x1-\\uFFFF# : ';'", "", 1, 70 },
+	{ /* 272 */ "\\x1-\\uFFFF# : '<'", "", 1, 70 },
+	{ /* 273 */ "\\x1-\\uFFFF# : '='", "", 1, 70 },
+	{ /* 274 */ "\\x1-\\uFFFF# : '>'", "", 1, 70 },
+	{ /* 275 */ "\\x1-\\uFFFF# : '?'", "", 1, 70 },
+	{ /* 276 */ "\\x1-\\uFFFF# : '@'", "", 1, 70 },
+	{ /* 277 */ "\\x1-\\uFFFF# : 'A-Z_a-z'", "", 1, 70 },
+	{ /* 278 */ "\\x1-\\uFFFF# : '\\\\'", "", 1, 70 },
+	{ /* 279 */ "\\x1-\\uFFFF# : '|'", "", 1, 70 },
+	{ /* 280 */ "\\x0-!#-[]-\\uFFFF# : '\\x0'", "", 1, 71 },
+	{ /* 281 */ "\\x0-!#-[]-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 71 },
+	{ /* 282 */ "\\x0-!#-[]-\\uFFFF# : '\\t'", "", 1, 71 },
+	{ /* 283 */ "\\x0-!#-[]-\\uFFFF# : '\\n'", "", 1, 71 },
+	{ /* 284 */ "\\x0-!#-[]-\\uFFFF# : '\\r'", "", 1, 71 },
+	{ /* 285 */ "\\x0-!#-[]-\\uFFFF# : ' '", "", 1, 71 },
+	{ /* 286 */ "\\x0-!#-[]-\\uFFFF# : '!'", "", 1, 71 },
+	{ /* 287 */ "\\x0-!#-[]-\\uFFFF# : '#%'", "", 1, 71 },
+	{ /* 288 */ "\\x0-!#-[]-\\uFFFF# : '$'", "", 1, 71 },
+	{ /* 289 */ "\\x0-!#-[]-\\uFFFF# : '''", "", 1, 71 },
+	{ /* 290 */ "\\x0-!#-[]-\\uFFFF# : '('", "", 1, 71 },
+	{ /* 291 */ "\\x0-!#-[]-\\uFFFF# : ')'", "", 1, 71 },
+	{ /* 292 */ "\\x0-!#-[]-\\uFFFF# : '*'", "", 1, 71 },
+	{ /* 293 */ "\\x0-!#-[]-\\uFFFF# : '+'", "", 1, 71 },
+	{ /* 294 */ "\\x0-!#-[]-\\uFFFF# : '.'", "", 1, 71 },
+	{ /* 295 */ "\\x0-!#-[]-\\uFFFF# : '0-9'", "", 1, 71 },
+	{ /* 296 */ "\\x0-!#-[]-\\uFFFF# : ':'", "", 1, 71 },
+	{ /* 297 */ "\\x0-!#-[]-\\uFFFF# : ';'", "", 1, 71 },
+	{ /* 298 */ "\\x0-!#-[]-\\uFFFF# : '<'", "", 1, 71 },
+	{ /* 299 */ "\\x0-!#-[]-\\uFFFF# : '='", "", 1, 71 },
+	{ /* 300 */ "\\x0-!#-[]-\\uFFFF# : '>'", "", 1, 71 },
+	{ /* 301 */ "\\x0-!#-[]-\\uFFFF# : '?'", "", 1, 71 },
+	{ /* 302 */ "\\x0-!#-[]-\\uFFFF# : '@'", "", 1, 71 },
+	{ /* 303 */ "\\x0-!#-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 71 },
+	{ /* 304 */ "\\x0-!#-[]-\\uFFFF# : '|'", "", 1, 71 },
+	{ /* 305 */ "\\x0-=?-\\uFFFF# : '\\x0'", "", 1, 72 },
+	{ /* 306 */ "\\x0-=?-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 72 },
+	{ /* 307 */ "\\x0-=?-\\uFFFF# : '\\t'", "", 1, 72 },
+	{ /* 308 */ "\\x0-=?-\\uFFFF# : '\\n'", "", 1, 72 },
+	{ /* 309 */ "\\x0-=?-\\uFFFF# : '\\r'", "", 1, 72 },
+	{ /* 310 */ "\\x0-=?-\\uFFFF# : ' '", "", 1, 72 },
+	{ /* 311 */ "\\x0-=?-\\uFFFF# : '!'", "", 1, 72 },
+	{ /* 312 */ "\\x0-=?-\\uFFFF# : '\"'", "", 1, 72 },
+	{ /* 313 */ "\\x0-=?-\\uFFFF# : '#%'", "", 1, 72 },
+	{ /* 314 */ "\\x0-=?-\\uFFFF# : '$'", "", 1, 72 },
+	{ /* 315 */ "\\x0-=?-\\uFFFF# : '''", "", 1, 72 },
+	{ /* 316 */ "\\x0-=?-\\uFFFF# : '('", "", 1, 72 },
+	{ /* 317 */ "\\x0-=?-\\uFFFF# : ')'", "", 1, 72 },
+	{ /* 318 */ "\\x0-=?-\\uFFFF# : '*'", "", 1, 72 },
+	{ /* 319 */ "\\x0-=?-\\uFFFF# : '+'", "", 1, 72 },
+	{ /* 320 */ "\\x0-=?-\\uFFFF# : '.'", "", 1, 72 },
+	{ /* 321 */ "\\x0-=?-\\uFFFF# : '0-9'", "", 1, 72 },
+	{ /* 322 */ "\\x0-=?-\\uFFFF# : ':'", "", 1, 72 },
+	{ /* 323 */ "\\x0-=?-\\uFFFF# : ';'", "", 1, 72 },
+	{ /* 324 */ "\\x0-=?-\\uFFFF# : '<'", "", 1, 72 },
+	{ /* 325 */ "\\x0-=?-\\uFFFF# : '='", "", 1, 72 },
+	{ /* 326 */ "\\x0-=?-\\uFFFF# : '?'", "", 1, 72 },
+	{ /* 327 */ "\\x0-=?-\\uFFFF# : '@'", "", 1, 72 },
+	{ /* 328 */ "\\x0-=?-\\uFFFF# : 'A-Z_a-z'", "", 1, 72 },
+	{ /* 329 */ "\\x0-=?-\\uFFFF# : '\\\\'", "", 1, 72 },
+	{ /* 330 */ "\\x0-=?-\\uFFFF# : '|'", "", 1, 72 },
+	{ /* 331 */ "0-9A-Z_a-z# : '0-9'", "", 1, 73 },
+	{ /* 332 */ "0-9A-Z_a-z# : 'A-Z_a-z'", "", 1, 73 },
+	{ /* 333 */ "\\x0-\\t\\v-\\uFFFF# : '\\x0'", "", 1, 74 },
+	{ /* 334 */ "\\x0-\\t\\v-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 74 },
+	{ /* 335 */ "\\x0-\\t\\v-\\uFFFF# : '\\t'", "", 1, 74 },
+	{ /* 336 */ "\\x0-\\t\\v-\\uFFFF# : '\\r'", "", 1, 74 },
+	{ /* 337 */ "\\x0-\\t\\v-\\uFFFF# : ' '", "", 1, 74 },
+	{ /* 338 */ "\\x0-\\t\\v-\\uFFFF# : '!'", "", 1, 74 },
+	{ /* 339 */ "\\x0-\\t\\v-\\uFFFF# : '\"'", "", 1, 74 },
+	{ /* 340 */ "\\x0-\\t\\v-\\uFFFF# : '#%'", "", 1, 74 },
+	{ /* 341 */ "\\x0-\\t\\v-\\uFFFF# : '$'", "", 1, 74 },
+	{ /* 342 */ "\\x0-\\t\\v-\\uFFFF# : '''", "", 1, 74 },
+	{ /* 343 */ "\\x0-\\t\\v-\\uFFFF# : '('", "", 1, 74 },
+	{ /* 344 */ "\\x0-\\t\\v-\\uFFFF# : ')'", "", 1, 74 },
+	{ /* 345 */ "\\x0-\\t\\v-\\uFFFF# : '*'", "", 1, 74 },
+	{ /* 346 */ "\\x0-\\t\\v-\\uFFFF# : '+'", "", 1, 74 },
+	{ /* 347 */ "\\x0-\\t\\v-\\uFFFF# : '.'", "", 1, 74 },
+	{ /* 348 */ "\\x0-\\t\\v-\\uFFFF# : '0-9'", "", 1, 74 },
+	{ /* 349 */ "\\x0-\\t\\v-\\uFFFF# : ':'", "", 1, 74 },
+	{ /* 350 */ "\\x0-\\t\\v-\\uFFFF# : ';'", "", 1, 74 },
+	{ /* 351 */ "\\x0-\\t\\v-\\uFFFF# : '<'", "", 1, 74 },
+	{ /* 352 */ "\\x0-\\t\\v-\\uFFFF# : '='", "", 1, 74 },
+	{ /* 353 */ "\\x0-\\t\\v-\\uFFFF# : '>'", "", 1, 74 },
+	{ /* 354 */ "\\x0-\\t\\v-\\uFFFF# : '?'", "", 1, 74 },
+	{ /* 355 */ "\\x0-\\t\\v-\\uFFFF# : '@'", "", 1, 74 },
+	{ /* 356 */ "\\x0-\\t\\v-\\uFFFF# : 'A-Z_a-z'", "", 1, 74 },
+	{ /* 357 */ "\\x0-\\t\\v-\\uFFFF# : '\\\\'", "", 1, 74 },
+	{ /* 358 */ "\\x0-\\t\\v-\\uFFFF# : '|'", "", 1, 74 }
 };
 
-UNICC_STATIC UNICC_SCHAR* _lexem( _pcb* pcb )
+/* Symbol ID ranges; Terminals are numbered before the nonterminals */
+#define UNICC_TERMINALS				69
+#define UNICC_NONTERMINALS			141
+#define UNICC_NONTERM_IDX( sym )	( ( sym ) - UNICC_TERMINALS )
+
+#if 0
+/* Comb vector slots of a symbol in a state */
+#define UNICC_ACT_SLOT( st, sym )	( _act_base[ st ] + ( sym ) )
+#define UNICC_GO_SLOT( st, sym )	\
+    ( _go_base[ st ] + UNICC_NONTERM_IDX( sym ) )
+#endif
+
+#if 0
+#define _act_width			0
+#define _go_width			0
+#define _def_prod_width		0
+#define _dfa_select_width	0
+#define _dfa_idx_width		0
+#define _dfa_chars_width	0
+#define _dfa_trans_width	0
+#define _dfa_accept_width	0
+#define _dfa_fold_width		0
+#define _dfa_mask_width		0
+
+#define UNICC_UNPACK( tab, i ) \
+    ( (int)_unpack( _##tab, _##tab##_width, \
+                                (long)( i ) ) )
+
+/* Table accessors; The DFA index table holds character-range indexes */
+#define UNICC_ACT( st, i )		\
+    UNICC_UNPACK( act, (long)( st ) * ( 27 * 3 + 1 ) + ( i ) )
+#define UNICC_GO( st, i )		\
+    UNICC_UNPACK( go, (long)( st ) * ( 21 * 3 + 1 ) + ( i ) )
+#define UNICC_DEF_PROD( st )	UNICC_UNPACK( def_prod, st )
+#define UNICC_DFA_SELECT( st )	UNICC_UNPACK( dfa_select, st )
+#define UNICC_DFA_IDX( m, st )	\
+    ( UNICC_UNPACK( dfa_idx, \
+        (long)( m ) * 284 + ( st ) ) * 2 )
+#define UNICC_DFA_CHARS( i )	UNICC_UNPACK( dfa_chars, i )
+#define UNICC_DFA_TRANS( i )	UNICC_UNPACK( dfa_trans, i )
+#define UNICC_DFA_ACCEPT( m, st )	\
+    UNICC_UNPACK( dfa_accept, \
+        (long)( m ) * 284 + ( st ) )
+#define UNICC_DFA_FOLD( m )		UNICC_UNPACK( dfa_fold, m )
+#define UNICC_DFA_MASK( st, i )	\
+    UNICC_UNPACK( dfa_mask, (long)( st ) * 0 + ( i ) )
+#else
+/* Table accessors; The DFA index table holds character-range indexes */
+#define UNICC_ACT( st, i )			_act[ st ][ i ]
+#define UNICC_GO( st, i )			_go[ st ][ i ]
+#define UNICC_DEF_PROD( st )		_def_prod[ st ]
+#define UNICC_DFA_SELECT( st )		_dfa_select[ st ]
+#define UNICC_DFA_IDX( m, st )		( _dfa_idx[ m ][ st ] * 2 )
+#define UNICC_DFA_CHARS( i )		_dfa_chars[ i ]
+#define UNICC_DFA_TRANS( i )		_dfa_trans[ i ]
+#define UNICC_DFA_ACCEPT( m, st )	_dfa_accept[ m ][ st ]
+#define UNICC_DFA_FOLD( m )			_dfa_fold[ m ]
+#define UNICC_DFA_MASK( st, i )		_dfa_mask[ st ][ i ]
+#endif
+
+#if 0
+/* Unpacks value //i// of a table packed as little-endian values of //width//
+    bytes each */
+UNICC_STATIC long _unpack( const unsigned char* blob,
+                                    int width, long i )
+{
+    long	v;
+
+    blob += i * width;
+
+    if( ( v = blob[ width - 1 ] ) > 127 )
+        v -= 256;
+
+    while( --width )
+        v = v * 256 + blob[ width - 1 ];
+
+    return v;
+}
+#endif
+
+/* Don't report on unused _lexem, _ast_free or
+    _ast_print */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+UNICC_INTERN UNICC_SCHAR* _lexem( _pcb* pcb )
 {
 #if UNICC_WCHAR || !UNICC_UTF8
     pcb->lexem = pcb->buf;
@@ -16387,7 +16810,7 @@ UNICC_STATIC UNICC_SCHAR* _lexem( _pcb* pcb )
     return pcb->lexem;
 }
 
-
+#if 0
 UNICC_STATIC _ast* _ast_create( _pcb* pcb, char* emit,
                                                     UNICC_SCHAR* token )
 {
@@ -16424,10 +16847,7 @@ UNICC_STATIC _ast* _ast_create( _pcb* pcb, char* emit,
 
     return node;
 }
-
-/* Don't report on unused _ast_free or _ast_print */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
 
 UNICC_STATIC _ast* _ast_free( _ast* node )
 {
@@ -16479,23 +16899,43 @@ UNICC_STATIC void _ast_print( FILE* stream, _ast* node )
 
 UNICC_STATIC int _get_act( _pcb* pcb )
 {
+#if 0
+    switch( pcb->tos->state )
+    {
+
+    }
+#else
     int i;
 
-    for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
+#if 0
+    if( pcb->sym > -1 && _act_check[
+            i = UNICC_ACT_SLOT( pcb->tos->state, pcb->sym ) ]
+                == pcb->tos->state )
     {
-        if( _act[ pcb->tos->state ][i] == pcb->sym )
+        if( ( pcb->act = _act_next[ i ] & 3 ) == UNICC_ERROR )
+            return 0; /* Force parse error! */
+
+        pcb->idx = _act_next[ i ] >> 2;
+        return 1;
+    }
+#else
+    for( i = 1; i < UNICC_ACT( pcb->tos->state, 0 ) * 3; i += 3 )
+    {
+        if( UNICC_ACT( pcb->tos->state, i ) == pcb->sym )
         {
-            if( ( pcb->act = _act[ pcb->tos->state ][i+1] )
+            if( ( pcb->act = UNICC_ACT( pcb->tos->state, i + 1 ) )
                     == UNICC_ERROR )
                 return 0; /* Force parse error! */
 
-            pcb->idx = _act[ pcb->tos->state ][i+2];
+            pcb->idx = UNICC_ACT( pcb->tos->state, i + 2 );
             return 1;
         }
     }
+#endif
+#endif
 
     /* Default production */
-    if( ( pcb->idx = _def_prod[ pcb->tos->state ] ) > -1 )
+    if( ( pcb->idx = UNICC_DEF_PROD( pcb->tos->state ) ) > -1 )
     {
         pcb->act = 1; /* Reduce */
         return 1;
@@ -16506,17 +16946,34 @@ UNICC_STATIC int _get_act( _pcb* pcb )
 
 UNICC_STATIC int _get_go( _pcb* pcb )
 {
+#if 0
+    switch( pcb->tos->state )
+    {
+
+    }
+#else
     int i;
 
-    for( i = 1; i < _go[ pcb->tos->state ][0] * 3; i += 3 )
+#if 0
+    if( _go_check[ i = UNICC_GO_SLOT( pcb->tos->state, pcb->lhs ) ]
+            == pcb->tos->state )
+    {
+        pcb->act = _go_next[ i ] & 3;
+        pcb->idx = _go_next[ i ] >> 2;
+        return 1;
+    }
+#else
+    for( i = 1; i < UNICC_GO( pcb->tos->state, 0 ) * 3; i += 3 )
     {
-        if( _go[ pcb->tos->state ][i] == pcb->lhs )
+        if( UNICC_GO( pcb->tos->state, i ) == pcb->lhs )
         {
-            pcb->act = _go[ pcb->tos->state ][ i + 1 ];
-            pcb->idx = _go[ pcb->tos->state ][ i + 2 ];
+            pcb->act = UNICC_GO( pcb->tos->state, i + 1 );
+            pcb->idx = UNICC_GO( pcb->tos->state, i + 2 );
             return 1;
         }
     }
+#endif
+#endif
 
     return 0;
 }
@@ -16623,7 +17080,7 @@ UNICC_STATIC UNICC_CHAR _utf8_getchar( int (*getfn)() )
 
 #endif
 
-UNICC_STATIC UNICC_CHAR _get_input( _pcb* pcb, unsigned int offset )
+UNICC_INTERN UNICC_CHAR _get_input( _pcb* pcb, unsigned int offset )
 {
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: get input: pcb->buf + offset = %p pcb->bufend = %p\n",
@@ -16710,12 +17167,15 @@ UNICC_STATIC UNICC_CHAR _get_input( _pcb* pcb, unsigned int offset )
 
 UNICC_STATIC void _clear_input( _pcb* pcb )
 {
+#if UNICC_LINE_INFO
     int		i;
+#endif
 
     if( pcb->buf )
     {
         if( pcb->len )
         {
+#if UNICC_LINE_INFO
             /* Update counters for line and column */
             for( i = 0; i < pcb->len; i++ )
             {
@@ -16727,6 +17187,7 @@ UNICC_STATIC void _clear_input( _pcb* pcb )
                 else
                     pcb->column++;
             }
+#endif
 
 #if UNICC_DEBUG > 2
     fprintf( stderr, "%s: clear input: "
@@ -16764,419 +17225,19 @@ UNICC_STATIC void _clear_input( _pcb* pcb )
 #endif
 }
 
-#if 88
-UNICC_STATIC void _lex( _pcb* pcb )
+/* Runs the semantic action of the production pcb->idx to be reduced */
+UNICC_INTERN void _reduce( _pcb* pcb )
 {
-    int 			dfa_st	= 0;
-    unsigned int	len		= 0;
-    int				chr;
-    UNICC_CHAR		next;
-#if !0
-    int				mach	= _dfa_select[ pcb->tos->state ];
-#else
-    int				mach	= 0;
-#endif
-
-    next = _get_input( pcb, len );
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
-#endif
-
-    if( next == pcb->eof )
-    {
-        pcb->sym = 0;
-        return;
-    }
-
-    do
+    switch( pcb->idx )
     {
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
-#endif
-
-        chr = _dfa_idx[ mach ][ dfa_st ];
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
-#endif
-
-        dfa_st = -1;
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: FIRST next = %d _dfa_chars[ chr ] = %d, "
-            "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-                _dfa_chars[ chr ], _dfa_chars[ chr + 1 ] );
-#endif
-        while( _dfa_chars[ chr ] > -1 )
-        {
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d _dfa_chars[ chr ] = %d, "
-        "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-            _dfa_chars[ chr ], _dfa_chars[ chr + 1 ] );
-#endif
-            if( next >= _dfa_chars[ chr ] &&
-                next <= _dfa_chars[ chr+1 ] )
-            {
-                dfa_st = *( _dfa_trans + ( chr / 2 ) );
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
-#endif
-                if( _dfa_accept[ mach ][ dfa_st ] > 0 )
-                {
-                    pcb->len = len + 1;
-                    pcb->sym = _dfa_accept[ mach ][ dfa_st ] - 1;
-
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
-            UNICC_PARSER, pcb->sym, _symbols[ pcb->sym ].greedy );
-#endif
-                    if( pcb->sym == 0 )
+            case 0:
                     {
-                        dfa_st = -1; /* test! */
-                        break;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
-
-                    /* Stop if matched symbol should be parsed nongreedy */
-                    if( !_symbols[ pcb->sym ].greedy )
+                    break;
+                case 1:
                     {
-                        dfa_st = -1;
-                        break;
-                    }
-                }
-
-                next = _get_input( pcb, ++len );
-                break;
-            }
-
-            chr += 2;
-        }
-    }
-    while( dfa_st > -1 && next != pcb->eof );
-
-    if( pcb->sym > -1 )
-    {
-#if UNICC_SEMANTIC_TERM_SEL
-        /*
-            Execute scanner actions, if existing, but with
-            UNICC_ON_SHIFT = 0, so that no memory allocation
-            should be performed. This actions should only be
-            handled if there are semantic-code dependent
-            terminal symbol selections.
-
-            tos is incremented here, if the semantic code
-            stores data for the symbol. It won't get lost
-            in case of a shift.
-        */
-        _alloc_stack( pcb );
-        pcb->tos++;
-
-        next = pcb->buf[ pcb->len ];
-        pcb->buf[ pcb->len ] = '\0';
-
-#define UNICC_ON_SHIFT 	0
-        switch( pcb->sym )
-        {
-
-
-            default:
-                break;
-        }
-#undef UNICC_ON_SHIFT
-
-        pcb->buf[ pcb->len ] = next;
-
-        pcb->tos--;
-#endif /* UNICC_SEMANTIC_TERM_SEL */
-    }
-
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: function exits, pcb->sym = %d, pcb->len = %d\n",
-            UNICC_PARSER, pcb->sym, pcb->len );
-#endif
-}
-#endif
-
-UNICC_STATIC int _get_sym( _pcb* pcb )
-{
-    pcb->sym = -1;
-    pcb->len = 0;
-
-#if 0
-    do
-    {
-#endif
-#if !0
-
-#if UNICC_DEBUG > 2
-        fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
-                    UNICC_PARSER, pcb->tos->state,
-                        _dfa_select[ pcb->tos->state ] );
-#endif
-
-        if( _dfa_select[ pcb->tos->state ] > -1 )
-            _lex( pcb );
-        /*
-         * If there is no DFA state machine,
-         * try to identify the end-of-file symbol.
-         * If this also fails, a parse error will
-         * raise.
-         */
-        else if( _get_input( pcb, 0 ) == pcb->eof )
-            pcb->sym = 0;
-#else
-        _lex( pcb );
-#endif /* !0 */
-
-#if 0
-
-        if( pcb->sym > -1 && _symbols[ pcb->sym ].whitespace )
-        {
-            UNICC_CLEARIN( pcb );
-            continue;
-        }
-
-        break;
-    }
-    while( 1 );
-#endif /* 0 */
-
-    return ( pcb->sym > -1 ) ? 1 : 0;
-}
-
-#if UNICC_STACKDEBUG
-UNICC_STATIC void _dbg_stack( FILE* out,
-    _tok* stack, _tok* tos )
-{
-    fprintf( out, "%s: Stack Dump: ", UNICC_PARSER );
-
-    for( ; stack <= tos; stack++ )
-    {
-        fprintf( out, "%d%s%s%s ", stack->state,
-            stack->symbol ? " (" : "",
-            stack->symbol ? stack->symbol->name : "",
-            stack->symbol ? ")" : "" );
-    }
-
-    fprintf( out, "\n" );
-}
-#endif /* UNICC_STACKDEBUG */
-
-UNICC_STATIC int _handle_error( _pcb* pcb, FILE* _dbg )
-{
-#if UNICC_DEBUG
-    int					i;
-#endif
-
-    if( !pcb->error_delay )
-    {
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: !!!PARSE ERROR!!!\n"
-                "%s: error recovery: current token %d (%s)\n",
-                    UNICC_PARSER, UNICC_PARSER, pcb->sym,
-                        ( ( pcb->sym >= 0 ) ?
-                            _symbols[ pcb->sym ].name :
-                                "(null)" ) );
-
-        fprintf( _dbg,
-                "%s: error recovery: expecting ", UNICC_PARSER );
-
-        for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
-        {
-            fprintf( _dbg, "%d (%s)%s",
-                _act[ pcb->tos->state ][i],
-                _symbols[ _act[ pcb->tos->state ][i] ].name,
-                ( i == _act[ pcb->tos->state ][0] * 3 - 3 ) ?
-                        "\n" : ", " );
-        }
-
-        fprintf( _dbg, "\n%s: error recovery: error_delay is %d, %s\n",
-                    UNICC_PARSER, pcb->error_delay,
-                    ( pcb->error_delay ? "error recovery runs silently" :
-                        "error is reported before its recover!" ) );
-#endif
-    }
-
-#if -1 < 0
-    /* No error token defined? Then exit here... */
-
-#if UNICC_DEBUG
-    fprintf( _dbg,
-        "%s: error recovery: No error resync token used by grammar, "
-            "exiting parser.\n", UNICC_PARSER );
-#endif
-
-    UNICC_PARSE_ERROR( pcb );
-    pcb->error_count++;
-
-    return 1;
-#else
-    /*
-    _pcb 		org_pcb;
-    */
-
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-        "trying to recover...\n", UNICC_PARSER );
-#if UNICC_STACKDEBUG
-    _dbg_stack( _dbg, pcb->stack, pcb->tos );
-#endif
-#endif
-
-    #if 0
-    /* Create a copy of original parser control block (maybe later...) */
-    memcpy( &org_pcb, pcb, sizeof( _pcb ) );
-    org_pcb.buf = (char*)malloc( ( strlen( pcb->buf ) / UNICC_MALLOCSTEP +
-                    ( !( strlen( pcb->buf ) % UNICC_MALLOCSTEP ) ? 1 : 0 ) )
-                            * UNICC_MALLOCSTEP );
-    strcpy( org_pcb.buf, pcb->buf );
-    #endif
-
-    /* Remember previous symbol, or discard it */
-    if( pcb->error_delay != UNICC_ERROR_DELAY )
-        pcb->old_sym = pcb->sym;
-    else
-    {
-        pcb->old_sym = -1;
-        pcb->len = 1;
-        UNICC_CLEARIN( pcb );
-    }
-
-    /* Try to shift on error resync */
-    pcb->sym = -1;
-
-    while( pcb->tos >= pcb->stack )
-    {
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: error recovery: in state %d, trying "
-                "to shift error resync token...\n",
-                    UNICC_PARSER, pcb->tos->state );
-#if UNICC_STACKDEBUG
-        _dbg_stack( _dbg, pcb->stack, pcb->tos );
-#endif
-#endif
-        if( _get_act( pcb ) )
-        {
-            /* Shift */
-            if( pcb->act & UNICC_SHIFT )
-            {
-#if UNICC_DEBUG
-                fprintf( _dbg, "%s: error recovery: "
-                            "error resync shifted\n", UNICC_PARSER );
-#endif
-                break;
-            }
-        }
-
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: error recovery: failed, "
-                    "discarding token '%s'\n", UNICC_PARSER,
-                        pcb->tos->symbol ?
-                            pcb->tos->symbol->name : "NULL" );
-#endif
-
-        /* Discard one token from stack */
-        /* TODO: Discarded token memory (semantic action) */
-        pcb->tos--;
-    }
-
-    if( pcb->tos <= pcb->stack )
-    {
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-                "Can't recover this issue, stack is empty.\n",
-                    UNICC_PARSER );
-#endif
-        UNICC_PARSE_ERROR( pcb );
-        pcb->error_count++;
-
-        return 1;
-    }
-
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-                "trying to continue with modified parser state\n",
-                    UNICC_PARSER );
-#endif
-
-    pcb->error_delay = UNICC_ERROR_DELAY + 1;
-
-    return 0;
-
-#endif /* -1 >= 0 */
-}
-
-int _parse( _pcb* pcb )
-{
-    int			ret;
-    int					i;
-
-    _ast*		node;
-    _ast*		lnode;
-
-#if UNICC_DEBUG
-    _vtype*		vptr;
-    FILE* 				_dbg;
-
-    _dbg = stderr;
-#endif
-
-    /* If there is no Parser Control Block given, allocate your own one! */
-    if( !pcb )
-    {
-        if( !( pcb = (_pcb*)malloc( sizeof( _pcb ) ) ) )
-        {
-            /* Can't allocate memory */
-            UNICC_OUTOFMEM( pcb );
-            return (int)0;
-        }
-
-        memset( pcb, 0, sizeof( _pcb ) );
-        pcb->is_internal = 1;
-    }
-    else
-        pcb->is_internal = 0;
-
-    /* Initialize Parser Control Block */
-    pcb->stacksize = 0;
-    if( _alloc_stack( pcb ) < 0 )
-        return (int)0;
-
-    memset( pcb->tos, 0, sizeof( _tok ) );
-
-    pcb->act = UNICC_SHIFT;
-    pcb->sym = -1;
-    pcb->old_sym = -1;
-    pcb->line = 1;
-    pcb->column = 1;
-
-    memset( &pcb->test, 0, sizeof( _vtype ) );
-
-    /* Begin of main parser loop */
-    while( 1 )
-    {
-        /* Reduce */
-        while( pcb->act & UNICC_REDUCE )
-        {
-#if UNICC_DEBUG
-            fprintf( _dbg, "%s: << "
-                    "reducing by production %d (%s)\n",
-                        UNICC_PARSER, pcb->idx,
-                            _productions[ pcb->idx ].definition );
-#endif
-            /* Set default left-hand side */
-            pcb->lhs = _productions[ pcb->idx ].lhs;
-
-            /* Run reduction code */
-            memset( &( pcb->ret ), 0, sizeof( _vtype ) );
-
-            switch( pcb->idx )
-            {
-            case 0:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 1:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
                 case 2:
@@ -17184,2879 +17245,2825 @@ int _parse( _pcb* pcb )
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 3:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 4:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 5:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 6:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 7:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 8:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 9:
-                    {
-                        ;
-                    }
-                    break;
-                case 10:
-                    {
-                        ;
-                    }
-                    break;
-                case 11:
-                    {
-                        ;
-                    }
-                    break;
-                case 12:
-                    {
-                    #line 132 "src/parse.par"
-
-                            if( !( parser->p_template ) )
-                                parser->p_template = pstrdup( strbuf );
-                            else if( !pcb->main )
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "!language" );
-                            ;
-                    }
-                    break;
-                case 13:
-                    {
-                    #line 160 "src/parse.par"
- parser->p_mode = MODE_SCANNERLESS;     ;
-                    }
-                    break;
-                case 14:
-                    {
-                    #line 162 "src/parse.par"
- parser->p_mode = MODE_SCANNER;     ;
-                    }
-                    break;
-                case 15:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 16:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 17:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 18:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 19:
-                    {
-                    #line 174 "src/parse.par"
-
-                            LIST* l;
-                            SYMBOL* s;
-
-                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                            {
-                                s = l->pptr;
-
-                                /* Do not allow nonterminal definitions here
-                                    in conext-free model */
-                                if( s->type == SYM_NON_TERMINAL &&
-                                    parser->p_mode !=
-                                        MODE_SCANNERLESS )
-                                {
-                                    print_error( parser, ERR_NONTERM_WS_NOT_ALLOWED,
-                                        ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
-                                                pcb->filename, pcb->line,
-                                                    s->name );
-                                }
-                                else
-                                    s->whitespace = TRUE;
-                            }
-
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 20:
-                    {
-                    #line 201 "src/parse.par"
-
-                            LIST* l;
-                            SYMBOL* s;
-
-
-                            /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line, "lexeme" );
-                            }
-                            else
-                            {
-                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                                {
-                                    s = l->pptr;
-                                    s->lexem = TRUE;
-                                }
-                            }
-
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 21:
-                    {
-                    #line 227 "src/parse.par"
-
-                            LIST* l;
-                            SYMBOL* s;
-
-                            /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line, "fixate" );
-                            }
-                            else
-                            {
-                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                                {
-                                    s = l->pptr;
-                                    s->fixated = TRUE;
-                                }
-                            }
-
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 22:
-                    {
-                    #line 252 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_LEFT );     ;
-                    }
-                    break;
-                case 23:
-                    {
-                    #line 256 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_RIGHT );     ;
-                    }
-                    break;
-                case 24:
-                    {
-                    #line 260 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_NOASSOC );     ;
-                    }
-                    break;
-                case 25:
-                    {
-                    #line 263 "src/parse.par"
- parser->p_prefix = pstrcatstr(
-                            parser->p_prefix, strbuf, FALSE );     ;
-                    }
-                    break;
-                case 26:
-                    {
-                    #line 267 "src/parse.par"
-  if( !( parser->p_def_action ) )
-                                parser->p_def_action = pstrdup( strbuf );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default epsilon action" );
-                            ;
-                    }
-                    break;
-                case 27:
-                    {
-                    #line 277 "src/parse.par"
-    if( !( parser->p_def_action_e ) )
-                                parser->p_def_action_e = pstrdup( strbuf );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default epsilon action" );
-                            ;
-                    }
-                    break;
-                case 28:
-                    {
-                    #line 287 "src/parse.par"
-    if( !( parser->p_def_type ) )
-                                parser->p_def_type = create_vtype(
-                                    parser, (char*)( ( pcb->tos - 0 )->value.value_3 ) );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default value type" );
-
-                            pfree( ( ( pcb->tos - 0 )->value.value_3 ) );
-                            ;
-                    }
-                    break;
-                case 29:
-                    {
-                    #line 300 "src/parse.par"
-    /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "lexem separation" );
-                            }
-                            else
-                                parser->p_lexem_sep = !( ( pcb->tos - 0 )->value.value_0 );
-                            ;
-                    }
-                    break;
-                case 30:
-                    {
-                    #line 314 "src/parse.par"
-    parser->p_cis_strings = !( ( pcb->tos - 0 )->value.value_0 );        ;
-                    }
-                    break;
-                case 31:
-                    {
-                    #line 317 "src/parse.par"
-    parser->p_reserve_regex = !( ( pcb->tos - 0 )->value.value_0 );            ;
-                    }
-                    break;
-                case 32:
-                    {
-                    #line 320 "src/parse.par"
-    parser->p_header = pstrcatstr(
-                                parser->p_header, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 33:
-                    {
-                    #line 324 "src/parse.par"
-    parser->p_footer = pstrcatstr(
-                                parser->p_footer, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 34:
-                    {
-                    #line 327 "src/parse.par"
-    parser->p_pcb = pstrcatstr(
-                                parser->p_pcb, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 35:
-                    {
-                    #line 332 "src/parse.par"
-
-                            char*    src;
-                            char*    filename = strbuf;
-
-                            strbuf = NULL;
-
-                            if( !pfiletostr( &src, filename ) )
-                            {
-                                print_error( parser, ERR_OPEN_INPUT_FILE,
-                                                ERRSTYLE_FATAL, filename );
-                            }
-                            else
-                            {
-                                parse_grammar( parser, filename, src );
-                                strbuf = NULL;
-                                pfree( src );
-                            }
-
-                            pfree( filename );
-                            ;
-                    }
-                    break;
-                case 36:
-                    {
-                     pcb->ret.value_0 = ( ( pcb->tos - 0 )->value.value_0 );     ;
-                    }
-                    break;
-                case 37:
-                    {
-                    #line 356 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 38:
-                    {
-                    #line 359 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 39:
-                    {
-                    #line 360 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 40:
-                    {
-                    #line 364 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 41:
-                    {
-                    #line 366 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 42:
-                    {
-                    #line 370 "src/parse.par"
-  pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_NON_TERMINAL, TRUE );
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 43:
-                    {
-                    #line 378 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 44:
-                    {
-                    #line 380 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 45:
-                    {
-                    #line 384 "src/parse.par"
-  pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ),
-                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
-                            ( ( pcb->tos - 0 )->value.value_2 )->derived_from =
-                                (SYMBOL*)list_access( ( ( pcb->tos - 1 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 46:
-                    {
-                    #line 390 "src/parse.par"
-  pcb->ret.value_1 = list_push( (LIST*)NULL,
-                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
-
-                            current_sym = ( ( pcb->tos - 0 )->value.value_2 );
-                            ;
-                    }
-                    break;
-                case 47:
-                    {
-                    #line 398 "src/parse.par"
-  pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
-
-                            if( pcb->ret.value_2->defined )
-                            {
-                                print_error( parser, ERR_DOUBLE_TERMINAL_DEF,
-                                    ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            pcb->ret.value_2->name );
-                            }
-
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 48:
-                    {
-                    #line 414 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 49:
-                    {
-                    #line 415 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 50:
-                    {
-                    #line 416 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 51:
-                    {
-                    #line 417 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 52:
-                    {
-                    #line 425 "src/parse.par"
-
-                            LIST*     l;
-                            LIST*    m;
-                            PROD*     p;
-                            SYMBOL*    lhs;
-                            VTYPE*    vt        = (VTYPE*)NULL;
-
-                            ( ( pcb->tos - 3 )->value.value_1 ) = list_push( ( ( pcb->tos - 3 )->value.value_1 ), (void*)( ( pcb->tos - 5 )->value.value_2 ) );
-
-                            /* Value type */
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                vt = create_vtype( parser,
-                                        (char*)( ( pcb->tos - 2 )->value.value_3 ) );
-
-                                pfree( ( ( pcb->tos - 2 )->value.value_3 ) );
-                            }
-
-                            /* Connect left-hand sides */
-                            for( l = ( ( pcb->tos - 3 )->value.value_1 ); l; l = list_next( l ) )
-                            {
-                                lhs = (SYMBOL*)list_access( l );
-
-                                LISTFOR( ( ( pcb->tos - 0 )->value.value_1 ), m )
-                                    plist_push( lhs->productions,
-                                        list_access( m ) );
-
-                                lhs->vtype = vt;
-                            }
-
-                            /* Link productions with this left-hand sides */
-                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                            {
-                                LIST* m;
-
-                                p = (PROD*)list_access( l );
-
-                                p->lhs = ( ( pcb->tos - 5 )->value.value_2 );
-
-                                LISTFOR( ( ( pcb->tos - 3 )->value.value_1 ), m )
-                                    plist_push( p->all_lhs, list_access( m ) );
-
-                                /* AST */
-                                if( ( ( pcb->tos - 1 )->value.value_0 ) && !p->emit )
-                                    p->emit = pstrdup( ( ( pcb->tos - 5 )->value.value_2 )->name );
-                            }
-
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            list_free( ( ( pcb->tos - 3 )->value.value_1 ) );
-
-                            /* Goal primary defined? */
-                            if( ( ( pcb->tos - 4 )->value.value_0 ) && pcb->main )
-                            {
-                                if( parser->goal )
-                                {
-                                    print_error( parser, ERR_MULTIPLE_GOAL_DEF,
-                                        ERRSTYLE_FATAL,
-                                            parser->goal->name );
-                                }
-                                else
-                                {
-                                    parser->goal = ( ( pcb->tos - 5 )->value.value_2 );
-                                    parser->goal->used = TRUE;
-                                }
-                            }
-                            ;
-                    }
-                    break;
-                case 53:
-                    {
-                     pcb->ret.value_1 = ( ( pcb->tos - 0 )->value.value_1 );     ;
-                    }
-                    break;
-                case 54:
-                    {
-                     pcb->ret.value_1 = 0;     ;
-                    }
-                    break;
-                case 55:
-                    {
-                    #line 495 "src/parse.par"
-
-                            SYMBOL* primary;
-                            SYMBOL* s;
-                            LIST* l;
-                            VTYPE* vt;
-
-                            primary = (SYMBOL*)list_access( ( ( pcb->tos - 5 )->value.value_1 ) );
-
-                            primary->ptn = ( ( pcb->tos - 3 )->value.value_6 );
-                            primary->greedy = greedy;
-                            primary->emit = ( ( pcb->tos - 1 )->value.value_3 );
-
-                            greedy = TRUE;
-
-                            /* Attach code */
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                /* Copy code for every symbol  */
-                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
-                                    l = list_next( l ) )
-                                {
-                                    s = (SYMBOL*)list_access( l );
-
-                                    /*
-                                        Last symbol gets strbuf-pointer,
-                                        all other assignments need to be
-                                        duplicated.
-                                    */
-                                    if( list_next( l ) )
-                                        s->code = pstrdup( strbuf );
-                                    else
-                                        s->code = strbuf;
-
-                                    primary->code_at = last_code_begin;
-                                }
-
-                                strbuf = (char*)NULL;
-                            }
-
-                            /* Value type */
-                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
-                            {
-                                vt = create_vtype( parser, ( ( pcb->tos - 4 )->value.value_3 ) );
-
-                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
-                                    l = list_next( l ) )
-                                {
-                                    s = (SYMBOL*)list_access( l );
-                                    s->vtype = vt;
-                                }
-
-                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
-                            }
-
-                            /* re_dbg_print_nfa( s->nfa_def,
-                                parser->p_universe ); */
-
-                            /* Assign the list of all possible symbols to
-                                the primary symbol */
-                            LISTFOR( ( ( pcb->tos - 5 )->value.value_1 ), l )
-                                plist_push( primary->all_sym,
-                                    list_access( l ) );
-
-                            current_sym = (SYMBOL*)NULL;
-                            ;
-                    }
-                    break;
-                case 56:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 57:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 58:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 59:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 60:
-                    {
-                    #line 563 "src/parse.par"
- greedy = TRUE;     ;
-                    }
-                    break;
-                case 61:
-                    {
-                    #line 565 "src/parse.par"
- greedy = FALSE;     ;
-                    }
-                    break;
-                case 62:
-                    {
-                    #line 569 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 63:
-                    {
-                    #line 571 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 64:
-                    {
-                    #line 575 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 2 )->value.value_1 ), ( ( pcb->tos - 0 )->value.value_4 ) );     ;
-                    }
-                    break;
-                case 65:
-                    {
-                    #line 578 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, ( ( pcb->tos - 0 )->value.value_4 ) );     ;
-                    }
-                    break;
-                case 66:
-                    {
-                    #line 582 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
-                    }
-                    break;
-                case 67:
-                    {
-                    #line 584 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
-                    }
-                    break;
-                case 68:
-                    {
-                    #line 586 "src/parse.par"
- pcb->ret.value_3 = (char*)NULL;     ;
-                    }
-                    break;
-                case 69:
-                    {
-                    #line 592 "src/parse.par"
-
-                            ( ( pcb->tos - 3 )->value.value_4 )->line = ( ( pcb->tos - 4 )->value.value_5 );
-
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                ( ( pcb->tos - 3 )->value.value_4 )->code = ( ( pcb->tos - 2 )->value.value_3 );
-                                ( ( pcb->tos - 3 )->value.value_4 )->code_at = last_code_begin;
-                            }
-
-                            ( ( pcb->tos - 3 )->value.value_4 )->emit = ( ( pcb->tos - 1 )->value.value_3 );
-
-                            pcb->ret.value_4 = ( ( pcb->tos - 3 )->value.value_4 );
-
-                            current_prod = (PROD*)NULL;
-                            ;
-                    }
-                    break;
-                case 70:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 71:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 72:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 73:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 74:
-                    {
-                     pcb->ret.value_4 = ( ( pcb->tos - 0 )->value.value_4 );     ;
-                    }
-                    break;
-                case 75:
-                    {
-                    #line 610 "src/parse.par"
-
-                            pcb->ret.value_4 = current_prod = create_production( parser,
-                                    (SYMBOL*)NULL );
-                            ;
-                    }
-                    break;
-                case 76:
-                    {
-                    #line 618 "src/parse.par"
-    current_prod->prec = ( ( pcb->tos - 0 )->value.value_2 )->prec;     ;
-                    }
-                    break;
-                case 77:
-                    {
-                    #line 624 "src/parse.par"
-    append_to_production( ( ( pcb->tos - 2 )->value.value_4 ), ( ( pcb->tos - 1 )->value.value_2 ),
-                                ( *strbuf == '\0' ? (char*)NULL :
-                                            pstrdup( strbuf ) ) );
-                                    pcb->ret.value_4 = ( ( pcb->tos - 2 )->value.value_4 );
-                            ;
-                    }
-                    break;
-                case 78:
-                    {
-                    #line 632 "src/parse.par"
-    pcb->ret.value_4 = current_prod =
-                                create_production( parser,
-                                    (SYMBOL*)NULL );
-
-                            append_to_production( pcb->ret.value_4, ( ( pcb->tos - 1 )->value.value_2 ),
-                                ( *strbuf == '\0' ? (char*)NULL :
-                                    pstrdup( strbuf ) ) );
-                            ;
-                    }
-                    break;
-                case 79:
-                    {
-                    #line 644 "src/parse.par"
-
-                            switch( ( ( pcb->tos - 0 )->value.value_5 ) )
-                            {
-                                case '*':
-                                    pcb->ret.value_2 = kleene_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                case '+':
-                                    pcb->ret.value_2 = positive_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                case '?':
-                                    pcb->ret.value_2 = optional_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                default:
-                                    pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );
-                                    break;
-                            }
-                            ;
-                    }
-                    break;
-                case 80:
-                    {
-                    #line 664 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    P_ERROR_RESYNC, SYM_SYSTEM_TERMINAL,
-                                        TRUE );
-                            ;
-                    }
-                    break;
-                case 81:
-                    {
-                    #line 671 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    P_END_OF_FILE, SYM_SYSTEM_TERMINAL,
-                                        TRUE );
-                            ;
-                    }
-                    break;
-                case 82:
-                    {
-                     pcb->ret.value_2 = ( ( pcb->tos - 0 )->value.value_2 );     ;
-                    }
-                    break;
-                case 83:
-                    {
-                    #line 681 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_NON_TERMINAL, TRUE );
-                            pcb->ret.value_2->used = TRUE;
-
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 84:
-                    {
-                    #line 692 "src/parse.par"
-
-                            char    temp_nonterm[ ONE_LINE + 1 ];
-                            PROD*    prod;
-                            LIST*    l;
-
-                            sprintf( temp_nonterm, P_EMBEDDED,
-                                    embedded_count++ );
-
-                            pcb->ret.value_2 = get_symbol( parser,
-                                    temp_nonterm, SYM_NON_TERMINAL,
-                                        TRUE );
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->used = TRUE;
-                            pcb->ret.value_2->generated = TRUE;
-
-                            /* Value type */
-                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
-                            {
-                                VTYPE*    vt;
-
-                                vt = create_vtype( parser,
-                                        (char*)( ( pcb->tos - 4 )->value.value_3 ) );
-                                pcb->ret.value_2->vtype = vt;
-
-                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
-                            }
-
-                            /* Associate the productions */
-                            current_prod = ( ( pcb->tos - 2 )->value.value_4 );
-
-                            /* Link productions with this left-hand side */
-                            for( l = ( ( pcb->tos - 1 )->value.value_1 ); l; l = list_next( l ) )
-                            {
-                                prod = (PROD*)list_access( l );
-
-                                prod->lhs = pcb->ret.value_2;
-                                plist_push( pcb->ret.value_2->productions, prod );
-                                plist_push( prod->all_lhs, pcb->ret.value_2 );
-                                make_semantic_rhs( prod );
-                            }
-                            ;
-                    }
-                    break;
-                case 85:
-                    {
-                    #line 736 "src/parse.par"
-     pcb->ret.value_4 = current_prod;
-                            current_prod = (PROD*)NULL;
-                            ;
-                    }
-                    break;
-                case 86:
-                    {
-                    #line 743 "src/parse.par"
-
-                            pccl*        ccl;
-
-                            ccl = pccl_create( -1, -1, strbuf );
-                            if( ( ( pcb->tos - 0 )->value.value_0 ) )
-                                pccl_negate( ccl );
-
-                            pcb->ret.value_2 = get_symbol( parser, (void*)ccl,
-                                    SYM_CCL_TERMINAL, TRUE );
-
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->used = TRUE;
-
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 87:
-                    {
-                    #line 762 "src/parse.par"
-
-                            pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
-
-                            pcb->ret.value_2->used = TRUE;
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->keyword = TRUE;
-                            pcb->ret.value_2->emit = ( ( pcb->tos - 0 )->value.value_0 ) ? pstrdup( strbuf ) : NULL;
-
-                            pcb->ret.value_2->ptn = pregex_ptn_create_string( strbuf,
-                                        parser->p_cis_strings ?
-                                            PREGEX_COMP_INSENSITIVE : 0 );
-
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 88:
-                    {
-                    #line 781 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
-
-                            /* pcb->ret.value_2->defined = TRUE;
-                            DO NOT SET DEFINED! */
-                            pcb->ret.value_2->used = TRUE;
-
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 89:
-                    {
-                    #line 794 "src/parse.par"
-  pcb->ret.value_5 = (int)'*';     ;
-                    }
-                    break;
-                case 90:
-                    {
-                    #line 797 "src/parse.par"
- pcb->ret.value_5 = (int)'+';     ;
-                    }
-                    break;
-                case 91:
-                    {
-                    #line 800 "src/parse.par"
- pcb->ret.value_5 = (int)'?';     ;
-                    }
-                    break;
-                case 92:
-                    {
-                    #line 803 "src/parse.par"
- pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 93:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 94:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 95:
-                    {
-                    #line 809 "src/parse.par"
- reset_strbuf();     ;
-                    }
-                    break;
-                case 96:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 97:
-                    {
-                    #line 818 "src/parse.par"
-
-                            pcb->ret.value_6 = pregex_ptn_create_alt(
-                                    ( ( pcb->tos - 2 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
-                            ;
-                    }
-                    break;
-                case 98:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 99:
-                    {
-                    #line 829 "src/parse.par"
-
-                            pcb->ret.value_6 = pregex_ptn_create_seq(
-                                    ( ( pcb->tos - 1 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
-                            ;
-                    }
-                    break;
-                case 100:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 101:
-                    {
-                    #line 841 "src/parse.par"
-
-                            pcb->ret.value_6 = pregex_ptn_create_kle( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
-                    }
-                    break;
-                case 102:
-                    {
-                    #line 847 "src/parse.par"
-
-                            pcb->ret.value_6 = pregex_ptn_create_pos( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
-                    }
-                    break;
-                case 103:
+                case 3:
                     {
-                    #line 853 "src/parse.par"
-
-                            pcb->ret.value_6 = pregex_ptn_create_opt( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 104:
+                case 4:
                     {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 105:
+                case 5:
                     {
-                    #line 863 "src/parse.par"
-
-                        pccl*        ccl;
-
-                        ccl = pccl_create( -1, -1, strbuf );
-                        if( ( ( pcb->tos - 0 )->value.value_0 ) )
-                            pccl_negate( ccl );
-
-                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 106:
+                case 6:
                     {
-                    #line 875 "src/parse.par"
-
-                        pcb->ret.value_6 = pregex_ptn_create_string( strbuf, 0 );
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 107:
+                case 7:
                     {
-                    #line 881 "src/parse.par"
-
-                        pccl*    ccl;
-                        greedy = FALSE;
-
-                        ccl = pccl_create( -1, -1, (char*)NULL );
-
-                        pccl_addrange( ccl, PCCL_MIN, PCCL_MAX );
-
-                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 108:
+                case 8:
                     {
-                    #line 894 "src/parse.par"
-
-                        pcb->ret.value_6 = pregex_ptn_create_sub( ( ( pcb->tos - 1 )->value.value_6 ) );
-                        ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 109:
+                case 9:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 110:
+                case 10:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 111:
+                case 11:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 112:
+                case 12:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 132 "src/parse.par"
+
+                            if( !( parser->p_template ) )
+                                parser->p_template = pstrdup( strbuf );
+                            else if( !pcb->main )
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "!language" );
+                            ;
                     }
                     break;
-                case 113:
+                case 13:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_0 );     ;
+                    #line 160 "src/parse.par"
+ parser->p_mode = MODE_SCANNERLESS;     ;
                     }
                     break;
-                case 114:
+                case 14:
                     {
-                    #line 908 "src/parse.par"
-    pcb->ret.value_0 = FALSE;     ;
+                    #line 162 "src/parse.par"
+ parser->p_mode = MODE_SCANNER;     ;
                     }
                     break;
-                case 115:
+                case 15:
                     {
-                    #line 912 "src/parse.par"
-    pcb->ret.value_0 = TRUE;     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 116:
+                case 16:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 2 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 117:
+                case 17:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 118:
+                case 18:
                     {
-                    #line 921 "src/parse.par"
-  reset_strbuf();     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 119:
+                case 19:
                     {
-                    #line 925 "src/parse.par"
-  strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 174 "src/parse.par"
+
+                            LIST* l;
+                            SYMBOL* s;
+
+                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                            {
+                                s = l->pptr;
+
+                                /* Do not allow nonterminal definitions here
+                                    in conext-free model */
+                                if( s->type == SYM_NON_TERMINAL &&
+                                    parser->p_mode !=
+                                        MODE_SCANNERLESS )
+                                {
+                                    print_error( parser, ERR_NONTERM_WS_NOT_ALLOWED,
+                                        ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
+                                                pcb->filename, pcb->line,
+                                                    s->name );
+                                }
+                                else
+                                    s->whitespace = TRUE;
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 120:
+                case 20:
                     {
-                    #line 928 "src/parse.par"
+                    #line 201 "src/parse.par"
 
-                        strbuf_append( (char)'\\' );
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                            LIST* l;
+                            SYMBOL* s;
+
+
+                            /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line, "lexeme" );
+                            }
+                            else
+                            {
+                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                                {
+                                    s = l->pptr;
+                                    s->lexem = TRUE;
+                                }
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 121:
+                case 21:
                     {
-                    #line 934 "src/parse.par"
- pcb->ret.value_0 = TRUE     ;
+                    #line 227 "src/parse.par"
+
+                            LIST* l;
+                            SYMBOL* s;
+
+                            /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line, "fixate" );
+                            }
+                            else
+                            {
+                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                                {
+                                    s = l->pptr;
+                                    s->fixated = TRUE;
+                                }
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 122:
+                case 22:
                     {
-                    #line 935 "src/parse.par"
- pcb->ret.value_0 = FALSE     ;
+                    #line 252 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_LEFT );     ;
                     }
                     break;
-                case 123:
+                case 23:
                     {
-                    #line 939 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 256 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_RIGHT );     ;
                     }
                     break;
-                case 124:
+                case 24:
                     {
-                    #line 940 "src/parse.par"
-    reset_strbuf();     ;
+                    #line 260 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_NOASSOC );     ;
                     }
                     break;
-                case 125:
+                case 25:
                     {
-                    #line 944 "src/parse.par"
-     strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 263 "src/parse.par"
+ parser->p_prefix = pstrcatstr(
+                            parser->p_prefix, strbuf, FALSE );     ;
                     }
                     break;
-                case 126:
+                case 26:
                     {
-                    #line 947 "src/parse.par"
-     strbuf_append( (char)'\\' );
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 267 "src/parse.par"
+  if( !( parser->p_def_action ) )
+                                parser->p_def_action = pstrdup( strbuf );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default epsilon action" );
+                            ;
                     }
                     break;
-                case 127:
+                case 27:
                     {
-                    #line 953 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
+                    #line 277 "src/parse.par"
+    if( !( parser->p_def_action_e ) )
+                                parser->p_def_action_e = pstrdup( strbuf );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default epsilon action" );
+                            ;
                     }
                     break;
-                case 128:
+                case 28:
                     {
-                    #line 954 "src/parse.par"
- pcb->ret.value_3 = (char*)NULL;     ;
+                    #line 287 "src/parse.par"
+    if( !( parser->p_def_type ) )
+                                parser->p_def_type = create_vtype(
+                                    parser, (char*)( ( pcb->tos - 0 )->value.value_3 ) );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default value type" );
+
+                            pfree( ( ( pcb->tos - 0 )->value.value_3 ) );
+                            ;
                     }
                     break;
-                case 129:
+                case 29:
                     {
-                    #line 958 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 300 "src/parse.par"
+    /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "lexem separation" );
+                            }
+                            else
+                                parser->p_lexem_sep = !( ( pcb->tos - 0 )->value.value_0 );
+                            ;
                     }
                     break;
-                case 130:
+                case 30:
                     {
-                    #line 959 "src/parse.par"
- reset_strbuf();     ;
+                    #line 314 "src/parse.par"
+    /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "skip whitespaces" );
+                            }
+                            else
+                                parser->p_ws_skip = !( ( pcb->tos - 0 )->value.value_0 );
+                            ;
                     }
                     break;
-                case 131:
+                case 31:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 328 "src/parse.par"
+    /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "shared lexers" );
+                            }
+                            else
+                                parser->p_shared_dfas = !( ( pcb->tos - 0 )->value.value_0 );
+                            ;
                     }
                     break;
-                case 132:
+                case 32:
                     {
-                    #line 966 "src/parse.par"
-
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 342 "src/parse.par"
+    /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "regular lexemes" );
+                            }
+                            else
+                                parser->p_regular_lexemes = !( ( pcb->tos - 0 )->value.value_0 );
+                            ;
                     }
                     break;
-                case 133:
+                case 33:
                     {
-                    #line 974 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 356 "src/parse.par"
+    parser->p_cis_strings = !( ( pcb->tos - 0 )->value.value_0 );        ;
                     }
                     break;
-                case 134:
+                case 34:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 359 "src/parse.par"
+    parser->p_reserve_regex = !( ( pcb->tos - 0 )->value.value_0 );            ;
                     }
                     break;
-                case 135:
+                case 35:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 362 "src/parse.par"
+    parser->p_header = pstrcatstr(
+                                parser->p_header, strbuf, FALSE );        ;
                     }
                     break;
-                case 136:
+                case 36:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 366 "src/parse.par"
+    parser->p_footer = pstrcatstr(
+                                parser->p_footer, strbuf, FALSE );        ;
                     }
                     break;
-                case 137:
+                case 37:
                     {
-                    #line 986 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 369 "src/parse.par"
+    parser->p_pcb = pstrcatstr(
+                                parser->p_pcb, strbuf, FALSE );        ;
                     }
                     break;
-                case 138:
+                case 38:
                     {
-                    #line 988 "src/parse.par"
+                    #line 374 "src/parse.par"
 
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
-                    }
-                    break;
-                case 139:
-                    {
-                    #line 996 "src/parse.par"
+                            char*    src;
+                            char*    filename = strbuf;
 
-                        pcb->ret.value_3 = pstrdup( ( ( pcb->tos - 0 )->value.value_3 ) );
-                        reset_strbuf();
-                        ;
-                    }
-                    break;
-                case 140:
-                    {
-                    #line 1003 "src/parse.par"
-    pcb->ret.value_3 = strbuf;     ;
+                            strbuf = NULL;
+
+                            if( !pfiletostr( &src, filename ) )
+                            {
+                                print_error( parser, ERR_OPEN_INPUT_FILE,
+                                                ERRSTYLE_FATAL, filename );
+                            }
+                            else
+                            {
+                                parse_grammar( parser, filename, src );
+                                strbuf = NULL;
+                                pfree( src );
+                            }
+
+                            parser->sources = list_push( parser->sources,
+                                                            filename );
+                            ;
                     }
                     break;
-                case 141:
+                case 39:
                     {
-                    #line 1005 "src/parse.par"
-
-                        reset_strbuf();
-                        pcb->ret.value_3 = (char*)NULL;
-                        ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 0 )->value.value_0 );     ;
                     }
                     break;
-                case 142:
+                case 40:
                     {
-                    #line 1012 "src/parse.par"
-
-                        if( !parser->p_template )
-                        {
-                            print_error( parser,
-                                ERR_NO_TARGET_TPL_SUPPLY,
-                                    ERRSTYLE_WARNING | ERRSTYLE_IMPORTANT
-                                            | ERRSTYLE_FILEINFO,
-                                        pcb->filename, last_code_begin );
-
-                            reset_strbuf();
-                        }
-                        ;
+                    #line 399 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 143:
+                case 41:
                     {
-                    #line 1027 "src/parse.par"
- last_code_begin = pcb->line;     ;
+                    #line 402 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 144:
+                case 42:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 403 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 145:
+                case 43:
                     {
-                    #line 1031 "src/parse.par"
-    reset_strbuf();     ;
+                    #line 407 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 146:
+                case 44:
                     {
-                    #line 1035 "src/parse.par"
-    strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );            ;
+                    #line 409 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 147:
+                case 45:
                     {
-                    #line 1038 "src/parse.par"
-
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 413 "src/parse.par"
+  pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_NON_TERMINAL, TRUE );
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 151:
+                case 46:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 421 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 152:
+                case 47:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 423 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 154:
+                case 48:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 427 "src/parse.par"
+  pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ),
+                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
+                            ( ( pcb->tos - 0 )->value.value_2 )->derived_from =
+                                (SYMBOL*)list_access( ( ( pcb->tos - 1 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 155:
+                case 49:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 433 "src/parse.par"
+  pcb->ret.value_1 = list_push( (LIST*)NULL,
+                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
+
+                            current_sym = ( ( pcb->tos - 0 )->value.value_2 );
+                            ;
                     }
                     break;
-                case 158:
+                case 50:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 441 "src/parse.par"
+  pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+
+                            if( pcb->ret.value_2->defined )
+                            {
+                                print_error( parser, ERR_DOUBLE_TERMINAL_DEF,
+                                    ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            pcb->ret.value_2->name );
+                            }
+
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 159:
+                case 51:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 457 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 160:
+                case 52:
                     {
-                    #line 1057 "src/parse.par"
-
-                        pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );
-                        ;
+                    #line 458 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 161:
+                case 53:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 459 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 162:
+                case 54:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 460 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 163:
+                case 55:
                     {
-                    #line 1066 "src/parse.par"
- pcb->ret.value_5 = pcb->line;     ;
+                    #line 468 "src/parse.par"
+
+                            LIST*     l;
+                            LIST*    m;
+                            PROD*     p;
+                            SYMBOL*    lhs;
+                            VTYPE*    vt        = (VTYPE*)NULL;
+
+                            ( ( pcb->tos - 3 )->value.value_1 ) = list_push( ( ( pcb->tos - 3 )->value.value_1 ), (void*)( ( pcb->tos - 5 )->value.value_2 ) );
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                vt = create_vtype( parser,
+                                        (char*)( ( pcb->tos - 2 )->value.value_3 ) );
+
+                                pfree( ( ( pcb->tos - 2 )->value.value_3 ) );
+                            }
+
+                            /* Connect left-hand sides */
+                            for( l = ( ( pcb->tos - 3 )->value.value_1 ); l; l = list_next( l ) )
+                            {
+                                lhs = (SYMBOL*)list_access( l );
+
+                                LISTFOR( ( ( pcb->tos - 0 )->value.value_1 ), m )
+                                    plist_push( lhs->productions,
+                                        list_access( m ) );
+
+                                lhs->vtype = vt;
+                            }
+
+                            /* Link productions with this left-hand sides */
+                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                            {
+                                LIST* m;
+
+                                p = (PROD*)list_access( l );
+
+                                p->lhs = ( ( pcb->tos - 5 )->value.value_2 );
+
+                                LISTFOR( ( ( pcb->tos - 3 )->value.value_1 ), m )
+                                    plist_push( p->all_lhs, list_access( m ) );
+
+                                /* AST */
+                                if( ( ( pcb->tos - 1 )->value.value_0 ) && !p->emit )
+                                    p->emit = pstrdup( ( ( pcb->tos - 5 )->value.value_2 )->name );
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            list_free( ( ( pcb->tos - 3 )->value.value_1 ) );
+
+                            /* Goal primary defined? */
+                            if( ( ( pcb->tos - 4 )->value.value_0 ) && pcb->main )
+                            {
+                                if( parser->goal )
+                                {
+                                    print_error( parser, ERR_MULTIPLE_GOAL_DEF,
+                                        ERRSTYLE_FATAL,
+                                            parser->goal->name );
+                                }
+                                else
+                                {
+                                    parser->goal = ( ( pcb->tos - 5 )->value.value_2 );
+                                    parser->goal->used = TRUE;
+                                }
+                            }
+                            ;
                     }
                     break;
-                case 164:
+                case 56:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_1 = ( ( pcb->tos - 0 )->value.value_1 );     ;
                     }
                     break;
-                case 170:
+                case 57:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_1 = 0;     ;
                     }
                     break;
-                case 171:
+                case 58:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 538 "src/parse.par"
+
+                            SYMBOL* primary;
+                            SYMBOL* s;
+                            LIST* l;
+                            VTYPE* vt;
+
+                            primary = (SYMBOL*)list_access( ( ( pcb->tos - 5 )->value.value_1 ) );
+
+                            primary->ptn = ( ( pcb->tos - 3 )->value.value_6 );
+                            primary->greedy = greedy;
+                            primary->emit = ( ( pcb->tos - 1 )->value.value_3 );
+
+                            greedy = TRUE;
+
+                            /* Attach code */
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                /* Copy code for every symbol  */
+                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
+                                    l = list_next( l ) )
+                                {
+                                    s = (SYMBOL*)list_access( l );
+
+                                    /*
+                                        Last symbol gets strbuf-pointer,
+                                        all other assignments need to be
+                                        duplicated.
+                                    */
+                                    if( list_next( l ) )
+                                        s->code = pstrdup( strbuf );
+                                    else
+                                        s->code = strbuf;
+
+                                    primary->code_at = last_code_begin;
+                                }
+
+                                strbuf = (char*)NULL;
+                            }
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
+                            {
+                                vt = create_vtype( parser, ( ( pcb->tos - 4 )->value.value_3 ) );
+
+                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
+                                    l = list_next( l ) )
+                                {
+                                    s = (SYMBOL*)list_access( l );
+                                    s->vtype = vt;
+                                }
+
+                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
+                            }
+
+                            /* re_dbg_print_nfa( s->nfa_def,
+                                parser->p_universe ); */
+
+                            /* Assign the list of all possible symbols to
+                                the primary symbol */
+                            LISTFOR( ( ( pcb->tos - 5 )->value.value_1 ), l )
+                                plist_push( primary->all_sym,
+                                    list_access( l ) );
+
+                            current_sym = (SYMBOL*)NULL;
+                            ;
                     }
                     break;
-                case 172:
+                case 59:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 173:
-                    {
-                        ;
-                    }
-                    break;
-                case 174:
-                    {
-                        ;
-                    }
-                    break;
-                case 175:
-                    {
-                        ;
-                    }
-                    break;
-                case 176:
-                    {
-                        ;
-                    }
-                    break;
-                case 177:
-                    {
-                        ;
-                    }
-                    break;
-                case 178:
-                    {
-                        ;
-                    }
-                    break;
-                case 179:
-                    {
-                        ;
-                    }
-                    break;
-                case 180:
+                case 60:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 181:
+                case 61:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 182:
+                case 62:
                     {
-                        ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 183:
+                case 63:
                     {
-                     pcb->ret.value_3 = ( ( pcb->tos - 1 )->value.value_3 );     ;
+                    #line 606 "src/parse.par"
+ greedy = TRUE;     ;
                     }
                     break;
-                case 184:
+                case 64:
                     {
-                        ;
+                    #line 608 "src/parse.par"
+ greedy = FALSE;     ;
                     }
                     break;
-                case 185:
+                case 65:
                     {
-                        ;
+                    #line 612 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 186:
+                case 66:
                     {
-                        ;
+                    #line 614 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 187:
+                case 67:
                     {
-                        ;
+                    #line 618 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 2 )->value.value_1 ), ( ( pcb->tos - 0 )->value.value_4 ) );     ;
                     }
                     break;
-                case 188:
+                case 68:
                     {
-                        ;
+                    #line 621 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, ( ( pcb->tos - 0 )->value.value_4 ) );     ;
                     }
                     break;
-                case 189:
+                case 69:
                     {
-                        ;
+                    #line 625 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 190:
+                case 70:
                     {
-                        ;
+                    #line 627 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 191:
+                case 71:
                     {
-                        ;
+                    #line 629 "src/parse.par"
+ pcb->ret.value_3 = (char*)NULL;     ;
                     }
                     break;
-                case 192:
+                case 72:
                     {
-                        ;
+                    #line 635 "src/parse.par"
+
+                            ( ( pcb->tos - 3 )->value.value_4 )->line = ( ( pcb->tos - 4 )->value.value_5 );
+
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                ( ( pcb->tos - 3 )->value.value_4 )->code = ( ( pcb->tos - 2 )->value.value_3 );
+                                ( ( pcb->tos - 3 )->value.value_4 )->code_at = last_code_begin;
+                            }
+
+                            ( ( pcb->tos - 3 )->value.value_4 )->emit = ( ( pcb->tos - 1 )->value.value_3 );
+
+                            pcb->ret.value_4 = ( ( pcb->tos - 3 )->value.value_4 );
+
+                            current_prod = (PROD*)NULL;
+                            ;
                     }
                     break;
-                case 193:
+                case 73:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 194:
-                    {
-                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
-                    }
-                    break;
-                case 195:
+                case 74:
                     {
-                     pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 196:
+                case 75:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 197:
+                case 76:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 198:
+                case 77:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_4 = ( ( pcb->tos - 0 )->value.value_4 );     ;
                     }
                     break;
-                case 199:
+                case 78:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 653 "src/parse.par"
+
+                            pcb->ret.value_4 = current_prod = create_production( parser,
+                                    (SYMBOL*)NULL );
+                            ;
                     }
                     break;
-                case 200:
+                case 79:
                     {
-                        ;
+                    #line 661 "src/parse.par"
+    current_prod->prec = ( ( pcb->tos - 0 )->value.value_2 )->prec;     ;
                     }
                     break;
-                case 201:
+                case 80:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 667 "src/parse.par"
+    append_to_production( ( ( pcb->tos - 2 )->value.value_4 ), ( ( pcb->tos - 1 )->value.value_2 ),
+                                ( *strbuf == '\0' ? (char*)NULL :
+                                            pstrdup( strbuf ) ) );
+                                    pcb->ret.value_4 = ( ( pcb->tos - 2 )->value.value_4 );
+                            ;
                     }
                     break;
-                case 202:
+                case 81:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 675 "src/parse.par"
+    pcb->ret.value_4 = current_prod =
+                                create_production( parser,
+                                    (SYMBOL*)NULL );
+
+                            append_to_production( pcb->ret.value_4, ( ( pcb->tos - 1 )->value.value_2 ),
+                                ( *strbuf == '\0' ? (char*)NULL :
+                                    pstrdup( strbuf ) ) );
+                            ;
                     }
                     break;
-                case 203:
+                case 82:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 687 "src/parse.par"
+
+                            switch( ( ( pcb->tos - 0 )->value.value_5 ) )
+                            {
+                                case '*':
+                                    pcb->ret.value_2 = kleene_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                case '+':
+                                    pcb->ret.value_2 = positive_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                case '?':
+                                    pcb->ret.value_2 = optional_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                default:
+                                    pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );
+                                    break;
+                            }
+                            ;
                     }
                     break;
-                case 204:
+                case 83:
                     {
-                        ;
+                    #line 707 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    P_ERROR_RESYNC, SYM_SYSTEM_TERMINAL,
+                                        TRUE );
+                            ;
                     }
                     break;
-                case 205:
+                case 84:
                     {
-                        ;
+                    #line 714 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    P_END_OF_FILE, SYM_SYSTEM_TERMINAL,
+                                        TRUE );
+                            ;
                     }
                     break;
-                case 206:
+                case 85:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_2 = ( ( pcb->tos - 0 )->value.value_2 );     ;
                     }
                     break;
-                case 207:
+                case 86:
                     {
-                        ;
+                    #line 724 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_NON_TERMINAL, TRUE );
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 208:
+                case 87:
                     {
-                        ;
+                    #line 735 "src/parse.par"
+
+                            char    temp_nonterm[ ONE_LINE + 1 ];
+                            PROD*    prod;
+                            LIST*    l;
+
+                            sprintf( temp_nonterm, P_EMBEDDED,
+                                    embedded_count++ );
+
+                            pcb->ret.value_2 = get_symbol( parser,
+                                    temp_nonterm, SYM_NON_TERMINAL,
+                                        TRUE );
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->used = TRUE;
+                            pcb->ret.value_2->generated = TRUE;
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
+                            {
+                                VTYPE*    vt;
+
+                                vt = create_vtype( parser,
+                                        (char*)( ( pcb->tos - 4 )->value.value_3 ) );
+                                pcb->ret.value_2->vtype = vt;
+
+                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
+                            }
+
+                            /* Associate the productions */
+                            current_prod = ( ( pcb->tos - 2 )->value.value_4 );
+
+                            /* Link productions with this left-hand side */
+                            for( l = ( ( pcb->tos - 1 )->value.value_1 ); l; l = list_next( l ) )
+                            {
+                                prod = (PROD*)list_access( l );
+
+                                prod->lhs = pcb->ret.value_2;
+                                plist_push( pcb->ret.value_2->productions, prod );
+                                plist_push( prod->all_lhs, pcb->ret.value_2 );
+                                make_semantic_rhs( prod );
+                            }
+                            ;
                     }
                     break;
-                case 209:
+                case 88:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 779 "src/parse.par"
+     pcb->ret.value_4 = current_prod;
+                            current_prod = (PROD*)NULL;
+                            ;
                     }
                     break;
-                case 210:
+                case 89:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 786 "src/parse.par"
+
+                            pccl*        ccl;
+
+                            ccl = pccl_create( -1, -1, strbuf );
+                            if( ( ( pcb->tos - 0 )->value.value_0 ) )
+                                pccl_negate( ccl );
+
+                            pcb->ret.value_2 = get_symbol( parser, (void*)ccl,
+                                    SYM_CCL_TERMINAL, TRUE );
+
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 211:
+                case 90:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 805 "src/parse.par"
+
+                            pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+
+                            pcb->ret.value_2->used = TRUE;
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->keyword = TRUE;
+                            pcb->ret.value_2->emit = ( ( pcb->tos - 0 )->value.value_0 ) ? pstrdup( strbuf ) : NULL;
+
+                            pcb->ret.value_2->ptn = pregex_ptn_create_string( strbuf,
+                                        parser->p_cis_strings ?
+                                            PREGEX_COMP_INSENSITIVE : 0 );
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 212:
+                case 91:
                     {
-                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
+                    #line 824 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+
+                            /* pcb->ret.value_2->defined = TRUE;
+                            DO NOT SET DEFINED! */
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 213:
+                case 92:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 837 "src/parse.par"
+  pcb->ret.value_5 = (int)'*';     ;
                     }
                     break;
-                case 214:
+                case 93:
                     {
-                        ;
+                    #line 840 "src/parse.par"
+ pcb->ret.value_5 = (int)'+';     ;
                     }
                     break;
-                case 215:
+                case 94:
                     {
-                        ;
+                    #line 843 "src/parse.par"
+ pcb->ret.value_5 = (int)'?';     ;
                     }
                     break;
-                case 216:
+                case 95:
                     {
-                        ;
+                    #line 846 "src/parse.par"
+ pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 217:
+                case 96:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 218:
+                case 97:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 219:
+                case 98:
                     {
-                        ;
+                    #line 852 "src/parse.par"
+ reset_strbuf();     ;
                     }
                     break;
-                case 220:
+                case 99:
                     {
-                        ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 221:
+                case 100:
                     {
-                        ;
+                    #line 861 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_alt(
+                                    ( ( pcb->tos - 2 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
+                            ;
                     }
                     break;
-                case 222:
+                case 101:
                     {
-                        ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 223:
+                case 102:
                     {
-                        ;
+                    #line 872 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_seq(
+                                    ( ( pcb->tos - 1 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
+                            ;
                     }
                     break;
-                case 224:
+                case 103:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 225:
+                case 104:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 884 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_kle( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 226:
+                case 105:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 890 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_pos( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 227:
+                case 106:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 896 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_opt( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 228:
+                case 107:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 229:
+                case 108:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 906 "src/parse.par"
+
+                        pccl*        ccl;
+
+                        ccl = pccl_create( -1, -1, strbuf );
+                        if( ( ( pcb->tos - 0 )->value.value_0 ) )
+                            pccl_negate( ccl );
+
+                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
+                        ;
                     }
                     break;
-                case 230:
+                case 109:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 918 "src/parse.par"
+
+                        pcb->ret.value_6 = pregex_ptn_create_string( strbuf, 0 );
+                        ;
                     }
                     break;
-                case 231:
+                case 110:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 924 "src/parse.par"
+
+                        pccl*    ccl;
+                        greedy = FALSE;
+
+                        ccl = pccl_create( -1, -1, (char*)NULL );
+
+                        pccl_addrange( ccl, PCCL_MIN, PCCL_MAX );
+
+                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
+                        ;
                     }
                     break;
-                case 232:
+                case 111:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 937 "src/parse.par"
+
+                        pcb->ret.value_6 = pregex_ptn_create_sub( ( ( pcb->tos - 1 )->value.value_6 ) );
+                        ;
                     }
                     break;
-                case 233:
+                case 112:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 234:
+                case 113:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 235:
+                case 114:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 236:
+                case 115:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 237:
+                case 116:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_0 );     ;
                     }
                     break;
-                case 238:
+                case 117:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 951 "src/parse.par"
+    pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 239:
+                case 118:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 955 "src/parse.par"
+    pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 240:
+                case 119:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 2 )->value.value_5 );     ;
                     }
                     break;
-                case 241:
+                case 120:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 242:
+                case 121:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 964 "src/parse.par"
+  reset_strbuf();     ;
                     }
                     break;
-                case 243:
+                case 122:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 968 "src/parse.par"
+  strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 244:
+                case 123:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 971 "src/parse.par"
+
+                        strbuf_append( (char)'\\' );
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 245:
+                case 124:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 977 "src/parse.par"
+ pcb->ret.value_0 = TRUE     ;
                     }
                     break;
-                case 246:
+                case 125:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 978 "src/parse.par"
+ pcb->ret.value_0 = FALSE     ;
                     }
                     break;
-                case 247:
+                case 126:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 982 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 248:
+                case 127:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 983 "src/parse.par"
+    reset_strbuf();     ;
                     }
                     break;
-                case 249:
+                case 128:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 987 "src/parse.par"
+     strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 250:
+                case 129:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 990 "src/parse.par"
+     strbuf_append( (char)'\\' );
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 251:
+                case 130:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 996 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 252:
+                case 131:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 997 "src/parse.par"
+ pcb->ret.value_3 = (char*)NULL;     ;
                     }
                     break;
-                case 253:
+                case 132:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1001 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 254:
+                case 133:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1002 "src/parse.par"
+ reset_strbuf();     ;
                     }
                     break;
-                case 255:
+                case 134:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 256:
+                case 135:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1009 "src/parse.par"
+
+                        reset_strbuf();
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 257:
+                case 136:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1017 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 258:
+                case 137:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 259:
+                case 138:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 260:
+                case 139:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 261:
+                case 140:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1039 "src/parse.par"
+
+                        pcb->ret.value_3 = pstrdup( ( ( pcb->tos - 0 )->value.value_3 ) );
+                        reset_strbuf();
+                        ;
                     }
                     break;
-                case 262:
+                case 141:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1046 "src/parse.par"
+    pcb->ret.value_3 = strbuf;     ;
                     }
                     break;
-                case 263:
+                case 142:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1048 "src/parse.par"
+
+                        reset_strbuf();
+                        pcb->ret.value_3 = (char*)NULL;
+                        ;
                     }
                     break;
-                case 264:
+                case 143:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1055 "src/parse.par"
+
+                        if( !parser->p_template )
+                        {
+                            print_error( parser,
+                                ERR_NO_TARGET_TPL_SUPPLY,
+                                    ERRSTYLE_WARNING | ERRSTYLE_IMPORTANT
+                                            | ERRSTYLE_FILEINFO,
+                                        pcb->filename, last_code_begin );
+
+                            reset_strbuf();
+                        }
+                        ;
                     }
                     break;
-                case 265:
+                case 144:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1070 "src/parse.par"
+ last_code_begin = pcb->line;     ;
                     }
                     break;
-                case 266:
+                case 145:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 267:
+                case 146:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1074 "src/parse.par"
+    reset_strbuf();     ;
                     }
                     break;
-                case 268:
+                case 147:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1078 "src/parse.par"
+    strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );            ;
                     }
                     break;
-                case 269:
+                case 148:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1081 "src/parse.par"
+
+                        reset_strbuf();
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 270:
+                case 152:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 271:
+                case 153:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 272:
+                case 155:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 273:
+                case 156:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 274:
+                case 159:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 275:
+                case 160:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 276:
+                case 161:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1100 "src/parse.par"
+
+                        pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );
+                        ;
                     }
                     break;
-                case 277:
+                case 162:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 278:
+                case 163:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 279:
+                case 164:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1109 "src/parse.par"
+ pcb->ret.value_5 = pcb->line;     ;
                     }
                     break;
-                case 280:
+                case 165:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 281:
+                case 171:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 282:
+                case 172:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 283:
+                case 173:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 284:
+                case 174:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 285:
+                case 175:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 286:
+                case 176:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 287:
+                case 177:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 288:
+                case 178:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 289:
+                case 179:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 290:
+                case 180:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 291:
+                case 181:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 292:
+                case 182:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 293:
+                case 183:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 294:
+                case 184:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_3 = ( ( pcb->tos - 1 )->value.value_3 );     ;
                     }
                     break;
-                case 295:
+                case 185:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 296:
+                case 186:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 297:
+                case 187:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 298:
+                case 188:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 299:
+                case 189:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 300:
+                case 190:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 301:
+                case 191:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 302:
+                case 192:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 303:
+                case 193:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 304:
+                case 194:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 305:
+                case 195:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 306:
+                case 196:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 307:
+                case 197:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 308:
+                case 198:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
                     }
                     break;
-                case 309:
+                case 199:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );     ;
                     }
                     break;
-                case 310:
+                case 200:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 311:
+                case 201:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 312:
+                case 202:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 313:
+                case 203:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 314:
+                case 204:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 315:
+                case 205:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 316:
+                case 206:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 317:
+                case 207:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 318:
+                case 208:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 319:
+                case 209:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 320:
+                case 210:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 321:
+                case 211:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 322:
+                case 212:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 323:
+                case 213:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 324:
+                case 214:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 325:
+                case 215:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 326:
+                case 216:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
                     }
                     break;
-                case 327:
+                case 217:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 328:
+                case 218:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 329:
+                case 219:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 330:
+                case 220:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 331:
+                case 221:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 332:
+                case 222:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 333:
+                case 223:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 334:
+                case 224:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 335:
+                case 225:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 336:
+                case 226:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 337:
+                case 227:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 338:
+                case 228:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 339:
+                case 229:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 340:
+                case 230:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 341:
+                case 231:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 342:
+                case 232:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 343:
+                case 233:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 344:
+                case 234:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 345:
+                case 235:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 346:
+                case 236:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 347:
+                case 237:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 348:
+                case 238:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 349:
+                case 239:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 350:
+                case 240:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 351:
+                case 241:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 352:
+                case 242:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 353:
+                case 243:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 354:
+                case 244:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 355:
+                case 245:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 356:
+                case 246:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 357:
+                case 247:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 358:
+                case 248:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 359:
+                case 249:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 360:
+                case 250:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 361:
+                case 251:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 362:
+                case 252:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 363:
+                case 253:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 364:
+                case 254:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 365:
+                case 255:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 366:
+                case 256:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 367:
+                case 257:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 368:
+                case 258:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 369:
+                case 259:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 370:
+                case 260:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 371:
+                case 261:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 372:
+                case 262:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 373:
+                case 263:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 374:
+                case 264:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 375:
+                case 265:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 376:
+                case 266:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 377:
+                case 267:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 378:
+                case 268:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 379:
+                case 269:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 380:
+                case 270:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 381:
+                case 271:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 382:
+                case 272:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 383:
+                case 273:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 384:
+                case 274:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 385:
+                case 275:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 386:
+                case 276:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 387:
+                case 277:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 388:
+                case 278:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 389:
+                case 279:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 390:
+                case 280:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 391:
+                case 281:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 392:
+                case 282:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 393:
+                case 283:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 394:
+                case 284:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 395:
+                case 285:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 396:
+                case 286:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 397:
+                case 287:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 398:
+                case 288:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 399:
+                case 289:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 400:
+                case 290:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 401:
+                case 291:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 402:
+                case 292:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 403:
+                case 293:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 404:
+                case 294:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 405:
+                case 295:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 406:
+                case 296:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 407:
+                case 297:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 408:
+                case 298:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 409:
+                case 299:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 410:
+                case 300:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 411:
+                case 301:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 412:
+                case 302:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 413:
+                case 303:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 414:
+                case 304:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 415:
+                case 305:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 416:
+                case 306:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 417:
+                case 307:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 418:
+                case 308:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 419:
+                case 309:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 420:
+                case 310:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 421:
+                case 311:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 422:
+                case 312:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 423:
+                case 313:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 424:
+                case 314:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 425:
+                case 315:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 426:
+                case 316:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 427:
+                case 317:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 428:
+                case 318:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 429:
+                case 319:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 430:
+                case 320:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 431:
+                case 321:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 432:
+                case 322:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 433:
+                case 323:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 434:
+                case 324:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 435:
+                case 325:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 436:
+                case 326:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 437:
+                case 327:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 438:
+                case 328:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 439:
+                case 329:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 440:
+                case 330:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 441:
+                case 331:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 442:
+                case 332:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 443:
+                case 333:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 444:
+                case 334:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 445:
+                case 335:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 446:
+                case 336:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 447:
+                case 337:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 448:
+                case 338:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 449:
+                case 339:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 450:
+                case 340:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 451:
+                case 341:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 452:
+                case 342:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 453:
+                case 343:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 454:
+                case 344:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 455:
+                case 345:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 456:
+                case 346:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 457:
+                case 347:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 458:
+                case 348:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 459:
+                case 349:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 460:
+                case 350:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 461:
+                case 351:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 462:
+                case 352:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 463:
+                case 353:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 464:
+                case 354:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 465:
+                case 355:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 466:
+                case 356:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 467:
+                case 357:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 468:
+                case 358:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
     
+    }
+}
+
+#if 87 && UNICC_SEMANTIC_TERM_SEL && 0
+/* Runs the scanner action of a matched terminal with UNICC_ON_SHIFT = 0,
+    for semantic-code dependent terminal selections */
+UNICC_INTERN void _scan_match( _pcb* pcb )
+{
+#define UNICC_ON_SHIFT 	0
+    switch( pcb->sym )
+    {
+
+
+        default:
+            break;
+    }
+#undef UNICC_ON_SHIFT
+}
+#endif
+
+#if 0
+/* Runs the scanner action of the shifted terminal with UNICC_ON_SHIFT = 1,
+    so that shifting-related operations will be performed */
+UNICC_INTERN void _scan_shift( _pcb* pcb )
+{
+#define UNICC_ON_SHIFT	1
+    switch( pcb->sym )
+    {
+
+
+        default:
+            ( ( pcb->tos - 0 )->value.value_5 ) = _get_input( pcb, 0 );
+            break;
+    }
+#undef UNICC_ON_SHIFT
+}
+#endif
+
+#if 87
+UNICC_STATIC void _lex( _pcb* pcb )
+{
+    int 			dfa_st	= 0;
+    unsigned int	len		= 0;
+    int				chr;
+    UNICC_CHAR		next;
+#if !0
+    int				mach	= UNICC_DFA_SELECT( pcb->tos->state );
+#else
+    int				mach	= 0;
+#endif
+
+    next = _get_input( pcb, len );
+#if 0
+    if( UNICC_DFA_FOLD( mach ) && next >= 'A' && next <= 'Z' )
+        next += 'a' - 'A';
+#endif
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
+#endif
+
+    if( next == pcb->eof )
+    {
+        pcb->sym = 0;
+        return;
+    }
+
+    do
+    {
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
+#endif
+
+        chr = UNICC_DFA_IDX( mach, dfa_st );
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
+#endif
+
+        dfa_st = -1;
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: FIRST next = %d _dfa_chars[ chr ] = %d, "
+            "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
+                UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );
+#endif
+        while( UNICC_DFA_CHARS( chr ) > -1 )
+        {
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: next = %d _dfa_chars[ chr ] = %d, "
+        "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
+            UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );
+#endif
+            if( next >= UNICC_DFA_CHARS( chr ) &&
+                next <= UNICC_DFA_CHARS( chr + 1 ) )
+            {
+                dfa_st = UNICC_DFA_TRANS( chr / 2 );
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
+#endif
+#if 0
+                /* Only accept terminals which are valid in this state */
+                if( UNICC_DFA_ACCEPT( mach, dfa_st ) > 0
+                    && ( UNICC_DFA_MASK( pcb->tos->state,
+                            ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 ) / 8 )
+                        & ( 1 << ( ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 )
+                                    % 8 ) ) ) )
+#else
+                if( UNICC_DFA_ACCEPT( mach, dfa_st ) > 0 )
+#endif
+                {
+                    pcb->len = len + 1;
+                    pcb->sym = UNICC_DFA_ACCEPT( mach, dfa_st ) - 1;
+
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
+            UNICC_PARSER, pcb->sym, _symbols[ pcb->sym ].greedy );
+#endif
+                    if( pcb->sym == 0 )
+                    {
+                        dfa_st = -1; /* test! */
+                        break;
+                    }
+
+                    /* Stop if matched symbol should be parsed nongreedy */
+                    if( !_symbols[ pcb->sym ].greedy )
+                    {
+                        dfa_st = -1;
+                        break;
+                    }
+                }
+
+                next = _get_input( pcb, ++len );
+#if 0
+                if( UNICC_DFA_FOLD( mach )
+                        && next >= 'A' && next <= 'Z' )
+                    next += 'a' - 'A';
+#endif
+                break;
+            }
+
+            chr += 2;
+        }
+    }
+    while( dfa_st > -1 && next != pcb->eof );
+
+    if( pcb->sym > -1 )
+    {
+#if UNICC_SEMANTIC_TERM_SEL && 0
+        /*
+            Execute scanner actions, if existing, but with
+            UNICC_ON_SHIFT = 0, so that no memory allocation
+            should be performed. This actions should only be
+            handled if there are semantic-code dependent
+            terminal symbol selections.
+
+            tos is incremented here, if the semantic code
+            stores data for the symbol. It won't get lost
+            in case of a shift.
+        */
+        _alloc_stack( pcb );
+        pcb->tos++;
+
+        next = pcb->buf[ pcb->len ];
+        pcb->buf[ pcb->len ] = '\0';
+
+        _scan_match( pcb );
+
+        pcb->buf[ pcb->len ] = next;
+
+        pcb->tos--;
+#endif /* UNICC_SEMANTIC_TERM_SEL */
+    }
+
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: function exits, pcb->sym = %d, pcb->len = %d\n",
+            UNICC_PARSER, pcb->sym, pcb->len );
+#endif
+}
+#endif
+
+UNICC_STATIC int _get_sym( _pcb* pcb )
+{
+    pcb->sym = -1;
+    pcb->len = 0;
+
+#if 0
+    do
+    {
+#endif
+#if !0
+
+#if UNICC_DEBUG > 2
+        fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
+                    UNICC_PARSER, pcb->tos->state,
+                        UNICC_DFA_SELECT( pcb->tos->state ) );
+#endif
+
+        if( UNICC_DFA_SELECT( pcb->tos->state ) > -1 )
+            _lex( pcb );
+        /*
+         * If there is no DFA state machine,
+         * try to identify the end-of-file symbol.
+         * If this also fails, a parse error will
+         * raise.
+         */
+        else if( _get_input( pcb, 0 ) == pcb->eof )
+            pcb->sym = 0;
+#else
+        _lex( pcb );
+#endif /* !0 */
+
+#if 0
+
+        if( pcb->sym > -1 && _symbols[ pcb->sym ].whitespace )
+        {
+            UNICC_CLEARIN( pcb );
+            continue;
+        }
+
+        break;
+    }
+    while( 1 );
+#endif /* 0 */
+
+    return ( pcb->sym > -1 ) ? 1 : 0;
+}
+
+#if UNICC_STACKDEBUG
+UNICC_STATIC void _dbg_stack( FILE* out,
+    _tok* stack, _tok* tos )
+{
+    fprintf( out, "%s: Stack Dump: ", UNICC_PARSER );
+
+    for( ; stack <= tos; stack++ )
+    {
+        fprintf( out, "%d%s%s%s ", stack->state,
+            stack->symbol ? " (" : "",
+            stack->symbol ? stack->symbol->name : "",
+            stack->symbol ? ")" : "" );
+    }
+
+    fprintf( out, "\n" );
+}
+#endif /* UNICC_STACKDEBUG */
+
+UNICC_STATIC int _handle_error( _pcb* pcb, FILE* _dbg )
+{
+#if UNICC_DEBUG
+    int					i;
+#endif
+
+    if( !pcb->error_delay )
+    {
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: !!!PARSE ERROR!!!\n"
+                "%s: error recovery: current token %d (%s)\n",
+                    UNICC_PARSER, UNICC_PARSER, pcb->sym,
+                        ( ( pcb->sym >= 0 ) ?
+                            _symbols[ pcb->sym ].name :
+                                "(null)" ) );
+
+        fprintf( _dbg,
+                "%s: error recovery: expecting ", UNICC_PARSER );
+
+#if 0
+        for( i = 0; i < UNICC_TERMINALS; i++ )
+        {
+            if( _act_check[ UNICC_ACT_SLOT( pcb->tos->state, i ) ]
+                    == pcb->tos->state )
+                fprintf( _dbg, "%d (%s), ",
+                    i, _symbols[ i ].name );
+        }
+#else
+        for( i = 1; i < UNICC_ACT( pcb->tos->state, 0 ) * 3; i += 3 )
+        {
+            fprintf( _dbg, "%d (%s)%s",
+                UNICC_ACT( pcb->tos->state, i ),
+                _symbols[ UNICC_ACT( pcb->tos->state, i ) ].name,
+                ( i == UNICC_ACT( pcb->tos->state, 0 ) * 3 - 3 ) ?
+                        "\n" : ", " );
+        }
+#endif
+
+        fprintf( _dbg, "\n%s: error recovery: error_delay is %d, %s\n",
+                    UNICC_PARSER, pcb->error_delay,
+                    ( pcb->error_delay ? "error recovery runs silently" :
+                        "error is reported before its recover!" ) );
+#endif
+    }
+
+#if -1 < 0
+    /* No error token defined? Then exit here... */
+
+#if UNICC_DEBUG
+    fprintf( _dbg,
+        "%s: error recovery: No error resync token used by grammar, "
+            "exiting parser.\n", UNICC_PARSER );
+#endif
+
+    UNICC_PARSE_ERROR( pcb );
+    pcb->error_count++;
+
+    return 1;
+#else
+    /*
+    _pcb 		org_pcb;
+    */
+
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+        "trying to recover...\n", UNICC_PARSER );
+#if UNICC_STACKDEBUG
+    _dbg_stack( _dbg, pcb->stack, pcb->tos );
+#endif
+#endif
+
+    #if 0
+    /* Create a copy of original parser control block (maybe later...) */
+    memcpy( &org_pcb, pcb, sizeof( _pcb ) );
+    org_pcb.buf = (char*)malloc( ( strlen( pcb->buf ) / UNICC_MALLOCSTEP +
+                    ( !( strlen( pcb->buf ) % UNICC_MALLOCSTEP ) ? 1 : 0 ) )
+                            * UNICC_MALLOCSTEP );
+    strcpy( org_pcb.buf, pcb->buf );
+    #endif
+
+    /* Remember previous symbol, or discard it */
+    if( pcb->error_delay != UNICC_ERROR_DELAY )
+        pcb->old_sym = pcb->sym;
+    else
+    {
+        pcb->old_sym = -1;
+        pcb->len = 1;
+        UNICC_CLEARIN( pcb );
+    }
+
+    /* Try to shift on error resync */
+    pcb->sym = -1;
+
+    while( pcb->tos >= pcb->stack )
+    {
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: error recovery: in state %d, trying "
+                "to shift error resync token...\n",
+                    UNICC_PARSER, pcb->tos->state );
+#if UNICC_STACKDEBUG
+        _dbg_stack( _dbg, pcb->stack, pcb->tos );
+#endif
+#endif
+        if( _get_act( pcb ) )
+        {
+            /* Shift */
+            if( pcb->act & UNICC_SHIFT )
+            {
+#if UNICC_DEBUG
+                fprintf( _dbg, "%s: error recovery: "
+                            "error resync shifted\n", UNICC_PARSER );
+#endif
+                break;
             }
+        }
+
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: error recovery: failed, "
+                    "discarding token '%s'\n", UNICC_PARSER,
+                        pcb->tos->symbol ?
+                            pcb->tos->symbol->name : "NULL" );
+#endif
+
+        /* Discard one token from stack */
+        /* TODO: Discarded token memory (semantic action) */
+        pcb->tos--;
+    }
+
+    if( pcb->tos <= pcb->stack )
+    {
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+                "Can't recover this issue, stack is empty.\n",
+                    UNICC_PARSER );
+#endif
+        UNICC_PARSE_ERROR( pcb );
+        pcb->error_count++;
+
+        return 1;
+    }
+
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+                "trying to continue with modified parser state\n",
+                    UNICC_PARSER );
+#endif
+
+    pcb->error_delay = UNICC_ERROR_DELAY + 1;
+
+    return 0;
+
+#endif /* -1 >= 0 */
+}
+
+int _parse( _pcb* pcb )
+{
+    int			ret;
+#if 0
+    int					i;
+
+    _ast*		node;
+    _ast*		lnode;
+#endif
+
+#if UNICC_DEBUG
+    _vtype*		vptr;
+    FILE* 				_dbg;
+
+    _dbg = stderr;
+#endif
+
+    /* If there is no Parser Control Block given, allocate your own one! */
+    if( !pcb )
+    {
+        if( !( pcb = (_pcb*)malloc( sizeof( _pcb ) ) ) )
+        {
+            /* Can't allocate memory */
+            UNICC_OUTOFMEM( pcb );
+            return (int)0;
+        }
 
+        memset( pcb, 0, sizeof( _pcb ) );
+        pcb->is_internal = 1;
+    }
+    else
+        pcb->is_internal = 0;
+
+    /* Initialize Parser Control Block */
+    pcb->stacksize = 0;
+    if( _alloc_stack( pcb ) < 0 )
+        return (int)0;
+
+    memset( pcb->tos, 0, sizeof( _tok ) );
+
+    pcb->act = UNICC_SHIFT;
+    pcb->sym = -1;
+    pcb->old_sym = -1;
+    pcb->line = 1;
+    pcb->column = 1;
+
+    memset( &pcb->test, 0, sizeof( _vtype ) );
+
+    /* Begin of main parser loop */
+    while( 1 )
+    {
+        /* Reduce */
+        while( pcb->act & UNICC_REDUCE )
+        {
+#if UNICC_DEBUG
+            fprintf( _dbg, "%s: << "
+                    "reducing by production %d (%s)\n",
+                        UNICC_PARSER, pcb->idx,
+                            _productions[ pcb->idx ].definition );
+#endif
+            /* Set default left-hand side */
+            pcb->lhs = _productions[ pcb->idx ].lhs;
+
+            /* Run reduction code */
+            memset( &( pcb->ret ), 0, sizeof( _vtype ) );
+
+            _reduce( pcb );
+
+#if 0
             /* Drop right-hand side */
             /* TODO: Destructor callbacks? */
             for( i = 0, node = (_ast*)NULL;
@@ -20081,8 +20088,6 @@ int _parse( _pcb* pcb )
                 pcb->tos--;
             }
 
-            /* This could be done if no AST construction would be done: */
-            /* pcb->tos -= _productions[ pcb->idx ].length; */
 
             if( node )
             {
@@ -20108,13 +20113,17 @@ int _parse( _pcb* pcb )
                     pcb->tos->node = node;
                 }
             }
+#else
+            /* Drop right-hand side; There is no AST construction */
+            pcb->tos -= _productions[ pcb->idx ].length;
+#endif
 
             /* Enforced error in semantic actions? */
             if( pcb->act == UNICC_ERROR )
                 break;
 
             /* Goal symbol reduced, and stack is empty? */
-            if( pcb->lhs == 182 && pcb->tos == pcb->stack )
+            if( pcb->lhs == 208 && pcb->tos == pcb->stack )
             {
                 memcpy( &( pcb->tos->value ), &( pcb->ret ),
                             sizeof( _vtype ) );
@@ -20147,13 +20156,16 @@ int _parse( _pcb* pcb )
                         sizeof( _vtype ) );
             pcb->tos->symbol = &( _symbols[ pcb->lhs ] );
             pcb->tos->state = ( pcb->act & UNICC_REDUCE ) ? -1 : pcb->idx;
+#if UNICC_LINE_INFO
             pcb->tos->line = pcb->line;
             pcb->tos->column = pcb->column;
+#endif
         }
 
         if( pcb->act == UNICC_SUCCESS || pcb->act == UNICC_ERROR )
             break;
 
+#if -1 >= 0
         /* If in error recovery, replace old-symbol */
         if( pcb->error_delay == UNICC_ERROR_DELAY
                 && ( pcb->sym = pcb->old_sym ) < 0 )
@@ -20183,6 +20195,9 @@ int _parse( _pcb* pcb )
         {
             _get_sym( pcb );
         }
+#else
+        _get_sym( pcb );
+#endif
 
 #if UNICC_DEBUG
         fprintf( _dbg, "%s: current token %d (%s)\n",
@@ -20239,37 +20254,31 @@ int _parse( _pcb* pcb )
             pcb->tos++;
             pcb->tos->node = (_ast*)NULL;
 
-            /*
-                Execute scanner actions, if existing.
-                Here, UNICC_ON_SHIFT is set to 1, so that shifting-
-                related operations will be performed.
-            */
-#define UNICC_ON_SHIFT	1
-            switch( pcb->sym )
-            {
-
-
-                default:
-                    ( ( pcb->tos - 0 )->value.value_5 ) = _get_input( pcb, 0 );
-                    break;
-            }
-#undef UNICC_ON_SHIFT
+#if 0
+            /* Execute scanner actions */
+            _scan_shift( pcb );
+#else
+            ( ( pcb->tos - 0 )->value.value_5 ) = _get_input( pcb, 0 );
+#endif
 
             pcb->tos->state = ( pcb->act & UNICC_REDUCE ) ? -1 : pcb->idx;
             pcb->tos->symbol = &( _symbols[ pcb->sym ] );
+#if UNICC_LINE_INFO
             pcb->tos->line = pcb->line;
             pcb->tos->column = pcb->column;
+#endif
 
+#if 0
             if( *pcb->tos->symbol->emit )
                 pcb->tos->node = _ast_create( pcb,
                                     pcb->tos->symbol->emit,
                                         _lexem( pcb ) );
-            else
-                pcb->tos->node = (_ast*)NULL;
+#endif
 
             pcb->buf[ pcb->len ] = pcb->next;
 
             /* Perform the shift on input */
+#if -1 >= 0
             if( pcb->sym != 0 && pcb->sym != -1 )
             {
                 UNICC_CLEARIN( pcb );
@@ -20278,6 +20287,10 @@ int _parse( _pcb* pcb )
 
             if( pcb->error_delay )
                 pcb->error_delay--;
+#else
+            if( pcb->sym != 0 )
+                UNICC_CLEARIN( pcb );
+#endif
         }
     }
 
@@ -20356,6 +20369,7 @@ int parse_grammar( PARSER* p, char* filename, char* src )
 
     prec_cnt = 1;
     embedded_count = 0;
+    greedy = TRUE;
 
     memset( &pcb, 0, sizeof( pcb ) );
     pcb.src = src;
@@ -20369,7 +20383,7 @@ int parse_grammar( PARSER* p, char* filename, char* src )
 
         _parse( &pcb );
 
-        pfree( strbuf );
+        strbuf = pfree( strbuf );
     }
 
     return pcb.error_count + error_count;
@@ -20378,7 +20392,7 @@ int parse_grammar( PARSER* p, char* filename, char* src )
 
 
 /* Create Main? */
-#if 1854 == 0
+#if 1882 == 0
     #ifndef UNICC_MAIN
     #define UNICC_MAIN 	1
     #endif
@@ -20477,4 +20491,3 @@ int main( int argc, char** argv )
     return 0;
 }
 #endif
-
@@ -55,17 +55,29 @@
 #define UNICC_DEBUG				0
 #endif
 
+/* Action table; Direct-coded parsers only use it for debug output */
+#define UNICC_ACTION_TABLE		\
+    ( !0 && ( !0 || UNICC_DEBUG ) )
+
 /* Stack debug switch */
 #ifndef UNICC_STACKDEBUG
 #define UNICC_STACKDEBUG		0
 #endif
 
-/* Parse error macro */
+/* Parse error macro; The default one reports line and column */
 #ifndef UNICC_PARSE_ERROR
 #define UNICC_PARSE_ERROR( pcb ) \
     fprintf( stderr, "line %d, column %d: syntax error on symbol %d, token '" \
         UNICC_SCHAR_FORMAT "'\n", \
     ( pcb )->line, ( pcb )->column, pcb->sym, _lexem( pcb ) )
+#ifndef UNICC_LINE_INFO
+#define UNICC_LINE_INFO			1
+#endif
+#endif
+
+/* Line and column counting, if used by the grammar's semantic code */
+#ifndef UNICC_LINE_INFO
+#define UNICC_LINE_INFO			1
 #endif
 
 /* Input buffering clean-up */
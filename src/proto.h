@@ -3,7 +3,8 @@ char* escape_for_target( GENERATOR* g, char* str, BOOLEAN clear );
 char* build_action( PARSER* parser, GENERATOR* g, PROD* p, char* base, BOOLEAN def_code );
 char* build_scan_action( PARSER* parser, GENERATOR* g, SYMBOL* s, char* base );
 char* mkproduction_str( PROD* p );
-BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile );
+BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile,
+                            char* src );
 void build_code( PARSER* parser );
 
 /* src/debug.c */
@@ -34,8 +35,9 @@ void detect_default_productions( PARSER* parser );
 /* src/lex.c */
 void merge_symbols_to_dfa( PARSER* parser );
 void construct_single_lexer( PARSER* parser );
-pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa );
+pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa, BOOLEAN folded );
 void nfa_from_symbol( PARSER* parser, pregex_nfa* nfa, SYMBOL* sym );
+void share_dfas( PARSER* parser );
 
 /* src/list.c */
 LIST* list_push( LIST* list, void* ptr );
@@ -52,7 +54,7 @@ LIST* list_union( LIST* first, LIST* second );
 char* print_version( BOOLEAN long_version );
 void print_copyright( FILE* stream );
 void print_usage( FILE* stream, char* progname );
-BOOLEAN get_command_line( int argc, char** argv, char** filename, char** output, PARSER* parser );
+BOOLEAN get_command_line( int argc, char** argv, char*** files, int* files_count, char** output, int* jobs, BOOLEAN* watch, PARSER* parser );
 
 /* src/mem.c */
 SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create );
@@ -79,6 +81,7 @@ void free_vtype( VTYPE* vt );
 int parse_grammar( PARSER* p, char* filename, char* src );
 
 /* src/rewrite.c */
+void regular_lexemes( PARSER* parser );
 void rewrite_grammar( PARSER* parser );
 void unique_charsets( PARSER* parser );
 void fix_precedences( PARSER* parser );
@@ -86,12 +89,22 @@ void inherit_fixiations( PARSER* parser );
 void inherit_vtypes( PARSER* parser );
 void setup_single_goal( PARSER* parser );
 void charsets_to_ptn( PARSER* parser );
+void prune_grammar( PARSER* parser );
 void symbol_orders( PARSER* parser );
 
 /* src/string.c */
 char* int_to_str( int val );
 char* long_to_str( long val );
 char* str_no_whitespace( char* str );
+void outbuf_init( OUTBUF* ob, FILE* stream );
+void outbuf_write( OUTBUF* ob, char* str, size_t len );
+void outbuf_append( OUTBUF* ob, char* str, BOOLEAN freestr );
+void outbuf_render( OUTBUF* ob, char* tpl, ... );
+void outbuf_flush( OUTBUF* ob );
+void outbuf_free( OUTBUF* ob );
+SNIPPET* snippet_compile( char* tpl, ... );
+void snippet_render( OUTBUF* ob, SNIPPET* snip, ... );
+SNIPPET* snippet_free( SNIPPET* snip );
 
 /* src/utils.c */
 char* derive_name( char* name, char append_char );
@@ -118,6 +131,7 @@ char* xml_str2utf8( char ** s, size_t* len );
 void xml_free_attr( char ** attr );
 XML_T xml_parse_str( char* s, size_t len );
 XML_T xml_parse_fp( FILE* fp );
+XML_T xml_parse_alloc( char* s );
 XML_T xml_parse_file( char* file );
 char* xml_ampencode( char* s, size_t len, char ** dst, size_t* dlen, size_t* max, short a );
 char* xml_toxml( XML_T xml );
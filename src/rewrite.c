@@ -2,21 +2,577 @@
 
 #include "unicc.h"
 
+/* Puts //ptn// into brackets, if it is an alternation or a sequence */
+static pregex_ptn* lexeme_sub( pregex_ptn* ptn )
+{
+    if( ptn->next || ptn->type == PREGEX_PTN_ALT )
+        return pregex_ptn_create_sub( ptn );
+
+    return ptn;
+}
+
+/* Appends //ptn// to the sequence //seq//, which may be (pregex_ptn*)NULL */
+static pregex_ptn* lexeme_seq( pregex_ptn* seq, pregex_ptn* ptn )
+{
+    if( ptn->type == PREGEX_PTN_ALT )
+        ptn = pregex_ptn_create_sub( ptn );
+
+    if( !seq )
+        return ptn;
+
+    return pregex_ptn_create_seq( seq, ptn, (pregex_ptn*)NULL );
+}
+
+/* Appends //ptn// as alternative to //alt//, which may be (pregex_ptn*)NULL */
+static pregex_ptn* lexeme_alt( pregex_ptn* alt, pregex_ptn* ptn )
+{
+    if( !alt )
+        return ptn;
+
+    return pregex_ptn_create_alt( alt, ptn, (pregex_ptn*)NULL );
+}
+
+/* Constructs the pattern matching the language derived by //sym//.
+
+Direct left- or right-recursion is turned into a repetition, any other kind of
+recursion causes the sub-grammar to be rejected. It is also rejected when it
+contains anything that would behave differently when matched by the lexical
+analyzer, like semantic actions or AST node emits.
+
+Every symbol visited below //sym// is added to //inlined//. //stack// holds the
+nonterminals currently under construction.
+
+//ptn// receives the pattern, which is (pregex_ptn*)NULL for the empty word.
+//nullable// receives TRUE if the pattern matches the empty word.
+
+Returns TRUE if the pattern could be constructed. */
+static BOOLEAN lexeme_to_ptn( SYMBOL* sym, plist* stack, plist* inlined,
+                                pregex_ptn** ptn, BOOLEAN* nullable )
+{
+    plistel*	e;
+    plistel*	f;
+    PROD*		p;
+    SYMBOL*		rsym;
+    pregex_ptn*	base			= (pregex_ptn*)NULL;
+    pregex_ptn*	rep				= (pregex_ptn*)NULL;
+    pregex_ptn*	seq;
+    pregex_ptn*	sub;
+    BOOLEAN		ok				= TRUE;
+    BOOLEAN		has_base		= FALSE;
+    BOOLEAN		base_nullable	= FALSE;
+    BOOLEAN		seq_nullable;
+    BOOLEAN		sub_nullable;
+    int			left			= 0;
+    int			right			= 0;
+    int			cnt;
+
+    *ptn = (pregex_ptn*)NULL;
+    *nullable = FALSE;
+
+    if( plist_count( stack ) && !plist_get_by_ptr( inlined, sym ) )
+        plist_push( inlined, sym );
+
+    switch( sym->type )
+    {
+        case SYM_CCL_TERMINAL:
+            *ptn = pregex_ptn_create_char( pccl_dup( sym->ccl ) );
+            return TRUE;
+
+        case SYM_REGEX_TERMINAL:
+            if( !sym->ptn || sym->code || sym->emit || !sym->greedy )
+                return FALSE;
+
+            *ptn = pregex_ptn_dup( sym->ptn );
+            return TRUE;
+
+        case SYM_NON_TERMINAL:
+            break;
+
+        default:
+            return FALSE;
+    }
+
+    /* Embedded recursions can't be expressed by a pattern */
+    if( plist_get_by_ptr( stack, sym ) )
+        return FALSE;
+
+    /* The lexeme itself keeps its emit, but none below */
+    if( sym->fixated || !sym->greedy
+            || ( sym->emit && plist_count( stack ) ) )
+        return FALSE;
+
+    plist_push( stack, sym );
+
+    plist_for( sym->productions, e )
+    {
+        p = (PROD*)plist_access( e );
+
+        if( p->code || p->emit || plist_count( p->all_lhs ) > 1 )
+        {
+            ok = FALSE;
+            break;
+        }
+
+        /* Find out if the production is left- or right-recursive */
+        cnt = 0;
+        plist_for( p->rhs, f )
+            if( (SYMBOL*)plist_access( f ) == sym )
+                cnt++;
+
+        if( cnt )
+        {
+            if( cnt > 1 || plist_count( p->rhs ) < 2 )
+                ok = FALSE;
+            else if( (SYMBOL*)plist_access( plist_first( p->rhs ) ) == sym )
+                left++;
+            else if( (SYMBOL*)plist_access( plist_last( p->rhs ) ) == sym )
+                right++;
+            else
+                ok = FALSE;
+
+            if( !ok )
+                break;
+        }
+
+        /* Construct the sequence of the remaining symbols */
+        seq = (pregex_ptn*)NULL;
+        seq_nullable = TRUE;
+
+        plist_for( p->rhs, f )
+        {
+            rsym = (SYMBOL*)plist_access( f );
+            if( rsym == sym )
+                continue;
+
+            if( !lexeme_to_ptn( rsym, stack, inlined, &sub, &sub_nullable ) )
+            {
+                ok = FALSE;
+                break;
+            }
+
+            if( sub )
+                seq = lexeme_seq( seq, sub );
+
+            if( !sub_nullable )
+                seq_nullable = FALSE;
+        }
+
+        if( ok && cnt && seq_nullable )
+            ok = FALSE; /* Repeating the empty word is ambiguous */
+
+        if( !ok )
+        {
+            pregex_ptn_free( seq );
+            break;
+        }
+
+        if( cnt )
+            rep = lexeme_alt( rep, seq );
+        else
+        {
+            has_base = TRUE;
+
+            if( seq_nullable )
+                base_nullable = TRUE;
+
+            if( seq )
+                base = lexeme_alt( base, seq );
+        }
+    }
+
+    plist_pop( stack, (void*)NULL );
+
+    if( !ok || !has_base || ( left && right ) )
+    {
+        pregex_ptn_free( base );
+        pregex_ptn_free( rep );
+        return FALSE;
+    }
+
+    if( base && base_nullable )
+        base = pregex_ptn_create_opt( lexeme_sub( base ) );
+
+    if( rep )
+    {
+        rep = pregex_ptn_create_kle( lexeme_sub( rep ) );
+
+        if( !base )
+            base = rep;
+        else if( left )
+            base = lexeme_seq( base, rep );
+        else
+            base = lexeme_seq( rep, base );
+    }
+
+    *ptn = base;
+    *nullable = base_nullable;
+
+    return TRUE;
+}
+
+/* Removes production //p// from the grammar. */
+static void drop_production( PARSER* parser, PROD* p )
+{
+    plistel*	e;
+
+    plist_for( parser->productions, e )
+    {
+        if( (PROD*)plist_access( e ) == p )
+        {
+            free_production( p );
+            plist_remove( parser->productions, e );
+            break;
+        }
+    }
+}
+
+/** Turns lexemes deriving a regular language into regex terminals.
+
+In scannerless mode, lexeme nonterminals are parsed character by character,
+each character costing at least one shift. If the sub-grammar of a lexeme is
+regular, it is compiled into a pattern, which is recognized by the lexical
+analyzers in one go. The lexeme itself is kept as a nonterminal deriving the
+new terminal, so its reduction and AST node emit still take place.
+
+Symbols which were only used by the replaced sub-grammars are dropped.
+
+This pass only runs when enabled by the "#regular lexemes" directive, because
+the new terminals are matched by the lexers by longest match and terminal
+priority, instead of being parsed along the grammar.
+
+//parser// is the pointer to parser information structure. */
+void regular_lexemes( PARSER* parser )
+{
+    plistel*	e;
+    plistel*	f;
+    SYMBOL*		sym;
+    SYMBOL*		term;
+    PROD*		p;
+    plist*		lexemes;
+    plist*		stack;
+    plist*		inlined;
+    plist*		reach;
+    pregex_ptn*	ptn;
+    BOOLEAN		nullable;
+    char*		deriv;
+    char*		keyname;
+    int*		ids;
+    int			cnt;
+    int			i;
+
+    PROC( "regular_lexemes" );
+    PARMS( "parser", "%p", parser );
+
+    /* Default actions would also be run for the productions of a lexeme */
+    if( parser->p_def_action || parser->p_def_action_e )
+    {
+        MSG( "Default actions defined, nothing to do" );
+        VOIDRET;
+    }
+
+    lexemes = plist_create( 0, PLIST_MOD_PTR );
+    stack = plist_create( 0, PLIST_MOD_PTRSET );
+    inlined = plist_create( 0, PLIST_MOD_PTRSET );
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( sym->type == SYM_NON_TERMINAL
+                && ( sym->lexem || sym->whitespace ) )
+            plist_push( lexemes, sym );
+    }
+
+    plist_for( lexemes, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( !lexeme_to_ptn( sym, stack, inlined, &ptn, &nullable ) )
+            continue;
+
+        /* Patterns must not match the empty word */
+        if( !ptn || nullable )
+        {
+            pregex_ptn_free( ptn );
+            continue;
+        }
+
+        MSG( "Regular lexeme" );
+        VARS( "sym->name", "%s", sym->name );
+
+        deriv = pstrcatstr( pstrdup( sym->name ), P_REWRITTEN_LEXEME, FALSE );
+
+        term = get_symbol( parser, deriv, SYM_REGEX_TERMINAL, TRUE );
+        term->ptn = ptn;
+        term->lexem = TRUE;
+        term->used = TRUE;
+        term->defined = TRUE;
+        term->generated = TRUE;
+        term->line = sym->line;
+
+        plist_push( inlined, term );
+        pfree( deriv );
+
+        /* Replace the productions of the lexeme */
+        plist_for( sym->productions, f )
+            drop_production( parser, (PROD*)plist_access( f ) );
+
+        plist_erase( sym->productions );
+
+        p = create_production( parser, sym );
+        p->line = sym->line;
+        append_to_production( p, term, (char*)NULL );
+    }
+
+    /*
+        Drop inlined symbols which can't be reached anymore from any other
+        symbol. New terminals belong to their lexeme, so they are
+        considered as inlined, too.
+    */
+    reach = plist_create( 0, PLIST_MOD_PTRSET );
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( !plist_get_by_ptr( inlined, sym ) || sym == parser->goal
+                || sym->whitespace
+                || ( sym->all_sym && plist_count( sym->all_sym ) ) )
+        {
+            plist_push( reach, sym );
+            plist_push( stack, sym );
+        }
+    }
+
+    while( plist_pop( stack, &sym ) )
+    {
+        if( sym->type != SYM_NON_TERMINAL )
+            continue;
+
+        plist_for( sym->productions, e )
+        {
+            p = (PROD*)plist_access( e );
+
+            plist_for( p->rhs, f )
+            {
+                sym = (SYMBOL*)plist_access( f );
+
+                if( !plist_get_by_ptr( reach, sym ) )
+                {
+                    plist_push( reach, sym );
+                    plist_push( stack, sym );
+                }
+            }
+        }
+    }
+
+    cnt = plist_count( parser->symbols );
+    ids = (int*)pmalloc( cnt * sizeof( int ) );
+    memset( ids, 0, cnt * sizeof( int ) );
+
+    plist_for( inlined, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( plist_get_by_ptr( reach, sym ) )
+            continue;
+
+        ids[ sym->id ] = 1;
+
+        MSG( "Dropping symbol" );
+        VARS( "sym->name", "%s", sym->name );
+
+        if( sym->type == SYM_NON_TERMINAL )
+        {
+            plist_for( sym->productions, f )
+                drop_production( parser, (PROD*)plist_access( f ) );
+        }
+        else if( sym->type == SYM_CCL_TERMINAL )
+            plist_remove( parser->ccls,
+                plist_get_by_key( parser->ccls, (char*)sym->ccl ) );
+
+        keyname = sym->keyname;
+        free_symbol( sym );
+
+        plist_remove( parser->symbols,
+            plist_get_by_key( parser->symbols, keyname ) );
+        pfree( keyname );
+    }
+
+    /*
+        Close the gaps in symbol numbering, keeping the order; Symbols
+        created afterwards by the grammar rewriting would get IDs already in
+        use otherwise. Productions are renumbered by prune_grammar().
+    */
+    if( plist_count( parser->symbols ) < cnt )
+    {
+        for( i = 1; i < cnt; i++ )
+            ids[ i ] += ids[ i - 1 ];
+
+        plist_for( parser->symbols, e )
+        {
+            sym = (SYMBOL*)plist_access( e );
+            sym->id -= ids[ sym->id ];
+        }
+    }
+
+    pfree( ids );
+
+    plist_free( lexemes );
+    plist_free( stack );
+    plist_free( inlined );
+    plist_free( reach );
+
+    VOIDRET;
+}
+
+/* Creates the whitespace nonterminal P_WHITESPACE deriving any of the symbols
+in //ws//, and returns its optional positive closure. */
+static SYMBOL* whitespace_closure( PARSER* parser, plist* ws )
+{
+    plistel*	e;
+    SYMBOL*		ws_all;
+    SYMBOL*		ws_list;
+    SYMBOL*		ws_optlist;
+    SYMBOL*		sym;
+    PROD*		p;
+
+    ws_all = get_symbol( parser, P_WHITESPACE, SYM_NON_TERMINAL, TRUE );
+    ws_all->lexem = TRUE;
+    ws_all->generated = TRUE;
+
+    plist_for( ws, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( sym->type == SYM_NON_TERMINAL )
+            sym->lexem = TRUE;
+
+        p = create_production( parser, ws_all );
+        append_to_production( p, sym, (char*)NULL );
+    }
+
+    ws_all->whitespace = TRUE;
+
+    ws_list = positive_closure( parser, ws_all );
+    ws_list->lexem = TRUE;
+    ws_list->whitespace = TRUE;
+
+    ws_optlist = optional_closure( parser, ws_list );
+    ws_optlist->lexem = TRUE;
+    ws_optlist->whitespace = TRUE;
+
+    return ws_optlist;
+}
+
+/* Creates the regex terminal P_SKIP matching any of the whitespace symbols in
+//ws//, which is skipped by the lexical analyzers of the states allowing for
+whitespace.
+
+Whitespace terminals lose their whitespace flag, they are still used as
+ordinary terminals by rewritten lexemes.
+
+Returns (SYMBOL*)NULL if any whitespace can't be expressed by a pattern, or
+emits AST nodes. */
+static SYMBOL* whitespace_skip( PARSER* parser, plist* ws )
+{
+    plistel*	e;
+    plist*		stack;
+    plist*		inlined;
+    SYMBOL*		sym;
+    SYMBOL*		skip		= (SYMBOL*)NULL;
+    pregex_ptn*	alt			= (pregex_ptn*)NULL;
+    pregex_ptn*	ptn;
+    BOOLEAN		nullable;
+    BOOLEAN		greedy		= TRUE;
+
+    PROC( "whitespace_skip" );
+    PARMS( "parser", "%p", parser );
+    PARMS( "ws", "%p", ws );
+
+    stack = plist_create( 0, PLIST_MOD_PTRSET );
+    inlined = plist_create( 0, PLIST_MOD_PTRSET );
+
+    plist_for( ws, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( sym->emit )
+            break;
+
+        /* A nongreedy whitespace makes the entire skip nongreedy */
+        if( sym->type == SYM_REGEX_TERMINAL && !sym->greedy
+                && sym->ptn && !sym->code )
+        {
+            ptn = pregex_ptn_dup( sym->ptn );
+            nullable = FALSE;
+            greedy = FALSE;
+        }
+        else if( !lexeme_to_ptn( sym, stack, inlined, &ptn, &nullable ) )
+            break;
+
+        /* Skipping the empty word would never end */
+        if( !ptn || nullable )
+        {
+            pregex_ptn_free( ptn );
+            break;
+        }
+
+        alt = lexeme_alt( alt, ptn );
+    }
+
+    plist_free( stack );
+    plist_free( inlined );
+
+    if( e )
+    {
+        MSG( "Whitespace can't be skipped, rewriting required" );
+        VARS( "sym->name", "%s", sym->name );
+
+        pregex_ptn_free( alt );
+        RETURN( skip );
+    }
+
+    skip = get_symbol( parser, P_SKIP, SYM_REGEX_TERMINAL, TRUE );
+    skip->ptn = alt;
+    skip->greedy = greedy;
+    skip->lexem = TRUE;
+    skip->whitespace = TRUE;
+    skip->used = TRUE;
+    skip->defined = TRUE;
+    skip->generated = TRUE;
+
+    plist_for( ws, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( IS_TERMINAL( sym ) )
+            sym->whitespace = FALSE;
+    }
+
+    RETURN( skip );
+}
+
 /** Rewrites the grammar.
 
 The revision is done to simulate tokens which are separated by whitespaces.
 
+When whitespace skipping is switched on, the whitespace is matched by the
+lexical analyzers of the states allowing for whitespace instead. Only the
+terminals and lexemes which are also used within other lexemes are rewritten
+then, because whitespace is only allowed behind them in some contexts.
+
 //parser// is the pointer to parser information structure. */
 void rewrite_grammar( PARSER* parser )
 {
     plistel	*	e,
             *	f;
-    plist	*	stack,
+    plist	*	ws,
+            *	stack,
             *	done,
-            *	rewritten;
-    SYMBOL	*	ws_all		= (SYMBOL*)NULL,
-            *	ws_list,
-            *	ws_optlist,
+            *	rewritten,
+            *	inner		= (plist*)NULL;
+    SYMBOL	*	ws_optlist	= (SYMBOL*)NULL,
             *	sym,
             *	nsym;
     PROD	*	p;
@@ -32,38 +588,29 @@ void rewrite_grammar( PARSER* parser )
     productions would be rewritten multiple times)
     */
 
-    /* Create productions for all whitespaces */
+    /* Collect all whitespaces */
+    ws = plist_create( 0, PLIST_MOD_PTR );
+
     plist_for( parser->symbols, e )
     {
         sym = (SYMBOL*)plist_access( e );
 
         if( sym->whitespace )
-        {
-            if( !ws_all )
-            {
-                ws_all = get_symbol( parser, P_WHITESPACE,
-                                        SYM_NON_TERMINAL, TRUE );
-                ws_all->lexem = TRUE;
-                ws_all->generated = TRUE;
-            }
-
-            p = create_production( parser, ws_all );
-            append_to_production( p, sym, (char*)NULL );
-        }
+            plist_push( ws, sym );
     }
 
-    if( !ws_all )
+    if( !plist_count( ws ) )
+    {
+        plist_free( ws );
         return;
+    }
 
-    ws_all->whitespace = TRUE;
-
-    ws_list = positive_closure( parser, ws_all );
-    ws_list->lexem = TRUE;
-    ws_list->whitespace = TRUE;
+    if( parser->p_ws_skip && !parser->goal->lexem )
+        parser->skip = whitespace_skip( parser, ws );
 
-    ws_optlist = optional_closure( parser, ws_list );
-    ws_optlist->lexem = TRUE;
-    ws_optlist->whitespace = TRUE;
+    /* Create productions for all whitespaces */
+    if( !parser->skip )
+        ws_optlist = whitespace_closure( parser, ws );
 
     /*
         Find out all lexeme non-terminals and those
@@ -108,6 +655,31 @@ void rewrite_grammar( PARSER* parser )
         }
     }
 
+    /*
+        With whitespace skipping, find all symbols used within lexemes;
+        These are the only ones to be rewritten.
+    */
+    if( parser->skip )
+    {
+        inner = plist_create( 0, PLIST_MOD_PTRSET );
+
+        plist_for( parser->productions, e )
+        {
+            p = (PROD*)plist_access( e );
+
+            if( !p->lhs->lexem )
+                continue;
+
+            plist_for( p->rhs, f )
+            {
+                sym = (SYMBOL*)plist_access( f );
+
+                if( !plist_get_by_ptr( inner, sym ) )
+                    plist_push( inner, sym );
+            }
+        }
+    }
+
     /*
         Find all non-terminals from goal; If there is a call to a
         lexem non-terminal or a terminal, rewrite their rules and
@@ -150,6 +722,13 @@ void rewrite_grammar( PARSER* parser )
                         if( sym->type == SYM_SYSTEM_TERMINAL )
                             continue;
 
+                        /* Whitespace behind this symbol is skipped */
+                        if( inner && !plist_get_by_ptr( inner, sym ) )
+                            continue;
+
+                        if( !ws_optlist )
+                            ws_optlist = whitespace_closure( parser, ws );
+
                         /* Construct derivative symbol name */
                         deriv = pstrdup( sym->name );
 
@@ -199,10 +778,16 @@ void rewrite_grammar( PARSER* parser )
         }
     }
 
+    plist_free( ws );
+    plist_free( inner );
     plist_free( done );
     plist_free( rewritten );
     plist_free( stack );
 
+    /* Leading whitespace is skipped by the lexer of the initial state */
+    if( parser->skip )
+        return;
+
     /* Build a new goal symbol */
     deriv = pstrdup( parser->goal->name );
 
@@ -229,23 +814,58 @@ void rewrite_grammar( PARSER* parser )
     parser->goal = sym;
 }
 
+/* Boundary event: A character class begins or ends at a position */
+typedef struct
+{
+    wchar_t			pos;			/* Position of the boundary */
+    int				cls;			/* Index of the character class */
+    BOOLEAN			open;			/* TRUE if the class begins at pos */
+} CCL_BOUND;
+
+/* Sort function for character class boundaries */
+static int sort_bounds( parray* array, void* l, void* r )
+{
+    return (int)( (CCL_BOUND*)r )->pos - (int)( (CCL_BOUND*)l )->pos;
+}
+
 /** Rewrites the grammar to work with uniquely identifyable character sets
 instead of overlapping ones. This function was completely rewritten in Nov 2009.
 
+All character classes are split into their disjoint atomic partition in one
+sweep over the sorted range boundaries, which open and close classes in a set
+of active classes. Every character class consisting of more than one atom is
+then turned into a nonterminal deriving its atoms.
+
 //parser// is the pointer to parser to be rewritten.
 */
 void unique_charsets( PARSER* parser )
 {
     plistel*	e;
-    plistel*	f;
     SYMBOL*		sym;
-    SYMBOL*		tsym;
     SYMBOL*		nsym;
-    SYMBOL*		rsym;
+    SYMBOL**	psym;
     PROD*		p;
-    pccl*		inter;
-    pccl*		diff;
-    int			old_prod_cnt;
+    pccl*		atom;
+    pccl**		patom;
+    parray*		classes;
+    parray*		bounds;
+    parray*		atoms;
+    parray*		atom_syms;
+    parray*		parts;
+    plist*		sigs;
+    wchar_t		begin;
+    wchar_t		end;
+    CCL_BOUND	bound;
+    CCL_BOUND*	lo;
+    CCL_BOUND*	hi;
+    int*		active;
+    int*		idx;
+    char*		sig;
+    char*		sp;
+    int			cnt;
+    int			act		= 0;
+    int			i;
+    int			j;
 
     /*
     11.11.2009	Jan Max Meyer
@@ -255,116 +875,202 @@ void unique_charsets( PARSER* parser )
 
     PROC( "unique_charsets" );
 
-    do
+    /* Collect character classes and their range boundaries */
+    classes = parray_create( sizeof( SYMBOL* ), 0 );
+    bounds = parray_create( sizeof( CCL_BOUND ), 0 );
+    parray_set_sortfn( bounds, sort_bounds );
+
+    plist_for( parser->symbols, e )
     {
-        old_prod_cnt = plist_count( parser->productions );
+        sym = (SYMBOL*)plist_access( e );
+        if( sym->type != SYM_CCL_TERMINAL )
+            continue;
 
-        plist_for( parser->symbols, e )
+        bound.cls = parray_count( classes );
+        parray_push( classes, &sym );
+
+        for( i = 0; pccl_get( &begin, &end, sym->ccl, i ); i++ )
         {
-            /* Get symbol pointer */
-            sym = (SYMBOL*)plist_access( e );
-            if( sym->type != SYM_CCL_TERMINAL )
-                continue;
+            bound.pos = begin;
+            bound.open = TRUE;
+            parray_push( bounds, &bound );
 
-            MSG( "NEXT SYMBOL FOR REVISION" );
-            VARS( "sym->name", "%s", sym->name );
+            bound.pos = end + 1;
+            bound.open = FALSE;
+            parray_push( bounds, &bound );
+        }
+    }
 
-            /*
-            fprintf( stderr, "sym->ccl: %d\n", pccl_size( sym->ccl ) );
-            pccl_print( stderr, sym->ccl, 1 );
-            */
+    VARS( "classes", "%d", parray_count( classes ) );
 
-            /* Find overlapping character classes */
-            MSG( "Searching for overlapping character classes" );
-            plist_for( parser->symbols, f )
+    if( parray_count( classes ) < 2 )
+    {
+        parray_free( classes );
+        parray_free( bounds );
+        VOIDRET;
+    }
+
+    parray_sort( bounds );
+
+    cnt = parray_count( classes );
+    /* Active classes, in ascending order */
+    active = (int*)pmalloc( cnt * sizeof( int ) );
+    /* Signature of the covering classes, by "%d " for each class */
+    sig = (char*)pmalloc( ( cnt * 12 + 1 ) * sizeof( char ) );
+
+    parts = (parray*)pmalloc( cnt * sizeof( parray ) );
+    for( i = 0; i < cnt; i++ )
+        parray_init( &parts[ i ], sizeof( int ), 0 );
+
+    atoms = parray_create( sizeof( pccl* ), 0 );
+    sigs = plist_create( sizeof( int ), PLIST_MOD_NONE );
+
+    /*
+        Sweep over the intervals between the boundaries. Every interval is
+        either fully covered or not covered at all by each character class,
+        so the set of covering classes identifies the atom it belongs to.
+        The boundary events at the begin of an interval open and close the
+        classes changing there, all other classes stay as they are.
+    */
+    MSG( "Building disjoint atomic partition" );
+
+    for( lo = (CCL_BOUND*)parray_first( bounds ); lo; lo = hi )
+    {
+        for( hi = lo; hi && hi->pos == lo->pos;
+                hi = (CCL_BOUND*)parray_next( bounds, hi ) )
+        {
+            if( hi->open )
             {
-                tsym = (SYMBOL*)plist_access( f );
+                for( i = act++; i > 0 && active[ i - 1 ] > hi->cls; i-- )
+                    active[ i ] = active[ i - 1 ];
 
-                if( tsym->type != SYM_CCL_TERMINAL )
-                    continue;
+                active[ i ] = hi->cls;
+            }
+            else
+            {
+                for( i = 0; active[ i ] != hi->cls; i++ )
+                    ;
 
-                VARS( "tsym->name", "%s", tsym->name );
+                for( act--; i < act; i++ )
+                    active[ i ] = active[ i + 1 ];
+            }
+        }
 
-                inter = pccl_intersect( sym->ccl, tsym->ccl );
+        if( !hi || !act )
+            continue;
 
-                /*
-                fprintf( stdout, "inter = >%s< sym = >%s< tsym = >%s<\n",
-                    pccl_to_str( inter, TRUE ),
-                    pccl_to_str( sym->ccl, TRUE ),
-                    pccl_to_str( tsym->ccl, TRUE ) );
-                */
+        *( sp = sig ) = '\0';
 
-                VARS( "inter", "%p", inter );
-                if( inter )
-                {
-                    MSG( "Intersections found with tsym" );
+        for( i = 0; i < act; i++ )
+            sp += sprintf( sp, "%d ", active[ i ] );
 
-                    /* Create charclass-symbol for remaining symbols */
-                    diff = pccl_diff( tsym->ccl, inter );
-                    if( !pccl_size( diff ) )
-                    {
-                        diff = pccl_free( diff );
-                        inter = pccl_free( inter );
-                        continue;
-                    }
+        VARS( "sig", "%s", sig );
 
-                    /* Disallow intersections in scanner-mode */
-                    if( parser->p_mode == MODE_SCANNER )
-                    {
-                        print_error( parser, ERR_CHARCLASS_OVERLAP,
-                                    ERRSTYLE_FATAL,
-                                        pccl_to_str( inter, TRUE ));
+        if( ( e = plist_get_by_key( sigs, sig ) ) )
+            atom = *( (pccl**)parray_get( atoms,
+                                        *( (int*)plist_access( e ) ) ) );
+        else
+        {
+            MSG( "New atom" );
+            atom = pccl_create( -1, -1, (char*)NULL );
 
-                        inter = pccl_free( inter );
-                        continue;
-                    }
+            i = parray_count( atoms );
+            parray_push( atoms, &atom );
+            plist_insert( sigs, (plistel*)NULL, sig, &i );
 
-                    /* Create charclass-symbol for intersecting symbols */
-                    if( !( nsym = get_symbol( parser, (void*)inter,
-                                    SYM_CCL_TERMINAL, FALSE ) ) )
-                    {
-                        nsym = get_symbol( parser, (void*)inter,
-                                        SYM_CCL_TERMINAL, TRUE );
-                        nsym->used = TRUE;
-                        nsym->defined = TRUE;
-                    }
-                    else
-                        inter = pccl_free( inter );
-
-                    rsym = get_symbol( parser, (void*)diff,
-                                    SYM_CCL_TERMINAL, TRUE );
-                    rsym->used = TRUE;
-                    rsym->defined = TRUE;
-
-                    /* Re-configure symbol */
-                    tsym->ccl = pccl_free( tsym->ccl );
-                    tsym->name = pstrcatstr( tsym->name,
-                                    P_REWRITTEN_CCL, FALSE );
-                    tsym->type = SYM_NON_TERMINAL;
-                    plist_erase( tsym->first );
-                    tsym->productions = plist_create( 0, PLIST_MOD_PTR );
-
-                    /* Create & append productions */
-                    p = create_production( parser, tsym );
-                    append_to_production( p, nsym, (char*)NULL );
-
-                    p = create_production( parser, tsym );
-                    append_to_production( p, rsym, (char*)NULL );
-                }
-                else
-                {
-                    MSG( "Has no intersections, next" );
-                }
+            for( j = act; j--; )
+                parray_push( &parts[ active[ j ] ], &i );
+        }
+
+        pccl_addrange( atom, lo->pos, hi->pos - 1 );
+    }
+
+    VARS( "atoms", "%d", parray_count( atoms ) );
+
+
+    /* Disallow intersections in scanner-mode */
+    if( parser->p_mode == MODE_SCANNER )
+    {
+        plist_for( sigs, e )
+        {
+            patom = (pccl**)parray_get( atoms, *( (int*)plist_access( e ) ) );
+
+            /* Atoms covered by more than one class are overlaps */
+            if( *( strchr( plist_key( e ), ' ' ) + 1 ) )
+                print_error( parser, ERR_CHARCLASS_OVERLAP, ERRSTYLE_FATAL,
+                                pccl_to_str( *patom, TRUE ) );
+
+            pccl_free( *patom );
+        }
+
+        atom_syms = (parray*)NULL;
+    }
+    else
+    {
+        /* Get or create the symbols of the atoms */
+        atom_syms = parray_create( sizeof( SYMBOL* ), 0 );
+
+        parray_for( atoms, patom )
+        {
+            if( !( nsym = get_symbol( parser, (void*)*patom,
+                            SYM_CCL_TERMINAL, FALSE ) ) )
+            {
+                nsym = get_symbol( parser, (void*)*patom,
+                                SYM_CCL_TERMINAL, TRUE );
+                nsym->used = TRUE;
+                nsym->defined = TRUE;
             }
+            else
+                pccl_free( *patom );
+
+            parray_push( atom_syms, &nsym );
         }
 
-        /*
-        fprintf( stderr, "-----\nCURRENT GRAMMAR:\n" );
-        dump_grammar( stderr, parser );
-        getchar();
-        */
+        /* Rewrite character classes consisting of more than one atom */
+        for( i = 0; i < cnt; i++ )
+        {
+            if( parray_count( &parts[ i ] ) < 2 )
+                continue;
+
+            sym = *( (SYMBOL**)parray_get( classes, i ) );
+
+            MSG( "Rewriting character class" );
+            VARS( "sym->name", "%s", sym->name );
+
+            /* Re-configure symbol */
+            plist_remove( parser->ccls,
+                plist_get_by_key( parser->ccls, (char*)sym->ccl ) );
+            sym->ccl = pccl_free( sym->ccl );
+            sym->name = pstrcatstr( sym->name, P_REWRITTEN_CCL, FALSE );
+            sym->type = SYM_NON_TERMINAL;
+            plist_erase( sym->first );
+            sym->productions = plist_create( 0, PLIST_MOD_PTR );
+
+            /* Create & append productions */
+            parray_for( &parts[ i ], idx )
+            {
+                psym = (SYMBOL**)parray_get( atom_syms, *idx );
+
+                p = create_production( parser, sym );
+                append_to_production( p, *psym, (char*)NULL );
+            }
+        }
     }
-    while( old_prod_cnt != plist_count( parser->productions ) );
+
+    for( i = 0; i < cnt; i++ )
+        parray_erase( &parts[ i ] );
+
+    pfree( parts );
+    pfree( active );
+    pfree( sig );
+
+    plist_free( sigs );
+    parray_free( atoms );
+
+    if( atom_syms )
+        parray_free( atom_syms );
+    parray_free( classes );
+    parray_free( bounds );
 
     VOIDRET;
 }
@@ -605,7 +1311,238 @@ void charsets_to_ptn( PARSER* parser )
 }
 
 
-/** Re-arrange symbol orders. */
+/* Checks if all right-hand side symbols of //p// are in //productive//. */
+static BOOLEAN production_is_productive( PROD* p, plist* productive )
+{
+    plistel*	e;
+    SYMBOL*		sym;
+
+    plist_for( p->rhs, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( !IS_TERMINAL( sym ) && !plist_get_by_ptr( productive, sym ) )
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/** Removes symbols and productions which don't contribute to the language.
+
+Nonterminals deriving no terminal string are non-productive; they are dropped
+together with every production using them. Afterwards, symbols and productions
+which can't be reached from the goal symbol are dropped, too. Symbols required
+beyond the productions, like system terminals, whitespace and the terminals of
+a scanner-mode lexer, are always kept. The productions are renumbered; the
+symbols are later renumbered by symbol_orders().
+
+Dropped symbols defined by the grammar are reported by warnings, and
+productions dropped from a remaining nonterminal are reported as useless.
+
+//parser// is the pointer to parser information structure. */
+void prune_grammar( PARSER* parser )
+{
+    plistel*	e;
+    plistel*	f;
+    SYMBOL*		sym;
+    PROD*		p;
+    plist*		productive;
+    plist*		reach;
+    plist*		stack;
+    char*		keyname;
+    BOOLEAN		changed;
+
+    PROC( "prune_grammar" );
+    PARMS( "parser", "%p", parser );
+
+    /* Undefined symbols are reported later on, keep the grammar as is */
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( !sym->generated && !sym->defined )
+        {
+            MSG( "Undefined symbols, nothing to do" );
+            VOIDRET;
+        }
+    }
+
+    /* Find productive nonterminals */
+    productive = plist_create( 0, PLIST_MOD_PTRSET );
+
+    do
+    {
+        changed = FALSE;
+
+        plist_for( parser->productions, e )
+        {
+            p = (PROD*)plist_access( e );
+
+            if( plist_get_by_ptr( productive, p->lhs )
+                    || !production_is_productive( p, productive ) )
+                continue;
+
+            plist_for( p->all_lhs, f )
+                plist_push( productive, plist_access( f ) );
+
+            changed = TRUE;
+        }
+    }
+    while( changed );
+
+    /* If the goal is not productive, the grammar is broken anyway */
+    if( !plist_get_by_ptr( productive, parser->goal ) )
+    {
+        MSG( "Goal symbol is not productive, nothing to do" );
+        plist_free( productive );
+        VOIDRET;
+    }
+
+    /* Find reachable symbols */
+    reach = plist_create( 0, PLIST_MOD_PTRSET );
+    stack = plist_create( 0, PLIST_MOD_PTR );
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+
+        if( sym == parser->goal || sym == parser->skip || sym->whitespace
+                || sym->type == SYM_SYSTEM_TERMINAL
+                || ( parser->p_mode == MODE_SCANNER && IS_TERMINAL( sym ) ) )
+        {
+            plist_push( reach, sym );
+            plist_push( stack, sym );
+        }
+    }
+
+    while( plist_pop( stack, &sym ) )
+    {
+        /* Keep base symbols and multiple terminal definitions */
+        if( sym->derived_from && !plist_get_by_ptr( reach, sym->derived_from ) )
+        {
+            plist_push( reach, sym->derived_from );
+            plist_push( stack, sym->derived_from );
+        }
+
+        plist_for( sym->all_sym, e )
+        {
+            if( !plist_get_by_ptr( reach, plist_access( e ) ) )
+            {
+                plist_push( reach, plist_access( e ) );
+                plist_push( stack, plist_access( e ) );
+            }
+        }
+
+        plist_for( sym->productions, e )
+        {
+            p = (PROD*)plist_access( e );
+
+            if( !production_is_productive( p, productive ) )
+                continue;
+
+            plist_for( p->all_lhs, f )
+            {
+                if( !plist_get_by_ptr( reach, plist_access( f ) ) )
+                {
+                    plist_push( reach, plist_access( f ) );
+                    plist_push( stack, plist_access( f ) );
+                }
+            }
+
+            plist_for( p->rhs, f )
+            {
+                if( !plist_get_by_ptr( reach, plist_access( f ) ) )
+                {
+                    plist_push( reach, plist_access( f ) );
+                    plist_push( stack, plist_access( f ) );
+                }
+            }
+        }
+    }
+
+    /* Drop productions */
+    for( e = plist_first( parser->productions ); e; e = f )
+    {
+        f = plist_next( e );
+        p = (PROD*)plist_access( e );
+
+        if( plist_get_by_ptr( reach, p->lhs )
+                && production_is_productive( p, productive ) )
+            continue;
+
+        MSG( "Dropping production" );
+        VARS( "p->id", "%d", p->id );
+
+        if( plist_get_by_ptr( reach, p->lhs ) && !p->lhs->generated )
+            print_error( parser, ERR_USELESS_RULE,
+                ERRSTYLE_WARNING | ERRSTYLE_PRODUCTION | ERRSTYLE_FILEINFO,
+                    parser->filename, p->line, p );
+
+        plist_for( p->all_lhs, f )
+            plist_remove( ( (SYMBOL*)plist_access( f ) )->productions,
+                plist_get_by_ptr( ( (SYMBOL*)plist_access( f ) )->productions,
+                                    p ) );
+
+        f = plist_next( e );
+        free_production( p );
+        plist_remove( parser->productions, e );
+    }
+
+    /* Drop symbols */
+    for( e = plist_first( parser->symbols ); e; e = f )
+    {
+        f = plist_next( e );
+        sym = (SYMBOL*)plist_access( e );
+
+        if( plist_get_by_ptr( reach, sym ) )
+            continue;
+
+        MSG( "Dropping symbol" );
+        VARS( "sym->name", "%s", sym->name );
+
+        /* Terminals only used by dropped productions are kept quiet */
+        if( !sym->generated && !sym->used )
+            print_error( parser, IS_TERMINAL( sym ) ?
+                ERR_UNUSED_TERM : ERR_UNUSED_NONTERM,
+                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                        parser->filename, sym->line, sym->name );
+        else if( !sym->generated && !IS_TERMINAL( sym ) )
+            print_error( parser, plist_get_by_ptr( productive, sym ) ?
+                ERR_UNREACHABLE_NONTERM : ERR_UNPRODUCTIVE_NONTERM,
+                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                        parser->filename, sym->line, sym->name );
+
+        if( sym->type == SYM_CCL_TERMINAL )
+            plist_remove( parser->ccls,
+                plist_get_by_key( parser->ccls, (char*)sym->ccl ) );
+
+        keyname = sym->keyname;
+        free_symbol( sym );
+
+        plist_remove( parser->symbols,
+            plist_get_by_key( parser->symbols, keyname ) );
+        pfree( keyname );
+    }
+
+    plist_for( parser->productions, e )
+        ( (PROD*)plist_access( e ) )->id = plist_offset( e );
+
+    plist_free( productive );
+    plist_free( reach );
+    plist_free( stack );
+
+    VOIDRET;
+}
+
+/** Re-arrange symbol orders.
+
+The symbols are numbered densely in their sort order, which puts all terminals
+before the nonterminals. Terminals get the IDs 0 to parser->terminals - 1, and
+the nonterminals follow, so that tables indexed by terminal or by nonterminal
+need no search and no mapping of the IDs.
+
+//parser// is the pointer to parser information structure. */
 void symbol_orders( PARSER* parser )
 {
     plistel*	e;
@@ -615,11 +1552,17 @@ void symbol_orders( PARSER* parser )
     PARMS( "parser", "%p", parser );
 
     plist_sort( parser->symbols );
+    parser->terminals = 0;
+
     plist_for( parser->symbols, e )
     {
         sym = (SYMBOL*)plist_access( e );
         sym->id = plist_offset( e );
+
+        if( IS_TERMINAL( sym ) )
+            parser->terminals++;
     }
 
+    VARS( "parser->terminals", "%d", parser->terminals );
     VOIDRET;
 }
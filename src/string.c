@@ -58,3 +58,261 @@ char* str_no_whitespace( char* str )
 
     return start;
 }
+
+/** Initializes the output buffer //ob//.
+
+If //stream// is given, the buffer content is written to it in chunks of
+OUTBUF_FLUSH bytes while appending, and outbuf_flush() writes the remainder.
+Otherwise, the buffer keeps all its content, which can be accessed as
+zero-terminated string by //ob//->buf; This is (char*)NULL as long as nothing
+has been appended. */
+void outbuf_init( OUTBUF* ob, FILE* stream )
+{
+    memset( ob, 0, sizeof( OUTBUF ) );
+    ob->stream = stream;
+}
+
+/** Appends //len// bytes from //str// to the output buffer //ob//. */
+void outbuf_write( OUTBUF* ob, char* str, size_t len )
+{
+    if( ob->len + len + 1 > ob->size )
+    {
+        ob->size = ( ob->size ? ob->size * 2 : OUTBUF_CHUNK );
+
+        if( ob->size < ob->len + len + 1 )
+            ob->size = ob->len + len + 1;
+
+        if( !( ob->buf = (char*)prealloc( ob->buf, ob->size ) ) )
+            OUTOFMEM;
+    }
+
+    memcpy( ob->buf + ob->len, str, len );
+    ob->len += len;
+    ob->buf[ ob->len ] = '\0';
+
+    if( ob->stream && ob->len >= OUTBUF_FLUSH )
+        outbuf_flush( ob );
+}
+
+/** Appends the string //str// to the output buffer //ob//.
+
+The buffer grows by doubling its size, so appending is amortized linear in the
+length of //str//. If //freestr// is TRUE, //str// is freed after appending. */
+void outbuf_append( OUTBUF* ob, char* str, BOOLEAN freestr )
+{
+    if( !str )
+        return;
+
+    outbuf_write( ob, str, strlen( str ) );
+
+    if( freestr )
+        pfree( str );
+}
+
+/** Renders the template //tpl// into the output buffer //ob//.
+
+This works exactly like pstrrender() with the same set of wildcard, value and
+free-flag triples, but writes its result into //ob// instead of allocating a
+new string, and finds each wildcard only once per occurrence. */
+void outbuf_render( OUTBUF* ob, char* tpl, ... )
+{
+    struct
+    {
+        char*	wildcard;
+        char*	value;
+        BOOLEAN	clear;
+        char*	match;
+    }			values[ 64 ];
+    va_list		args;
+    int			i;
+    int			vcount;
+    int			match;
+
+    va_start( args, tpl );
+
+    for( vcount = 0; vcount < sizeof( values ) / sizeof( *values ); vcount++ )
+    {
+        if( !( values[ vcount ].wildcard = va_arg( args, char* ) ) )
+            break;
+
+        values[ vcount ].value = va_arg( args, char* );
+        values[ vcount ].clear = (BOOLEAN)va_arg( args, int );
+        values[ vcount ].match = tpl ?
+                        strstr( tpl, values[ vcount ].wildcard ) : (char*)NULL;
+    }
+
+    va_end( args );
+
+    while( tpl )
+    {
+        /* Find the nearest wildcard, the first one wins on equal position */
+        for( i = 0, match = vcount; i < vcount; i++ )
+            if( values[ i ].match && ( match == vcount
+                    || values[ i ].match < values[ match ].match ) )
+                match = i;
+
+        if( match == vcount )
+        {
+            outbuf_append( ob, tpl, FALSE );
+            break;
+        }
+
+        outbuf_write( ob, tpl, values[ match ].match - tpl );
+        outbuf_append( ob, values[ match ].value, FALSE );
+        tpl = values[ match ].match + strlen( values[ match ].wildcard );
+
+        /* Search again for wildcards which matched before the new position */
+        for( i = 0; i < vcount; i++ )
+            if( values[ i ].match && values[ i ].match < tpl )
+                values[ i ].match = strstr( tpl, values[ i ].wildcard );
+    }
+
+    for( i = 0; i < vcount; i++ )
+        if( values[ i ].clear )
+            pfree( values[ i ].value );
+}
+
+/** Writes the content of //ob// to its stream, and empties the buffer. */
+void outbuf_flush( OUTBUF* ob )
+{
+    if( !ob->stream || !ob->len )
+        return;
+
+    fwrite( ob->buf, sizeof( char ), ob->len, ob->stream );
+
+    ob->len = 0;
+    *ob->buf = '\0';
+}
+
+/** Frees the content of the output buffer //ob//, which is reset. */
+void outbuf_free( OUTBUF* ob )
+{
+    pfree( ob->buf );
+    outbuf_init( ob, ob->stream );
+}
+
+/** Compiles the template snippet //tpl// for repeated rendering.
+
+The snippet is split into literal text segments, each followed by one of the
+wildcards specified by //...//. These are pairs of
+
+- //char* wildcard// as the wildcard name, and
+- //int type// as SNIPPET_INT or SNIPPET_STR, the type of its value,
+-
+
+terminated by (char*)NULL. Wildcards are matched like pstrrender() does;
+Wildcards not specified remain in the text. The segments refer to //tpl//,
+which must exist as long as the snippet is used.
+
+Returns an allocated SNIPPET, which must be freed with snippet_free(). */
+SNIPPET* snippet_compile( char* tpl, ... )
+{
+    SNIPPET*	snip;
+    SNIPPET_SEG	seg;
+    char*		wildcards	[ SNIPPET_MAXARGS ];
+    char*		match		[ SNIPPET_MAXARGS ];
+    va_list		args;
+    int			i;
+
+    snip = (SNIPPET*)pmalloc( sizeof( SNIPPET ) );
+    snip->segs = parray_create( sizeof( SNIPPET_SEG ), 0 );
+
+    va_start( args, tpl );
+
+    for( snip->args = 0; snip->args < SNIPPET_MAXARGS; snip->args++ )
+    {
+        if( !( wildcards[ snip->args ] = va_arg( args, char* ) ) )
+            break;
+
+        snip->types[ snip->args ] = va_arg( args, int );
+        match[ snip->args ] = tpl ?
+                        strstr( tpl, wildcards[ snip->args ] ) : (char*)NULL;
+    }
+
+    va_end( args );
+
+    while( tpl && *tpl )
+    {
+        /* Find the nearest wildcard, the first one wins on equal position */
+        for( i = 0, seg.arg = -1; i < snip->args; i++ )
+            if( match[ i ] && ( seg.arg < 0 || match[ i ] < match[ seg.arg ] ) )
+                seg.arg = i;
+
+        seg.text = tpl;
+
+        if( seg.arg < 0 )
+        {
+            seg.len = strlen( tpl );
+            parray_push( snip->segs, &seg );
+            break;
+        }
+
+        seg.len = match[ seg.arg ] - tpl;
+        parray_push( snip->segs, &seg );
+
+        tpl = match[ seg.arg ] + strlen( wildcards[ seg.arg ] );
+
+        for( i = 0; i < snip->args; i++ )
+            if( match[ i ] && match[ i ] < tpl )
+                match[ i ] = strstr( tpl, wildcards[ i ] );
+    }
+
+    return snip;
+}
+
+/** Renders the compiled snippet //snip// into the output buffer //ob//.
+
+//...// are the values for the wildcards, in the order and of the types
+they were specified to snippet_compile(). Integer values are printed directly
+into the buffer; String values are not freed, (char*)NULL renders nothing. */
+void snippet_render( OUTBUF* ob, SNIPPET* snip, ... )
+{
+    SNIPPET_SEG*	seg;
+    int				ints	[ SNIPPET_MAXARGS ];
+    char*			strs	[ SNIPPET_MAXARGS ];
+    char			num		[ 32 ];
+    va_list			args;
+    int				i;
+
+    va_start( args, snip );
+
+    for( i = 0; i < snip->args; i++ )
+    {
+        if( snip->types[ i ] == SNIPPET_INT )
+            ints[ i ] = va_arg( args, int );
+        else
+            strs[ i ] = va_arg( args, char* );
+    }
+
+    va_end( args );
+
+    parray_for( snip->segs, seg )
+    {
+        outbuf_write( ob, seg->text, seg->len );
+
+        if( seg->arg < 0 )
+            continue;
+
+        if( snip->types[ seg->arg ] == SNIPPET_INT )
+        {
+            sprintf( num, "%d", ints[ seg->arg ] );
+            outbuf_write( ob, num, strlen( num ) );
+        }
+        else
+            outbuf_append( ob, strs[ seg->arg ], FALSE );
+    }
+}
+
+/** Frees the compiled snippet //snip//.
+
+Returns (SNIPPET*)NULL. */
+SNIPPET* snippet_free( SNIPPET* snip )
+{
+    if( !snip )
+        return (SNIPPET*)NULL;
+
+    parray_free( snip->segs );
+    pfree( snip );
+
+    return (SNIPPET*)NULL;
+}
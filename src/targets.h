@@ -0,0 +1,6257 @@
+/* Stock target templates. This file was generated by
+targets/tools/mktargets.awk from the target templates;
+Don't edit, regenerate it! */
+
+static char*	stock_target_0[] =
+{
+	"<\?xml version=\"1.0\" standalone=\"yes\"\?>\n",
+	"<generator name=\"C++\">\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Boolean values\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"    <true>true</true>\n",
+	"    <false>false</false>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Table value types, from the narrowest to the widest\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"    <int_type min=\"0\" max=\"255\">unsigned char</int_type>\n",
+	"    <int_type min=\"-128\" max=\"127\">signed char</int_type>\n",
+	"    <int_type min=\"0\" max=\"65535\">unsigned short</int_type>\n",
+	"    <int_type min=\"-32768\" max=\"32767\">short</int_type>\n",
+	"    <int_type min=\"-2147483647\" max=\"2147483647\">int</int_type>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Escape sequences\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- Backslash must be double-quoted -->\n",
+	"    <escape-sequence for=\"\\\" do=\"\\\\\" />\n",
+	"    <!-- Escape double quotation marks -->\n",
+	"    <escape-sequence for=\"&#x22;\" do=\"\\&#x22;\" />\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Value-stack templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <vstack_def_type>int</vstack_def_type>\n",
+	"    <vstack_term_type>int</vstack_term_type>\n",
+	"\n",
+	"    <vstack_single>typedef @@value-type @@prefix_vtype;</vstack_single>\n",
+	"    <vstack_union_start>union @@prefix_VTYPE&#x0A;{&#x0A;</vstack_union_start>\n",
+	"    <vstack_union_end>} @@prefix_vtype;&#x0A;&#x0A;</vstack_union_end>\n",
+	"    <vstack_union_def>    @@value-type @@attribute;&#x0A;</vstack_union_def>\n",
+	"    <vstack_union_att>value_@@value-type-id</vstack_union_att>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <action_start>                case @@production-number:&#x0A;                {&#x0A;                    </action_start>\n",
+	"    <action_end>&#x0A;                    ;&#x0A;                }                break;\n",
+	"    </action_end>\n",
+	"\n",
+	"    <action_single>( ( this->tos - @@offset )->value )</action_single>\n",
+	"\n",
+	"    <action_union>( ( this->tos - @@offset )->value.@@attribute )</action_union>\n",
+	"    <action_lhs_single>this->ret</action_lhs_single>\n",
+	"    <action_lhs_union>this->ret.@@attribute</action_lhs_union>\n",
+	"\n",
+	"    <action_set_lhs>( this->lhs = @@sym )</action_set_lhs>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic terminal action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <scan_action_start>                case @@symbol-number:&#x0A;                {&#x0A;                    </scan_action_start>\n",
+	"    <scan_action_end>&#x0A;                    ;&#x0A;                }                break;\n",
+	"    </scan_action_end>\n",
+	"\n",
+	"    <scan_action_begin_offset>this->lexem( pcb )</scan_action_begin_offset>\n",
+	"    <scan_action_end_offset>this->len</scan_action_end_offset>\n",
+	"    <scan_action_ret_single>this->tos->value</scan_action_ret_single>\n",
+	"    <scan_action_ret_union>( this->tos->value.@@attribute )</scan_action_ret_union>\n",
+	"\n",
+	"    <scan_action_set_symbol>( this->sym = @@sym )</scan_action_set_symbol>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Parse table templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <defprod>\n",
+	"        <col>@@production-number</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </defprod>\n",
+	"\n",
+	"    <acttab>\n",
+	"        <row_start>			{ @@number-of-columns</row_start>\n",
+	"        <row_end> }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>, @@symbol,@@action,@@index </col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </acttab>\n",
+	"\n",
+	"    <gotab>\n",
+	"        <row_start>			{ @@number-of-columns</row_start>\n",
+	"        <row_end> }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>, @@symbol,@@action,@@index </col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </gotab>\n",
+	"\n",
+	"    <dfa_select>\n",
+	"        <col>@@machine</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_select>\n",
+	"\n",
+	"    <dfa_char>\n",
+	"        <col>@@from, @@to</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_char>\n",
+	"\n",
+	"    <dfa_trans>\n",
+	"        <col>@@goto</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_trans>\n",
+	"\n",
+	"    <dfa_idx>\n",
+	"        <row_start>			{ </row_start>\n",
+	"        <row_end> }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>@@index</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_idx>\n",
+	"\n",
+	"    <dfa_accept>\n",
+	"        <row_start>			{ </row_start>\n",
+	"        <row_end> }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>@@accept</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_accept>\n",
+	"\n",
+	"    <dfa_fold>\n",
+	"        <col>@@fold</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_fold>\n",
+	"\n",
+	"    <dfa_mask>\n",
+	"        <row_start>			{ </row_start>\n",
+	"        <row_end> }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>@@mask</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_mask>\n",
+	"\n",
+	"    <comb>\n",
+	"        <col>@@value</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </comb>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Symbol and production information tables\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <symbols>\n",
+	"        <col>			{ /* @@symbol */ \"@@symbol-name\", \"@@emit\", @@type, @@lexem, @@whitespace, @@greedy }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </symbols>\n",
+	"\n",
+	"    <productions>\n",
+	"        <col>			{ /* @@production-number */ \"@@production\", \"@@emit\", @@length, @@lhs }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </productions>\n",
+	"\n",
+	"    <code_localization>#line @@line \"@@filename\"\n",
+	"</code_localization>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Sections\n",
+	"    ****************************************************************************\n",
+	"    The parser is composed of the following sections, which are inserted into\n",
+	"    the files below for their placeholders @@<name>-section. With split\n",
+	"    translation units (-U), the files with the split-attribute \"yes\" are\n",
+	"    written instead of those with \"no\". The parse tables stay members of the\n",
+	"    parser class, and are therefore part of the header. A line break directly\n",
+	"    behind the opening section-tag is not part of the section.\n",
+	"\n",
+	"    Code only required by some parsers is enclosed by the condition lines\n",
+	"    \"@@if feature\", \"@@else\" and \"@@endif\", which are expanded by the code\n",
+	"    generator as described in the C target.\n",
+	"    -->\n",
+	"    <section name=\"actions\">\n",
+	"// Runs the semantic action of the production this-&gt;idx to be reduced\n",
+	"void @@prefix_parser::reduce( void )\n",
+	"{\n",
+	"    switch( this-&gt;idx )\n",
+	"    {\n",
+	"@@actions\n",
+	"    }\n",
+	"}\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"scanner\">\n",
+	"/*\n",
+	"    Runs the scanner action of the shifted terminal with UNICC_ON_SHIFT = 1,\n",
+	"    so that shifting-related operations will be performed.\n",
+	"*/\n",
+	"void @@prefix_parser::scan_shift( void )\n",
+	"{\n",
+	"#define UNICC_ON_SHIFT	1\n",
+	"    switch( this-&gt;sym )\n",
+	"    {\n",
+	"@@scan_actions\n",
+	"\n",
+	"        default:\n",
+	"            @@top-value = this-&gt;get_input( 0 );\n",
+	"            break;\n",
+	"    }\n",
+	"#undef UNICC_ON_SHIFT\n",
+	"}\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"driver\">\n",
+	"UNICC_SCHAR* @@prefix_parser::get_lexem( void )\n",
+	"{\n",
+	"#if UNICC_WCHAR || !UNICC_UTF8\n",
+	"    this-&gt;lexem = this-&gt;buf;\n",
+	"#else\n",
+	"    size_t		size;\n",
+	"\n",
+	"    size = wcstombs( (char*)NULL, this-&gt;buf, 0 );\n",
+	"\n",
+	"    free( this-&gt;lexem );\n",
+	"\n",
+	"    if( !( this-&gt;lexem = (UNICC_SCHAR*)malloc(\n",
+	"            ( size + 1 ) * sizeof( UNICC_SCHAR ) ) ) )\n",
+	"    {\n",
+	"        UNICC_OUTOFMEM( this );\n",
+	"        return NULL;\n",
+	"    }\n",
+	"\n",
+	"    wcstombs( this-&gt;lexem, this-&gt;buf, size + 1 );\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: lexem: this-&gt;lexem = &gt;\" UNICC_SCHAR_FORMAT \"&lt;\\n\",\n",
+	"                        UNICC_PARSER, this-&gt;lexem );\n",
+	"#endif\n",
+	"    return this-&gt;lexem;\n",
+	"}\n",
+	"\n",
+	"@@prefix_ast* @@prefix_parser::ast_free( @@prefix_ast* node )\n",
+	"{\n",
+	"    if( !node )\n",
+	"        return NULL;\n",
+	"\n",
+	"    this-&gt;ast_free( node-&gt;child );\n",
+	"    this-&gt;ast_free( node-&gt;next );\n",
+	"\n",
+	"    if( node-&gt;token )\n",
+	"        free( node-&gt;token );\n",
+	"\n",
+	"    free( node );\n",
+	"    return NULL;\n",
+	"}\n",
+	"\n",
+	"@@prefix_ast* @@prefix_parser::ast_create( const char* emit, UNICC_SCHAR* token )\n",
+	"{\n",
+	"    @@prefix_ast*	node;\n",
+	"\n",
+	"    if( !( node = (@@prefix_ast*)malloc( sizeof( @@prefix_ast ) ) ) )\n",
+	"    {\n",
+	"        UNICC_OUTOFMEM( this );\n",
+	"        return node;\n",
+	"    }\n",
+	"\n",
+	"    memset( node, 0, sizeof( @@prefix_ast ) );\n",
+	"\n",
+	"    node-&gt;emit = emit;\n",
+	"\n",
+	"    if( token )\n",
+	"    {\n",
+	"        #if !UNICC_WCHAR\n",
+	"        if( !( node-&gt;token = strdup( token ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( this );\n",
+	"            free( node );\n",
+	"            return (@@prefix_ast*)NULL;\n",
+	"        }\n",
+	"        #else\n",
+	"        if( !( node-&gt;token = wcsdup( token ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( this );\n",
+	"            free( node );\n",
+	"            return (@@prefix_ast*)NULL;\n",
+	"        }\n",
+	"        #endif\n",
+	"    }\n",
+	"\n",
+	"    return node;\n",
+	"}\n",
+	"\n",
+	"void @@prefix_parser::ast_print( FILE* stream, @@prefix_ast* node )\n",
+	"{\n",
+	"    int 		i;\n",
+	"    static int 	rec;\n",
+	"\n",
+	"    if( !node )\n",
+	"        return;\n",
+	"\n",
+	"    if( !stream )\n",
+	"        stream = stderr;\n",
+	"\n",
+	"    while( node )\n",
+	"    {\n",
+	"        for( i = 0; i &lt; rec; i++ )\n",
+	"            fprintf( stream,  \" \" );\n",
+	"\n",
+	"        fprintf( stream, \"%s\", node-&gt;emit );\n",
+	"\n",
+	"        if( node-&gt;token &amp;&amp; strcmp( node-&gt;emit, node-&gt;token ) != 0 )\n",
+	"            fprintf( stream, \" (%s)\", node-&gt;token );\n",
+	"\n",
+	"        fprintf( stream, \"\\n\" );\n",
+	"\n",
+	"        rec++;\n",
+	"        this-&gt;ast_print( stream, node-&gt;child );\n",
+	"        rec--;\n",
+	"\n",
+	"        node = node-&gt;next;\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"bool @@prefix_parser::get_act( void )\n",
+	"{\n",
+	"@@if comb-tables\n",
+	"    int i;\n",
+	"\n",
+	"    if( this-&gt;sym &gt; -1 &amp;&amp; this-&gt;act_check[\n",
+	"            i = this-&gt;act_base[ this-&gt;tos-&gt;state ] + this-&gt;sym ]\n",
+	"                == this-&gt;tos-&gt;state )\n",
+	"    {\n",
+	"        if( ( this-&gt;act = this-&gt;act_next[ i ] &amp; 3 ) == UNICC_ERROR )\n",
+	"            return 0; /* Force parse error! */\n",
+	"\n",
+	"        this-&gt;idx = this-&gt;act_next[ i ] &gt;&gt; 2;\n",
+	"        return true;\n",
+	"    }\n",
+	"@@else\n",
+	"    for( int i = 1; i &lt; this-&gt;actions[ this-&gt;tos-&gt;state ][0] * 3; i += 3 )\n",
+	"    {\n",
+	"        if( this-&gt;actions[ this-&gt;tos-&gt;state ][i] == this-&gt;sym )\n",
+	"        {\n",
+	"            if( ( this-&gt;act = this-&gt;actions[ this-&gt;tos-&gt;state ][i+1] )\n",
+	"                    == UNICC_ERROR )\n",
+	"                return 0; /* Force parse error! */\n",
+	"\n",
+	"            this-&gt;idx = this-&gt;actions[ this-&gt;tos-&gt;state ][i+2];\n",
+	"            return true;\n",
+	"        }\n",
+	"    }\n",
+	"@@endif\n",
+	"\n",
+	"    /* Default production */\n",
+	"    if( ( this-&gt;idx = this-&gt;def_prod[ this-&gt;tos-&gt;state ] ) &gt; -1 )\n",
+	"    {\n",
+	"        this-&gt;act = 1; /* Reduce */\n",
+	"        return true;\n",
+	"    }\n",
+	"\n",
+	"    return false;\n",
+	"}\n",
+	"\n",
+	"bool @@prefix_parser::get_go( void )\n",
+	"{\n",
+	"@@if comb-tables\n",
+	"    int i;\n",
+	"\n",
+	"    if( this-&gt;go_check[ i = this-&gt;go_base[ this-&gt;tos-&gt;state ]\n",
+	"            + UNICC_NONTERM_IDX( this-&gt;lhs ) ] == this-&gt;tos-&gt;state )\n",
+	"    {\n",
+	"        this-&gt;act = this-&gt;go_next[ i ] &amp; 3;\n",
+	"        this-&gt;idx = this-&gt;go_next[ i ] &gt;&gt; 2;\n",
+	"        return true;\n",
+	"    }\n",
+	"@@else\n",
+	"    for( int i = 1; i &lt; this-&gt;go[ this-&gt;tos-&gt;state ][0] * 3; i += 3 )\n",
+	"    {\n",
+	"        if( this-&gt;go[ this-&gt;tos-&gt;state ][i] == this-&gt;lhs )\n",
+	"        {\n",
+	"            this-&gt;act = this-&gt;go[ this-&gt;tos-&gt;state ][ i + 1 ];\n",
+	"            this-&gt;idx = this-&gt;go[ this-&gt;tos-&gt;state ][ i + 2 ];\n",
+	"            return true;\n",
+	"        }\n",
+	"    }\n",
+	"@@endif\n",
+	"\n",
+	"    return false;\n",
+	"}\n",
+	"\n",
+	"bool @@prefix_parser::alloc_stack( void )\n",
+	"{\n",
+	"    if( !this-&gt;stacksize )\n",
+	"    {\n",
+	"        if( !( this-&gt;tos = this-&gt;stack = (@@prefix_tok*)malloc(\n",
+	"                UNICC_MALLOCSTEP * sizeof( @@prefix_tok ) ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( this );\n",
+	"            return false;\n",
+	"        }\n",
+	"\n",
+	"        this-&gt;stacksize = UNICC_MALLOCSTEP;\n",
+	"    }\n",
+	"    else if( ( this-&gt;tos - this-&gt;stack ) == this-&gt;stacksize )\n",
+	"    {\n",
+	"        size_t			size = ( this-&gt;tos - this-&gt;stack );\n",
+	"        @@prefix_tok*	ptr;\n",
+	"\n",
+	"        if( !( ptr = (@@prefix_tok*)realloc( this-&gt;stack,\n",
+	"                ( this-&gt;stacksize + UNICC_MALLOCSTEP )\n",
+	"                    * sizeof( @@prefix_tok ) ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( this );\n",
+	"\n",
+	"            if( this-&gt;stack )\n",
+	"            {\n",
+	"                free( this-&gt;stack );\n",
+	"                this-&gt;tos = this-&gt;stack = NULL;\n",
+	"                this-&gt;stacksize = 0;\n",
+	"            }\n",
+	"\n",
+	"            return false;\n",
+	"        }\n",
+	"\n",
+	"        this-&gt;tos = this-&gt;stack = ptr;\n",
+	"        this-&gt;stacksize += UNICC_MALLOCSTEP;\n",
+	"        this-&gt;tos += size;\n",
+	"    }\n",
+	"\n",
+	"    return true;\n",
+	"}\n",
+	"\n",
+	"UNICC_CHAR @@prefix_parser::get_input( size_t offset )\n",
+	"{\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: get input: this-&gt;buf + offset = %p this-&gt;bufend = %p\\n\",\n",
+	"                UNICC_PARSER, this-&gt;buf + offset, this-&gt;bufend );\n",
+	"#endif\n",
+	"\n",
+	"    while( this-&gt;buf + offset &gt;= this-&gt;bufend )\n",
+	"    {\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"            fprintf( stderr, \"%s: get input: requiring more input\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"        if( !this-&gt;buf )\n",
+	"        {\n",
+	"            this-&gt;bufend = this-&gt;buf = (UNICC_CHAR*)malloc(\n",
+	"                ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );\n",
+	"\n",
+	"            if( !this-&gt;buf )\n",
+	"            {\n",
+	"                UNICC_OUTOFMEM( this );\n",
+	"                return 0;\n",
+	"            }\n",
+	"\n",
+	"            *this-&gt;buf = 0;\n",
+	"        }\n",
+	"        else if( *this-&gt;buf &amp;&amp; !( ( this-&gt;bufend - this-&gt;buf ) %\n",
+	"                    UNICC_MALLOCSTEP ) )\n",
+	"        {\n",
+	"            size_t size	= this-&gt;bufend - this-&gt;buf;\n",
+	"            UNICC_CHAR*	buf;\n",
+	"\n",
+	"            if( !( buf = (UNICC_CHAR*)realloc( this-&gt;buf,\n",
+	"                        ( size + UNICC_MALLOCSTEP + 1 )\n",
+	"                            * sizeof( UNICC_CHAR ) ) ) )\n",
+	"            {\n",
+	"                UNICC_OUTOFMEM( this );\n",
+	"\n",
+	"                free( this-&gt;buf );\n",
+	"                this-&gt;buf = NULL;\n",
+	"\n",
+	"                return 0;\n",
+	"            }\n",
+	"\n",
+	"            this-&gt;buf = buf;\n",
+	"            this-&gt;bufend = this-&gt;buf + size;\n",
+	"        }\n",
+	"\n",
+	"        if( this-&gt;is_eof || ( *( this-&gt;bufend ) = (UNICC_CHAR)UNICC_GETINPUT )\n",
+	"                                    == this-&gt;eof )\n",
+	"        {\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"            fprintf( stderr, \"%s: get input: can't get more input, \"\n",
+	"                        \"end-of-file reached\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"            this-&gt;is_eof = true;\n",
+	"            return this-&gt;eof;\n",
+	"        }\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"        fprintf( stderr, \"%s: get input: read char &gt;%c&lt; %d\\n\",\n",
+	"                    UNICC_PARSER, (char)*( this-&gt;bufend ), *( this-&gt;bufend ) );\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"        fprintf( stderr, \"%s: get input: reading character &gt;%c&lt; %d\\n\",\n",
+	"                    UNICC_PARSER, (char)*( this-&gt;bufend ), *( this-&gt;bufend ) );\n",
+	"#endif\n",
+	"\n",
+	"        *( ++this-&gt;bufend ) = 0;\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    {\n",
+	"        UNICC_CHAR*		chptr;\n",
+	"\n",
+	"        fprintf( stderr, \"%s: get input: offset = %d\\n\",\n",
+	"                    UNICC_PARSER, offset );\n",
+	"        fprintf( stderr, \"%s: get input: buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                    UNICC_PARSER, this-&gt;buf );\n",
+	"        fprintf( stderr, \"%s: get input: returning %d\\n\",\n",
+	"                    UNICC_PARSER, *( this-&gt;buf + offset ) );\n",
+	"    }\n",
+	"#endif\n",
+	"\n",
+	"    return this-&gt;buf[ offset ];\n",
+	"}\n",
+	"\n",
+	"void @@prefix_parser::clear_input( void )\n",
+	"{\n",
+	"    if( this-&gt;buf )\n",
+	"    {\n",
+	"        if( this-&gt;len )\n",
+	"        {\n",
+	"#if UNICC_LINE_INFO\n",
+	"            /* Update counters for line and column */\n",
+	"            for( int i = 0; i &lt; this-&gt;len; i++ )\n",
+	"            {\n",
+	"                if( (char)this-&gt;buf[i] == '\\n' )\n",
+	"                {\n",
+	"                    this-&gt;line++;\n",
+	"                    this-&gt;column = 1;\n",
+	"                }\n",
+	"                else\n",
+	"                    this-&gt;column++;\n",
+	"            }\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG &gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: \"\n",
+	"        \"Clearing %d characters (%d bytes)\\n\",\n",
+	"            UNICC_PARSER, this-&gt;len, this-&gt;len * sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"            UNICC_PARSER, this-&gt;buf, sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: this-&gt;bufend &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"            UNICC_PARSER, this-&gt;bufend );\n",
+	"#endif\n",
+	"\n",
+	"            memmove( this-&gt;buf, this-&gt;buf + this-&gt;len,\n",
+	"                        ( ( this-&gt;bufend - ( this-&gt;buf + this-&gt;len ) ) + 1 + 1 )\n",
+	"                            * sizeof( UNICC_CHAR ) );\n",
+	"            this-&gt;bufend = this-&gt;buf + ( this-&gt;bufend - ( this-&gt;buf + this-&gt;len ) );\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: now buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                UNICC_PARSER, this-&gt;buf, sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: now bufend = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                UNICC_PARSER, this-&gt;bufend, sizeof( UNICC_CHAR ) );\n",
+	"#endif\n",
+	"        }\n",
+	"        else\n",
+	"        {\n",
+	"            this-&gt;bufend = this-&gt;buf;\n",
+	"            *( this-&gt;buf ) = 0;\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    this-&gt;len = 0;\n",
+	"    this-&gt;sym = -1;\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: symbol cleared\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"}\n",
+	"\n",
+	"@@if lexers\n",
+	"void @@prefix_parser::lex( void )\n",
+	"{\n",
+	"    int 		state	= 0;\n",
+	"    size_t		len		= 0;\n",
+	"    int			chr;\n",
+	"    UNICC_CHAR	next;\n",
+	"@@if !mode\n",
+	"    int			machine	= this-&gt;dfa_select[ this-&gt;tos-&gt;state ];\n",
+	"@@else\n",
+	"    int			machine	= 0;\n",
+	"@@endif\n",
+	"\n",
+	"    next = this-&gt;get_input( len );\n",
+	"@@if case-folding\n",
+	"    if( this-&gt;dfa_fold[ machine ] &amp;&amp; next &gt;= 'A' &amp;&amp; next &lt;= 'Z' )\n",
+	"        next += 'a' - 'A';\n",
+	"@@endif\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d\\n\", UNICC_PARSER, next );\n",
+	"#endif\n",
+	"\n",
+	"    if( next == this-&gt;eof )\n",
+	"    {\n",
+	"        this-&gt;sym = @@eof;\n",
+	"        return;\n",
+	"    }\n",
+	"\n",
+	"    do\n",
+	"    {\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d\\n\", UNICC_PARSER, next );\n",
+	"#endif\n",
+	"\n",
+	"        chr = this-&gt;dfa_idx[ machine ][ state ] * 2;\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: chr = %d\\n\", UNICC_PARSER, chr );\n",
+	"#endif\n",
+	"\n",
+	"        state = -1;\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: FIRST next = %d this-&gt;dfa_chars[ chr ] = %d, \"\n",
+	"            \"this-&gt;dfa_chars[ chr+1 ] = %d\\n\", UNICC_PARSER, next,\n",
+	"                this-&gt;dfa_chars[ chr ], this-&gt;dfa_chars[ chr + 1 ] );\n",
+	"#endif\n",
+	"        while( this-&gt;dfa_chars[ chr ] &gt; -1 )\n",
+	"        {\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d this-&gt;dfa_chars[ chr ] = %d, \"\n",
+	"        \"this-&gt;dfa_chars[ chr+1 ] = %d\\n\", UNICC_PARSER, next,\n",
+	"            this-&gt;dfa_chars[ chr ], this-&gt;dfa_chars[ chr + 1 ] );\n",
+	"#endif\n",
+	"            if( next &gt;= this-&gt;dfa_chars[ chr ] &amp;&amp;\n",
+	"                next &lt;= this-&gt;dfa_chars[ chr+1 ] )\n",
+	"            {\n",
+	"                state = *( this-&gt;dfa_trans + ( chr / 2 ) );\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: state = %d\\n\", UNICC_PARSER, state );\n",
+	"#endif\n",
+	"@@if shared-lexers\n",
+	"                /* Only accept terminals which are valid in this state */\n",
+	"                if( this-&gt;dfa_accept[ machine ][ state ] &gt; 0\n",
+	"                    &amp;&amp; ( this-&gt;dfa_mask[ this-&gt;tos-&gt;state ]\n",
+	"                            [ ( this-&gt;dfa_accept[ machine ][ state ] - 1 ) / 8 ]\n",
+	"                        &amp; ( 1 &lt;&lt; ( ( this-&gt;dfa_accept[ machine ][ state ] - 1 )\n",
+	"                                    % 8 ) ) ) )\n",
+	"@@else\n",
+	"                if( this-&gt;dfa_accept[ machine ][ state ] &gt; 0 )\n",
+	"@@endif\n",
+	"                {\n",
+	"                    this-&gt;len = len + 1;\n",
+	"                    this-&gt;sym = this-&gt;dfa_accept[ machine ][ state ] - 1;\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: new accepting symbol this-&gt;sym = %d greedy = %d\\n\",\n",
+	"            UNICC_PARSER, this-&gt;sym, this-&gt;symbols[ this-&gt;sym ].greedy );\n",
+	"#endif\n",
+	"                    if( this-&gt;sym == @@eof )\n",
+	"                    {\n",
+	"                        state = -1; /* test! */\n",
+	"                        break;\n",
+	"                    }\n",
+	"\n",
+	"                    /* Stop if matched symbol should be parsed nongreedy */\n",
+	"                    if( !this-&gt;symbols[ this-&gt;sym ].greedy )\n",
+	"                    {\n",
+	"                        state = -1;\n",
+	"                        break;\n",
+	"                    }\n",
+	"                }\n",
+	"\n",
+	"                next = this-&gt;get_input( ++len );\n",
+	"@@if case-folding\n",
+	"                if( this-&gt;dfa_fold[ machine ]\n",
+	"                        &amp;&amp; next &gt;= 'A' &amp;&amp; next &lt;= 'Z' )\n",
+	"                    next += 'a' - 'A';\n",
+	"@@endif\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"            chr += 2;\n",
+	"        }\n",
+	"    }\n",
+	"    while( state &gt; -1 &amp;&amp; next != this-&gt;eof );\n",
+	"\n",
+	"    if( this-&gt;sym &gt; -1 )\n",
+	"    {\n",
+	"@@if scanner-actions\n",
+	"#if UNICC_SEMANTIC_TERM_SEL\n",
+	"        /*\n",
+	"            Execute scanner actions, if existing, but with\n",
+	"            UNICC_ON_SHIFT = 0, so that no memory allocation\n",
+	"            should be performed. This actions should only be\n",
+	"            handled if there are semantic-code dependent\n",
+	"            terminal symbol selections.\n",
+	"\n",
+	"            tos is incremented here, if the semantic code\n",
+	"            stores data for the symbol. It won't get lost\n",
+	"            in case of a shift.\n",
+	"        */\n",
+	"        this-&gt;alloc_stack();\n",
+	"        this-&gt;tos++;\n",
+	"\n",
+	"        next = this-&gt;buf[ this-&gt;len ];\n",
+	"        this-&gt;buf[ this-&gt;len ] = 0;\n",
+	"\n",
+	"#define UNICC_ON_SHIFT 	0\n",
+	"        switch( this-&gt;sym )\n",
+	"        {\n",
+	"@@scan_actions\n",
+	"\n",
+	"            default:\n",
+	"                break;\n",
+	"        }\n",
+	"#undef UNICC_ON_SHIFT\n",
+	"\n",
+	"        this-&gt;buf[ this-&gt;len ] = next;\n",
+	"\n",
+	"        this-&gt;tos--;\n",
+	"#endif /* UNICC_SEMANTIC_TERM_SEL */\n",
+	"@@endif\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: function exits, this-&gt;sym = %d, this-&gt;len = %d\\n\",\n",
+	"            UNICC_PARSER, this-&gt;sym, this-&gt;len );\n",
+	"#endif\n",
+	"}\n",
+	"@@endif\n",
+	"\n",
+	"bool @@prefix_parser::get_sym( void )\n",
+	"{\n",
+	"    this-&gt;sym = -1;\n",
+	"    this-&gt;len = 0;\n",
+	"\n",
+	"@@if skip-whitespace\n",
+	"    do\n",
+	"    {\n",
+	"@@endif\n",
+	"@@if !mode\n",
+	"\n",
+	"#if UNICC_DEBUG &gt; 2\n",
+	"        fprintf( stderr, \"%s: get sym: state = %d dfa_select = %d\\n\",\n",
+	"                    UNICC_PARSER, this-&gt;tos-&gt;state,\n",
+	"                        @@prefix_dfa_select[ this-&gt;tos-&gt;state ] );\n",
+	"#endif\n",
+	"\n",
+	"        if( this-&gt;dfa_select[ this-&gt;tos-&gt;state ] &gt; -1 )\n",
+	"            this-&gt;lex();\n",
+	"        /*\n",
+	"         * If there is no DFA state machine,\n",
+	"         * try to identify the end-of-file symbol.\n",
+	"         * If this also fails, a parse error will\n",
+	"         * raise.\n",
+	"         */\n",
+	"        else if( this-&gt;get_input( 0 ) == this-&gt;eof )\n",
+	"            this-&gt;sym = @@eof;\n",
+	"@@else\n",
+	"        this-&gt;lex();\n",
+	"@@endif\n",
+	"\n",
+	"@@if skip-whitespace\n",
+	"\n",
+	"        if( this-&gt;sym &gt; -1 &amp;&amp; this-&gt;symbols[ this-&gt;sym ].whitespace )\n",
+	"        {\n",
+	"            UNICC_CLEARIN( this );\n",
+	"            continue;\n",
+	"        }\n",
+	"\n",
+	"        break;\n",
+	"    }\n",
+	"    while( 1 );\n",
+	"@@endif\n",
+	"\n",
+	"    return this-&gt;sym &gt; -1;\n",
+	"}\n",
+	"\n",
+	"#if UNICC_STACKDEBUG\n",
+	"void @@prefix_parser::dbg_stack( FILE* out, @@prefix_tok* stack, @@prefix_tok* tos )\n",
+	"{\n",
+	"    fprintf( out, \"%s: Stack Dump: \", UNICC_PARSER );\n",
+	"\n",
+	"    for( ; stack &lt;= tos; stack++ )\n",
+	"    {\n",
+	"        fprintf( out, \"%d%s%s%s \", stack-&gt;state,\n",
+	"            stack-&gt;symbol \? \" (\" : \"\",\n",
+	"            stack-&gt;symbol \? stack-&gt;symbol-&gt;name : \"\",\n",
+	"            stack-&gt;symbol \? \")\" : \"\" );\n",
+	"    }\n",
+	"\n",
+	"    fprintf( out, \"\\n\" );\n",
+	"}\n",
+	"#endif /* UNICC_STACKDEBUG */\n",
+	"\n",
+	"bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )\n",
+	"{\n",
+	"    if( !this-&gt;error_delay )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: !!!PARSE ERROR!!!\\n\"\n",
+	"                \"%s: error recovery: current token %d (%s)\\n\",\n",
+	"                    UNICC_PARSER, UNICC_PARSER, this-&gt;sym,\n",
+	"                        ( ( this-&gt;sym &gt;= 0 ) \?\n",
+	"                            this-&gt;symbols[ this-&gt;sym ].name :\n",
+	"                                \"(null)\" ) );\n",
+	"\n",
+	"        fprintf( @@prefix_dbg,\n",
+	"                \"%s: error recovery: expecting \", UNICC_PARSER );\n",
+	"\n",
+	"@@if comb-tables\n",
+	"        for( int i = 0; i &lt; @@number-of-terminals; i++ )\n",
+	"        {\n",
+	"            if( this-&gt;act_check[ this-&gt;act_base[ this-&gt;tos-&gt;state ] + i ]\n",
+	"                    == this-&gt;tos-&gt;state )\n",
+	"                fprintf( @@prefix_dbg, \"%d (%s), \",\n",
+	"                    i, this-&gt;symbols[ i ].name );\n",
+	"        }\n",
+	"@@else\n",
+	"        for( int i = 1; i &lt; this-&gt;actions[ this-&gt;tos-&gt;state ][0] * 3; i += 3 )\n",
+	"        {\n",
+	"            fprintf( @@prefix_dbg, \"%d (%s)%s\",\n",
+	"                this-&gt;actions[ this-&gt;tos-&gt;state ][i],\n",
+	"                this-&gt;symbols[ this-&gt;actions[ this-&gt;tos-&gt;state ][i] ].name,\n",
+	"                ( i == this-&gt;actions[ this-&gt;tos-&gt;state ][0] * 3 - 3 ) \?\n",
+	"                        \"\\n\" : \", \" );\n",
+	"        }\n",
+	"@@endif\n",
+	"\n",
+	"        fprintf( @@prefix_dbg, \"\\n%s: error recovery: error_delay is %d, %s\\n\",\n",
+	"                    UNICC_PARSER, this-&gt;error_delay,\n",
+	"                    ( this-&gt;error_delay \? \"error recovery runs silently\" :\n",
+	"                        \"error is reported before its recover!\" ) );\n",
+	"#endif\n",
+	"    }\n",
+	"\n",
+	"@@if !error-token\n",
+	"    /* No error token defined\? Then exit here... */\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg,\n",
+	"        \"%s: error recovery: No error resync token used by grammar, \"\n",
+	"            \"exiting parser.\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"\n",
+	"    UNICC_PARSE_ERROR( this );\n",
+	"    this-&gt;error_count++;\n",
+	"\n",
+	"    return 1;\n",
+	"@@else\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"        \"trying to recover...\\n\", UNICC_PARSER );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"    @@prefix_dbg_stack( @@prefix_dbg, this-&gt;stack, this-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"    /* Remember previous symbol, or discard it */\n",
+	"    if( this-&gt;error_delay != UNICC_ERROR_DELAY )\n",
+	"        this-&gt;old_sym = this-&gt;sym;\n",
+	"    else\n",
+	"    {\n",
+	"        this-&gt;old_sym = -1;\n",
+	"        this-&gt;len = 1;\n",
+	"        UNICC_CLEARIN( this );\n",
+	"    }\n",
+	"\n",
+	"    /* Try to shift on error resync */\n",
+	"    this-&gt;sym = @@error;\n",
+	"\n",
+	"    while( this-&gt;tos &gt;= this-&gt;stack )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: error recovery: in state %d, trying \"\n",
+	"                \"to shift error resync token...\\n\",\n",
+	"                    UNICC_PARSER, this-&gt;tos-&gt;state );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"        this-&gt;dbg_stack( @@prefix_dbg, this-&gt;stack, this-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"        if( this-&gt;get_act() )\n",
+	"        {\n",
+	"            /* Shift */\n",
+	"            if( this-&gt;act &amp; UNICC_SHIFT )\n",
+	"            {\n",
+	"#if UNICC_DEBUG\n",
+	"                fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                            \"error resync shifted\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"                break;\n",
+	"            }\n",
+	"        }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: error recovery: failed, \"\n",
+	"                    \"discarding token '%s'\\n\", UNICC_PARSER,\n",
+	"                        this-&gt;tos-&gt;symbol \?\n",
+	"                            this-&gt;tos-&gt;symbol-&gt;name : \"NULL\" );\n",
+	"#endif\n",
+	"\n",
+	"        /* Discard one token from stack */\n",
+	"        /* TODO: Discarded token memory (semantic action) */\n",
+	"        this-&gt;tos--;\n",
+	"    }\n",
+	"\n",
+	"    if( this-&gt;tos &lt;= this-&gt;stack )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"Can't recover this issue, stack is empty.\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"        UNICC_PARSE_ERROR( this );\n",
+	"        this-&gt;error_count++;\n",
+	"\n",
+	"        return true;\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"trying to continue with modified parser state\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"\n",
+	"    this-&gt;error_delay = UNICC_ERROR_DELAY + 1;\n",
+	"\n",
+	"    return false;\n",
+	"\n",
+	"@@endif\n",
+	"}\n",
+	"\n",
+	"@@goal-type @@prefix_parser::parse( void )\n",
+	"{\n",
+	"    @@goal-type			ret;\n",
+	"@@if ast-construction\n",
+	"    @@prefix_ast*		node;\n",
+	"    @@prefix_ast*		lnode;\n",
+	"@@endif\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    @@prefix_vtype*		vptr;\n",
+	"    FILE* 				@@prefix_dbg = stderr;\n",
+	"#endif\n",
+	"\n",
+	"    // Initialize parser\n",
+	"    this-&gt;stacksize = 0;\n",
+	"    if( !this-&gt;alloc_stack() )\n",
+	"        return (@@goal-type)NULL;\n",
+	"\n",
+	"    memset( this-&gt;tos, 0, sizeof( @@prefix_tok ) );\n",
+	"\n",
+	"    this-&gt;act = UNICC_SHIFT;\n",
+	"    this-&gt;is_eof = false;\n",
+	"    this-&gt;sym = this-&gt;old_sym = -1;\n",
+	"    this-&gt;line = this-&gt;column = 1;\n",
+	"\n",
+	"    memset( &amp;this-&gt;test, 0, sizeof( @@prefix_vtype ) );\n",
+	"\n",
+	"    // Begin of main parser loop\n",
+	"    while( true )\n",
+	"    {\n",
+	"        // Reduce\n",
+	"        while( this-&gt;act &amp; UNICC_REDUCE )\n",
+	"        {\n",
+	"#if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: &lt;&lt; \"\n",
+	"                    \"reducing by production %d (%s)\\n\",\n",
+	"                        UNICC_PARSER, this-&gt;idx,\n",
+	"                            this-&gt;productions[ this-&gt;idx ].definition );\n",
+	"#endif\n",
+	"            // Set default left-hand side\n",
+	"            this-&gt;lhs = this-&gt;productions[ this-&gt;idx ].lhs;\n",
+	"\n",
+	"            // Run reduction code\n",
+	"            memset( &amp;( this-&gt;ret ), 0, sizeof( @@prefix_vtype ) );\n",
+	"\n",
+	"            this-&gt;reduce();\n",
+	"\n",
+	"@@if ast-construction\n",
+	"            // Drop right-hand side, collect AST nodes\n",
+	"            node = NULL;\n",
+	"\n",
+	"            for( int i = 0; i &lt; this-&gt;productions[ this-&gt;idx ].length; i++ )\n",
+	"            {\n",
+	"                if( this-&gt;tos-&gt;node )\n",
+	"                {\n",
+	"                    if( node )\n",
+	"                    {\n",
+	"                        while( node-&gt;prev )\n",
+	"                            node = node-&gt;prev;\n",
+	"\n",
+	"                        node-&gt;prev = this-&gt;tos-&gt;node;\n",
+	"                        this-&gt;tos-&gt;node-&gt;next = node;\n",
+	"                    }\n",
+	"\n",
+	"                    node = this-&gt;tos-&gt;node;\n",
+	"                    this-&gt;tos-&gt;node = NULL;\n",
+	"                }\n",
+	"\n",
+	"                this-&gt;tos--;\n",
+	"            }\n",
+	"\n",
+	"            // Chain collected AST nodes\n",
+	"            if( node )\n",
+	"            {\n",
+	"                if( lnode = this-&gt;tos-&gt;node )\n",
+	"                {\n",
+	"                    while( lnode-&gt;next )\n",
+	"                        lnode = lnode-&gt;next;\n",
+	"\n",
+	"                    lnode-&gt;next = node;\n",
+	"                    node-&gt;prev = lnode;\n",
+	"                }\n",
+	"                else\n",
+	"                    this-&gt;tos-&gt;node = node;\n",
+	"            }\n",
+	"\n",
+	"            // Generate AST node\?\n",
+	"            if( *this-&gt;productions[ this-&gt;idx ].emit )\n",
+	"            {\n",
+	"                if( ( node = this-&gt;ast_create(\n",
+	"                                this-&gt;productions[ this-&gt;idx ].emit, NULL ) ) )\n",
+	"                {\n",
+	"                    node-&gt;child = this-&gt;tos-&gt;node;\n",
+	"                    this-&gt;tos-&gt;node = node;\n",
+	"                }\n",
+	"            }\n",
+	"@@else\n",
+	"            // Drop right-hand side; There is no AST construction\n",
+	"            this-&gt;tos -= this-&gt;productions[ this-&gt;idx ].length;\n",
+	"@@endif\n",
+	"\n",
+	"            // Enforced error in semantic actions\?\n",
+	"            if( this-&gt;act == UNICC_ERROR )\n",
+	"                break;\n",
+	"\n",
+	"            // Goal symbol reduced, and stack is empty\?\n",
+	"            if( this-&gt;lhs == @@goal &amp;&amp; this-&gt;tos == this-&gt;stack )\n",
+	"            {\n",
+	"                memcpy( &amp;( this-&gt;tos-&gt;value ), &amp;( this-&gt;ret ),\n",
+	"                            sizeof( @@prefix_vtype ) );\n",
+	"                this-&gt;ast = this-&gt;tos-&gt;node;\n",
+	"\n",
+	"                UNICC_CLEARIN( this );\n",
+	"\n",
+	"                this-&gt;act = UNICC_SUCCESS;\n",
+	"\n",
+	"                #if UNICC_DEBUG\n",
+	"                fprintf( stderr, \"%s: goal symbol reduced, exiting parser\\n\",\n",
+	"                        UNICC_PARSER );\n",
+	"                #endif\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: after reduction, \"\n",
+	"                        \"shifting nonterminal %d (%s)\\n\",\n",
+	"                            UNICC_PARSER, this-&gt;lhs,\n",
+	"                                this-&gt;symbols[ this-&gt;lhs ].name );\n",
+	"            #endif\n",
+	"\n",
+	"            this-&gt;get_go();\n",
+	"\n",
+	"            this-&gt;tos++;\n",
+	"            this-&gt;tos-&gt;node = NULL;\n",
+	"\n",
+	"            memcpy( &amp;( this-&gt;tos-&gt;value ), &amp;( this-&gt;ret ),\n",
+	"                        sizeof( @@prefix_vtype ) );\n",
+	"            this-&gt;tos-&gt;symbol = &amp;( this-&gt;symbols[ this-&gt;lhs ] );\n",
+	"            this-&gt;tos-&gt;state = ( this-&gt;act &amp; UNICC_REDUCE ) \? -1 : this-&gt;idx;\n",
+	"#if UNICC_LINE_INFO\n",
+	"            this-&gt;tos-&gt;line = this-&gt;line;\n",
+	"            this-&gt;tos-&gt;column = this-&gt;column;\n",
+	"#endif\n",
+	"        }\n",
+	"\n",
+	"        if( this-&gt;act == UNICC_SUCCESS || this-&gt;act == UNICC_ERROR )\n",
+	"            break;\n",
+	"\n",
+	"@@if error-token\n",
+	"        /* If in error recovery, replace old-symbol */\n",
+	"        if( this-&gt;error_delay == UNICC_ERROR_DELAY\n",
+	"                &amp;&amp; ( this-&gt;sym = this-&gt;old_sym ) &lt; 0 )\n",
+	"        {\n",
+	"            /* If symbol is invalid, try to find new token */\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"old token invalid, requesting new token\\n\",\n",
+	"                        UNICC_PARSER );\n",
+	"            #endif\n",
+	"\n",
+	"            while( !this-&gt;get_sym() )\n",
+	"            {\n",
+	"                /* Skip one character */\n",
+	"                this-&gt;len = 1;\n",
+	"\n",
+	"                UNICC_CLEARIN( this );\n",
+	"            }\n",
+	"\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"new token %d (%s)\\n\", UNICC_PARSER, this-&gt;sym,\n",
+	"                    this-&gt;symbols[ this-&gt;sym ].name );\n",
+	"            #endif\n",
+	"        }\n",
+	"        else\n",
+	"            this-&gt;get_sym();\n",
+	"@@else\n",
+	"        this-&gt;get_sym();\n",
+	"@@endif\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: current token %d (%s)\\n\",\n",
+	"                    UNICC_PARSER, this-&gt;sym,\n",
+	"                        ( this-&gt;sym &lt; 0 ) \? \"(null)\" :\n",
+	"                            this-&gt;symbols[ this-&gt;sym ].name );\n",
+	"#endif\n",
+	"\n",
+	"        /* Get action table entry */\n",
+	"        if( !this-&gt;get_act() )\n",
+	"        {\n",
+	"            /* Error state, try to recover */\n",
+	"            if( this-&gt;handle_error(\n",
+	"#if UNICC_DEBUG\n",
+	"                    @@prefix_dbg\n",
+	"#else\n",
+	"                    NULL\n",
+	"#endif\n",
+	"                    ) )\n",
+	"                break;\n",
+	"        }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg,\n",
+	"            \"%s: sym = %d (%s) [len = %d] tos-&gt;state = %d act = %s idx = %d\\n\",\n",
+	"                UNICC_PARSER, this-&gt;sym,\n",
+	"                    ( ( this-&gt;sym &gt;= 0 ) \?\n",
+	"                        this-&gt;symbols[ this-&gt;sym ].name :\n",
+	"                            \"(invalid symbol id)\" ),\n",
+	"                    this-&gt;len, this-&gt;tos-&gt;state,\n",
+	"                        ( ( this-&gt;act == UNICC_SHIFT &amp; UNICC_REDUCE ) \?\n",
+	"                                \"shift/reduce\" :\n",
+	"                            ( this-&gt;act &amp; UNICC_SHIFT ) \?\n",
+	"                                    \"shift\" : \"reduce\" ), this-&gt;idx );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"        this-&gt;dbg_stack( @@prefix_dbg, this-&gt;stack, this-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"        /* Shift */\n",
+	"        if( this-&gt;act &amp; UNICC_SHIFT )\n",
+	"        {\n",
+	"            this-&gt;next = this-&gt;buf[ this-&gt;len ];\n",
+	"            this-&gt;buf[ this-&gt;len ] = '\\0';\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: &gt;&gt; shifting terminal %d (%s)\\n\",\n",
+	"            UNICC_PARSER, this-&gt;sym, this-&gt;symbols[ this-&gt;sym ].name );\n",
+	"#endif\n",
+	"\n",
+	"            if( !this-&gt;alloc_stack() )\n",
+	"                return (@@goal-type)NULL;\n",
+	"\n",
+	"            this-&gt;tos++;\n",
+	"            this-&gt;tos-&gt;node = NULL;\n",
+	"\n",
+	"@@if scanner-actions\n",
+	"            // Execute scanner actions\n",
+	"            this-&gt;scan_shift();\n",
+	"@@else\n",
+	"            @@top-value = this-&gt;get_input( 0 );\n",
+	"@@endif\n",
+	"\n",
+	"            this-&gt;tos-&gt;state = ( this-&gt;act &amp; UNICC_REDUCE ) \? -1 : this-&gt;idx;\n",
+	"            this-&gt;tos-&gt;symbol = &amp;( this-&gt;symbols[ this-&gt;sym ] );\n",
+	"#if UNICC_LINE_INFO\n",
+	"            this-&gt;tos-&gt;line = this-&gt;line;\n",
+	"            this-&gt;tos-&gt;column = this-&gt;column;\n",
+	"#endif\n",
+	"\n",
+	"@@if ast-construction\n",
+	"            if( *this-&gt;tos-&gt;symbol-&gt;emit )\n",
+	"                this-&gt;tos-&gt;node = this-&gt;ast_create(\n",
+	"                                    this-&gt;tos-&gt;symbol-&gt;emit,\n",
+	"                                        this-&gt;get_lexem() );\n",
+	"@@endif\n",
+	"\n",
+	"            this-&gt;buf[ this-&gt;len ] = this-&gt;next;\n",
+	"\n",
+	"            /* Perform the shift on input */\n",
+	"@@if error-token\n",
+	"            if( this-&gt;sym != @@eof &amp;&amp; this-&gt;sym != @@error )\n",
+	"            {\n",
+	"                UNICC_CLEARIN( this );\n",
+	"                this-&gt;old_sym = -1;\n",
+	"            }\n",
+	"\n",
+	"            if( this-&gt;error_delay )\n",
+	"                this-&gt;error_delay--;\n",
+	"@@else\n",
+	"            if( this-&gt;sym != @@eof )\n",
+	"                UNICC_CLEARIN( this );\n",
+	"@@endif\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    #if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: parse completed with %d errors\\n\",\n",
+	"        UNICC_PARSER, this-&gt;error_count );\n",
+	"    #endif\n",
+	"\n",
+	"    // Save return value\n",
+	"    ret = @@goal-value;\n",
+	"\n",
+	"    // Clean up parser control block\n",
+	"    UNICC_CLEARIN( this );\n",
+	"\n",
+	"    free( this-&gt;stack );\n",
+	"    this-&gt;stack = NULL;\n",
+	"\n",
+	"#if UNICC_UTF8\n",
+	"    free( this-&gt;lexem );\n",
+	"    this-&gt;lexem = NULL;\n",
+	"#endif\n",
+	"\n",
+	"    return ret;\n",
+	"}\n",
+	"\n",
+	"@@epilogue\n",
+	"\n",
+	"/* Create Main\? */\n",
+	"#if @@epilogue_len == 0\n",
+	"    #ifndef UNICC_MAIN\n",
+	"    #define UNICC_MAIN 	1\n",
+	"    #endif\n",
+	"#else\n",
+	"    #ifndef UNICC_MAIN\n",
+	"    #define UNICC_MAIN 	0\n",
+	"    #endif\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_MAIN\n",
+	"int main( int argc, char** argv )\n",
+	"{\n",
+	"#define UNICCMAIN_SILENT		1\n",
+	"#define UNICCMAIN_ENDLESS		2\n",
+	"#define UNICCMAIN_LINEMODE		4\n",
+	"#define UNICCMAIN_SYNTAXTREE	8\n",
+	"#define UNICCMAIN_AUGSYNTAXTREE	16\n",
+	"\n",
+	"    char*				opt;\n",
+	"    int					flags	= 0;\n",
+	"    @@prefix_parser*	parser = new @@prefix_parser;\n",
+	"\n",
+	"#ifdef LC_ALL\n",
+	"    setlocale( LC_ALL, \"\" );\n",
+	"#endif\n",
+	"\n",
+	"    /* Get command-line options */\n",
+	"    for( int i = 1; i &lt; argc; i++ )\n",
+	"    {\n",
+	"        if( *(argv[i]) == '-' )\n",
+	"        {\n",
+	"            opt = argv[i] + 1;\n",
+	"\n",
+	"            /* Long option coming\? */\n",
+	"            if( *opt == '-' )\n",
+	"            {\n",
+	"                opt++;\n",
+	"\n",
+	"                if( !strcmp( opt, \"silent\" ) )\n",
+	"                    flags |= UNICCMAIN_SILENT;\n",
+	"                else if( !strcmp( opt, \"endless\" ) )\n",
+	"                    flags |= UNICCMAIN_ENDLESS;\n",
+	"                else if( !strcmp( opt, \"line-mode\" ) )\n",
+	"                    flags |= UNICCMAIN_LINEMODE;\n",
+	"                else\n",
+	"                {\n",
+	"                    fprintf( stderr, \"Unknown option '--%s'\\n\", argv[i] );\n",
+	"                    return 1;\n",
+	"                }\n",
+	"            }\n",
+	"\n",
+	"            for( ; *opt; opt++ )\n",
+	"            {\n",
+	"                if( *opt == 's' )\n",
+	"                    flags |= UNICCMAIN_SILENT;\n",
+	"                else if( *opt == 'e' )\n",
+	"                    flags |= UNICCMAIN_ENDLESS;\n",
+	"                else if( *opt == 'l' )\n",
+	"                    flags |= UNICCMAIN_LINEMODE;\n",
+	"                else\n",
+	"                {\n",
+	"                    fprintf( stderr, \"Unknown option '-%c'\\n\", *opt );\n",
+	"                    return 1;\n",
+	"                }\n",
+	"            }\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    if( flags &amp; UNICCMAIN_LINEMODE )\n",
+	"        parser-&gt;eof = '\\n';\n",
+	"    else\n",
+	"        parser-&gt;eof = EOF;\n",
+	"\n",
+	"    /* Parser invocation loop */\n",
+	"    do\n",
+	"    {\n",
+	"        if( !( flags &amp; UNICCMAIN_SILENT ) )\n",
+	"            printf( \"\\nok\\n\" );\n",
+	"\n",
+	"        parser-&gt;parse();\n",
+	"\n",
+	"        /* Print AST */\n",
+	"        if( parser-&gt;ast )\n",
+	"        {\n",
+	"            parser-&gt;ast_print( stderr, parser-&gt;ast );\n",
+	"            parser-&gt;ast = parser-&gt;ast_free( parser-&gt;ast );\n",
+	"        }\n",
+	"    }\n",
+	"    while( flags &amp; UNICCMAIN_ENDLESS );\n",
+	"\n",
+	"    return 0;\n",
+	"}\n",
+	"#endif\n",
+	"</section>\n",
+	"\n",
+	"    <file filename=\"@@basename.cpp\" split=\"no\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"// Include parser control block definitions\n",
+	"#include \"@@basename.hpp\"\n",
+	"\n",
+	"@@actions-section\n",
+	"@@scanner-section\n",
+	"@@driver-section</file>\n",
+	"<file filename=\"@@basename_actions.cpp\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"// Include parser control block definitions\n",
+	"#include \"@@basename.hpp\"\n",
+	"\n",
+	"@@actions-section</file>\n",
+	"<file filename=\"@@basename_scanner.cpp\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"// Include parser control block definitions\n",
+	"#include \"@@basename.hpp\"\n",
+	"\n",
+	"@@scanner-section</file>\n",
+	"<file filename=\"@@basename_parser.cpp\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"// Include parser control block definitions\n",
+	"#include \"@@basename.hpp\"\n",
+	"\n",
+	"@@driver-section</file>\n",
+	"<file filename=\"@@basename.mk\" split=\"yes\"># Translation units of the parser generated by unicc from @@filename.\n",
+	"# DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"\n",
+	"@@Cbasename_SOURCES = @@basename_actions.cpp @@basename_scanner.cpp \\\n",
+	"    @@basename_parser.cpp\n",
+	"@@Cbasename_HEADERS = @@basename.hpp\n",
+	"@@Cbasename_OBJECTS = $(@@Cbasename_SOURCES:.cpp=.o)\n",
+	"</file>\n",
+	"<file filename=\"@@basename.hpp\">/*\n",
+	"    Parser header generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#ifndef @@CBASENAME_H\n",
+	"#define @@CBASENAME_H\n",
+	"\n",
+	"/* Wide character processing enabled\? */\n",
+	"#ifndef UNICC_WCHAR\n",
+	"#define UNICC_WCHAR					0\n",
+	"#endif\n",
+	"\n",
+	"/* UTF-8 processing enabled\? */\n",
+	"#if !UNICC_WCHAR\n",
+	"#ifndef UNICC_UTF8\n",
+	"#	define UNICC_UTF8				1\n",
+	"#endif\n",
+	"#else\n",
+	"#	ifdef UNICC_UTF8\n",
+	"#	undef UNICC_UTF8\n",
+	"#	endif\n",
+	"#	define UNICC_UTF8				0\n",
+	"#endif\n",
+	"\n",
+	"/* UNICC_CHAR is used as character type for internal processing */\n",
+	"#ifndef UNICC_CHAR\n",
+	"#if UNICC_UTF8 || UNICC_WCHAR\n",
+	"#	define UNICC_CHAR				wchar_t\n",
+	"#	define UNICC_CHAR_FORMAT		\"%S\"\n",
+	"#else\n",
+	"#	define UNICC_CHAR				char\n",
+	"#	define UNICC_CHAR_FORMAT		\"%s\"\n",
+	"#endif\n",
+	"#endif /* UNICC_CHAR */\n",
+	"\n",
+	"/* UNICC_SCHAR defines the character type for semantic action procession */\n",
+	"#ifndef UNICC_SCHAR\n",
+	"#if UNICC_WCHAR\n",
+	"#	define UNICC_SCHAR				wchar_t\n",
+	"#	define UNICC_SCHAR_FORMAT		\"%S\"\n",
+	"#else\n",
+	"#	define UNICC_SCHAR				char\n",
+	"#	define UNICC_SCHAR_FORMAT		\"%s\"\n",
+	"#endif\n",
+	"#endif /* UNICC_SCHAR */\n",
+	"\n",
+	"/* Debug level */\n",
+	"#ifndef UNICC_DEBUG\n",
+	"#define UNICC_DEBUG				0\n",
+	"#endif\n",
+	"\n",
+	"/* Stack debug switch */\n",
+	"#ifndef UNICC_STACKDEBUG\n",
+	"#define UNICC_STACKDEBUG		0\n",
+	"#endif\n",
+	"\n",
+	"/* Line and column counting, if used by the grammar's semantic code */\n",
+	"#ifndef UNICC_LINE_INFO\n",
+	"#define UNICC_LINE_INFO			@@line-info\n",
+	"#endif\n",
+	"\n",
+	"/* Parse error macro; The default one reports line and column if counted */\n",
+	"#ifndef UNICC_PARSE_ERROR\n",
+	"#if UNICC_LINE_INFO\n",
+	"#define UNICC_PARSE_ERROR( parser ) \\\n",
+	"    fprintf( stderr, \"line %d, column %d: syntax error on symbol %d, token '\" \\\n",
+	"        UNICC_SCHAR_FORMAT \"'\\n\", \\\n",
+	"    parser-&gt;line, parser-&gt;column, parser-&gt;sym, parser-&gt;get_lexem() )\n",
+	"#else\n",
+	"#define UNICC_PARSE_ERROR( parser ) \\\n",
+	"    fprintf( stderr, \"syntax error on symbol %d, token '\" \\\n",
+	"        UNICC_SCHAR_FORMAT \"'\\n\", \\\n",
+	"    parser-&gt;sym, parser-&gt;get_lexem() )\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"/* Input buffering clean-up */\n",
+	"#ifndef UNICC_CLEARIN\n",
+	"#define UNICC_CLEARIN( parser )	parser-&gt;clear_input()\n",
+	"#endif\n",
+	"\n",
+	"/*TODO:*/\n",
+	"#ifndef UNICC_NO_INPUT_BUFFER\n",
+	"#define UNICC_NO_INPUT_BUFFER	0\n",
+	"#endif\n",
+	"\n",
+	"/* Memory allocation step size for dynamic stack- and buffer allocation */\n",
+	"#ifndef UNICC_MALLOCSTEP\n",
+	"#define UNICC_MALLOCSTEP		128\n",
+	"#endif\n",
+	"\n",
+	"/* Call this when running out of memory during memory allocation */\n",
+	"#ifndef UNICC_OUTOFMEM\n",
+	"#define UNICC_OUTOFMEM( parser )	fprintf( stderr, \\\n",
+	"                                        \"Fatal error, ran out of memory\\n\" ), \\\n",
+	"                                    exit( 1 )\n",
+	"#endif\n",
+	"\n",
+	"#ifdef UNICC_PARSER\n",
+	"#undef UNICC_PARSER\n",
+	"#endif\n",
+	"#define UNICC_PARSER			\"@@prefix\" \"debug\"\n",
+	"\n",
+	"/* Symbol ID ranges; Terminals are numbered before the nonterminals */\n",
+	"#ifdef UNICC_TERMINALS\n",
+	"#undef UNICC_TERMINALS\n",
+	"#endif\n",
+	"#define UNICC_TERMINALS			@@number-of-terminals\n",
+	"\n",
+	"#ifdef UNICC_NONTERMINALS\n",
+	"#undef UNICC_NONTERMINALS\n",
+	"#endif\n",
+	"#define UNICC_NONTERMINALS		@@number-of-nonterminals\n",
+	"\n",
+	"#ifndef UNICC_NONTERM_IDX\n",
+	"#define UNICC_NONTERM_IDX( sym )	( ( sym ) - UNICC_TERMINALS )\n",
+	"#endif\n",
+	"\n",
+	"/* Don't change next three defines below! */\n",
+	"#ifndef UNICC_ERROR\n",
+	"#define UNICC_ERROR				0\n",
+	"#endif\n",
+	"#ifndef UNICC_REDUCE\n",
+	"#define UNICC_REDUCE			1\n",
+	"#endif\n",
+	"#ifndef UNICC_SHIFT\n",
+	"#define UNICC_SHIFT				2\n",
+	"#endif\n",
+	"#ifndef UNICC_SUCCESS\n",
+	"#define UNICC_SUCCESS			4\n",
+	"#endif\n",
+	"\n",
+	"/* Error delay after recovery */\n",
+	"#ifndef UNICC_ERROR_DELAY\n",
+	"#define UNICC_ERROR_DELAY		3\n",
+	"#endif\n",
+	"\n",
+	"/* Enable/Disable terminal selection in semantic actions */\n",
+	"#ifndef UNICC_SEMANTIC_TERM_SEL\n",
+	"#define UNICC_SEMANTIC_TERM_SEL	0\n",
+	"#endif\n",
+	"\n",
+	"#define UNICC_GETINPUT             getchar()\n",
+	"\n",
+	"/* Value Types */\n",
+	"@@value-type-definition\n",
+	"\n",
+	"/* Typedef for symbol information table */\n",
+	"typedef struct\n",
+	"{\n",
+	"    const char*	name;\n",
+	"    const char*	emit;\n",
+	"    short		type;\n",
+	"    bool		lexem;\n",
+	"    bool		whitespace;\n",
+	"    bool		greedy;\n",
+	"} @@prefix_syminfo;\n",
+	"\n",
+	"/* Typedef for production information table */\n",
+	"typedef struct\n",
+	"{\n",
+	"    const char*	definition;\n",
+	"    const char*	emit;\n",
+	"    int			length;\n",
+	"    int			lhs;\n",
+	"} @@prefix_prodinfo;\n",
+	"\n",
+	"/* Abstract Syntax Tree */\n",
+	"typedef struct @@prefix_AST @@prefix_ast;\n",
+	"\n",
+	"struct @@prefix_AST\n",
+	"{\n",
+	"    const char*		emit;\n",
+	"    UNICC_SCHAR*	token;\n",
+	"\n",
+	"    @@prefix_ast*	parent;\n",
+	"    @@prefix_ast*	child;\n",
+	"    @@prefix_ast*	prev;\n",
+	"    @@prefix_ast*	next;\n",
+	"};\n",
+	"\n",
+	"/* Stack Token */\n",
+	"typedef struct\n",
+	"{\n",
+	"    @@prefix_vtype		value;\n",
+	"    @@prefix_ast*		node;\n",
+	"\n",
+	"    const\n",
+	"    @@prefix_syminfo*	symbol;\n",
+	"\n",
+	"    int					state;\n",
+	"\n",
+	"    size_t				line;\n",
+	"    size_t				column;\n",
+	"} @@prefix_tok;\n",
+	"\n",
+	"// Parser class\n",
+	"class @@prefix_parser\n",
+	"{\n",
+	"    private:\n",
+	"        // --- Tables ---\n",
+	"\n",
+	"        @@if comb-tables\n",
+	"        // Action Table as comb vectors\n",
+	"        const @@action-base-type act_base[ @@number-of-states ] =\n",
+	"        {\n",
+	"            @@action-base\n",
+	"        };\n",
+	"\n",
+	"        const @@action-check-type act_check[ @@action-comb-size ] =\n",
+	"        {\n",
+	"            @@action-check\n",
+	"        };\n",
+	"\n",
+	"        const @@action-next-type act_next[ @@action-comb-size ] =\n",
+	"        {\n",
+	"            @@action-next\n",
+	"        };\n",
+	"\n",
+	"        // GoTo Table as comb vectors\n",
+	"        const @@goto-base-type go_base[ @@number-of-states ] =\n",
+	"        {\n",
+	"            @@goto-base\n",
+	"        };\n",
+	"\n",
+	"        const @@goto-check-type go_check[ @@goto-comb-size ] =\n",
+	"        {\n",
+	"            @@goto-check\n",
+	"        };\n",
+	"\n",
+	"        const @@goto-next-type go_next[ @@goto-comb-size ] =\n",
+	"        {\n",
+	"            @@goto-next\n",
+	"        };\n",
+	"        @@else\n",
+	"        // Action Table\n",
+	"        const @@action-table-type actions[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =\n",
+	"        {\n",
+	"@@action-table\n",
+	"        };\n",
+	"\n",
+	"        // GoTo Table\n",
+	"        const @@goto-table-type go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =\n",
+	"        {\n",
+	"@@goto-table\n",
+	"        };\n",
+	"        @@endif\n",
+	"\n",
+	"        // Default productions per state\n",
+	"        const @@default-productions-type def_prod[ @@number-of-states ] =\n",
+	"        {\n",
+	"            @@default-productions\n",
+	"        };\n",
+	"\n",
+	"        @@if !mode\n",
+	"        // DFA selection table\n",
+	"        const @@dfa-select-type dfa_select[ @@number-of-states ] =\n",
+	"        {\n",
+	"            @@dfa-select\n",
+	"        };\n",
+	"        @@endif\n",
+	"\n",
+	"        @@if lexers\n",
+	"        // DFA index table\n",
+	"        const @@dfa-index-type dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =\n",
+	"        {\n",
+	"@@dfa-index\n",
+	"        };\n",
+	"\n",
+	"        // DFA transition chars\n",
+	"        const @@dfa-char-type dfa_chars[ @@size-of-dfa-characters * 2 ] =\n",
+	"        {\n",
+	"            @@dfa-char\n",
+	"        };\n",
+	"\n",
+	"        // DFA transitions\n",
+	"        const @@dfa-trans-type dfa_trans[ @@size-of-dfa-characters ] =\n",
+	"        {\n",
+	"            @@dfa-trans\n",
+	"        };\n",
+	"\n",
+	"        // DFA acception states\n",
+	"        const @@dfa-accept-type dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =\n",
+	"        {\n",
+	"@@dfa-accept\n",
+	"        };\n",
+	"\n",
+	"        @@if case-folding\n",
+	"        // DFA case-folding flags\n",
+	"        const @@dfa-fold-type dfa_fold[ @@number-of-dfa-machines ] =\n",
+	"        {\n",
+	"            @@dfa-fold\n",
+	"        };\n",
+	"        @@endif\n",
+	"\n",
+	"        @@if shared-lexers\n",
+	"        // Accept masks of the states using a shared DFA\n",
+	"        const @@dfa-mask-type dfa_mask[ @@number-of-states ][ @@dfa-mask-width ] =\n",
+	"        {\n",
+	"@@dfa-mask\n",
+	"        };\n",
+	"        @@endif\n",
+	"\n",
+	"        @@endif\n",
+	"\n",
+	"        // Symbol information table\n",
+	"        const @@prefix_syminfo symbols[ @@number-of-symbols ] =\n",
+	"        {\n",
+	"@@symbols\n",
+	"        };\n",
+	"\n",
+	"        // Production information table\n",
+	"        const @@prefix_prodinfo productions[ @@number-of-productions ] =\n",
+	"        {\n",
+	"@@productions\n",
+	"        };\n",
+	"\n",
+	"        // --- Runtime ---\n",
+	"\n",
+	"        // Stack\n",
+	"        @@prefix_tok*	stack;\n",
+	"        @@prefix_tok*	tos;\n",
+	"\n",
+	"        // Stack size\n",
+	"        size_t			stacksize;\n",
+	"\n",
+	"        // Values\n",
+	"        @@prefix_vtype	ret;\n",
+	"        @@prefix_vtype	test;\n",
+	"\n",
+	"        // State\n",
+	"        int				act;\n",
+	"        int				idx;\n",
+	"        int				lhs;\n",
+	"\n",
+	"        // Lookahead\n",
+	"        int				sym;\n",
+	"        int				old_sym;\n",
+	"        size_t			len;\n",
+	"\n",
+	"        // Input buffering\n",
+	"        UNICC_SCHAR*	lexem;\n",
+	"        UNICC_CHAR*		buf;\n",
+	"        UNICC_CHAR*		bufend;\n",
+	"        UNICC_CHAR*		bufsize;\n",
+	"\n",
+	"        // Lexical analysis\n",
+	"        UNICC_CHAR		next;\n",
+	"        bool			is_eof;\n",
+	"\n",
+	"        // Error handling\n",
+	"        int				error_delay;\n",
+	"        int				error_count;\n",
+	"\n",
+	"        size_t			line;\n",
+	"        size_t			column;\n",
+	"\n",
+	"        // User-defined components\n",
+	"        @@pcb\n",
+	"\n",
+	"        // Functions\n",
+	"\n",
+	"        //fn.clearin.cpp\n",
+	"        void clear_input(void);\n",
+	"\n",
+	"        //fn.debug.cpp\n",
+	"        #if UNICC_STACKDEBUG\n",
+	"        void dbg_stack( FILE* out, @@prefix_tok* stack, @@prefix_tok* tos )\n",
+	"        #endif\n",
+	"\n",
+	"        //fn.getact.cpp\n",
+	"        bool get_act( void );\n",
+	"\n",
+	"        //fn.getgo.cpp\n",
+	"        bool get_go( void );\n",
+	"\n",
+	"        //fn.getinput.cpp\n",
+	"        UNICC_CHAR get_input( size_t offset );\n",
+	"\n",
+	"        //fn.getsym.cpp\n",
+	"        bool get_sym( void );\n",
+	"\n",
+	"        //fn.handleerr.cpp\n",
+	"        bool handle_error( FILE* @@prefix_dbg );\n",
+	"\n",
+	"        //fn.lex.cpp\n",
+	"        @@if lexers\n",
+	"        void lex( void );\n",
+	"        @@endif\n",
+	"\n",
+	"        //fn.reduce.cpp\n",
+	"        void reduce( void );\n",
+	"\n",
+	"        //fn.scan.cpp\n",
+	"        void scan_shift( void );\n",
+	"\n",
+	"        //fn.stack.cpp\n",
+	"        bool alloc_stack( void );\n",
+	"\n",
+	"        //fn.unicode.cpp\n",
+	"        UNICC_SCHAR* get_lexem( void );\n",
+	"\n",
+	"    public:\n",
+	"        // EOF behavior\n",
+	"        UNICC_CHAR			eof;\n",
+	"\n",
+	"        // Abstract syntax tree\n",
+	"        @@prefix_ast*		ast;\n",
+	"\n",
+	"        //fn.parse.cpp\n",
+	"        @@goal-type parse( void );\n",
+	"\n",
+	"        //fn.ast.cpp\n",
+	"        @@prefix_ast* ast_free( @@prefix_ast* node );\n",
+	"        @@prefix_ast* ast_create( const char* emit, UNICC_SCHAR* token );\n",
+	"        void ast_print( FILE* stream, @@prefix_ast* node );\n",
+	"};\n",
+	"\n",
+	"#endif /* @@CBASENAME_H */\n",
+	"</file>\n",
+	"</generator>\n",
+	(char*)NULL
+};
+
+static char*	stock_target_1[] =
+{
+	"<\?xml version=\"1.0\" standalone=\"yes\"\?>\n",
+	"<!--\n",
+	"This template should serve as a general description and reference of how\n",
+	"templates for the UniCC parser generator's static build-in code generator\n",
+	"may be described.\n",
+	"\n",
+	"It should be possible to abstract this template and given expansion macros\n",
+	"to several other programming languages, not only C-like ones.\n",
+	"\n",
+	"In this template, there are many expansion macros used. Expansion macros begin\n",
+	"with \"@@\" and a followed identifier. These macros are expaned in several stages,\n",
+	"some macros represent values that directly come from the code generator, other\n",
+	"macros define code-parts that had already been constructed by subsequent\n",
+	"construction stages and are inserted in particular positions. All macros are\n",
+	"pre-defined by the UniCC program module generator, is is not possible to build\n",
+	"own expansion macros or deviating construction logics due the statical structure\n",
+	"of the UniCC program module generator.\n",
+	"\n",
+	"The expansion macro @@prefix holds the prefix which is possibly defined for a\n",
+	"grammar.\n",
+	"\n",
+	"No XML-tag is 'really' required. UniCC will drop a warning when it misses a tag,\n",
+	"but continues code generation with the tags it finds.\n",
+	"\n",
+	"Some of the following comments begin with 1D TABLE or 2D TABLE. A 1D TABLE\n",
+	"expands into an one-dimensional array, a 2D TABLE into a two-dimensional array;\n",
+	"To obtain the sizes for both dimensions, there are expanding macros both in the\n",
+	"<file>-tag and related to every table.\n",
+	"\n",
+	"1D Tables always consist of a <col> and a <col_sep> tag.\n",
+	"2D Tables always consist of a <row_start>, <row_end>, <row_sep>, <col> and a\n",
+	"<col_sep> tag. <row_sep> and <col_sep> define separators that will be inserted\n",
+	"between the rows/columns, except the last row/column.\n",
+	"-->\n",
+	"\n",
+	"<generator name=\"C\">\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Boolean values\n",
+	"    ****************************************************************************\n",
+	"    Values for booleans.\n",
+	"    -->\n",
+	"    <true>1</true>\n",
+	"    <false>0</false>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Table value types\n",
+	"    ****************************************************************************\n",
+	"    Integer types for the tables, with the range of values they can hold.\n",
+	"    For every table, the first type covering all of its values is used by the\n",
+	"    @@<table>-type placeholders, so they are listed from the narrowest to the\n",
+	"    widest type.\n",
+	"    -->\n",
+	"    <int_type min=\"0\" max=\"255\">unsigned char</int_type>\n",
+	"    <int_type min=\"-128\" max=\"127\">signed char</int_type>\n",
+	"    <int_type min=\"0\" max=\"65535\">unsigned short</int_type>\n",
+	"    <int_type min=\"-32768\" max=\"32767\">short</int_type>\n",
+	"    <int_type min=\"-2147483647\" max=\"2147483647\">int</int_type>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Escape sequences\n",
+	"    ****************************************************************************\n",
+	"    These are the escapable sequence definitions for the target language\n",
+	"    which should be replaced when terminal-/nonterminal (especially generated\n",
+	"    ones) names are generated into the target file, e.g. in the <symbols>-tag.\n",
+	"    -->\n",
+	"\n",
+	"    <!-- Backslash must be double-quoted -->\n",
+	"    <escape-sequence for=\"\\\" do=\"\\\\\" />\n",
+	"    <!-- Escape double quotation marks -->\n",
+	"    <escape-sequence for=\"&#x22;\" do=\"\\&#x22;\" />\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Value-stack templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- Default (return) value type for nonterminals -->\n",
+	"    <vstack_def_type>int</vstack_def_type>\n",
+	"    <!-- Default value type for character-class terminals -->\n",
+	"    <vstack_term_type>int</vstack_term_type>\n",
+	"\n",
+	"    <!--\n",
+	"    Code to be generated for the value stack datatype-definition\n",
+	"    when only one datatype is used within the whole grammar (or if\n",
+	"    always the default-type is used).\n",
+	"\n",
+	"    Placeholders:	@@value-type			- 	Expands to the type-declaration\n",
+	"                                                of the only used value type.\n",
+	"    -->\n",
+	"    <vstack_single>typedef @@value-type @@prefix_vtype;</vstack_single>\n",
+	"\n",
+	"    <!--\n",
+	"    Begin and end of code to be generated for the value stack\n",
+	"    datatype-definition when multiple datatypes are used within the\n",
+	"    whole grammar.  Note that you can define here even struct-like\n",
+	"    code or array-like structure if your target language supports\n",
+	"    only those.\n",
+	"\n",
+	"    Placeholders:	@@number-of-value-types	-	Expands to the maximum number\n",
+	"                                                of value types possible here.\n",
+	"                                                Can be used in both of the\n",
+	"                                                following tags.\n",
+	"    -->\n",
+	"    <vstack_union_start>typedef union @@prefix_VTYPE&#x0A;{&#x0A;</vstack_union_start>\n",
+	"    <vstack_union_end>} @@prefix_vtype;&#x0A;&#x0A;</vstack_union_end>\n",
+	"\n",
+	"    <!--\n",
+	"    This tag defines a data type definition within the union.\n",
+	"    As @@attribute, the content of the <vstack_union_att>-tag is expanded,\n",
+	"    which then contains a consecutive number of the datatype.\n",
+	"    This block is repeated for every value type within the union/whatever ;)\n",
+	"\n",
+	"    Placeholders:	@@value-type			- 	Expands to the type-declaration\n",
+	"                                                of the current data type as\n",
+	"                                                specified within the grammar.\n",
+	"                    @@attribute				-	As @@attribute, the content\n",
+	"                                                of the <vstack_union_att>-tag\n",
+	"                                                is expanded, which then\n",
+	"                                                contains a consecutive number\n",
+	"                                                of the datatype.\n",
+	"                    @@value-type-id			-	The value type ID, which begins\n",
+	"                                                at 0. This can be the index of\n",
+	"                                                an array!\n",
+	"    -->\n",
+	"    <vstack_union_def>    @@value-type @@attribute;&#x0A;</vstack_union_def>\n",
+	"\n",
+	"    <!--\n",
+	"    This tag defines is used in several code-generation parts, both when\n",
+	"    the value stack union is defined and when reduction code for productions\n",
+	"    is produced.\n",
+	"\n",
+	"    Placeholders:	@@value-type-id			-	The value type ID, which\n",
+	"                                                begins at 0.\n",
+	"                                                This can be the index of\n",
+	"                                                an array!\n",
+	"    -->\n",
+	"    <vstack_union_att>value_@@value-type-id</vstack_union_att>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!--\n",
+	"    Begin and end of code to be generated for each reduction code action of a\n",
+	"    production. This code is embedded to a switch-structure below, every block\n",
+	"    is a \"case\" within this switch. <action_start> is generated BEFORE and\n",
+	"    <action_end> BEHIND each reduction code.\n",
+	"\n",
+	"    Placeholders:	@@production-number		-	The number of the production to\n",
+	"                                                be reduced. Can be used in both\n",
+	"                                                of the following tags.\n",
+	"    -->\n",
+	"    <action_start>            case @@production-number:&#x0A;                    {&#x0A;                    </action_start>\n",
+	"    <action_end>    ;&#x0A;                    }&#x0A;                    break;\n",
+	"    </action_end>\n",
+	"\n",
+	"    <!--\n",
+	"    Single value access when only one datatype is used in the whole grammar.\n",
+	"\n",
+	"    Placeholders:	@@offset				-	The number of the right-hand\n",
+	"                                                side symbol to be accessed.\n",
+	"                                                This is the number specified in\n",
+	"                                                the production reduction code\n",
+	"                                                as number or even by the\n",
+	"                                                right-hand side element's\n",
+	"                                                identifier. The offset is\n",
+	"                                                inserted here by UniCC's\n",
+	"                                                code generator.\n",
+	"    -->\n",
+	"    <action_single>( ( pcb->tos - @@offset )->value )</action_single>\n",
+	"\n",
+	"    <!--\n",
+	"    Multiple value access, in case of different datatypes used within the\n",
+	"    grammar.\n",
+	"\n",
+	"    Placeholders:	@@offset				-	The number of the right-hand\n",
+	"                                                side symbol to be accessed.\n",
+	"                                                This is the number specified in\n",
+	"                                                the production reduction code\n",
+	"                                                as number or even by the\n",
+	"                                                right-hand side element's\n",
+	"                                                identifier. The offset is\n",
+	"                                                inserted here by UniCC's\n",
+	"                                                code generator.\n",
+	"                    @@attribute				-	As @@attribute, the content of\n",
+	"                                                the <vstack_union_att>-tag is\n",
+	"                                                expanded, which then contains\n",
+	"                                                a consecutive number of the\n",
+	"                                                datatype.\n",
+	"    -->\n",
+	"    <action_union>( ( pcb->tos - @@offset )->value.@@attribute )</action_union>\n",
+	"\n",
+	"    <!--\n",
+	"    Single value left-hand side assignment variable when only one datatype\n",
+	"    is used in the whole grammar.\n",
+	"\n",
+	"    Placeholders:	none\n",
+	"    -->\n",
+	"    <action_lhs_single>pcb->ret</action_lhs_single>\n",
+	"\n",
+	"    <!--\n",
+	"    Multiple value left-hand side assignment variable when different\n",
+	"    datatypes are used within the whole grammar.\n",
+	"\n",
+	"    Placeholders:	@@attribute				-	As @@attribute, the content of\n",
+	"                                                the <vstack_union_att>-tag is\n",
+	"                                                expanded, which then contains\n",
+	"                                                a consecutive number of the\n",
+	"                                                datatype.\n",
+	"    -->\n",
+	"    <action_lhs_union>pcb->ret.@@attribute</action_lhs_union>\n",
+	"\n",
+	"    <!--\n",
+	"    This template will be triggered when a semantic action selects a\n",
+	"    left-hand side. By default, the primary left-hand side will be replaced\n",
+	"    by the production after reduction. This can be changed by using the\n",
+	"    @$<name>-placeholders in semantic actions.\n",
+	"\n",
+	"    Only defined left-hand sides for the production can be associated.\n",
+	"\n",
+	"    Placeholders:	@@sym					-	Will be replaced by the\n",
+	"                                                symbol-id of the specified\n",
+	"                                                left-hand side symbol.\n",
+	"    -->\n",
+	"    <action_set_lhs>( pcb->lhs = @@sym )</action_set_lhs>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic terminal action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!--\n",
+	"    Begin and end of code to be generated for each match of a regular\n",
+	"    expression token. This code is embedded to a switch-structure below,\n",
+	"    every block is a \"case\" within this switch. <scan_action_start> is\n",
+	"    generated BEFORE and <scan_action_end> BEHIND each reduction code.\n",
+	"\n",
+	"    The code here is only produced when the matched regex-terminal contains\n",
+	"    individual code segments.\n",
+	"\n",
+	"    Placeholders:	@@symbol-number			-	The id of the terminal the\n",
+	"                                                lexical analyzer action belongs\n",
+	"                                                to. Can be used in both of the\n",
+	"                                                following tags.\n",
+	"    -->\n",
+	"\n",
+	"    <scan_action_start>                case @@symbol-number:&#x0A;                {&#x0A;                    </scan_action_start>\n",
+	"    <scan_action_end>    ;&#x0A;                }&#x0A;                    break;\n",
+	"    </scan_action_end>\n",
+	"\n",
+	"    <!--\n",
+	"    The content of the tags <scan_action_begin_offset> and\n",
+	"    <scan_action_end_offset> are inserted in regex-terminal semantic code\n",
+	"    blocks for the placeholders @> and @< to get the start-address and\n",
+	"    length of the matched string. Normally, these are variable names.\n",
+	"\n",
+	"    Placeholders:	none\n",
+	"    -->\n",
+	"    <scan_action_begin_offset>@@prefix_lexem( pcb )</scan_action_begin_offset>\n",
+	"    <scan_action_end_offset>pcb->len</scan_action_end_offset>\n",
+	"\n",
+	"    <!--\n",
+	"    When @@ is used in regex-terminal semantic code blocks, a variable that\n",
+	"    receives the semantic value of the token to be pushed to the value stack\n",
+	"    must be given. For single value assignments,this is done here.\n",
+	"    This value is only used when the grammar uses only one datatype.\n",
+	"\n",
+	"    Placeholders:		none\n",
+	"    -->\n",
+	"    <scan_action_ret_single>pcb->tos->value</scan_action_ret_single>\n",
+	"\n",
+	"    <!--\n",
+	"    Same play for multiple value assignments in regex-terminal semantic action blocks.\n",
+	"\n",
+	"    Placeholders:	@@attribute				-	As @@attribute, the content of\n",
+	"                                                the <vstack_union_att>-tag is\n",
+	"                                                expanded, which then contains\n",
+	"                                                a consecutive number of the\n",
+	"                                                datatype.\n",
+	"    -->\n",
+	"    <scan_action_ret_union>( pcb->tos->value.@@attribute )</scan_action_ret_union>\n",
+	"\n",
+	"    <!--\n",
+	"    This template is used when there is a semantic action-based\n",
+	"    regular expression terminal decision. This is equivalent to the\n",
+	"    selection of left-hand side in semantic production actions above.\n",
+	"\n",
+	"    Placeholders:	@@sym				-		The symbol-id of the requested\n",
+	"                                                terminal symbol will be inserted\n",
+	"                                                here.\n",
+	"    -->\n",
+	"    <scan_action_set_symbol>( pcb->sym = @@sym )</scan_action_set_symbol>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Parse table templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <defprod>-tag defines an one-dimensional array for the id's of\n",
+	"    the default productions that should be reduced when no other action\n",
+	"    is selected. UniCC choses the default production by the most common\n",
+	"    reduction that comes up. All reductions which belong to that production\n",
+	"    are removed from the action table, so that the default table is chosen.\n",
+	"    The following Placeholders can only be used in the <col>-tag below\n",
+	"    <defprod>.\n",
+	"\n",
+	"    Placeholders:	@@state-number			-	The id-number of the state\n",
+	"                                                where the default production\n",
+	"                                                belongs to.\n",
+	"                    @@production-number		-	The production id number\n",
+	"                                                indexing the production.\n",
+	"                                                This can be automatically\n",
+	"                                                solved via the array index\n",
+	"                                                itself. The production\n",
+	"                                                numbers begins at 0.\n",
+	"                                                If there is no adequate\n",
+	"                                                default-production, the\n",
+	"                                                production-number will be\n",
+	"                                                -1.\n",
+	"    -->\n",
+	"    <defprod>\n",
+	"        <col>    @@production-number</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </defprod>\n",
+	"\n",
+	"    <!-- 2D TABLE\n",
+	"    The <acttab>-tag expands to the parser action table. The action table\n",
+	"    describes the parser actions for every state and lookahead-symbol\n",
+	"    combination (resp. state-terminal combination).\n",
+	"\n",
+	"    Placeholders:	@@number-of-columns		-	Total number of columns\n",
+	"                                                for every entry. Can only\n",
+	"                                                be used in <row_start> and\n",
+	"                                                <row_end>.\n",
+	"                    @@row					-	The row index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <row_start> and <row_end>.\n",
+	"                    @@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@symbol				-	Lookahead-symbol ID for\n",
+	"                                                each entry column, can only\n",
+	"                                                be used in <col>.\n",
+	"                    @@action				-	The action for each entry\n",
+	"                                                column, can only be used in\n",
+	"                                                <col>. This expands to\n",
+	"                                                1 for reduce,\n",
+	"                                                2 for shift and\n",
+	"                                                3 for shift&reduce.\n",
+	"                    @@index					-	The number of the next state\n",
+	"                                                in case of a shift, or the\n",
+	"                                                number of the reduction\n",
+	"                                                action in case of a reduce\n",
+	"                                                or shift&reduce action.\n",
+	"    -->\n",
+	"    <acttab>\n",
+	"        <row_start>    {&#x0A;        @@number-of-columns</row_start>\n",
+	"        <row_end>&#x0A;    }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>,&#x0A;        @@symbol, @@action, @@index</col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </acttab>\n",
+	"\n",
+	"    <!-- 2D TABLE\n",
+	"    The <gotab>-tag expands to the parser goto table. The goto table\n",
+	"    describes the parser actions to be performed on a state and\n",
+	"    nonterminal-symbol combination right after a reduction.\n",
+	"\n",
+	"    Placeholders:	@@number-of-columns		-	Total number of columns\n",
+	"                                                for every entry. Can only\n",
+	"                                                be used in <row_start> and\n",
+	"                                                <row_end>.\n",
+	"                    @@row					-	The row index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <row_start> and <row_end>.\n",
+	"                    @@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@symbol				-	Nonterminal-symbol ID for\n",
+	"                                                each entry column, can only\n",
+	"                                                be used in <col>.\n",
+	"                    @@action				-	The action for each entry\n",
+	"                                                column, can only be used in\n",
+	"                                                <col>. This expands to\n",
+	"                                                2 for shift and\n",
+	"                                                3 for shift&reduce.\n",
+	"\n",
+	"                                                A reduce-only will never be\n",
+	"                                                the case.\n",
+	"                    @@index					-	The number of the next state.\n",
+	"    -->\n",
+	"    <gotab>\n",
+	"        <row_start>    {&#x0A;        @@number-of-columns</row_start>\n",
+	"        <row_end>&#x0A;    }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>,&#x0A;        @@symbol, @@action, @@index</col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </gotab>\n",
+	"\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Lexical analyzer table templates\n",
+	"    ****************************************************************************\n",
+	"    UniCC constructs one single lexical analyzer in insensitive mode, and\n",
+	"    several lexical analyzers in sensitive mode, that must be selected for every\n",
+	"    LALR-state.\n",
+	"\n",
+	"    Several states may use the same lexical analyzer, so there is a table to\n",
+	"    select the lexical analyzer from, relating to every LALR-state.\n",
+	"    A lexical analyzer is a deterministic finite-state machine (DFA) that is\n",
+	"    pre-calculated by UniCC and used to identify tokens from the input,\n",
+	"    according to context-valid possibilities (sensitive mode) or globally\n",
+	"    (insensitive mode).\n",
+	"    -->\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <dfa_select>-tag expands to a table that hold the index of the lexical\n",
+	"    analyzer for every LALR-state.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@machine				-	Expand to the index of the state\n",
+	"                                                machine for the LALR-state.\n",
+	"                                                Index begins at 0.\n",
+	"    -->\n",
+	"    <dfa_select>\n",
+	"        <col>        @@machine</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_select>\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <dfa_char>-tag expands to a table that hold all the characters for all\n",
+	"    states, where a character-range with @@from = -1 and @@to = -1 defines the\n",
+	"    end of a state character range definition.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@from					-	Character-code from\n",
+	"                    @@to					-	Character-code to\n",
+	"    -->\n",
+	"    <dfa_char>\n",
+	"        <col>        @@from, @@to</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_char>\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <dfa_trans>-tag expands to a table that hold all the transitions\n",
+	"    to the next DFA state if a character range from <dfa_char> matches.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@goto					-	Next state to go to.\n",
+	"    -->\n",
+	"    <dfa_trans>\n",
+	"        <col>        @@goto</col>\n",
+	"        <col_sep>,&#x0A; </col_sep>\n",
+	"    </dfa_trans>\n",
+	"\n",
+	"\n",
+	"    <!-- 2D TABLE\n",
+	"    The <dfa_idx>-tag expands to a table that hold for every lexical analyzer\n",
+	"    DFA a table with the offsets of the character-ranges in table <dfa_char>.\n",
+	"\n",
+	"    Placeholders:	@@row					-	The row index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <row_start> and <row_end>.\n",
+	"                    @@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@index					-	Beginning offset of the state\n",
+	"                                                in character-ranges; It must\n",
+	"                                                be multiplied by 2 to get the\n",
+	"                                                index in <dfa_char>.\n",
+	"                    @@number-of-columns		-	Number of DFA states for the\n",
+	"                                                given DFA state machine.\n",
+	"    -->\n",
+	"    <dfa_idx>\n",
+	"        <row_start>    {&#x0A;</row_start>\n",
+	"        <row_end>&#x0A;    }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>        @@index</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_idx>\n",
+	"\n",
+	"    <!-- 2D TABLE\n",
+	"    The <dfa_accept>-tag expands to a table that hold accepting symbol\n",
+	"    identifier tables for every DFA state.\n",
+	"\n",
+	"    Placeholders:	@@row					-	The row index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <row_start> and <row_end>.\n",
+	"                    @@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@accept				-	Accepting ID of the terminal\n",
+	"                                                symbol that is probably\n",
+	"                                                matched until this state by\n",
+	"                                                the lexical analyzer.\n",
+	"                    @@number-of-columns		-	Number of DFA states for the\n",
+	"                                                given DFA state machine.\n",
+	"    -->\n",
+	"    <dfa_accept>\n",
+	"        <row_start>    {&#x0A;</row_start>\n",
+	"        <row_end>&#x0A;    }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>        @@accept</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_accept>\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <dfa_fold>-tag expands to a table that holds for every lexical analyzer\n",
+	"    if it runs on case-folded input, where upper-case letters are mapped into\n",
+	"    lower-case letters before the transitions are looked up.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@fold					-	1 if the DFA runs on\n",
+	"                                                case-folded input, else 0.\n",
+	"    -->\n",
+	"    <dfa_fold>\n",
+	"        <col>        @@fold</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_fold>\n",
+	"\n",
+	"    <!-- 2D TABLE\n",
+	"    The <dfa_mask>-tag expands to a table that holds for every parser state a\n",
+	"    bitmask of the terminal symbols that may be accepted from its lexical\n",
+	"    analyzer. It is only generated with shared lexers, where the DFA of a state\n",
+	"    may also accept terminals that are not valid in this state.\n",
+	"\n",
+	"    Placeholders:	@@state-number			-	The state index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <row_start> and <row_end>.\n",
+	"                    @@mask					-	Eight bits of the mask; the\n",
+	"                                                bit of symbol n is bit n % 8\n",
+	"                                                in column n / 8.\n",
+	"                    @@number-of-columns		-	Number of columns of the mask.\n",
+	"    -->\n",
+	"    <dfa_mask>\n",
+	"        <row_start>    {&#x0A;</row_start>\n",
+	"        <row_end>&#x0A;    }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>        @@mask</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_mask>\n",
+	"\n",
+	"    <!--\n",
+	"    The <blob>-tag defines how the tables are emitted when packed tables are\n",
+	"    requested (-p). Every table is then packed into one flat blob of signed,\n",
+	"    little-endian values of the narrowest width fitting all its values, which\n",
+	"    is much cheaper to compile than the nested initializer lists above.\n",
+	"\n",
+	"    Placeholders:	@@byte					-	Decimal value of one byte.\n",
+	"                    @@octal					-	Three-digit octal value of\n",
+	"                                                one byte.\n",
+	"                    @@hex					-	Two-digit hexadecimal value\n",
+	"                                                of one byte.\n",
+	"\n",
+	"    <byte> is the representation of one byte inside the blob, <line_sep> is\n",
+	"    inserted after every 20 bytes to keep the lines short.\n",
+	"    -->\n",
+	"    <blob>\n",
+	"        <byte>\\@@octal</byte>\n",
+	"        <line_sep>\"&#x0A;        \"</line_sep>\n",
+	"    </blob>\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <comb>-tag defines how the comb vectors are emitted when comb-vector\n",
+	"    tables are requested (-c). The action and goto tables are then each\n",
+	"    compressed into a base vector, holding an offset for every state, and a\n",
+	"    check and next vector, holding the overlaid rows of all states. An entry\n",
+	"    for a symbol exists in a state if the check vector holds the state's number\n",
+	"    at the state's offset plus the symbol's column, so it is found in constant\n",
+	"    time. The next vector holds the entry's index * 4 + its action.\n",
+	"\n",
+	"    Placeholders:	@@value					-	One value of the vector.\n",
+	"    -->\n",
+	"    <comb>\n",
+	"        <col>        @@value</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </comb>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Symbol and production information tables\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <symbol>-tag expands to a symbol information table that has an\n",
+	"    entry for each grammar symbol (intermixed terminal and nonterminal),\n",
+	"    which may contain its definition string or name, its type, its data-type\n",
+	"    index and several symbol-related flags. The table is not required for\n",
+	"    the parsing, but used for debug/trace and extended possibilites, e.g.\n",
+	"    automatically generated syntax trees.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@greedy				- 	1, if the symbol is a regular\n",
+	"                                                expression terminal and should\n",
+	"                                                be parsed greedy, 0 if not.\n",
+	"                    @@lexem					-	1, if the symbol is configured\n",
+	"                                                as a lexem, 0 if not.\n",
+	"                    @@symbol				-	The ID of the symbol.\n",
+	"                    @@symbol-name			-	The symbol string of the symbol,\n",
+	"                                                which is escaped by the escape\n",
+	"                                                sequences defined on top.\n",
+	"                    @@type					-	The symbol type:\n",
+	"                                                0) Nonterminal\n",
+	"                                                1) Character-class terminal\n",
+	"                                                2) Regex-class terminal\n",
+	"                                                3) String-class terminal\n",
+	"                    @@whitespace			-	1, if the symbol is configured\n",
+	"                                                as whitespace symbol, 0 if not.\n",
+	"    -->\n",
+	"    <symbols>\n",
+	"        <col>	{ /* @@symbol */ \"@@symbol-name\", \"@@emit\", @@type, @@lexem, @@whitespace, @@greedy }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </symbols>\n",
+	"\n",
+	"    <!-- 1D TABLE\n",
+	"    The <production>-tag expands to a production information table that has an\n",
+	"    entry for every production, which may contain its definition string, length\n",
+	"    and default left-hand side. This table is not required for the parsing, but\n",
+	"    used for debug/trace and extended possibilites, e.g. automatically\n",
+	"    generated syntax trees.\n",
+	"\n",
+	"    Placeholders:	@@column				-	The column index, beginning\n",
+	"                                                at 0. Can only be used in\n",
+	"                                                <col>.\n",
+	"                    @@production-number		-	The ID of the production.\n",
+	"                    @@production			-	The production string,\n",
+	"                                                which is escaped by the escape\n",
+	"                                                sequences defined on top.\n",
+	"                    @@length				-	The length of the production\n",
+	"                                                (symbols on the right-hand\n",
+	"                                                side)\n",
+	"                    @@lhs					-	Default left-hand side.\n",
+	"                                                Multiple left-hand sides are\n",
+	"                                                not covered here.\n",
+	"    -->\n",
+	"    <productions>\n",
+	"        <col>	{ /* @@production-number */ \"@@production\", \"@@emit\", @@length, @@lhs }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </productions>\n",
+	"\n",
+	"    <!--\n",
+	"    The <code_localization>-tag is printed before every line of semantic\n",
+	"    code, and equipped with some information about the source. Programming\n",
+	"    languages like C support a way to let the compiler report other locations\n",
+	"    in generated files, like it is the case with UniCC.\n",
+	"\n",
+	"    Placeholders:	@@line					-	The first line number where the\n",
+	"                                                semantic code was parsed at.\n",
+	"                    @@filename				-	The filename, where the semantoc\n",
+	"                                                code has been parsed from (this\n",
+	"                                                is the name of the parser\n",
+	"                                                definition file)\n",
+	"    -->\n",
+	"    <code_localization>#line @@line \"@@filename\"\n",
+	"</code_localization>\n",
+	"\n",
+	"\n",
+	"    <!--\n",
+	"    Now, the output files are described. It can be one file or multiple, all\n",
+	"    allow the insertion of the same placeholers.\n",
+	"\n",
+	"    Placeholders:	@@actions				-	Inserts the parser action code\n",
+	"                                                that is constructed from the\n",
+	"                                                program code attached to\n",
+	"                                                productions in combination with\n",
+	"                                                the tags\n",
+	"                                                <action_start> and <action_end>\n",
+	"                    @@action-table			-	Inserts the expanded action\n",
+	"                                                table that is generated from the\n",
+	"                                                <acttab> tags.\n",
+	"                    @@ast-construction		-	1 if any symbol or production\n",
+	"                                                emits an AST node, else 0.\n",
+	"                    @@basename				-	The basename of the target file.\n",
+	"                    @@Cbasename				-	The basename of the target file,\n",
+	"                                                as C-identifier. For example,\n",
+	"                                                \"test.1\" becomes \"test_1\".\n",
+	"                    @@CBASENAME				-	The basename of the target file,\n",
+	"                                                as C-identifier, in upper case\n",
+	"                                                order. For example,\n",
+	"                                                \"test.1\" becomes \"TEST_1\".\n",
+	"                    @@case-folding			-	1 if any lexical analyzer\n",
+	"                                                runs on case-folded input,\n",
+	"                                                else 0.\n",
+	"                    @@character-universe		-	Upper limit of the character\n",
+	"                                                universe. Lowest limit is\n",
+	"                                                always 0.\n",
+	"                    @@copyright_len			-	The length of the content of\n",
+	"                                                the #copyright parser directive.\n",
+	"                    @@copyright				-	Content of the #copyright\n",
+	"                                                parser directive.\n",
+	"                    @@deepest-action-row		-	Number of elements in the\n",
+	"                                                deepest row of the expanded\n",
+	"                                                array of the <acttab>-tag.\n",
+	"                                                This should be used for array\n",
+	"                                                memory allocation.\n",
+	"                    @@deepest-dfa-accept-row-	Number of elements in the\n",
+	"                                                deepest row of the expanded\n",
+	"                                                array of the <dfa_accept>-tag.\n",
+	"                                                This is used for array memory\n",
+	"                                                allocation.\n",
+	"                    @@deepest-dfa-index-row	-	Number of elements in the\n",
+	"                                                deepest row of the expanded\n",
+	"                                                array of the <dfa_idx>-tag.\n",
+	"                                                This is used for array memory\n",
+	"                                                allocation.\n",
+	"                    @@deepest-goto-row		-	Number of elements in the\n",
+	"                                                deepest row of the expanded\n",
+	"                                                array of the <gotab>-tag.\n",
+	"                                                This should be used for array\n",
+	"                                                memory allocation.\n",
+	"                    @@default-productions	-	Expands to the array of\n",
+	"                                                default productions from the\n",
+	"                                                <defprod>-tag.\n",
+	"                    @@description_len		-	The length of the content of\n",
+	"                                                the #description parser\n",
+	"                                                directive.\n",
+	"                    @@description			-	Content of the #description\n",
+	"                                                parser directive.\n",
+	"                    @@dfa-accept			-	Expands to the array of\n",
+	"                                                DFA accepting states from the\n",
+	"                                                <dfa_accept>-tag.\n",
+	"                    @@dfa-char				-	Expands to the array of DFA\n",
+	"                                                state characters from the\n",
+	"                                                <dfa_char>-tag.\n",
+	"                    @@dfa-fold				-	Expands to the array of DFA\n",
+	"                                                case-folding flags from the\n",
+	"                                                <dfa_fold>-tag.\n",
+	"                    @@dfa-mask				-	Expands to the array of\n",
+	"                                                accept masks of the states\n",
+	"                                                from the <dfa_mask>-tag.\n",
+	"                    @@dfa-mask-width		-	Number of columns of the\n",
+	"                                                arrays in the <dfa_mask>-tag.\n",
+	"                    @@dfa-index				-	Expands to the array of\n",
+	"                                                DFA state indexes from the\n",
+	"                                                <dfa_idx>-tag.\n",
+	"                    @@dfa-select				-	Expands to the array of\n",
+	"                                                DFA machine selection from the\n",
+	"                                                <dfa_select>-tag.\n",
+	"                    @@dfa-trans				-	Expands to the array of\n",
+	"                                                DFA transitions from the\n",
+	"                                                <dfa_trans>-tag.\n",
+	"                    @@eof					-	The symbol ID of the end-of-file\n",
+	"                                                terminal symbol. This is -1\n",
+	"                                                if not defined.\n",
+	"                    @@epilogue_len			-	The length of the content of\n",
+	"                                                the #epilogue parser\n",
+	"                                                directive.\n",
+	"                    @@epilogue				-	Content of the #epilogue\n",
+	"                                                parser directive.\n",
+	"                    @@error					-	The symbol ID of the error\n",
+	"                                                resynchrinoization terminal\n",
+	"                                                This is -1 if not defined.\n",
+	"                    @@filename_len			-	The length of the parser source\n",
+	"                                                filename.\n",
+	"                    @@filename				-	The filename of the parser\n",
+	"                                                source file.\n",
+	"                    @@goal					-	The symbol ID of the goal\n",
+	"                                                symbol (always a nonterminal).\n",
+	"                    @@goal-production		-	The production ID of the\n",
+	"                                                goal production.\n",
+	"                    @@goto-table			-	Inserts the expanded goto table\n",
+	"                                                that is generated from the\n",
+	"                                                <gotab> tags.\n",
+	"                    @@line-info				-	1 if the semantic code of the\n",
+	"                                                grammar accesses a line or\n",
+	"                                                column member or refers to\n",
+	"                                                the @@prefix_pcb type,\n",
+	"                                                else 0.\n",
+	"                    @@max-symbol-name-length-	Maxiumum size of the longest\n",
+	"                                                symbol name that was generated\n",
+	"                                                in the <symbols>-tag.\n",
+	"                    @@mode					-	The parser construction mode;\n",
+	"                                                0 for senstivie mode,\n",
+	"                                                1 for insensitive mode\n",
+	"                    @@scanner-actions		-	1 if any terminal symbol has\n",
+	"                                                semantic code, else 0.\n",
+	"                    @@shared-lexers			-	1 if the states share their\n",
+	"                                                lexical analyzers, and the\n",
+	"                                                accepted terminals must be\n",
+	"                                                filtered by the <dfa_mask>\n",
+	"                                                table, else 0.\n",
+	"                    @@skip-whitespace		-	1 if the lexical analyzer\n",
+	"                                                skips whitespace tokens,\n",
+	"                                                else 0\n",
+	"\n",
+	"                    @@name_len				-	The length of the content of\n",
+	"                                                the #parser parser\n",
+	"                                                directive.\n",
+	"                    @@name					-	Content of the #parser\n",
+	"                                                parser directive.\n",
+	"                    @@number-of-dfa-machines-	Total number of DFA state\n",
+	"                                                machines. This is always 1\n",
+	"                                                in insentivie parsers.\n",
+	"                    @@number-of-productions	-	The number of productions.\n",
+	"                    @@number-of-states		-	The number of LALR(1) states.\n",
+	"                    @@number-of-symbols		-	The number of symbols.\n",
+	"                    @@number-of-terminals	-	The number of terminal\n",
+	"                                                symbols. Terminals have the\n",
+	"                                                IDs from 0 to this number - 1,\n",
+	"                                                the nonterminals follow.\n",
+	"                    @@number-of-nonterminals	-	The number of nonterminal\n",
+	"                                                symbols.\n",
+	"                    @@packed-tables			-	1 if the parse tables are\n",
+	"                                                emitted as packed byte blobs\n",
+	"                                                using the <blob>-tag, else 0.\n",
+	"                    @@comb-tables			-	1 if the action and goto\n",
+	"                                                tables are emitted as comb\n",
+	"                                                vectors using the <comb>-tag,\n",
+	"                                                else 0.\n",
+	"                    @@action-comb-size		-	The length of the check and\n",
+	"                                                next vectors of the action\n",
+	"                                                table.\n",
+	"                    @@goto-comb-size		-	The length of the check and\n",
+	"                                                next vectors of the goto\n",
+	"                                                table.\n",
+	"                    @@<vector>				-	A comb vector, where <vector>\n",
+	"                                                is one of action-base,\n",
+	"                                                action-check, action-next,\n",
+	"                                                goto-base, goto-check or\n",
+	"                                                goto-next.\n",
+	"                    @@<vector>-type			-	The narrowest <int_type> that\n",
+	"                                                holds all values of a comb\n",
+	"                                                vector.\n",
+	"                    @@<table>-blob			-	The packed byte blob of a\n",
+	"                                                table, where <table> is one of\n",
+	"                                                action-table, goto-table,\n",
+	"                                                default-productions,\n",
+	"                                                dfa-select, dfa-index,\n",
+	"                                                dfa-char, dfa-trans,\n",
+	"                                                dfa-accept, dfa-fold or\n",
+	"                                                dfa-mask.\n",
+	"                    @@<table>-blob-width	-	Size in bytes of one value in\n",
+	"                                                the according blob (1, 2 or\n",
+	"                                                4, little endian).\n",
+	"                    @@<table>-type			-	The narrowest <int_type> that\n",
+	"                                                holds all values of a table,\n",
+	"                                                where <table> is one of the\n",
+	"                                                tables listed above.\n",
+	"                    @@pcb_len				-	The length of the content of\n",
+	"                                                the #pcb parser directive.\n",
+	"                    @@pcb					-	Content of the #pcb\n",
+	"                                                parser directive.\n",
+	"                    @@productions			-	Expands to the productions\n",
+	"                                                string array produced by\n",
+	"                                                the <productions>-tag.\n",
+	"                    @@prologue_len			-	The length of the content of\n",
+	"                                                the #prologue parser\n",
+	"                                                directive.\n",
+	"                    @@prologue				-	Content of the #prologue\n",
+	"                                                parser directive.\n",
+	"                    @@scan_actions			-	Expands to the semantic\n",
+	"                                                scanner actions that may\n",
+	"                                                be processed when a token\n",
+	"                                                has been correctly matched.\n",
+	"                    @@size-of-dfa-characters-	The size of the array\n",
+	"                                                expaned by <dfa_char>.\n",
+	"                    @@symbols				-	Expands to the symbol\n",
+	"                                                string array produced by\n",
+	"                                                the <symbols>-tag.\n",
+	"                    @@top-value				-	Expands to the variable\n",
+	"                                                pointing to the top of\n",
+	"                                                the value-stack.\n",
+	"                    @@value-type-definition	-	Expands to the value type\n",
+	"                                                definitions.\n",
+	"                    @@version_len			-	The length of the content of\n",
+	"                                                the #version parser\n",
+	"                                                directive.\n",
+	"                    @@version				-	Content of the #version\n",
+	"                                                parser directive.\n",
+	"\n",
+	"    The expansion macros @@basename, @@Cbasename, @@CBASENAME, @@filename,\n",
+	"    @@filename_len and @@prefix can be used everywhere in all tags. They are\n",
+	"    replaced as last. They can also be used in semantic actions defined in the\n",
+	"    parser's semantic actions. It is also possible to use the above macros in\n",
+	"    the filename-attribute of the file-tag, to generate adequate filenames.\n",
+	"    -->\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Conditions\n",
+	"    ****************************************************************************\n",
+	"    Parts of the files and sections which are only required by some parsers\n",
+	"    are enclosed by condition lines, which are expanded by the code generator\n",
+	"    before any placeholder. A line \"@@if feature\" keeps the lines up to the\n",
+	"    matching \"@@else\" or \"@@endif\" line only if the feature is used by the\n",
+	"    parser, \"@@if !feature\" only if it is not; The lines behind \"@@else\" are\n",
+	"    kept otherwise. Conditions can be nested, and the condition lines are\n",
+	"    never part of the output.\n",
+	"\n",
+	"    Features:		packed-tables			-	Packed byte blobs are emitted.\n",
+	"                    comb-tables				-	Comb vectors are emitted.\n",
+	"                    mode					-	The parser is constructed in\n",
+	"                                                insensitive mode.\n",
+	"                    lexers					-	The parser has lexical\n",
+	"                                                analyzers.\n",
+	"                    case-folding			-	Any lexical analyzer runs on\n",
+	"                                                case-folded input.\n",
+	"                    shared-lexers			-	The states share their\n",
+	"                                                lexical analyzers.\n",
+	"                    skip-whitespace			-	The lexical analyzers skip\n",
+	"                                                whitespace.\n",
+	"                    ast-construction		-	Any symbol or production\n",
+	"                                                emits an AST node.\n",
+	"                    scanner-actions			-	Any terminal symbol has\n",
+	"                                                semantic code.\n",
+	"                    error-token				-	The grammar uses the error\n",
+	"                                                token for error recovery.\n",
+	"    -->\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Sections\n",
+	"    ****************************************************************************\n",
+	"    The parser is composed of the following sections, which are inserted into\n",
+	"    the files below for their placeholders @@<name>-section. By default, they\n",
+	"    are all written into one file; With split translation units (-U), every\n",
+	"    file with the split-attribute \"yes\" is written instead of those with \"no\",\n",
+	"    so that the parts of the parser can be compiled separately. Files without\n",
+	"    a split-attribute are always written. A line break directly behind the\n",
+	"    opening section-tag is not part of the section.\n",
+	"\n",
+	"    Functions and tables used by other parts of the parser are defined with\n",
+	"    UNICC_INTERN, which expands to UNICC_STATIC in the single file, and\n",
+	"    declares them with external linkage in split translation units.\n",
+	"    -->\n",
+	"    <section name=\"tables\">\n",
+	"@@if comb-tables\n",
+	"/* Action Table as comb vectors */\n",
+	"UNICC_INTERN @@action-base-type @@prefix_act_base[ @@number-of-states ] =\n",
+	"{\n",
+	"@@action-base\n",
+	"};\n",
+	"\n",
+	"UNICC_INTERN @@action-check-type @@prefix_act_check[ @@action-comb-size ] =\n",
+	"{\n",
+	"@@action-check\n",
+	"};\n",
+	"\n",
+	"UNICC_INTERN @@action-next-type @@prefix_act_next[ @@action-comb-size ] =\n",
+	"{\n",
+	"@@action-next\n",
+	"};\n",
+	"\n",
+	"/* GoTo Table as comb vectors */\n",
+	"UNICC_INTERN @@goto-base-type @@prefix_go_base[ @@number-of-states ] =\n",
+	"{\n",
+	"@@goto-base\n",
+	"};\n",
+	"\n",
+	"UNICC_INTERN @@goto-check-type @@prefix_go_check[ @@goto-comb-size ] =\n",
+	"{\n",
+	"@@goto-check\n",
+	"};\n",
+	"\n",
+	"UNICC_INTERN @@goto-next-type @@prefix_go_next[ @@goto-comb-size ] =\n",
+	"{\n",
+	"@@goto-next\n",
+	"};\n",
+	"\n",
+	"@@endif\n",
+	"@@if packed-tables\n",
+	"@@if !comb-tables\n",
+	"/* Action Table */\n",
+	"UNICC_INTERN const unsigned char @@prefix_act[] =\n",
+	"        \"@@action-table-blob\";\n",
+	"\n",
+	"/* GoTo Table */\n",
+	"UNICC_INTERN const unsigned char @@prefix_go[] =\n",
+	"        \"@@goto-table-blob\";\n",
+	"@@endif\n",
+	"\n",
+	"/* Default productions per state */\n",
+	"UNICC_INTERN const unsigned char @@prefix_def_prod[] =\n",
+	"        \"@@default-productions-blob\";\n",
+	"\n",
+	"@@if !mode\n",
+	"/* DFA selection table */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_select[] =\n",
+	"        \"@@dfa-select-blob\";\n",
+	"@@endif\n",
+	"\n",
+	"@@if lexers\n",
+	"/* DFA index table */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_idx[] =\n",
+	"        \"@@dfa-index-blob\";\n",
+	"\n",
+	"/* DFA transition chars */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_chars[] =\n",
+	"        \"@@dfa-char-blob\";\n",
+	"\n",
+	"/* DFA transitions */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_trans[] =\n",
+	"        \"@@dfa-trans-blob\";\n",
+	"\n",
+	"/* DFA acception states */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_accept[] =\n",
+	"        \"@@dfa-accept-blob\";\n",
+	"\n",
+	"@@if case-folding\n",
+	"/* DFA case-folding flags */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_fold[] =\n",
+	"        \"@@dfa-fold-blob\";\n",
+	"@@endif\n",
+	"\n",
+	"@@if shared-lexers\n",
+	"/* Accept masks of the states using a shared DFA */\n",
+	"UNICC_INTERN const unsigned char @@prefix_dfa_mask[] =\n",
+	"        \"@@dfa-mask-blob\";\n",
+	"@@endif\n",
+	"\n",
+	"@@endif\n",
+	"@@else\n",
+	"@@if !comb-tables\n",
+	"/* Action Table */\n",
+	"UNICC_INTERN @@action-table-type @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =\n",
+	"{\n",
+	"@@action-table\n",
+	"};\n",
+	"\n",
+	"/* GoTo Table */\n",
+	"UNICC_INTERN @@goto-table-type @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =\n",
+	"{\n",
+	"@@goto-table\n",
+	"};\n",
+	"@@endif\n",
+	"\n",
+	"/* Default productions per state */\n",
+	"UNICC_INTERN @@default-productions-type @@prefix_def_prod[ @@number-of-states ] =\n",
+	"{\n",
+	"@@default-productions\n",
+	"};\n",
+	"\n",
+	"@@if !mode\n",
+	"/* DFA selection table */\n",
+	"UNICC_INTERN @@dfa-select-type @@prefix_dfa_select[ @@number-of-states ] =\n",
+	"{\n",
+	"@@dfa-select\n",
+	"};\n",
+	"@@endif\n",
+	"\n",
+	"@@if lexers\n",
+	"/* DFA index table */\n",
+	"UNICC_INTERN @@dfa-index-type @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =\n",
+	"{\n",
+	"@@dfa-index\n",
+	"};\n",
+	"\n",
+	"/* DFA transition chars */\n",
+	"UNICC_INTERN @@dfa-char-type @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ] =\n",
+	"{\n",
+	"@@dfa-char\n",
+	"};\n",
+	"\n",
+	"/* DFA transitions */\n",
+	"UNICC_INTERN @@dfa-trans-type @@prefix_dfa_trans[ @@size-of-dfa-characters ] =\n",
+	"{\n",
+	"@@dfa-trans\n",
+	"};\n",
+	"\n",
+	"/* DFA acception states */\n",
+	"UNICC_INTERN @@dfa-accept-type @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =\n",
+	"{\n",
+	"@@dfa-accept\n",
+	"};\n",
+	"\n",
+	"@@if case-folding\n",
+	"/* DFA case-folding flags */\n",
+	"UNICC_INTERN @@dfa-fold-type @@prefix_dfa_fold[ @@number-of-dfa-machines ] =\n",
+	"{\n",
+	"@@dfa-fold\n",
+	"};\n",
+	"@@endif\n",
+	"\n",
+	"@@if shared-lexers\n",
+	"/* Accept masks of the states using a shared DFA */\n",
+	"UNICC_INTERN @@dfa-mask-type @@prefix_dfa_mask[ @@number-of-states ][ @@dfa-mask-width ] =\n",
+	"{\n",
+	"@@dfa-mask\n",
+	"};\n",
+	"@@endif\n",
+	"\n",
+	"@@endif\n",
+	"@@endif\n",
+	"\n",
+	"/* Symbol information table */\n",
+	"UNICC_INTERN @@prefix_syminfo @@prefix_symbols[] =\n",
+	"{\n",
+	"@@symbols\n",
+	"};\n",
+	"\n",
+	"/* Production information table */\n",
+	"UNICC_INTERN @@prefix_prodinfo @@prefix_productions[] =\n",
+	"{\n",
+	"@@productions\n",
+	"};\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"access\">\n",
+	"/* Symbol ID ranges; Terminals are numbered before the nonterminals */\n",
+	"#define UNICC_TERMINALS				@@number-of-terminals\n",
+	"#define UNICC_NONTERMINALS			@@number-of-nonterminals\n",
+	"#define UNICC_NONTERM_IDX( sym )	( ( sym ) - UNICC_TERMINALS )\n",
+	"\n",
+	"@@if comb-tables\n",
+	"/* Comb vector slots of a symbol in a state */\n",
+	"#define UNICC_ACT_SLOT( st, sym )	( @@prefix_act_base[ st ] + ( sym ) )\n",
+	"#define UNICC_GO_SLOT( st, sym )	\\\n",
+	"    ( @@prefix_go_base[ st ] + UNICC_NONTERM_IDX( sym ) )\n",
+	"@@endif\n",
+	"\n",
+	"@@if packed-tables\n",
+	"@@if !comb-tables\n",
+	"#define @@prefix_act_width			@@action-table-blob-width\n",
+	"#define @@prefix_go_width			@@goto-table-blob-width\n",
+	"@@endif\n",
+	"#define @@prefix_def_prod_width		@@default-productions-blob-width\n",
+	"@@if !mode\n",
+	"#define @@prefix_dfa_select_width	@@dfa-select-blob-width\n",
+	"@@endif\n",
+	"@@if lexers\n",
+	"#define @@prefix_dfa_idx_width		@@dfa-index-blob-width\n",
+	"#define @@prefix_dfa_chars_width	@@dfa-char-blob-width\n",
+	"#define @@prefix_dfa_trans_width	@@dfa-trans-blob-width\n",
+	"#define @@prefix_dfa_accept_width	@@dfa-accept-blob-width\n",
+	"@@if case-folding\n",
+	"#define @@prefix_dfa_fold_width		@@dfa-fold-blob-width\n",
+	"@@endif\n",
+	"@@if shared-lexers\n",
+	"#define @@prefix_dfa_mask_width		@@dfa-mask-blob-width\n",
+	"@@endif\n",
+	"@@endif\n",
+	"\n",
+	"#define UNICC_UNPACK( tab, i ) \\\n",
+	"    ( (int)@@prefix_unpack( @@prefix_##tab, @@prefix_##tab##_width, \\\n",
+	"                                (long)( i ) ) )\n",
+	"\n",
+	"/* Table accessors; The DFA index table holds character-range indexes */\n",
+	"@@if !comb-tables\n",
+	"#define UNICC_ACT( st, i )		\\\n",
+	"    UNICC_UNPACK( act, (long)( st ) * ( @@deepest-action-row * 3 + 1 ) + ( i ) )\n",
+	"#define UNICC_GO( st, i )		\\\n",
+	"    UNICC_UNPACK( go, (long)( st ) * ( @@deepest-goto-row * 3 + 1 ) + ( i ) )\n",
+	"@@endif\n",
+	"#define UNICC_DEF_PROD( st )	UNICC_UNPACK( def_prod, st )\n",
+	"@@if !mode\n",
+	"#define UNICC_DFA_SELECT( st )	UNICC_UNPACK( dfa_select, st )\n",
+	"@@endif\n",
+	"@@if lexers\n",
+	"#define UNICC_DFA_IDX( m, st )	\\\n",
+	"    ( UNICC_UNPACK( dfa_idx, \\\n",
+	"        (long)( m ) * @@deepest-dfa-index-row + ( st ) ) * 2 )\n",
+	"#define UNICC_DFA_CHARS( i )	UNICC_UNPACK( dfa_chars, i )\n",
+	"#define UNICC_DFA_TRANS( i )	UNICC_UNPACK( dfa_trans, i )\n",
+	"#define UNICC_DFA_ACCEPT( m, st )	\\\n",
+	"    UNICC_UNPACK( dfa_accept, \\\n",
+	"        (long)( m ) * @@deepest-dfa-accept-row + ( st ) )\n",
+	"@@if case-folding\n",
+	"#define UNICC_DFA_FOLD( m )		UNICC_UNPACK( dfa_fold, m )\n",
+	"@@endif\n",
+	"@@if shared-lexers\n",
+	"#define UNICC_DFA_MASK( st, i )	\\\n",
+	"    UNICC_UNPACK( dfa_mask, (long)( st ) * @@dfa-mask-width + ( i ) )\n",
+	"@@endif\n",
+	"@@endif\n",
+	"@@else\n",
+	"/* Table accessors; The DFA index table holds character-range indexes */\n",
+	"@@if !comb-tables\n",
+	"#define UNICC_ACT( st, i )			@@prefix_act[ st ][ i ]\n",
+	"#define UNICC_GO( st, i )			@@prefix_go[ st ][ i ]\n",
+	"@@endif\n",
+	"#define UNICC_DEF_PROD( st )		@@prefix_def_prod[ st ]\n",
+	"@@if !mode\n",
+	"#define UNICC_DFA_SELECT( st )		@@prefix_dfa_select[ st ]\n",
+	"@@endif\n",
+	"@@if lexers\n",
+	"#define UNICC_DFA_IDX( m, st )		( @@prefix_dfa_idx[ m ][ st ] * 2 )\n",
+	"#define UNICC_DFA_CHARS( i )		@@prefix_dfa_chars[ i ]\n",
+	"#define UNICC_DFA_TRANS( i )		@@prefix_dfa_trans[ i ]\n",
+	"#define UNICC_DFA_ACCEPT( m, st )	@@prefix_dfa_accept[ m ][ st ]\n",
+	"@@if case-folding\n",
+	"#define UNICC_DFA_FOLD( m )			@@prefix_dfa_fold[ m ]\n",
+	"@@endif\n",
+	"@@if shared-lexers\n",
+	"#define UNICC_DFA_MASK( st, i )		@@prefix_dfa_mask[ st ][ i ]\n",
+	"@@endif\n",
+	"@@endif\n",
+	"@@endif\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"support\">\n",
+	"@@if packed-tables\n",
+	"/* Unpacks value //i// of a table packed as little-endian values of //width//\n",
+	"    bytes each */\n",
+	"UNICC_STATIC long @@prefix_unpack( const unsigned char* blob,\n",
+	"                                    int width, long i )\n",
+	"{\n",
+	"    long	v;\n",
+	"\n",
+	"    blob += i * width;\n",
+	"\n",
+	"    if( ( v = blob[ width - 1 ] ) &gt; 127 )\n",
+	"        v -= 256;\n",
+	"\n",
+	"    while( --width )\n",
+	"        v = v * 256 + blob[ width - 1 ];\n",
+	"\n",
+	"    return v;\n",
+	"}\n",
+	"@@endif\n",
+	"\n",
+	"/* Don't report on unused @@prefix_lexem, @@prefix_ast_free or\n",
+	"    @@prefix_ast_print */\n",
+	"#pragma GCC diagnostic push\n",
+	"#pragma GCC diagnostic ignored \"-Wunused-function\"\n",
+	"\n",
+	"UNICC_INTERN UNICC_SCHAR* @@prefix_lexem( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"#if UNICC_WCHAR || !UNICC_UTF8\n",
+	"    pcb-&gt;lexem = pcb-&gt;buf;\n",
+	"#else\n",
+	"    size_t		size;\n",
+	"\n",
+	"    size = wcstombs( (char*)NULL, pcb-&gt;buf, 0 );\n",
+	"\n",
+	"    free( pcb-&gt;lexem );\n",
+	"\n",
+	"    if( !( pcb-&gt;lexem = (UNICC_SCHAR*)malloc(\n",
+	"            ( size + 1 ) * sizeof( UNICC_SCHAR ) ) ) )\n",
+	"    {\n",
+	"        UNICC_OUTOFMEM( pcb );\n",
+	"        return (UNICC_SCHAR*)NULL;\n",
+	"    }\n",
+	"\n",
+	"    wcstombs( pcb-&gt;lexem, pcb-&gt;buf, size + 1 );\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: lexem: pcb-&gt;lexem = &gt;\" UNICC_SCHAR_FORMAT \"&lt;\\n\",\n",
+	"                        UNICC_PARSER, pcb-&gt;lexem );\n",
+	"#endif\n",
+	"    return pcb-&gt;lexem;\n",
+	"}\n",
+	"\n",
+	"@@if ast-construction\n",
+	"UNICC_STATIC @@prefix_ast* @@prefix_ast_create( @@prefix_pcb* pcb, char* emit,\n",
+	"                                                    UNICC_SCHAR* token )\n",
+	"{\n",
+	"    @@prefix_ast*	node;\n",
+	"\n",
+	"    if( !( node = (@@prefix_ast*)malloc( sizeof( @@prefix_ast ) ) ) )\n",
+	"    {\n",
+	"        UNICC_OUTOFMEM( pcb );\n",
+	"        return node;\n",
+	"    }\n",
+	"\n",
+	"    memset( node, 0, sizeof( @@prefix_ast ) );\n",
+	"\n",
+	"    node-&gt;emit = emit;\n",
+	"\n",
+	"    if( token )\n",
+	"    {\n",
+	"        #if !UNICC_WCHAR\n",
+	"        if( !( node-&gt;token = strdup( token ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( pcb );\n",
+	"            free( node );\n",
+	"            return (@@prefix_ast*)NULL;\n",
+	"        }\n",
+	"        #else\n",
+	"        if( !( node-&gt;token = wcsdup( token ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( pcb );\n",
+	"            free( node );\n",
+	"            return (@@prefix_ast*)NULL;\n",
+	"        }\n",
+	"        #endif\n",
+	"    }\n",
+	"\n",
+	"    return node;\n",
+	"}\n",
+	"@@endif\n",
+	"\n",
+	"UNICC_STATIC @@prefix_ast* @@prefix_ast_free( @@prefix_ast* node )\n",
+	"{\n",
+	"    if( !node )\n",
+	"        return (@@prefix_ast*)NULL;\n",
+	"\n",
+	"    @@prefix_ast_free( node-&gt;child );\n",
+	"    @@prefix_ast_free( node-&gt;next );\n",
+	"\n",
+	"    if( node-&gt;token )\n",
+	"        free( node-&gt;token );\n",
+	"\n",
+	"    free( node );\n",
+	"    return (@@prefix_ast*)NULL;\n",
+	"}\n",
+	"\n",
+	"UNICC_STATIC void @@prefix_ast_print( FILE* stream, @@prefix_ast* node )\n",
+	"{\n",
+	"    int 		i;\n",
+	"    static int 	rec;\n",
+	"\n",
+	"    if( !node )\n",
+	"        return;\n",
+	"\n",
+	"    if( !stream )\n",
+	"        stream = stderr;\n",
+	"\n",
+	"    while( node )\n",
+	"    {\n",
+	"        for( i = 0; i &lt; rec; i++ )\n",
+	"            fprintf( stream,  \" \" );\n",
+	"\n",
+	"        fprintf( stream, \"%s\", node-&gt;emit );\n",
+	"\n",
+	"        if( node-&gt;token &amp;&amp; strcmp( node-&gt;emit, node-&gt;token ) != 0 )\n",
+	"            fprintf( stream, \" (%s)\", node-&gt;token );\n",
+	"\n",
+	"        fprintf( stream, \"\\n\" );\n",
+	"\n",
+	"        rec++;\n",
+	"        @@prefix_ast_print( stream, node-&gt;child );\n",
+	"        rec--;\n",
+	"\n",
+	"        node = node-&gt;next;\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"#pragma GCC diagnostic pop\n",
+	"\n",
+	"UNICC_STATIC int @@prefix_get_act( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    int i;\n",
+	"\n",
+	"@@if comb-tables\n",
+	"    if( pcb-&gt;sym &gt; -1 &amp;&amp; @@prefix_act_check[\n",
+	"            i = UNICC_ACT_SLOT( pcb-&gt;tos-&gt;state, pcb-&gt;sym ) ]\n",
+	"                == pcb-&gt;tos-&gt;state )\n",
+	"    {\n",
+	"        if( ( pcb-&gt;act = @@prefix_act_next[ i ] &amp; 3 ) == UNICC_ERROR )\n",
+	"            return 0; /* Force parse error! */\n",
+	"\n",
+	"        pcb-&gt;idx = @@prefix_act_next[ i ] &gt;&gt; 2;\n",
+	"        return 1;\n",
+	"    }\n",
+	"@@else\n",
+	"    for( i = 1; i &lt; UNICC_ACT( pcb-&gt;tos-&gt;state, 0 ) * 3; i += 3 )\n",
+	"    {\n",
+	"        if( UNICC_ACT( pcb-&gt;tos-&gt;state, i ) == pcb-&gt;sym )\n",
+	"        {\n",
+	"            if( ( pcb-&gt;act = UNICC_ACT( pcb-&gt;tos-&gt;state, i + 1 ) )\n",
+	"                    == UNICC_ERROR )\n",
+	"                return 0; /* Force parse error! */\n",
+	"\n",
+	"            pcb-&gt;idx = UNICC_ACT( pcb-&gt;tos-&gt;state, i + 2 );\n",
+	"            return 1;\n",
+	"        }\n",
+	"    }\n",
+	"@@endif\n",
+	"\n",
+	"    /* Default production */\n",
+	"    if( ( pcb-&gt;idx = UNICC_DEF_PROD( pcb-&gt;tos-&gt;state ) ) &gt; -1 )\n",
+	"    {\n",
+	"        pcb-&gt;act = 1; /* Reduce */\n",
+	"        return 1;\n",
+	"    }\n",
+	"\n",
+	"    return 0;\n",
+	"}\n",
+	"\n",
+	"UNICC_STATIC int @@prefix_get_go( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    int i;\n",
+	"\n",
+	"@@if comb-tables\n",
+	"    if( @@prefix_go_check[ i = UNICC_GO_SLOT( pcb-&gt;tos-&gt;state, pcb-&gt;lhs ) ]\n",
+	"            == pcb-&gt;tos-&gt;state )\n",
+	"    {\n",
+	"        pcb-&gt;act = @@prefix_go_next[ i ] &amp; 3;\n",
+	"        pcb-&gt;idx = @@prefix_go_next[ i ] &gt;&gt; 2;\n",
+	"        return 1;\n",
+	"    }\n",
+	"@@else\n",
+	"    for( i = 1; i &lt; UNICC_GO( pcb-&gt;tos-&gt;state, 0 ) * 3; i += 3 )\n",
+	"    {\n",
+	"        if( UNICC_GO( pcb-&gt;tos-&gt;state, i ) == pcb-&gt;lhs )\n",
+	"        {\n",
+	"            pcb-&gt;act = UNICC_GO( pcb-&gt;tos-&gt;state, i + 1 );\n",
+	"            pcb-&gt;idx = UNICC_GO( pcb-&gt;tos-&gt;state, i + 2 );\n",
+	"            return 1;\n",
+	"        }\n",
+	"    }\n",
+	"@@endif\n",
+	"\n",
+	"    return 0;\n",
+	"}\n",
+	"\n",
+	"UNICC_STATIC int @@prefix_alloc_stack( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    unsigned int	size;\n",
+	"\n",
+	"    if( !pcb-&gt;stacksize )\n",
+	"    {\n",
+	"        if( !( pcb-&gt;tos = pcb-&gt;stack = (@@prefix_tok*)malloc(\n",
+	"                UNICC_MALLOCSTEP * sizeof( @@prefix_tok ) ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( pcb );\n",
+	"            return -1;\n",
+	"        }\n",
+	"\n",
+	"        pcb-&gt;stacksize = UNICC_MALLOCSTEP;\n",
+	"    }\n",
+	"    else if( ( size = (unsigned int)( pcb-&gt;tos - pcb-&gt;stack ) )\n",
+	"                == pcb-&gt;stacksize )\n",
+	"    {\n",
+	"        @@prefix_tok*	ptr;\n",
+	"\n",
+	"        if( !( ptr = (@@prefix_tok*)realloc( pcb-&gt;stack,\n",
+	"                ( pcb-&gt;stacksize + UNICC_MALLOCSTEP )\n",
+	"                    * sizeof( @@prefix_tok ) ) ) )\n",
+	"        {\n",
+	"            UNICC_OUTOFMEM( pcb );\n",
+	"            free( pcb-&gt;stack );\n",
+	"\n",
+	"            return -1;\n",
+	"        }\n",
+	"\n",
+	"        pcb-&gt;tos = pcb-&gt;stack = ptr;\n",
+	"\n",
+	"        pcb-&gt;stacksize += UNICC_MALLOCSTEP;\n",
+	"        pcb-&gt;tos += size;\n",
+	"    }\n",
+	"\n",
+	"    return 0;\n",
+	"}\n",
+	"\n",
+	"#ifndef UNICC_GETINPUT\n",
+	"\n",
+	"#if UNICC_UTF8\n",
+	"static int offsets_utf8[ 6 ] =\n",
+	"{\n",
+	"    0x00000000UL, 0x00003080UL, 0x000E2080UL,\n",
+	"    0x03C82080UL, 0xFA082080UL, 0x82082080UL\n",
+	"};\n",
+	"\n",
+	"static int trailbyte_utf8[ 256 ] =\n",
+	"{\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,\n",
+	"    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,\n",
+	"    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5\n",
+	"};\n",
+	"\n",
+	"UNICC_STATIC UNICC_CHAR @@prefix_utf8_getchar( int (*getfn)() )\n",
+	"{\n",
+	"    UNICC_CHAR	ch	= 0;\n",
+	"    int 		nb;\n",
+	"    int			c;\n",
+	"\n",
+	"    if( !getfn )\n",
+	"        getfn = getchar;\n",
+	"\n",
+	"    switch( ( nb = trailbyte_utf8[ ( c = (*getfn)() ) ] ) )\n",
+	"    {\n",
+	"        case 3:\n",
+	"            ch += c;\n",
+	"            ch &lt;&lt;= 6;\n",
+	"            c = (*getfn)();\n",
+	"        case 2:\n",
+	"            ch += c;\n",
+	"            ch &lt;&lt;= 6;\n",
+	"            c = (*getfn)();\n",
+	"        case 1:\n",
+	"            ch += c;\n",
+	"            ch &lt;&lt;= 6;\n",
+	"            c = (*getfn)();\n",
+	"        case 0:\n",
+	"            ch += c;\n",
+	"            break;\n",
+	"    }\n",
+	"\n",
+	"    ch -= offsets_utf8[ nb ];\n",
+	"#if UNICC_DEBUG	&gt; 3\n",
+	"    fprintf( stderr, \"%s: getchar: %d\\n\", UNICC_PARSER, ch );\n",
+	"#endif\n",
+	"    return ch;\n",
+	"}\n",
+	"#define UNICC_GETINPUT		@@prefix_utf8_getchar( getchar )\n",
+	"\n",
+	"#else\n",
+	"#define UNICC_GETINPUT		getchar()\n",
+	"#endif\n",
+	"\n",
+	"#endif\n",
+	"\n",
+	"UNICC_INTERN UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset )\n",
+	"{\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: get input: pcb-&gt;buf + offset = %p pcb-&gt;bufend = %p\\n\",\n",
+	"                UNICC_PARSER, pcb-&gt;buf + offset, pcb-&gt;bufend );\n",
+	"#endif\n",
+	"\n",
+	"    while( pcb-&gt;buf + offset &gt;= pcb-&gt;bufend )\n",
+	"    {\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"            fprintf( stderr, \"%s: get input: requiring more input\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"        if( !pcb-&gt;buf )\n",
+	"        {\n",
+	"            pcb-&gt;bufend = pcb-&gt;buf = (UNICC_CHAR*)malloc(\n",
+	"                ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );\n",
+	"\n",
+	"            if( !pcb-&gt;buf )\n",
+	"            {\n",
+	"                UNICC_OUTOFMEM( pcb );\n",
+	"                return 0;\n",
+	"            }\n",
+	"\n",
+	"            *pcb-&gt;buf = 0;\n",
+	"        }\n",
+	"        else if( *pcb-&gt;buf &amp;&amp; !( ( pcb-&gt;bufend - pcb-&gt;buf ) %\n",
+	"                    UNICC_MALLOCSTEP ) )\n",
+	"        {\n",
+	"            unsigned int 	size	= (unsigned int)( pcb-&gt;bufend - pcb-&gt;buf );\n",
+	"            UNICC_CHAR*		buf;\n",
+	"\n",
+	"            if( !( buf = (UNICC_CHAR*)realloc( pcb-&gt;buf,\n",
+	"                        ( size + UNICC_MALLOCSTEP + 1 )\n",
+	"                            * sizeof( UNICC_CHAR ) ) ) )\n",
+	"            {\n",
+	"                UNICC_OUTOFMEM( pcb );\n",
+	"                free( pcb-&gt;buf );\n",
+	"\n",
+	"                return 0;\n",
+	"            }\n",
+	"\n",
+	"            pcb-&gt;buf = buf;\n",
+	"            pcb-&gt;bufend = pcb-&gt;buf + size;\n",
+	"        }\n",
+	"\n",
+	"        if( pcb-&gt;is_eof || ( *( pcb-&gt;bufend ) = (UNICC_CHAR)UNICC_GETINPUT )\n",
+	"                                    == pcb-&gt;eof )\n",
+	"        {\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"            fprintf( stderr, \"%s: get input: can't get more input, \"\n",
+	"                        \"end-of-file reached\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"            pcb-&gt;is_eof = 1;\n",
+	"            return pcb-&gt;eof;\n",
+	"        }\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"        fprintf( stderr, \"%s: get input: read char &gt;%c&lt; %d\\n\",\n",
+	"                    UNICC_PARSER, (char)*( pcb-&gt;bufend ), *( pcb-&gt;bufend ) );\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"        fprintf( stderr, \"%s: get input: reading character &gt;%c&lt; %d\\n\",\n",
+	"                    UNICC_PARSER, (char)*( pcb-&gt;bufend ), *( pcb-&gt;bufend ) );\n",
+	"#endif\n",
+	"\n",
+	"        *( ++pcb-&gt;bufend ) = 0;\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    {\n",
+	"        UNICC_CHAR*		chptr;\n",
+	"\n",
+	"        fprintf( stderr, \"%s: get input: offset = %d\\n\",\n",
+	"                    UNICC_PARSER, offset );\n",
+	"        fprintf( stderr, \"%s: get input: buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                    UNICC_PARSER, pcb-&gt;buf );\n",
+	"        fprintf( stderr, \"%s: get input: returning %d\\n\",\n",
+	"                    UNICC_PARSER, *( pcb-&gt;buf + offset ) );\n",
+	"    }\n",
+	"#endif\n",
+	"\n",
+	"    return pcb-&gt;buf[ offset ];\n",
+	"}\n",
+	"\n",
+	"UNICC_STATIC void @@prefix_clear_input( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"#if UNICC_LINE_INFO\n",
+	"    int		i;\n",
+	"#endif\n",
+	"\n",
+	"    if( pcb-&gt;buf )\n",
+	"    {\n",
+	"        if( pcb-&gt;len )\n",
+	"        {\n",
+	"#if UNICC_LINE_INFO\n",
+	"            /* Update counters for line and column */\n",
+	"            for( i = 0; i &lt; pcb-&gt;len; i++ )\n",
+	"            {\n",
+	"                if( (char)pcb-&gt;buf[i] == '\\n' )\n",
+	"                {\n",
+	"                    pcb-&gt;line++;\n",
+	"                    pcb-&gt;column = 1;\n",
+	"                }\n",
+	"                else\n",
+	"                    pcb-&gt;column++;\n",
+	"            }\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_DEBUG &gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: \"\n",
+	"        \"Clearing %d characters (%d bytes)\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;len, pcb-&gt;len * sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;buf, sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: pcb-&gt;bufend &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;bufend );\n",
+	"#endif\n",
+	"\n",
+	"            memmove( pcb-&gt;buf, pcb-&gt;buf + pcb-&gt;len,\n",
+	"                        ( ( pcb-&gt;bufend - ( pcb-&gt;buf + pcb-&gt;len ) ) + 1 + 1 )\n",
+	"                            * sizeof( UNICC_CHAR ) );\n",
+	"            pcb-&gt;bufend = pcb-&gt;buf + ( pcb-&gt;bufend - ( pcb-&gt;buf + pcb-&gt;len ) );\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: now buf = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                UNICC_PARSER, pcb-&gt;buf, sizeof( UNICC_CHAR ) );\n",
+	"    fprintf( stderr, \"%s: clear input: now bufend = &gt;\" UNICC_CHAR_FORMAT \"&lt;\\n\",\n",
+	"                UNICC_PARSER, pcb-&gt;bufend, sizeof( UNICC_CHAR ) );\n",
+	"#endif\n",
+	"        }\n",
+	"        else\n",
+	"        {\n",
+	"            pcb-&gt;bufend = pcb-&gt;buf;\n",
+	"            *( pcb-&gt;buf ) = 0;\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    pcb-&gt;len = 0;\n",
+	"    pcb-&gt;sym = -1;\n",
+	"#if UNICC_DEBUG	&gt; 2\n",
+	"    fprintf( stderr, \"%s: clear input: symbol cleared\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"}\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"actions\">\n",
+	"/* Runs the semantic action of the production pcb-&gt;idx to be reduced */\n",
+	"UNICC_INTERN void @@prefix_reduce( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    switch( pcb-&gt;idx )\n",
+	"    {\n",
+	"@@actions\n",
+	"    }\n",
+	"}\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"scanner\">\n",
+	"@@if lexers\n",
+	"@@if scanner-actions\n",
+	"#if UNICC_SEMANTIC_TERM_SEL\n",
+	"/* Runs the scanner action of a matched terminal with UNICC_ON_SHIFT = 0,\n",
+	"    for semantic-code dependent terminal selections */\n",
+	"UNICC_INTERN void @@prefix_scan_match( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"#define UNICC_ON_SHIFT 	0\n",
+	"    switch( pcb-&gt;sym )\n",
+	"    {\n",
+	"@@scan_actions\n",
+	"\n",
+	"        default:\n",
+	"            break;\n",
+	"    }\n",
+	"#undef UNICC_ON_SHIFT\n",
+	"}\n",
+	"#endif\n",
+	"@@endif\n",
+	"@@endif\n",
+	"\n",
+	"@@if scanner-actions\n",
+	"/* Runs the scanner action of the shifted terminal with UNICC_ON_SHIFT = 1,\n",
+	"    so that shifting-related operations will be performed */\n",
+	"UNICC_INTERN void @@prefix_scan_shift( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"#define UNICC_ON_SHIFT	1\n",
+	"    switch( pcb-&gt;sym )\n",
+	"    {\n",
+	"@@scan_actions\n",
+	"\n",
+	"        default:\n",
+	"            @@top-value = @@prefix_get_input( pcb, 0 );\n",
+	"            break;\n",
+	"    }\n",
+	"#undef UNICC_ON_SHIFT\n",
+	"}\n",
+	"@@endif\n",
+	"</section>\n",
+	"\n",
+	"    <section name=\"driver\">\n",
+	"@@if lexers\n",
+	"UNICC_STATIC void @@prefix_lex( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    int 			dfa_st	= 0;\n",
+	"    unsigned int	len		= 0;\n",
+	"    int				chr;\n",
+	"    UNICC_CHAR		next;\n",
+	"@@if !mode\n",
+	"    int				mach	= UNICC_DFA_SELECT( pcb-&gt;tos-&gt;state );\n",
+	"@@else\n",
+	"    int				mach	= 0;\n",
+	"@@endif\n",
+	"\n",
+	"    next = @@prefix_get_input( pcb, len );\n",
+	"@@if case-folding\n",
+	"    if( UNICC_DFA_FOLD( mach ) &amp;&amp; next &gt;= 'A' &amp;&amp; next &lt;= 'Z' )\n",
+	"        next += 'a' - 'A';\n",
+	"@@endif\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d\\n\", UNICC_PARSER, next );\n",
+	"#endif\n",
+	"\n",
+	"    if( next == pcb-&gt;eof )\n",
+	"    {\n",
+	"        pcb-&gt;sym = @@eof;\n",
+	"        return;\n",
+	"    }\n",
+	"\n",
+	"    do\n",
+	"    {\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d\\n\", UNICC_PARSER, next );\n",
+	"#endif\n",
+	"\n",
+	"        chr = UNICC_DFA_IDX( mach, dfa_st );\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: chr = %d\\n\", UNICC_PARSER, chr );\n",
+	"#endif\n",
+	"\n",
+	"        dfa_st = -1;\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: FIRST next = %d @@prefix_dfa_chars[ chr ] = %d, \"\n",
+	"            \"@@prefix_dfa_chars[ chr+1 ] = %d\\n\", UNICC_PARSER, next,\n",
+	"                UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );\n",
+	"#endif\n",
+	"        while( UNICC_DFA_CHARS( chr ) &gt; -1 )\n",
+	"        {\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: next = %d @@prefix_dfa_chars[ chr ] = %d, \"\n",
+	"        \"@@prefix_dfa_chars[ chr+1 ] = %d\\n\", UNICC_PARSER, next,\n",
+	"            UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );\n",
+	"#endif\n",
+	"            if( next &gt;= UNICC_DFA_CHARS( chr ) &amp;&amp;\n",
+	"                next &lt;= UNICC_DFA_CHARS( chr + 1 ) )\n",
+	"            {\n",
+	"                dfa_st = UNICC_DFA_TRANS( chr / 2 );\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: dfa_st = %d\\n\", UNICC_PARSER, dfa_st );\n",
+	"#endif\n",
+	"@@if shared-lexers\n",
+	"                /* Only accept terminals which are valid in this state */\n",
+	"                if( UNICC_DFA_ACCEPT( mach, dfa_st ) &gt; 0\n",
+	"                    &amp;&amp; ( UNICC_DFA_MASK( pcb-&gt;tos-&gt;state,\n",
+	"                            ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 ) / 8 )\n",
+	"                        &amp; ( 1 &lt;&lt; ( ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 )\n",
+	"                                    % 8 ) ) ) )\n",
+	"@@else\n",
+	"                if( UNICC_DFA_ACCEPT( mach, dfa_st ) &gt; 0 )\n",
+	"@@endif\n",
+	"                {\n",
+	"                    pcb-&gt;len = len + 1;\n",
+	"                    pcb-&gt;sym = UNICC_DFA_ACCEPT( mach, dfa_st ) - 1;\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: new accepting symbol pcb-&gt;sym = %d greedy = %d\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;sym, @@prefix_symbols[ pcb-&gt;sym ].greedy );\n",
+	"#endif\n",
+	"                    if( pcb-&gt;sym == @@eof )\n",
+	"                    {\n",
+	"                        dfa_st = -1; /* test! */\n",
+	"                        break;\n",
+	"                    }\n",
+	"\n",
+	"                    /* Stop if matched symbol should be parsed nongreedy */\n",
+	"                    if( !@@prefix_symbols[ pcb-&gt;sym ].greedy )\n",
+	"                    {\n",
+	"                        dfa_st = -1;\n",
+	"                        break;\n",
+	"                    }\n",
+	"                }\n",
+	"\n",
+	"                next = @@prefix_get_input( pcb, ++len );\n",
+	"@@if case-folding\n",
+	"                if( UNICC_DFA_FOLD( mach )\n",
+	"                        &amp;&amp; next &gt;= 'A' &amp;&amp; next &lt;= 'Z' )\n",
+	"                    next += 'a' - 'A';\n",
+	"@@endif\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"            chr += 2;\n",
+	"        }\n",
+	"    }\n",
+	"    while( dfa_st &gt; -1 &amp;&amp; next != pcb-&gt;eof );\n",
+	"\n",
+	"    if( pcb-&gt;sym &gt; -1 )\n",
+	"    {\n",
+	"@@if scanner-actions\n",
+	"#if UNICC_SEMANTIC_TERM_SEL\n",
+	"        /*\n",
+	"            Execute scanner actions, if existing, but with\n",
+	"            UNICC_ON_SHIFT = 0, so that no memory allocation\n",
+	"            should be performed. This actions should only be\n",
+	"            handled if there are semantic-code dependent\n",
+	"            terminal symbol selections.\n",
+	"\n",
+	"            tos is incremented here, if the semantic code\n",
+	"            stores data for the symbol. It won't get lost\n",
+	"            in case of a shift.\n",
+	"        */\n",
+	"        @@prefix_alloc_stack( pcb );\n",
+	"        pcb-&gt;tos++;\n",
+	"\n",
+	"        next = pcb-&gt;buf[ pcb-&gt;len ];\n",
+	"        pcb-&gt;buf[ pcb-&gt;len ] = '\\0';\n",
+	"\n",
+	"        @@prefix_scan_match( pcb );\n",
+	"\n",
+	"        pcb-&gt;buf[ pcb-&gt;len ] = next;\n",
+	"\n",
+	"        pcb-&gt;tos--;\n",
+	"#endif /* UNICC_SEMANTIC_TERM_SEL */\n",
+	"@@endif\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG	&gt; 1\n",
+	"fprintf( stderr, \"%s: lex: function exits, pcb-&gt;sym = %d, pcb-&gt;len = %d\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;sym, pcb-&gt;len );\n",
+	"#endif\n",
+	"}\n",
+	"@@endif\n",
+	"\n",
+	"UNICC_STATIC int @@prefix_get_sym( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    pcb-&gt;sym = -1;\n",
+	"    pcb-&gt;len = 0;\n",
+	"\n",
+	"@@if skip-whitespace\n",
+	"    do\n",
+	"    {\n",
+	"@@endif\n",
+	"@@if !mode\n",
+	"\n",
+	"#if UNICC_DEBUG &gt; 2\n",
+	"        fprintf( stderr, \"%s: get sym: state = %d dfa_select = %d\\n\",\n",
+	"                    UNICC_PARSER, pcb-&gt;tos-&gt;state,\n",
+	"                        UNICC_DFA_SELECT( pcb-&gt;tos-&gt;state ) );\n",
+	"#endif\n",
+	"\n",
+	"        if( UNICC_DFA_SELECT( pcb-&gt;tos-&gt;state ) &gt; -1 )\n",
+	"            @@prefix_lex( pcb );\n",
+	"        /*\n",
+	"         * If there is no DFA state machine,\n",
+	"         * try to identify the end-of-file symbol.\n",
+	"         * If this also fails, a parse error will\n",
+	"         * raise.\n",
+	"         */\n",
+	"        else if( @@prefix_get_input( pcb, 0 ) == pcb-&gt;eof )\n",
+	"            pcb-&gt;sym = @@eof;\n",
+	"@@else\n",
+	"        @@prefix_lex( pcb );\n",
+	"@@endif\n",
+	"\n",
+	"@@if skip-whitespace\n",
+	"\n",
+	"        if( pcb-&gt;sym &gt; -1 &amp;&amp; @@prefix_symbols[ pcb-&gt;sym ].whitespace )\n",
+	"        {\n",
+	"            UNICC_CLEARIN( pcb );\n",
+	"            continue;\n",
+	"        }\n",
+	"\n",
+	"        break;\n",
+	"    }\n",
+	"    while( 1 );\n",
+	"@@endif\n",
+	"\n",
+	"    return ( pcb-&gt;sym &gt; -1 ) \? 1 : 0;\n",
+	"}\n",
+	"\n",
+	"#if UNICC_STACKDEBUG\n",
+	"UNICC_STATIC void @@prefix_dbg_stack( FILE* out,\n",
+	"    @@prefix_tok* stack, @@prefix_tok* tos )\n",
+	"{\n",
+	"    fprintf( out, \"%s: Stack Dump: \", UNICC_PARSER );\n",
+	"\n",
+	"    for( ; stack &lt;= tos; stack++ )\n",
+	"    {\n",
+	"        fprintf( out, \"%d%s%s%s \", stack-&gt;state,\n",
+	"            stack-&gt;symbol \? \" (\" : \"\",\n",
+	"            stack-&gt;symbol \? stack-&gt;symbol-&gt;name : \"\",\n",
+	"            stack-&gt;symbol \? \")\" : \"\" );\n",
+	"    }\n",
+	"\n",
+	"    fprintf( out, \"\\n\" );\n",
+	"}\n",
+	"#endif /* UNICC_STACKDEBUG */\n",
+	"\n",
+	"UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )\n",
+	"{\n",
+	"#if UNICC_DEBUG\n",
+	"    int					i;\n",
+	"#endif\n",
+	"\n",
+	"    if( !pcb-&gt;error_delay )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: !!!PARSE ERROR!!!\\n\"\n",
+	"                \"%s: error recovery: current token %d (%s)\\n\",\n",
+	"                    UNICC_PARSER, UNICC_PARSER, pcb-&gt;sym,\n",
+	"                        ( ( pcb-&gt;sym &gt;= 0 ) \?\n",
+	"                            @@prefix_symbols[ pcb-&gt;sym ].name :\n",
+	"                                \"(null)\" ) );\n",
+	"\n",
+	"        fprintf( @@prefix_dbg,\n",
+	"                \"%s: error recovery: expecting \", UNICC_PARSER );\n",
+	"\n",
+	"@@if comb-tables\n",
+	"        for( i = 0; i &lt; UNICC_TERMINALS; i++ )\n",
+	"        {\n",
+	"            if( @@prefix_act_check[ UNICC_ACT_SLOT( pcb-&gt;tos-&gt;state, i ) ]\n",
+	"                    == pcb-&gt;tos-&gt;state )\n",
+	"                fprintf( @@prefix_dbg, \"%d (%s), \",\n",
+	"                    i, @@prefix_symbols[ i ].name );\n",
+	"        }\n",
+	"@@else\n",
+	"        for( i = 1; i &lt; UNICC_ACT( pcb-&gt;tos-&gt;state, 0 ) * 3; i += 3 )\n",
+	"        {\n",
+	"            fprintf( @@prefix_dbg, \"%d (%s)%s\",\n",
+	"                UNICC_ACT( pcb-&gt;tos-&gt;state, i ),\n",
+	"                @@prefix_symbols[ UNICC_ACT( pcb-&gt;tos-&gt;state, i ) ].name,\n",
+	"                ( i == UNICC_ACT( pcb-&gt;tos-&gt;state, 0 ) * 3 - 3 ) \?\n",
+	"                        \"\\n\" : \", \" );\n",
+	"        }\n",
+	"@@endif\n",
+	"\n",
+	"        fprintf( @@prefix_dbg, \"\\n%s: error recovery: error_delay is %d, %s\\n\",\n",
+	"                    UNICC_PARSER, pcb-&gt;error_delay,\n",
+	"                    ( pcb-&gt;error_delay \? \"error recovery runs silently\" :\n",
+	"                        \"error is reported before its recover!\" ) );\n",
+	"#endif\n",
+	"    }\n",
+	"\n",
+	"@@if !error-token\n",
+	"    /* No error token defined\? Then exit here... */\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg,\n",
+	"        \"%s: error recovery: No error resync token used by grammar, \"\n",
+	"            \"exiting parser.\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"\n",
+	"    UNICC_PARSE_ERROR( pcb );\n",
+	"    pcb-&gt;error_count++;\n",
+	"\n",
+	"    return 1;\n",
+	"@@else\n",
+	"    /*\n",
+	"    @@prefix_pcb 		org_pcb;\n",
+	"    */\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"        \"trying to recover...\\n\", UNICC_PARSER );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"    @@prefix_dbg_stack( @@prefix_dbg, pcb-&gt;stack, pcb-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"    #if 0\n",
+	"    /* Create a copy of original parser control block (maybe later...) */\n",
+	"    memcpy( &amp;org_pcb, pcb, sizeof( @@prefix_pcb ) );\n",
+	"    org_pcb.buf = (char*)malloc( ( strlen( pcb-&gt;buf ) / UNICC_MALLOCSTEP +\n",
+	"                    ( !( strlen( pcb-&gt;buf ) % UNICC_MALLOCSTEP ) \? 1 : 0 ) )\n",
+	"                            * UNICC_MALLOCSTEP );\n",
+	"    strcpy( org_pcb.buf, pcb-&gt;buf );\n",
+	"    #endif\n",
+	"\n",
+	"    /* Remember previous symbol, or discard it */\n",
+	"    if( pcb-&gt;error_delay != UNICC_ERROR_DELAY )\n",
+	"        pcb-&gt;old_sym = pcb-&gt;sym;\n",
+	"    else\n",
+	"    {\n",
+	"        pcb-&gt;old_sym = -1;\n",
+	"        pcb-&gt;len = 1;\n",
+	"        UNICC_CLEARIN( pcb );\n",
+	"    }\n",
+	"\n",
+	"    /* Try to shift on error resync */\n",
+	"    pcb-&gt;sym = @@error;\n",
+	"\n",
+	"    while( pcb-&gt;tos &gt;= pcb-&gt;stack )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: error recovery: in state %d, trying \"\n",
+	"                \"to shift error resync token...\\n\",\n",
+	"                    UNICC_PARSER, pcb-&gt;tos-&gt;state );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"        @@prefix_dbg_stack( @@prefix_dbg, pcb-&gt;stack, pcb-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"        if( @@prefix_get_act( pcb ) )\n",
+	"        {\n",
+	"            /* Shift */\n",
+	"            if( pcb-&gt;act &amp; UNICC_SHIFT )\n",
+	"            {\n",
+	"#if UNICC_DEBUG\n",
+	"                fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                            \"error resync shifted\\n\", UNICC_PARSER );\n",
+	"#endif\n",
+	"                break;\n",
+	"            }\n",
+	"        }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: error recovery: failed, \"\n",
+	"                    \"discarding token '%s'\\n\", UNICC_PARSER,\n",
+	"                        pcb-&gt;tos-&gt;symbol \?\n",
+	"                            pcb-&gt;tos-&gt;symbol-&gt;name : \"NULL\" );\n",
+	"#endif\n",
+	"\n",
+	"        /* Discard one token from stack */\n",
+	"        /* TODO: Discarded token memory (semantic action) */\n",
+	"        pcb-&gt;tos--;\n",
+	"    }\n",
+	"\n",
+	"    if( pcb-&gt;tos &lt;= pcb-&gt;stack )\n",
+	"    {\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"Can't recover this issue, stack is empty.\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"        UNICC_PARSE_ERROR( pcb );\n",
+	"        pcb-&gt;error_count++;\n",
+	"\n",
+	"        return 1;\n",
+	"    }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"trying to continue with modified parser state\\n\",\n",
+	"                    UNICC_PARSER );\n",
+	"#endif\n",
+	"\n",
+	"    pcb-&gt;error_delay = UNICC_ERROR_DELAY + 1;\n",
+	"\n",
+	"    return 0;\n",
+	"\n",
+	"@@endif\n",
+	"}\n",
+	"\n",
+	"@@goal-type @@prefix_parse( @@prefix_pcb* pcb )\n",
+	"{\n",
+	"    @@goal-type			ret;\n",
+	"@@if ast-construction\n",
+	"    int					i;\n",
+	"\n",
+	"    @@prefix_ast*		node;\n",
+	"    @@prefix_ast*		lnode;\n",
+	"@@endif\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"    @@prefix_vtype*		vptr;\n",
+	"    FILE* 				@@prefix_dbg;\n",
+	"\n",
+	"    @@prefix_dbg = stderr;\n",
+	"#endif\n",
+	"\n",
+	"    /* If there is no Parser Control Block given, allocate your own one! */\n",
+	"    if( !pcb )\n",
+	"    {\n",
+	"        if( !( pcb = (@@prefix_pcb*)malloc( sizeof( @@prefix_pcb ) ) ) )\n",
+	"        {\n",
+	"            /* Can't allocate memory */\n",
+	"            UNICC_OUTOFMEM( pcb );\n",
+	"            return (@@goal-type)0;\n",
+	"        }\n",
+	"\n",
+	"        memset( pcb, 0, sizeof( @@prefix_pcb ) );\n",
+	"        pcb-&gt;is_internal = 1;\n",
+	"    }\n",
+	"    else\n",
+	"        pcb-&gt;is_internal = 0;\n",
+	"\n",
+	"    /* Initialize Parser Control Block */\n",
+	"    pcb-&gt;stacksize = 0;\n",
+	"    if( @@prefix_alloc_stack( pcb ) &lt; 0 )\n",
+	"        return (@@goal-type)0;\n",
+	"\n",
+	"    memset( pcb-&gt;tos, 0, sizeof( @@prefix_tok ) );\n",
+	"\n",
+	"    pcb-&gt;act = UNICC_SHIFT;\n",
+	"    pcb-&gt;sym = -1;\n",
+	"    pcb-&gt;old_sym = -1;\n",
+	"    pcb-&gt;line = 1;\n",
+	"    pcb-&gt;column = 1;\n",
+	"\n",
+	"    memset( &amp;pcb-&gt;test, 0, sizeof( @@prefix_vtype ) );\n",
+	"\n",
+	"    /* Begin of main parser loop */\n",
+	"    while( 1 )\n",
+	"    {\n",
+	"        /* Reduce */\n",
+	"        while( pcb-&gt;act &amp; UNICC_REDUCE )\n",
+	"        {\n",
+	"#if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: &lt;&lt; \"\n",
+	"                    \"reducing by production %d (%s)\\n\",\n",
+	"                        UNICC_PARSER, pcb-&gt;idx,\n",
+	"                            @@prefix_productions[ pcb-&gt;idx ].definition );\n",
+	"#endif\n",
+	"            /* Set default left-hand side */\n",
+	"            pcb-&gt;lhs = @@prefix_productions[ pcb-&gt;idx ].lhs;\n",
+	"\n",
+	"            /* Run reduction code */\n",
+	"            memset( &amp;( pcb-&gt;ret ), 0, sizeof( @@prefix_vtype ) );\n",
+	"\n",
+	"            @@prefix_reduce( pcb );\n",
+	"\n",
+	"@@if ast-construction\n",
+	"            /* Drop right-hand side */\n",
+	"            /* TODO: Destructor callbacks\? */\n",
+	"            for( i = 0, node = (@@prefix_ast*)NULL;\n",
+	"                    i &lt; @@prefix_productions[ pcb-&gt;idx ].length;\n",
+	"                        i++ )\n",
+	"            {\n",
+	"                if( pcb-&gt;tos-&gt;node )\n",
+	"                {\n",
+	"                    if( node )\n",
+	"                    {\n",
+	"                        while( node-&gt;prev )\n",
+	"                            node = node-&gt;prev;\n",
+	"\n",
+	"                        node-&gt;prev = pcb-&gt;tos-&gt;node;\n",
+	"                        pcb-&gt;tos-&gt;node-&gt;next = node;\n",
+	"                    }\n",
+	"\n",
+	"                    node = pcb-&gt;tos-&gt;node;\n",
+	"                    pcb-&gt;tos-&gt;node = (@@prefix_ast*)NULL;\n",
+	"                }\n",
+	"\n",
+	"                pcb-&gt;tos--;\n",
+	"            }\n",
+	"\n",
+	"\n",
+	"            if( node )\n",
+	"            {\n",
+	"                if( ( lnode = pcb-&gt;tos-&gt;node ) )\n",
+	"                {\n",
+	"                    while( lnode-&gt;next )\n",
+	"                        lnode = lnode-&gt;next;\n",
+	"\n",
+	"                    lnode-&gt;next = node;\n",
+	"                    node-&gt;prev = lnode;\n",
+	"                }\n",
+	"                else\n",
+	"                    pcb-&gt;tos-&gt;node = node;\n",
+	"            }\n",
+	"\n",
+	"            if( *@@prefix_productions[ pcb-&gt;idx ].emit )\n",
+	"            {\n",
+	"                if( ( node = @@prefix_ast_create( pcb,\n",
+	"                                @@prefix_productions[ pcb-&gt;idx ].emit,\n",
+	"                                    (UNICC_SCHAR*)NULL ) ) )\n",
+	"                {\n",
+	"                    node-&gt;child = pcb-&gt;tos-&gt;node;\n",
+	"                    pcb-&gt;tos-&gt;node = node;\n",
+	"                }\n",
+	"            }\n",
+	"@@else\n",
+	"            /* Drop right-hand side; There is no AST construction */\n",
+	"            pcb-&gt;tos -= @@prefix_productions[ pcb-&gt;idx ].length;\n",
+	"@@endif\n",
+	"\n",
+	"            /* Enforced error in semantic actions\? */\n",
+	"            if( pcb-&gt;act == UNICC_ERROR )\n",
+	"                break;\n",
+	"\n",
+	"            /* Goal symbol reduced, and stack is empty\? */\n",
+	"            if( pcb-&gt;lhs == @@goal &amp;&amp; pcb-&gt;tos == pcb-&gt;stack )\n",
+	"            {\n",
+	"                memcpy( &amp;( pcb-&gt;tos-&gt;value ), &amp;( pcb-&gt;ret ),\n",
+	"                            sizeof( @@prefix_vtype ) );\n",
+	"                pcb-&gt;ast = pcb-&gt;tos-&gt;node;\n",
+	"\n",
+	"                UNICC_CLEARIN( pcb );\n",
+	"\n",
+	"                pcb-&gt;act = UNICC_SUCCESS;\n",
+	"\n",
+	"                #if UNICC_DEBUG\n",
+	"                fprintf( stderr, \"%s: goal symbol reduced, exiting parser\\n\",\n",
+	"                        UNICC_PARSER );\n",
+	"                #endif\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: after reduction, \"\n",
+	"                        \"shifting nonterminal %d (%s)\\n\",\n",
+	"                            UNICC_PARSER, pcb-&gt;lhs,\n",
+	"                                @@prefix_symbols[ pcb-&gt;lhs ].name );\n",
+	"            #endif\n",
+	"\n",
+	"            @@prefix_get_go( pcb );\n",
+	"\n",
+	"            pcb-&gt;tos++;\n",
+	"            pcb-&gt;tos-&gt;node = (@@prefix_ast*)NULL;\n",
+	"\n",
+	"            memcpy( &amp;( pcb-&gt;tos-&gt;value ), &amp;( pcb-&gt;ret ),\n",
+	"                        sizeof( @@prefix_vtype ) );\n",
+	"            pcb-&gt;tos-&gt;symbol = &amp;( @@prefix_symbols[ pcb-&gt;lhs ] );\n",
+	"            pcb-&gt;tos-&gt;state = ( pcb-&gt;act &amp; UNICC_REDUCE ) \? -1 : pcb-&gt;idx;\n",
+	"#if UNICC_LINE_INFO\n",
+	"            pcb-&gt;tos-&gt;line = pcb-&gt;line;\n",
+	"            pcb-&gt;tos-&gt;column = pcb-&gt;column;\n",
+	"#endif\n",
+	"        }\n",
+	"\n",
+	"        if( pcb-&gt;act == UNICC_SUCCESS || pcb-&gt;act == UNICC_ERROR )\n",
+	"            break;\n",
+	"\n",
+	"@@if error-token\n",
+	"        /* If in error recovery, replace old-symbol */\n",
+	"        if( pcb-&gt;error_delay == UNICC_ERROR_DELAY\n",
+	"                &amp;&amp; ( pcb-&gt;sym = pcb-&gt;old_sym ) &lt; 0 )\n",
+	"        {\n",
+	"            /* If symbol is invalid, try to find new token */\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"old token invalid, requesting new token\\n\",\n",
+	"                        UNICC_PARSER );\n",
+	"            #endif\n",
+	"\n",
+	"            while( !@@prefix_get_sym( pcb ) )\n",
+	"            {\n",
+	"                /* Skip one character */\n",
+	"                pcb-&gt;len = 1;\n",
+	"\n",
+	"                UNICC_CLEARIN( pcb );\n",
+	"            }\n",
+	"\n",
+	"            #if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: error recovery: \"\n",
+	"                \"new token %d (%s)\\n\", UNICC_PARSER, pcb-&gt;sym,\n",
+	"                    @@prefix_symbols[ pcb-&gt;sym ].name );\n",
+	"            #endif\n",
+	"        }\n",
+	"        else\n",
+	"        {\n",
+	"            @@prefix_get_sym( pcb );\n",
+	"        }\n",
+	"@@else\n",
+	"        @@prefix_get_sym( pcb );\n",
+	"@@endif\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg, \"%s: current token %d (%s)\\n\",\n",
+	"                    UNICC_PARSER, pcb-&gt;sym,\n",
+	"                        ( pcb-&gt;sym &lt; 0 ) \? \"(null)\" :\n",
+	"                            @@prefix_symbols[ pcb-&gt;sym ].name );\n",
+	"#endif\n",
+	"\n",
+	"        /* Get action table entry */\n",
+	"        if( !@@prefix_get_act( pcb ) )\n",
+	"        {\n",
+	"            /* Error state, try to recover */\n",
+	"            if( @@prefix_handle_error( pcb,\n",
+	"#if UNICC_DEBUG\n",
+	"                    @@prefix_dbg\n",
+	"#else\n",
+	"                    (FILE*)NULL\n",
+	"#endif\n",
+	"                    ) )\n",
+	"                break;\n",
+	"        }\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"        fprintf( @@prefix_dbg,\n",
+	"            \"%s: sym = %d (%s) [len = %d] tos-&gt;state = %d act = %s idx = %d\\n\",\n",
+	"                UNICC_PARSER, pcb-&gt;sym,\n",
+	"                    ( ( pcb-&gt;sym &gt;= 0 ) \?\n",
+	"                        @@prefix_symbols[ pcb-&gt;sym ].name :\n",
+	"                            \"(invalid symbol id)\" ),\n",
+	"                    pcb-&gt;len, pcb-&gt;tos-&gt;state,\n",
+	"                        ( ( pcb-&gt;act == UNICC_SHIFT &amp; UNICC_REDUCE ) \?\n",
+	"                                \"shift/reduce\" :\n",
+	"                            ( pcb-&gt;act &amp; UNICC_SHIFT ) \?\n",
+	"                                    \"shift\" : \"reduce\" ), pcb-&gt;idx );\n",
+	"#if UNICC_STACKDEBUG\n",
+	"        @@prefix_dbg_stack( @@prefix_dbg, pcb-&gt;stack, pcb-&gt;tos );\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"        /* Shift */\n",
+	"        if( pcb-&gt;act &amp; UNICC_SHIFT )\n",
+	"        {\n",
+	"            pcb-&gt;next = pcb-&gt;buf[ pcb-&gt;len ];\n",
+	"            pcb-&gt;buf[ pcb-&gt;len ] = '\\0';\n",
+	"\n",
+	"#if UNICC_DEBUG\n",
+	"            fprintf( @@prefix_dbg, \"%s: &gt;&gt; shifting terminal %d (%s)\\n\",\n",
+	"            UNICC_PARSER, pcb-&gt;sym, @@prefix_symbols[ pcb-&gt;sym ].name );\n",
+	"#endif\n",
+	"\n",
+	"            if( @@prefix_alloc_stack( pcb ) &lt; 0 )\n",
+	"                return (@@goal-type)0;\n",
+	"\n",
+	"            pcb-&gt;tos++;\n",
+	"            pcb-&gt;tos-&gt;node = (@@prefix_ast*)NULL;\n",
+	"\n",
+	"@@if scanner-actions\n",
+	"            /* Execute scanner actions */\n",
+	"            @@prefix_scan_shift( pcb );\n",
+	"@@else\n",
+	"            @@top-value = @@prefix_get_input( pcb, 0 );\n",
+	"@@endif\n",
+	"\n",
+	"            pcb-&gt;tos-&gt;state = ( pcb-&gt;act &amp; UNICC_REDUCE ) \? -1 : pcb-&gt;idx;\n",
+	"            pcb-&gt;tos-&gt;symbol = &amp;( @@prefix_symbols[ pcb-&gt;sym ] );\n",
+	"#if UNICC_LINE_INFO\n",
+	"            pcb-&gt;tos-&gt;line = pcb-&gt;line;\n",
+	"            pcb-&gt;tos-&gt;column = pcb-&gt;column;\n",
+	"#endif\n",
+	"\n",
+	"@@if ast-construction\n",
+	"            if( *pcb-&gt;tos-&gt;symbol-&gt;emit )\n",
+	"                pcb-&gt;tos-&gt;node = @@prefix_ast_create( pcb,\n",
+	"                                    pcb-&gt;tos-&gt;symbol-&gt;emit,\n",
+	"                                        @@prefix_lexem( pcb ) );\n",
+	"@@endif\n",
+	"\n",
+	"            pcb-&gt;buf[ pcb-&gt;len ] = pcb-&gt;next;\n",
+	"\n",
+	"            /* Perform the shift on input */\n",
+	"@@if error-token\n",
+	"            if( pcb-&gt;sym != @@eof &amp;&amp; pcb-&gt;sym != @@error )\n",
+	"            {\n",
+	"                UNICC_CLEARIN( pcb );\n",
+	"                pcb-&gt;old_sym = -1;\n",
+	"            }\n",
+	"\n",
+	"            if( pcb-&gt;error_delay )\n",
+	"                pcb-&gt;error_delay--;\n",
+	"@@else\n",
+	"            if( pcb-&gt;sym != @@eof )\n",
+	"                UNICC_CLEARIN( pcb );\n",
+	"@@endif\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    #if UNICC_DEBUG\n",
+	"    fprintf( @@prefix_dbg, \"%s: parse completed with %d errors\\n\",\n",
+	"        UNICC_PARSER, pcb-&gt;error_count );\n",
+	"    #endif\n",
+	"\n",
+	"    /* Save return value */\n",
+	"    ret = @@goal-value;\n",
+	"\n",
+	"    /* Clean up parser control block */\n",
+	"    free( pcb-&gt;buf );\n",
+	"    free( pcb-&gt;stack );\n",
+	"#if UNICC_UTF8\n",
+	"    free( pcb-&gt;lexem );\n",
+	"#endif\n",
+	"\n",
+	"    /* Clean memory of self-allocated parser control block */\n",
+	"    if( pcb-&gt;is_internal )\n",
+	"        free( pcb );\n",
+	"\n",
+	"    return ret;\n",
+	"}\n",
+	"\n",
+	"@@epilogue\n",
+	"\n",
+	"/* Create Main\? */\n",
+	"#if @@epilogue_len == 0\n",
+	"    #ifndef UNICC_MAIN\n",
+	"    #define UNICC_MAIN 	1\n",
+	"    #endif\n",
+	"#else\n",
+	"    #ifndef UNICC_MAIN\n",
+	"    #define UNICC_MAIN 	0\n",
+	"    #endif\n",
+	"#endif\n",
+	"\n",
+	"#if UNICC_MAIN\n",
+	"\n",
+	"int main( int argc, char** argv )\n",
+	"{\n",
+	"#define UNICCMAIN_SILENT		1\n",
+	"#define UNICCMAIN_ENDLESS		2\n",
+	"#define UNICCMAIN_LINEMODE		4\n",
+	"#define UNICCMAIN_SYNTAXTREE	8\n",
+	"#define UNICCMAIN_AUGSYNTAXTREE	16\n",
+	"\n",
+	"    char*			opt;\n",
+	"    int				flags	= 0;\n",
+	"    int				i;\n",
+	"    @@prefix_pcb	pcb;\n",
+	"\n",
+	"#ifdef LC_ALL\n",
+	"    setlocale( LC_ALL, \"\" );\n",
+	"#endif\n",
+	"\n",
+	"    /* Get command-line options */\n",
+	"    for( i = 1; i &lt; argc; i++ )\n",
+	"    {\n",
+	"        if( *(argv[i]) == '-' )\n",
+	"        {\n",
+	"            opt = argv[i] + 1;\n",
+	"\n",
+	"            /* Long option coming\? */\n",
+	"            if( *opt == '-' )\n",
+	"            {\n",
+	"                opt++;\n",
+	"\n",
+	"                if( !strcmp( opt, \"silent\" ) )\n",
+	"                    flags |= UNICCMAIN_SILENT;\n",
+	"                else if( !strcmp( opt, \"endless\" ) )\n",
+	"                    flags |= UNICCMAIN_ENDLESS;\n",
+	"                else if( !strcmp( opt, \"line-mode\" ) )\n",
+	"                    flags |= UNICCMAIN_LINEMODE;\n",
+	"                else\n",
+	"                {\n",
+	"                    fprintf( stderr, \"Unknown option '--%s'\\n\", argv[i] );\n",
+	"                    return 1;\n",
+	"                }\n",
+	"            }\n",
+	"\n",
+	"            for( ; *opt; opt++ )\n",
+	"            {\n",
+	"                if( *opt == 's' )\n",
+	"                    flags |= UNICCMAIN_SILENT;\n",
+	"                else if( *opt == 'e' )\n",
+	"                    flags |= UNICCMAIN_ENDLESS;\n",
+	"                else if( *opt == 'l' )\n",
+	"                    flags |= UNICCMAIN_LINEMODE;\n",
+	"                else\n",
+	"                {\n",
+	"                    fprintf( stderr, \"Unknown option '-%c'\\n\", *opt );\n",
+	"                    return 1;\n",
+	"                }\n",
+	"            }\n",
+	"        }\n",
+	"    }\n",
+	"\n",
+	"    /* Parser invocation loop */\n",
+	"    do\n",
+	"    {\n",
+	"        if( !( flags &amp; UNICCMAIN_SILENT ) )\n",
+	"            printf( \"\\nok\\n\" );\n",
+	"\n",
+	"        /* Invoke parser */\n",
+	"        memset( &amp;pcb, 0, sizeof( @@prefix_pcb ) );\n",
+	"\n",
+	"        if( flags &amp; UNICCMAIN_LINEMODE )\n",
+	"            pcb.eof = '\\n';\n",
+	"        else\n",
+	"            pcb.eof = EOF;\n",
+	"\n",
+	"        @@prefix_parse( &amp;pcb );\n",
+	"\n",
+	"        /* Print AST */\n",
+	"        if( pcb.ast )\n",
+	"        {\n",
+	"            @@prefix_ast_print( stderr, pcb.ast );\n",
+	"            @@prefix_ast_free( pcb.ast );\n",
+	"        }\n",
+	"    }\n",
+	"    while( flags &amp; UNICCMAIN_ENDLESS );\n",
+	"\n",
+	"    return 0;\n",
+	"}\n",
+	"#endif\n",
+	"</section>\n",
+	"\n",
+	"    <file filename=\"@@basename.c\" split=\"no\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"/* Include parser control block definitions */\n",
+	"#include \"@@basename.h\"\n",
+	"\n",
+	"/* Functions and tables shared between the parts of the parser */\n",
+	"#define UNICC_INTERN			UNICC_STATIC\n",
+	"\n",
+	"@@tables-section\n",
+	"@@access-section\n",
+	"@@support-section\n",
+	"@@actions-section\n",
+	"@@scanner-section\n",
+	"@@driver-section</file>\n",
+	"<file filename=\"@@basename_int.h\" split=\"yes\">/*\n",
+	"    Internal parser header generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#ifndef @@CBASENAME_INT_H\n",
+	"#define @@CBASENAME_INT_H\n",
+	"\n",
+	"#if @@prologue_len == 0\n",
+	"#include &lt;stdlib.h&gt;\n",
+	"#include &lt;stdio.h&gt;\n",
+	"#include &lt;string.h&gt;\n",
+	"#include &lt;locale.h&gt;\n",
+	"#else\n",
+	"@@prologue\n",
+	"#endif\n",
+	"\n",
+	"/* Include parser control block definitions */\n",
+	"#include \"@@basename.h\"\n",
+	"\n",
+	"/* Functions and tables shared between the translation units */\n",
+	"#define UNICC_INTERN\n",
+	"\n",
+	"@@if comb-tables\n",
+	"extern @@action-base-type @@prefix_act_base[ @@number-of-states ];\n",
+	"extern @@action-check-type @@prefix_act_check[ @@action-comb-size ];\n",
+	"extern @@action-next-type @@prefix_act_next[ @@action-comb-size ];\n",
+	"extern @@goto-base-type @@prefix_go_base[ @@number-of-states ];\n",
+	"extern @@goto-check-type @@prefix_go_check[ @@goto-comb-size ];\n",
+	"extern @@goto-next-type @@prefix_go_next[ @@goto-comb-size ];\n",
+	"@@endif\n",
+	"@@if packed-tables\n",
+	"@@if !comb-tables\n",
+	"extern const unsigned char @@prefix_act[];\n",
+	"extern const unsigned char @@prefix_go[];\n",
+	"@@endif\n",
+	"extern const unsigned char @@prefix_def_prod[];\n",
+	"@@if !mode\n",
+	"extern const unsigned char @@prefix_dfa_select[];\n",
+	"@@endif\n",
+	"@@if lexers\n",
+	"extern const unsigned char @@prefix_dfa_idx[];\n",
+	"extern const unsigned char @@prefix_dfa_chars[];\n",
+	"extern const unsigned char @@prefix_dfa_trans[];\n",
+	"extern const unsigned char @@prefix_dfa_accept[];\n",
+	"@@if case-folding\n",
+	"extern const unsigned char @@prefix_dfa_fold[];\n",
+	"@@endif\n",
+	"@@if shared-lexers\n",
+	"extern const unsigned char @@prefix_dfa_mask[];\n",
+	"@@endif\n",
+	"@@endif\n",
+	"@@else\n",
+	"@@if !comb-tables\n",
+	"extern @@action-table-type @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ];\n",
+	"extern @@goto-table-type @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ];\n",
+	"@@endif\n",
+	"extern @@default-productions-type @@prefix_def_prod[ @@number-of-states ];\n",
+	"@@if !mode\n",
+	"extern @@dfa-select-type @@prefix_dfa_select[ @@number-of-states ];\n",
+	"@@endif\n",
+	"@@if lexers\n",
+	"extern @@dfa-index-type @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ];\n",
+	"extern @@dfa-char-type @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ];\n",
+	"extern @@dfa-trans-type @@prefix_dfa_trans[ @@size-of-dfa-characters ];\n",
+	"extern @@dfa-accept-type @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ];\n",
+	"@@if case-folding\n",
+	"extern @@dfa-fold-type @@prefix_dfa_fold[ @@number-of-dfa-machines ];\n",
+	"@@endif\n",
+	"@@if shared-lexers\n",
+	"extern @@dfa-mask-type @@prefix_dfa_mask[ @@number-of-states ][ @@dfa-mask-width ];\n",
+	"@@endif\n",
+	"@@endif\n",
+	"@@endif\n",
+	"\n",
+	"extern @@prefix_syminfo @@prefix_symbols[];\n",
+	"extern @@prefix_prodinfo @@prefix_productions[];\n",
+	"\n",
+	"@@access-section\n",
+	"extern UNICC_SCHAR* @@prefix_lexem( @@prefix_pcb* pcb );\n",
+	"extern UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset );\n",
+	"extern void @@prefix_reduce( @@prefix_pcb* pcb );\n",
+	"@@if lexers\n",
+	"@@if scanner-actions\n",
+	"#if UNICC_SEMANTIC_TERM_SEL\n",
+	"extern void @@prefix_scan_match( @@prefix_pcb* pcb );\n",
+	"#endif\n",
+	"@@endif\n",
+	"@@endif\n",
+	"@@if scanner-actions\n",
+	"extern void @@prefix_scan_shift( @@prefix_pcb* pcb );\n",
+	"@@endif\n",
+	"\n",
+	"#endif /* @@CBASENAME_INT_H */\n",
+	"</file>\n",
+	"<file filename=\"@@basename_tables.c\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#include \"@@basename_int.h\"\n",
+	"\n",
+	"@@tables-section</file>\n",
+	"<file filename=\"@@basename_actions.c\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#include \"@@basename_int.h\"\n",
+	"\n",
+	"@@actions-section</file>\n",
+	"<file filename=\"@@basename_scanner.c\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#include \"@@basename_int.h\"\n",
+	"\n",
+	"@@scanner-section</file>\n",
+	"<file filename=\"@@basename_parser.c\" split=\"yes\">/*\n",
+	"    This parser module was generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#include \"@@basename_int.h\"\n",
+	"\n",
+	"@@support-section\n",
+	"@@driver-section</file>\n",
+	"<file filename=\"@@basename.mk\" split=\"yes\"># Translation units of the parser generated by unicc from @@filename.\n",
+	"# DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"\n",
+	"@@Cbasename_SOURCES = @@basename_tables.c @@basename_actions.c \\\n",
+	"    @@basename_scanner.c @@basename_parser.c\n",
+	"@@Cbasename_HEADERS = @@basename.h @@basename_int.h\n",
+	"@@Cbasename_OBJECTS = $(@@Cbasename_SOURCES:.c=.o)\n",
+	"</file>\n",
+	"<file filename=\"@@basename.h\">/*\n",
+	"    Parser header generated by unicc from @@filename.\n",
+	"    DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"*/\n",
+	"\n",
+	"#ifndef @@CBASENAME_H\n",
+	"#define @@CBASENAME_H\n",
+	"\n",
+	"/* Wide character processing enabled\? */\n",
+	"#ifndef UNICC_WCHAR\n",
+	"#define UNICC_WCHAR					0\n",
+	"#endif\n",
+	"\n",
+	"/* UTF-8 processing enabled\? */\n",
+	"#if !UNICC_WCHAR\n",
+	"#ifndef UNICC_UTF8\n",
+	"#	define UNICC_UTF8				1\n",
+	"#endif\n",
+	"#else\n",
+	"#	ifdef UNICC_UTF8\n",
+	"#	undef UNICC_UTF8\n",
+	"#	endif\n",
+	"#	define UNICC_UTF8				0\n",
+	"#endif\n",
+	"\n",
+	"/* UNICC_CHAR is used as character type for internal processing */\n",
+	"#ifndef UNICC_CHAR\n",
+	"#if UNICC_UTF8 || UNICC_WCHAR\n",
+	"#	define UNICC_CHAR				wchar_t\n",
+	"#	define UNICC_CHAR_FORMAT		\"%S\"\n",
+	"#else\n",
+	"#	define UNICC_CHAR				char\n",
+	"#	define UNICC_CHAR_FORMAT		\"%s\"\n",
+	"#endif\n",
+	"#endif /* UNICC_CHAR */\n",
+	"\n",
+	"/* UNICC_SCHAR defines the character type for semantic action procession */\n",
+	"#ifndef UNICC_SCHAR\n",
+	"#if UNICC_WCHAR\n",
+	"#	define UNICC_SCHAR				wchar_t\n",
+	"#	define UNICC_SCHAR_FORMAT		\"%S\"\n",
+	"#else\n",
+	"#	define UNICC_SCHAR				char\n",
+	"#	define UNICC_SCHAR_FORMAT		\"%s\"\n",
+	"#endif\n",
+	"#endif /* UNICC_SCHAR */\n",
+	"\n",
+	"/* Boolean */\n",
+	"#ifndef UNICC_BOOLEAN\n",
+	"#define UNICC_BOOLEAN			short\n",
+	"#endif\n",
+	"\n",
+	"/* Debug level */\n",
+	"#ifndef UNICC_DEBUG\n",
+	"#define UNICC_DEBUG				0\n",
+	"#endif\n",
+	"\n",
+	"/* Stack debug switch */\n",
+	"#ifndef UNICC_STACKDEBUG\n",
+	"#define UNICC_STACKDEBUG		0\n",
+	"#endif\n",
+	"\n",
+	"/* Line and column counting, if used by the grammar's semantic code */\n",
+	"#ifndef UNICC_LINE_INFO\n",
+	"#define UNICC_LINE_INFO			@@line-info\n",
+	"#endif\n",
+	"\n",
+	"/* Parse error macro; The default one reports line and column if counted */\n",
+	"#ifndef UNICC_PARSE_ERROR\n",
+	"#if UNICC_LINE_INFO\n",
+	"#define UNICC_PARSE_ERROR( pcb ) \\\n",
+	"    fprintf( stderr, \"line %d, column %d: syntax error on symbol %d, token '\" \\\n",
+	"        UNICC_SCHAR_FORMAT \"'\\n\", \\\n",
+	"    ( pcb )-&gt;line, ( pcb )-&gt;column, pcb-&gt;sym, @@prefix_lexem( pcb ) )\n",
+	"#else\n",
+	"#define UNICC_PARSE_ERROR( pcb ) \\\n",
+	"    fprintf( stderr, \"syntax error on symbol %d, token '\" \\\n",
+	"        UNICC_SCHAR_FORMAT \"'\\n\", \\\n",
+	"    pcb-&gt;sym, @@prefix_lexem( pcb ) )\n",
+	"#endif\n",
+	"#endif\n",
+	"\n",
+	"/* Input buffering clean-up */\n",
+	"#ifndef UNICC_CLEARIN\n",
+	"#define UNICC_CLEARIN( pcb )		@@prefix_clear_input( pcb )\n",
+	"#endif\n",
+	"\n",
+	"/*TODO:*/\n",
+	"#ifndef UNICC_NO_INPUT_BUFFER\n",
+	"#define UNICC_NO_INPUT_BUFFER	0\n",
+	"#endif\n",
+	"\n",
+	"/* Memory allocation step size for dynamic stack- and buffer allocation */\n",
+	"#ifndef UNICC_MALLOCSTEP\n",
+	"#define UNICC_MALLOCSTEP		128\n",
+	"#endif\n",
+	"\n",
+	"/* Call this when running out of memory during memory allocation */\n",
+	"#ifndef UNICC_OUTOFMEM\n",
+	"#define UNICC_OUTOFMEM( pcb )	fprintf( stderr, \\\n",
+	"                                    \"Fatal error, ran out of memory\\n\" ), \\\n",
+	"                                exit( 1 )\n",
+	"#endif\n",
+	"\n",
+	"/* Static switch */\n",
+	"#ifndef UNICC_STATIC\n",
+	"#define UNICC_STATIC			static\n",
+	"#endif\n",
+	"\n",
+	"#ifdef UNICC_PARSER\n",
+	"#undef UNICC_PARSER\n",
+	"#endif\n",
+	"#define UNICC_PARSER			\"@@prefix\" \"debug\"\n",
+	"\n",
+	"/* Don't change next three defines below! */\n",
+	"#ifndef UNICC_ERROR\n",
+	"#define UNICC_ERROR				0\n",
+	"#endif\n",
+	"#ifndef UNICC_REDUCE\n",
+	"#define UNICC_REDUCE			1\n",
+	"#endif\n",
+	"#ifndef UNICC_SHIFT\n",
+	"#define UNICC_SHIFT				2\n",
+	"#endif\n",
+	"#ifndef UNICC_SUCCESS\n",
+	"#define UNICC_SUCCESS			4\n",
+	"#endif\n",
+	"\n",
+	"/* Error delay after recovery */\n",
+	"#ifndef UNICC_ERROR_DELAY\n",
+	"#define UNICC_ERROR_DELAY		3\n",
+	"#endif\n",
+	"\n",
+	"/* Enable/Disable terminal selection in semantic actions */\n",
+	"#ifndef UNICC_SEMANTIC_TERM_SEL\n",
+	"#define UNICC_SEMANTIC_TERM_SEL	0\n",
+	"#endif\n",
+	"\n",
+	"/* Value Types */\n",
+	"@@value-type-definition\n",
+	"\n",
+	"/* Typedef for symbol information table */\n",
+	"typedef struct\n",
+	"{\n",
+	"    char*			name;\n",
+	"    char*			emit;\n",
+	"    short			type;\n",
+	"    UNICC_BOOLEAN	lexem;\n",
+	"    UNICC_BOOLEAN	whitespace;\n",
+	"    UNICC_BOOLEAN	greedy;\n",
+	"} @@prefix_syminfo;\n",
+	"\n",
+	"/* Typedef for production information table */\n",
+	"typedef struct\n",
+	"{\n",
+	"    char*	definition;\n",
+	"    char*	emit;\n",
+	"    int		length;\n",
+	"    int		lhs;\n",
+	"} @@prefix_prodinfo;\n",
+	"\n",
+	"/* Abstract Syntax Tree */\n",
+	"typedef struct @@prefix_AST @@prefix_ast;\n",
+	"\n",
+	"struct @@prefix_AST\n",
+	"{\n",
+	"    char*			emit;\n",
+	"    UNICC_SCHAR*	token;\n",
+	"\n",
+	"    @@prefix_ast*	parent;\n",
+	"    @@prefix_ast*	child;\n",
+	"    @@prefix_ast*	prev;\n",
+	"    @@prefix_ast*	next;\n",
+	"};\n",
+	"\n",
+	"/* Stack Token */\n",
+	"typedef struct\n",
+	"{\n",
+	"    @@prefix_vtype		value;\n",
+	"    @@prefix_ast*		node;\n",
+	"\n",
+	"    @@prefix_syminfo*	symbol;\n",
+	"\n",
+	"    int					state;\n",
+	"    unsigned int		line;\n",
+	"    unsigned int		column;\n",
+	"} @@prefix_tok;\n",
+	"\n",
+	"\n",
+	"/* Parser Control Block */\n",
+	"typedef struct\n",
+	"{\n",
+	"    /* Is this PCB allocated by parser\? */\n",
+	"    char				is_internal;\n",
+	"\n",
+	"    /* Stack */\n",
+	"    @@prefix_tok*		stack;\n",
+	"    @@prefix_tok*		tos;\n",
+	"\n",
+	"    /* Stack size */\n",
+	"    unsigned int		stacksize;\n",
+	"\n",
+	"    /* Values */\n",
+	"    @@prefix_vtype		ret;\n",
+	"    @@prefix_vtype		test;\n",
+	"\n",
+	"    /* State */\n",
+	"    int					act;\n",
+	"    int					idx;\n",
+	"    int					lhs;\n",
+	"\n",
+	"    /* Lookahead */\n",
+	"    int					sym;\n",
+	"    int					old_sym;\n",
+	"    unsigned int		len;\n",
+	"\n",
+	"    /* Input buffering */\n",
+	"    UNICC_SCHAR*		lexem;\n",
+	"    UNICC_CHAR*			buf;\n",
+	"    UNICC_CHAR*			bufend;\n",
+	"    UNICC_CHAR*			bufsize;\n",
+	"\n",
+	"    /* Lexical analysis */\n",
+	"    UNICC_CHAR			next;\n",
+	"    UNICC_CHAR			eof;\n",
+	"    UNICC_BOOLEAN		is_eof;\n",
+	"\n",
+	"    /* Error handling */\n",
+	"    int					error_delay;\n",
+	"    int					error_count;\n",
+	"\n",
+	"    unsigned int		line;\n",
+	"    unsigned int		column;\n",
+	"\n",
+	"    /* Abstract Syntax Tree */\n",
+	"    @@prefix_ast*		ast;\n",
+	"\n",
+	"    /* User-defined components */\n",
+	"    @@pcb\n",
+	"\n",
+	"} @@prefix_pcb;\n",
+	"\n",
+	"#endif /* @@CBASENAME_H */\n",
+	"</file>\n",
+	"</generator>\n",
+	(char*)NULL
+};
+
+static char*	stock_target_2[] =
+{
+	"<\?xml version=\"1.0\" standalone=\"yes\"\?>\n",
+	"<generator name=\"JavaScript\">\n",
+	"    <code_localization />\n",
+	"	<!--\n",
+	"	****************************************************************************\n",
+	"	Boolean values\n",
+	"	****************************************************************************\n",
+	"	-->\n",
+	"	<true>true</true>\n",
+	"	<false>false</false>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Escape sequences\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- Backslash must be double-quoted -->\n",
+	"    <escape-sequence for=\"\\\" do=\"\\\\\" />\n",
+	"    <!-- Escape double quotation marks -->\n",
+	"    <escape-sequence for=\"&#x22;\" do=\"\\&#x22;\" />\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Value-stack templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <vstack_def_type>any</vstack_def_type>\n",
+	"    <vstack_term_type>any</vstack_term_type>\n",
+	"    <vstack_union_att>@@value-type-id</vstack_union_att>\n",
+	"    <vstack_union_def>@@attribute: null, </vstack_union_def>\n",
+	"    <vstack_single>value: null</vstack_single>\n",
+	"    <vstack_union_start>value: {</vstack_union_start>\n",
+	"    <vstack_union_end>}</vstack_union_end>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <action_start>parse_@@production-number() {\n",
+	"</action_start>\n",
+	"    <action_end>	;\n",
+	"}\n",
+	"\n",
+	"</action_end>\n",
+	"\n",
+	"    <action_single>this.stack[ this.stack.length - ( @@offset + 1 ) ].value</action_single>\n",
+	"\n",
+	"    <action_union>this.stack[ this.stack.length - ( @@offset + 1 ) ].value.@@attribute</action_union>\n",
+	"    <action_lhs_single>this.ret</action_lhs_single>\n",
+	"    <action_lhs_union>this.ret.@@attribute</action_lhs_union>\n",
+	"\n",
+	"    <action_set_lhs>this.lhs = @@sym</action_set_lhs>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Semantic terminal action templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <scan_action_start>scan_@@production-number() {\n",
+	"</scan_action_start>\n",
+	"    <scan_action_end>	;\n",
+	"}\n",
+	"\n",
+	"</scan_action_end>\n",
+	"\n",
+	"    <scan_action_begin_offset>this.buf</scan_action_begin_offset>\n",
+	"    <scan_action_end_offset>this.len</scan_action_end_offset>\n",
+	"    <scan_action_ret_single>this.tos.value</scan_action_ret_single>\n",
+	"    <scan_action_ret_union>this.tos.value.@@attribute</scan_action_ret_union>\n",
+	"\n",
+	"    <scan_action_set_symbol>( this.sym = @@sym )</scan_action_set_symbol>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Parse table templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <defprod>\n",
+	"        <col>            @@production-number</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </defprod>\n",
+	"\n",
+	"    <acttab>\n",
+	"        <row_start>            {</row_start>\n",
+	"        <row_end>&#x0A;            }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@symbol: [@@action, @@index]</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </acttab>\n",
+	"\n",
+	"    <gotab>\n",
+	"        <row_start>            {</row_start>\n",
+	"        <row_end>&#x0A;            }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@symbol: [@@action, @@index]</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </gotab>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Lexer\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <dfa_select>\n",
+	"        <col>            @@machine</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_select>\n",
+	"\n",
+	"    <dfa_char>\n",
+	"        <col>            @@from, @@to</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_char>\n",
+	"\n",
+	"    <dfa_trans>\n",
+	"        <col>            @@goto</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_trans>\n",
+	"\n",
+	"    <dfa_idx>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>&#x0A;            ]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@index</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </dfa_idx>\n",
+	"\n",
+	"    <dfa_accept>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>&#x0A;            ]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@accept</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </dfa_accept>\n",
+	"\n",
+	"    <dfa_fold>\n",
+	"        <col>            @@fold</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_fold>\n",
+	"\n",
+	"    <dfa_mask>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>@@mask</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_mask>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Symbol and production information tables\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <symbols>\n",
+	"        <col>            {\n",
+	"                \"symbol\": \"@@symbol-name\",\n",
+	"                \"emit\": \"@@emit\",\n",
+	"                \"is-terminal\": @@type,\n",
+	"                \"is-lexem\": @@lexem,\n",
+	"                \"is-whitespace\": @@whitespace,\n",
+	"                \"is-greedy\": @@greedy\n",
+	"            }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </symbols>\n",
+	"\n",
+	"    <productions>\n",
+	"        <col>            {\n",
+	"                \"production\": \"@@production\",\n",
+	"                \"emit\": \"@@emit\",\n",
+	"                \"length\": @@length,\n",
+	"                \"left-hand-side\": @@lhs\n",
+	"            }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </productions>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    JavaScript program\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"<file filename=\"@@basename.js\">// This parser module was generated by unicc from @@filename.\n",
+	"// DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"@@prologue\n",
+	"\n",
+	"class @@prefixNode {\n",
+	"    constructor(emit, match, children) {\n",
+	"        this.emit = emit;\n",
+	"        this.match = match;\n",
+	"        this.children = children;\n",
+	"    }\n",
+	"\n",
+	"    dump(level) {\n",
+	"        if( level === undefined )\n",
+	"            level = 0;\n",
+	"\n",
+	"        if( this.emit !== undefined ) {\n",
+	"            let txt = this.emit;\n",
+	"\n",
+	"            for( let i = 0; i &lt; level; i++ )\n",
+	"                txt = \" \" + txt;\n",
+	"\n",
+	"            if( this.match &amp;&amp; this.match !== this.emit )\n",
+	"                txt += \" (\" + this.match + \")\";\n",
+	"\n",
+	"            console.log(txt);\n",
+	"            level++;\n",
+	"        }\n",
+	"\n",
+	"        if( this.children ) {\n",
+	"            for( let child of this.children )\n",
+	"                if( Boolean( child ) )\n",
+	"                    child.dump(level);\n",
+	"        }\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"class @@prefixParserToken {\n",
+	"    constructor() {\n",
+	"        this.state = 0;\n",
+	"        this.line = 0;\n",
+	"        this.column = 0;\n",
+	"\n",
+	"        this.node = null;\n",
+	"\n",
+	"        @@value-type-definition\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"// Defining a custom exception for parse errors\n",
+	"class @@prefixParseError extends Error {\n",
+	"    constructor(line, column, expecting) {\n",
+	"        super(`${line}:${column} Parse error, expecting '${expecting.join(\"', '\")}'`);\n",
+	"        this.line = line;\n",
+	"        this.column = column;\n",
+	"        this.expecting = expecting;\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"// Parser Control Block is used to handle parser states\n",
+	"class @@prefixParserControlBlock {\n",
+	"    constructor() {\n",
+	"        // Stack\n",
+	"        this.stack = [];\n",
+	"        this.tos = null;\n",
+	"\n",
+	"        // Values\n",
+	"        this.ret = null;\n",
+	"\n",
+	"        // State\n",
+	"        this.act = null;\n",
+	"        this.idx = null;\n",
+	"        this.lhs = null;\n",
+	"\n",
+	"        // Lookahead\n",
+	"        this.sym = -1;\n",
+	"        this.old_sym = -1;\n",
+	"        this.len = 0;\n",
+	"\n",
+	"        // Lexical analysis\n",
+	"        this.lexem = null;\n",
+	"        this.next = null;\n",
+	"        this.eof = null;\n",
+	"        this.is_eof = false;\n",
+	"\n",
+	"        // Input buffering\n",
+	"        this.input = null;\n",
+	"        this.buf = \"\";\n",
+	"\n",
+	"        // Error handling\n",
+	"        this.error_delay = 3;\n",
+	"        this.error_count = 0;\n",
+	"\n",
+	"        this.line = 1;\n",
+	"        this.column = 1;\n",
+	"\n",
+	"        // User-defined\n",
+	"        @@pcb\n",
+	"    }\n",
+	"\n",
+	"    get top() {\n",
+	"        return @@top-value;\n",
+	"    }\n",
+	"\n",
+	"    set top(value) {\n",
+	"        @@top-value = value;\n",
+	"    }\n",
+	"\n",
+	"    // Parsing actions\n",
+	"\n",
+	"    @@scan_actions\n",
+	"    @@actions\n",
+	"}\n",
+	"\n",
+	"// Parser\n",
+	"\n",
+	"export default class @@prefixParser {\n",
+	"    static #grammar = {\n",
+	"        \"symbols\": [\n",
+	"@@symbols\n",
+	"        ],\n",
+	"        \"productions\": [\n",
+	"@@productions\n",
+	"        ],\n",
+	"        \"goal\": @@goal\n",
+	"    };\n",
+	"\n",
+	"    static #lexer = {\n",
+	"        \"select\": [\n",
+	"@@dfa-select\n",
+	"        ],\n",
+	"        \"index\": [\n",
+	"@@dfa-index\n",
+	"        ],\n",
+	"        \"chars\": [\n",
+	"@@dfa-char\n",
+	"        ],\n",
+	"        \"transitions\": [\n",
+	"@@dfa-trans\n",
+	"        ],\n",
+	"        \"accept\": [\n",
+	"@@dfa-accept\n",
+	"        ],\n",
+	"@@if case-folding\n",
+	"        \"fold\": [\n",
+	"@@dfa-fold\n",
+	"        ],\n",
+	"@@endif\n",
+	"        \"mask\": [\n",
+	"@@dfa-mask\n",
+	"        ]\n",
+	"    };\n",
+	"    static #parser = {\n",
+	"        \"action\": [\n",
+	"@@action-table\n",
+	"        ],\n",
+	"        \"goto\": [\n",
+	"@@goto-table\n",
+	"        ],\n",
+	"        \"default-production\": [\n",
+	"@@default-productions\n",
+	"        ]\n",
+	"    };\n",
+	"\n",
+	"    // Get character\n",
+	"    static #get_char(pcb) {\n",
+	"        // Get next character from input stream\n",
+	"        if( typeof pcb.input === \"function\" )\n",
+	"            return pcb.input();\n",
+	"\n",
+	"        let ch = pcb.eof;\n",
+	"\n",
+	"        if( pcb.input.length > 0 ) {\n",
+	"            ch = pcb.input[0];\n",
+	"            pcb.input = pcb.input.slice(1);\n",
+	"        }\n",
+	"\n",
+	"        return ch;\n",
+	"    }\n",
+	"\n",
+	"    static #get_input(pcb, offset) {\n",
+	"        // Input buffering\n",
+	"        while( offset &gt;= pcb.buf.length ) {\n",
+	"            if( pcb.is_eof )\n",
+	"                return pcb.eof;\n",
+	"\n",
+	"            let ch = this.#get_char(pcb);\n",
+	"            if( ch === pcb.eof ) {\n",
+	"                pcb.is_eof = true;\n",
+	"                return pcb.eof;\n",
+	"            }\n",
+	"\n",
+	"            pcb.buf += ch;\n",
+	"        }\n",
+	"\n",
+	"        //console.log(\"#get_input %s, %d, %s, %d\", pcb.buf, offset, pcb.buf.charAt(offset), pcb.buf.charCodeAt(offset))\n",
+	"\n",
+	"        return pcb.buf.charCodeAt(offset);\n",
+	"    }\n",
+	"\n",
+	"    static #clear_input(pcb) {\n",
+	"        // Purge input from buffer that is not necessary anymore\n",
+	"\n",
+	"        if( pcb.buf.length ) {\n",
+	"            // Perform position counting.\n",
+	"            for( let pos = 0; pos &lt;= pcb.len; pos++ ) {\n",
+	"                if( pcb.buf[pos] === '\\n' ) {\n",
+	"                    pcb.line++;\n",
+	"                    pcb.column = 0;\n",
+	"                }\n",
+	"                else\n",
+	"                    pcb.column++;\n",
+	"            }\n",
+	"\n",
+	"            pcb.buf = pcb.buf.slice( pcb.len );\n",
+	"        }\n",
+	"\n",
+	"        pcb.len = 0;\n",
+	"        pcb.sym = -1;\n",
+	"    }\n",
+	"\n",
+	"    static #lex(pcb) {\n",
+	"        // Perform lexical analysis\n",
+	"        let state = 0, length = 0;\n",
+	"\n",
+	"        let machine = Boolean(@@mode) \? 0 : this.#lexer[\"select\"][pcb.tos.state];\n",
+	"@@if case-folding\n",
+	"        let fold = Boolean(this.#lexer[\"fold\"][machine]);\n",
+	"@@endif\n",
+	"        let mask = Boolean(@@shared-lexers) \? this.#lexer[\"mask\"][pcb.tos.state] : null;\n",
+	"        let next = this.#get_input(pcb, length);\n",
+	"\n",
+	"@@if case-folding\n",
+	"        // Map upper-case letters into lower-case ones on case-folding DFAs\n",
+	"        if( fold &amp;&amp; next &gt;= 0x41 &amp;&amp; next &lt;= 0x5A )\n",
+	"            next += 0x20;\n",
+	"@@endif\n",
+	"\n",
+	"        if( next === pcb.eof ) {\n",
+	"            pcb.sym = @@eof;\n",
+	"            return;\n",
+	"        }\n",
+	"\n",
+	"        while( state &gt; -1 &amp;&amp; next !== pcb.eof ) {\n",
+	"            let idx = this.#lexer[\"index\"][machine][state];\n",
+	"            state = -1;\n",
+	"\n",
+	"            while( this.#lexer[\"chars\"][idx * 2] &gt; -1 ) {\n",
+	"                if( next &gt;= this.#lexer[\"chars\"][idx * 2]\n",
+	"                        &amp;&amp; next &lt;= this.#lexer[\"chars\"][idx * 2 + 1] ) {\n",
+	"\n",
+	"                    length++;\n",
+	"                    state = this.#lexer[\"transitions\"][idx];\n",
+	"\n",
+	"                    let accept = this.#lexer[\"accept\"][machine][state] - 1;\n",
+	"\n",
+	"                    // With shared lexers, only accept terminals valid in this state\n",
+	"                    if( accept &gt; -1 &amp;&amp; ( !mask || mask[accept &gt;&gt; 3] &amp; ( 1 &lt;&lt; ( accept &amp; 7 ) ) ) ) {\n",
+	"                        pcb.sym = accept;\n",
+	"                        pcb.len = length;\n",
+	"\n",
+	"                        // Test! (\?\?)\n",
+	"                        if( pcb.sym === @@eof ) {\n",
+	"                            state = -1;\n",
+	"                            break;\n",
+	"                        }\n",
+	"\n",
+	"                        // Stop if matched symbol should be parsed nongreedy\n",
+	"                        if( !Boolean(this.#grammar[\"symbols\"][pcb.sym][\"is-greedy\"]) ) {\n",
+	"                            state = -1;\n",
+	"                            break;\n",
+	"                        }\n",
+	"                    }\n",
+	"\n",
+	"                    next = this.#get_input(pcb, length);\n",
+	"\n",
+	"@@if case-folding\n",
+	"                    if( fold &amp;&amp; next &gt;= 0x41 &amp;&amp; next &lt;= 0x5A )\n",
+	"                        next += 0x20;\n",
+	"@@endif\n",
+	"\n",
+	"                    break;\n",
+	"                }\n",
+	"\n",
+	"                idx++;\n",
+	"            }\n",
+	"\n",
+	"            // TODO: Semantic Terminal Selection\?\n",
+	"        }\n",
+	"\n",
+	"        //console.log(\"lex sym = %d, len = %d\", pcb.sym, pcb.len);\n",
+	"    }\n",
+	"\n",
+	"    static #get_sym(pcb) {\n",
+	"        // Get lookahead symbol\n",
+	"        pcb.sym = -1;\n",
+	"        pcb.len = 0;\n",
+	"\n",
+	"        // insensitive mode\n",
+	"        if( Boolean(@@mode) )\n",
+	"            while( true )\n",
+	"            {\n",
+	"                this.#lex(pcb);\n",
+	"\n",
+	"                // check for whitespace\n",
+	"                if( pcb.sym &gt; -1 &amp;&amp; Boolean(this.#grammar[\"symbols\"][pcb.sym][\"is-whitespace\"]) ) {\n",
+	"                    this.#clear_input(pcb);\n",
+	"                    continue;\n",
+	"                }\n",
+	"\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"        // sensitive mode\n",
+	"        else\n",
+	"            while( true )\n",
+	"            {\n",
+	"                if( this.#lexer[\"select\"][pcb.tos.state] &gt; -1 )\n",
+	"                    this.#lex(pcb);\n",
+	"\n",
+	"                // If there is no matching DFA state machine, try to identify\n",
+	"                // the end-of-file symbol. If this also fails, a parse error\n",
+	"                // will raise.\n",
+	"                else if( this.constructor.#get_input(pcb, 0) === pcb.eof )\n",
+	"                    pcb.sym = @@eof;\n",
+	"\n",
+	"                // check for skipped whitespace\n",
+	"                if( Boolean(@@skip-whitespace) &amp;&amp; pcb.sym &gt; -1\n",
+	"                        &amp;&amp; Boolean(this.#grammar[\"symbols\"][pcb.sym][\"is-whitespace\"]) ) {\n",
+	"                    this.#clear_input(pcb);\n",
+	"                    continue;\n",
+	"                }\n",
+	"\n",
+	"                break;\n",
+	"            }\n",
+	"\n",
+	"        return Boolean(pcb.sym &gt; -1);\n",
+	"    }\n",
+	"\n",
+	"    parse(s) {\n",
+	"        // Constants\n",
+	"        const ERROR		= 0;\n",
+	"        const REDUCE	= 1;\n",
+	"        const SHIFT		= 2;\n",
+	"        const SUCCESS	= 4;\n",
+	"\n",
+	"        // Start of parse function\n",
+	"        let pcb = new @@prefixParserControlBlock()\n",
+	"        pcb.input = s\n",
+	"        pcb.act = SHIFT;\n",
+	"\n",
+	"        pcb.tos = new @@prefixParserToken()\n",
+	"        pcb.stack.push(pcb.tos)\n",
+	"\n",
+	"        while( true ) {\n",
+	"            //console.log(\"state = %d\", pcb.tos.state);\n",
+	"\n",
+	"            // Reduce\n",
+	"            while( pcb.act &amp; REDUCE ) {\n",
+	"                // Set default left-hand side\n",
+	"                pcb.lhs = this.constructor.#grammar[\"productions\"][pcb.idx][\"left-hand-side\"];\n",
+	"\n",
+	"                //console.log(\"REDUCE idx = %d, prod = %s\", pcb.idx, this.constructor.#grammar[\"productions\"][pcb.idx][\"production\"]);\n",
+	"                // print(\"state\", pcb.tos.state);\n",
+	"\n",
+	"                // Call reduce function\n",
+	"                //console.log(\"CALL\", \"_reduce_action_%d\" % pcb.idx)\n",
+	"\n",
+	"                if( ( \"parse_\" + pcb.idx ) in pcb )\n",
+	"                    pcb[ \"parse_\" + pcb.idx ]();\n",
+	"\n",
+	"                // Drop right-hand side\n",
+	"                let cnodes = null, node = null;\n",
+	"\n",
+	"                for( let i = 0; i &lt; this.constructor.#grammar[\"productions\"][pcb.idx][\"length\"]; i++ ) {\n",
+	"                    let item = pcb.stack.pop();\n",
+	"\n",
+	"                    if( item.node )\n",
+	"                    {\n",
+	"                        if( cnodes === null )\n",
+	"                            cnodes = [];\n",
+	"\n",
+	"                        if( Array.isArray( item.node ) )\n",
+	"                            cnodes = item.node.concat(cnodes);\n",
+	"                        else\n",
+	"                            cnodes.unshift(item.node);\n",
+	"                    }\n",
+	"                }\n",
+	"\n",
+	"                pcb.tos = pcb.stack[pcb.stack.length - 1];\n",
+	"                pcb.tos.value = pcb.ret;\n",
+	"\n",
+	"                // Handle AST nodes\n",
+	"                if( Boolean( this.constructor.#grammar[\"productions\"][pcb.idx][\"emit\"] ) ) {\n",
+	"                    //console.log(\"%s = %s\", this.constructor.#grammar[\"productions\"][pcb.idx][\"production\"], this.#grammar[\"productions\"][pcb.idx][\"emit\"]);\n",
+	"                    node = new @@prefixNode(this.constructor.#grammar[\"productions\"][pcb.idx][\"emit\"], null, cnodes);\n",
+	"                }\n",
+	"\n",
+	"                // Goal symbol reduced, and stack is empty\?\n",
+	"                if( pcb.lhs === @@goal &amp;&amp; pcb.stack.length === 1 ) {\n",
+	"                    pcb.tos.node = node \? node : cnodes;\n",
+	"                    this.constructor.#clear_input(pcb);\n",
+	"                    pcb.act = SUCCESS;\n",
+	"                    break;\n",
+	"                }\n",
+	"\n",
+	"                // Get goto table entry\n",
+	"                pcb.act = this.constructor.#parser[\"goto\"][pcb.tos.state][pcb.lhs][0];\n",
+	"                pcb.idx = this.constructor.#parser[\"goto\"][pcb.tos.state][pcb.lhs][1];\n",
+	"\n",
+	"                pcb.tos = new @@prefixParserToken();\n",
+	"                pcb.stack.push(pcb.tos)\n",
+	"\n",
+	"                pcb.tos.symbol = this.constructor.#grammar[\"symbols\"][pcb.lhs];\n",
+	"                pcb.tos.state = pcb.act &amp; REDUCE \? -1 : pcb.idx;\n",
+	"                pcb.tos.value = pcb.ret;\n",
+	"\n",
+	"                pcb.tos.node = node \? node : cnodes;\n",
+	"                pcb.tos.value = pcb.ret;\n",
+	"\n",
+	"                pcb.tos.line = pcb.line;\n",
+	"                pcb.tos.column = pcb.column;\n",
+	"            }\n",
+	"\n",
+	"            if( pcb.act === SUCCESS || pcb.act === ERROR )\n",
+	"                break;\n",
+	"\n",
+	"            // Get next input symbol\n",
+	"            this.constructor.#get_sym(pcb);\n",
+	"\n",
+	"            //console.log(\"pcb.sym = %d (%s)\", pcb.sym, this.constructor.#grammar[\"symbols\"][pcb.sym][\"symbol\"]);\n",
+	"            //console.log(\"pcb.len = %d\", pcb.len);\n",
+	"\n",
+	"            // Get action table entry\n",
+	"            if( pcb.sym in this.constructor.#parser[\"action\"][pcb.tos.state] ) {\n",
+	"                pcb.act = this.constructor.#parser[\"action\"][pcb.tos.state][pcb.sym][0];\n",
+	"                pcb.idx = this.constructor.#parser[\"action\"][pcb.tos.state][pcb.sym][1];\n",
+	"            } else {\n",
+	"                // Otherwise, apply default production\n",
+	"                pcb.idx = this.constructor.#parser[\"default-production\"][pcb.tos.state];\n",
+	"\n",
+	"                if( pcb.idx &gt; -1 ) {\n",
+	"                    pcb.act = REDUCE;\n",
+	"                }\n",
+	"                else {\n",
+	"                    pcb.act = 0;\n",
+	"                }\n",
+	"            }\n",
+	"\n",
+	"            if( !pcb.act ) {\n",
+	"                throw new @@prefixParseError(\n",
+	"                    pcb.line,\n",
+	"                    pcb.column,\n",
+	"                    Object.keys(\n",
+	"                        this.constructor.#parser[\"action\"][pcb.tos.state]\n",
+	"                    ).map(sym => this.constructor.#grammar.symbols[sym].symbol).sort()\n",
+	"                );\n",
+	"            }\n",
+	"\n",
+	"            // Shift\n",
+	"            if( pcb.act &amp; SHIFT ) {\n",
+	"                //console.log(\"SHIFT sym = %d (%s)\", pcb.sym, this.constructor.#grammar[\"symbols\"][pcb.sym][\"symbol\"]);\n",
+	"\n",
+	"                pcb.tos = new @@prefixParserToken();\n",
+	"                pcb.stack.push(pcb.tos);\n",
+	"\n",
+	"                // Execute scanner actions, if existing.\n",
+	"                if( ( \"scan_\" + pcb.idx ) in pcb )\n",
+	"                    pcb[ \"parse_\" + pcb.idx ]();\n",
+	"\n",
+	"                pcb.tos.state = pcb.act &amp; REDUCE \? -1 : pcb.idx;\n",
+	"                pcb.tos.symbol = this.constructor.#grammar[\"symbols\"][pcb.sym];\n",
+	"\n",
+	"                pcb.tos.line = pcb.line;\n",
+	"                pcb.tos.column = pcb.column;\n",
+	"                pcb.top = pcb.buf.slice(0, pcb.len);\n",
+	"\n",
+	"                if( Boolean( pcb.tos.symbol[\"emit\"] ) )\n",
+	"                    pcb.tos.node = new @@prefixNode(pcb.tos.symbol[\"emit\"], pcb.top);\n",
+	"\n",
+	"                if( pcb.sym !== @@eof &amp;&amp; pcb.sym !== @@error ) {\n",
+	"                    this.constructor.#clear_input(pcb);\n",
+	"                    pcb.old_sym = -1\n",
+	"                }\n",
+	"            }\n",
+	"        }\n",
+	"\n",
+	"        if( !pcb.ret &amp;&amp; pcb.tos.node ) {\n",
+	"            if( Array.isArray( pcb.tos.node ) ) {\n",
+	"                if( pcb.tos.node.length &gt; 1 )\n",
+	"                    return new @@prefixNode(null, null, pcb.tos.node);\n",
+	"                else\n",
+	"                    return pcb.tos.node.pop();\n",
+	"            }\n",
+	"\n",
+	"            return pcb.tos.node;\n",
+	"        }\n",
+	"\n",
+	"        return pcb.ret;\n",
+	"    }\n",
+	"}\n",
+	"\n",
+	"@@epilogue\n",
+	"</file>\n",
+	"</generator>\n",
+	(char*)NULL
+};
+
+static char*	stock_target_3[] =
+{
+	"<\?xml version=\"1.0\" standalone=\"yes\"\?>\n",
+	"<generator name=\"JSON\">\n",
+	"    <true>true</true>\n",
+	"    <false>false</false>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Escape sequences\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <!-- Backslash must be double-quoted -->\n",
+	"    <escape-sequence for=\"\\\" do=\"\\\\\" />\n",
+	"    <!-- Escape double quotation marks -->\n",
+	"    <escape-sequence for=\"&#x22;\" do=\"\\&#x22;\" />\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Parse table templates\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <defprod>\n",
+	"        <col>            @@production-number</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </defprod>\n",
+	"\n",
+	"    <acttab>\n",
+	"        <row_start>            {</row_start>\n",
+	"        <row_end>&#x0A;            }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                \"@@symbol\": [@@action, @@index]</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </acttab>\n",
+	"\n",
+	"    <gotab>\n",
+	"        <row_start>            {</row_start>\n",
+	"        <row_end>&#x0A;            }</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                \"@@symbol\": [@@action, @@index]</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </gotab>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Lexer\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <dfa_select>\n",
+	"        <col>            @@machine</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_select>\n",
+	"\n",
+	"    <dfa_char>\n",
+	"        <col>            @@from, @@to</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_char>\n",
+	"\n",
+	"    <dfa_trans>\n",
+	"        <col>            @@goto</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_trans>\n",
+	"\n",
+	"    <dfa_idx>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>&#x0A;            ]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@index</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </dfa_idx>\n",
+	"\n",
+	"    <dfa_accept>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>&#x0A;            ]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>&#x0A;                @@accept</col>\n",
+	"        <col_sep>,</col_sep>\n",
+	"    </dfa_accept>\n",
+	"\n",
+	"    <dfa_fold>\n",
+	"        <col>            @@fold</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </dfa_fold>\n",
+	"\n",
+	"    <dfa_mask>\n",
+	"        <row_start>            [</row_start>\n",
+	"        <row_end>]</row_end>\n",
+	"        <row_sep>,&#x0A;</row_sep>\n",
+	"        <col>@@mask</col>\n",
+	"        <col_sep>, </col_sep>\n",
+	"    </dfa_mask>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    Symbol and production information tables\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"    <symbols>\n",
+	"        <col>            {\n",
+	"                \"symbol\": \"@@symbol-name\",\n",
+	"                \"emit\": \"@@emit\",\n",
+	"                \"is-terminal\": @@type,\n",
+	"                \"is-lexem\": @@lexem,\n",
+	"                \"is-whitespace\": @@whitespace,\n",
+	"                \"is-greedy\": @@greedy\n",
+	"            }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </symbols>\n",
+	"\n",
+	"    <productions>\n",
+	"        <col>            {\n",
+	"                \"production\": \"@@production\",\n",
+	"                \"emit\": \"@@emit\",\n",
+	"                \"length\": @@length,\n",
+	"                \"left-hand-side\": @@lhs\n",
+	"            }</col>\n",
+	"        <col_sep>,&#x0A;</col_sep>\n",
+	"    </productions>\n",
+	"\n",
+	"    <!--\n",
+	"    ****************************************************************************\n",
+	"    JSON-File\n",
+	"    ****************************************************************************\n",
+	"    -->\n",
+	"\n",
+	"<file filename=\"@@basename.json\">{\n",
+	"    \"grammar\": {\n",
+	"        \"symbols\": [\n",
+	"@@symbols\n",
+	"        ],\n",
+	"        \"productions\": [\n",
+	"@@productions\n",
+	"        ],\n",
+	"        \"goal\": @@goal\n",
+	"    },\n",
+	"    \"lexer\": {\n",
+	"        \"machine\": [\n",
+	"@@dfa-select\n",
+	"        ],\n",
+	"        \"indexes\": [\n",
+	"@@dfa-index\n",
+	"        ],\n",
+	"        \"chars\": [\n",
+	"@@dfa-char\n",
+	"        ],\n",
+	"        \"transitions\": [\n",
+	"@@dfa-trans\n",
+	"        ],\n",
+	"        \"accept\": [\n",
+	"@@dfa-accept\n",
+	"        ],\n",
+	"@@if case-folding\n",
+	"        \"fold\": [\n",
+	"@@dfa-fold\n",
+	"        ],\n",
+	"@@endif\n",
+	"        \"mask\": [\n",
+	"@@dfa-mask\n",
+	"        ]\n",
+	"    },\n",
+	"    \"parser\": {\n",
+	"        \"actions\": [\n",
+	"@@action-table\n",
+	"        ],\n",
+	"        \"gotos\": [\n",
+	"@@goto-table\n",
+	"        ],\n",
+	"        \"default_productions\": [\n",
+	"@@default-productions\n",
+	"        ]\n",
+	"    }\n",
+	"}\n",
+	"</file>\n",
+	"\n",
+	"</generator>\n",
+	(char*)NULL
+};
+
+static char*	stock_target_4[] =
+{
+	"<\?xml version=\"1.0\" standalone=\"yes\"\?>\n",
+	"<generator name=\"Python\">\n",
+	"    <true>True</true>\n",
+	"    <false>False</false>\n",
+	"    <escape-sequence for=\"\\\" do=\"\\\\\" />\n",
+	"    <escape-sequence for=\"&#x22;\" do=\"\\&#x22;\" />\n",
+	"\n",
+	"    <vstack_def_type>any</vstack_def_type>\n",
+	"    <vstack_term_type>any</vstack_term_type>\n",
+	"    <vstack_union_att>@@value-type-id</vstack_union_att>\n",
+	"    <vstack_union_def>@@attribute: None, </vstack_union_def>\n",
+	"    <vstack_single>value = None</vstack_single>\n",
+	"    <vstack_union_start>value = {</vstack_union_start>\n",
+	"    <vstack_union_end>}</vstack_union_end>\n",
+	"\n",
+	"    <action_start>    def _reduce_action_@@production-number(self, pcb):&#x0A;        </action_start>\n",
+	"    <action_end>&#x0A;        return&#x0A;&#x0A;</action_end>\n",
+	"    <action_single>pcb.stack[-1 - @@offset].value</action_single>\n",
+	"    <action_union>pcb.stack[-1 - @@offset].value[@@attribute]</action_union>\n",
+	"    <action_lhs_single>pcb.ret</action_lhs_single>\n",
+	"    <action_lhs_union>pcb.ret[@@attribute]</action_lhs_union>\n",
+	"\n",
+	"    <action_set_lhs>pcb.lhs = @@sym</action_set_lhs>\n",
+	"\n",
+	"    <scan_action_start>    def _scan_action_@@symbol-number(self, pcb, shift = True):&#x0A;        </scan_action_start>\n",
+	"    <scan_action_end>&#x0A;        return&#x0A;&#x0A;</scan_action_end>\n",
+	"    <scan_action_begin_offset>pcb.buf</scan_action_begin_offset>\n",
+	"    <scan_action_end_offset>pcb.len</scan_action_end_offset>\n",
+	"    <scan_action_ret_single>pcb.tos.value</scan_action_ret_single>\n",
+	"    <scan_action_ret_union>pcb.tos.value[@@attribute]</scan_action_ret_union>\n",
+	"    <scan_action_set_symbol>pcb.sym = @@sym</scan_action_set_symbol>\n",
+	"\n",
+	"    <defprod>\n",
+	"        <col>        @@production-number,&#x0A;</col>\n",
+	"    </defprod>\n",
+	"\n",
+	"    <acttab>\n",
+	"        <row_start>        (&#x0A;</row_start>\n",
+	"        <row_end>        ),&#x0A;</row_end>\n",
+	"        <col>            (@@symbol, @@action, @@index),&#x0A;</col>\n",
+	"    </acttab>\n",
+	"\n",
+	"    <gotab>\n",
+	"        <row_start>        (&#x0A;</row_start>\n",
+	"        <row_end>        ),&#x0A;</row_end>\n",
+	"        <col>            (@@symbol, @@action, @@index),&#x0A;</col>\n",
+	"    </gotab>\n",
+	"\n",
+	"    <dfa_select>\n",
+	"        <col>        @@machine,&#x0A;</col>\n",
+	"    </dfa_select>\n",
+	"\n",
+	"    <dfa_char>\n",
+	"        <col>        (@@from, @@to),&#x0A;</col>\n",
+	"    </dfa_char>\n",
+	"\n",
+	"    <dfa_trans>\n",
+	"        <col>        @@goto,&#x0A;</col>\n",
+	"    </dfa_trans>\n",
+	"\n",
+	"    <dfa_idx>\n",
+	"        <row_start>        (&#x0A;</row_start>\n",
+	"        <row_end>        ),&#x0A;</row_end>\n",
+	"        <col>            @@index,&#x0A;</col>\n",
+	"    </dfa_idx>\n",
+	"\n",
+	"    <dfa_accept>\n",
+	"        <row_start>        (&#x0A;</row_start>\n",
+	"        <row_end>        ),&#x0A;</row_end>\n",
+	"        <col>            @@accept,&#x0A;</col>\n",
+	"    </dfa_accept>\n",
+	"\n",
+	"    <dfa_fold>\n",
+	"        <col>        @@fold,&#x0A;</col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </dfa_fold>\n",
+	"\n",
+	"    <dfa_mask>\n",
+	"        <row_start>        (</row_start>\n",
+	"        <row_end>),&#x0A;</row_end>\n",
+	"        <row_sep></row_sep>\n",
+	"        <col>@@mask, </col>\n",
+	"        <col_sep></col_sep>\n",
+	"    </dfa_mask>\n",
+	"\n",
+	"    <symbols>\n",
+	"        <col>        (\"@@symbol-name\", \"@@emit\", @@type, @@lexem, @@whitespace, @@greedy),&#x0A;</col>\n",
+	"    </symbols>\n",
+	"\n",
+	"    <productions>\n",
+	"        <col>        (\"@@production\", \"@@emit\", @@length, @@lhs),&#x0A;</col>\n",
+	"    </productions>\n",
+	"\n",
+	"    <file filename=\"@@basename.py\">#!/usr/bin/env python\n",
+	"# -*- coding: utf-8 -*-\n",
+	"#\n",
+	"# This parser module was generated by unicc from @@filename.\n",
+	"# DO NOT EDIT THIS FILE MANUALLY, IT WILL GO AWAY!\n",
+	"#\n",
+	"@@prologue\n",
+	"\n",
+	"class @@prefixNode(object):\n",
+	"    \"\"\"\n",
+	"    This is an AST node.\n",
+	"\n",
+	"    Objects of this class are only created when the parser makes\n",
+	"    use of the AST node syntax.\n",
+	"    \"\"\"\n",
+	"\n",
+	"    def __init__(self, emit=None, match=None, children=None):\n",
+	"        self.emit = emit\n",
+	"        self.match = match\n",
+	"        self.children = children or []\n",
+	"\n",
+	"    def dump(self, level=0):\n",
+	"        if self.emit:\n",
+	"            txt = \"%s%s\" % (level * \" \", self.emit)\n",
+	"            if self.match and self.match != self.emit:\n",
+	"                txt += \" (%s)\" % self.match\n",
+	"\n",
+	"            print(txt)\n",
+	"            level += 1\n",
+	"\n",
+	"        for child in self.children:\n",
+	"            if child:\n",
+	"                child.dump(level)\n",
+	"\n",
+	"\n",
+	"class @@prefixParseException(Exception):\n",
+	"    \"\"\"\n",
+	"    Exception to be raised on a parse error.\n",
+	"    TODO: This might be replaced by SyntaxError builtin.\n",
+	"    \"\"\"\n",
+	"\n",
+	"    def __init__(self, row, col, txt=None):\n",
+	"        if isinstance(txt, list):\n",
+	"            expecting = txt\n",
+	"            txt = (\"Line %d, column %d: Parse error, expecting %s\" %\n",
+	"                   (row, col, \", \".join([(\"%r\" % symbol[0])\n",
+	"                                         for symbol in txt])))\n",
+	"        else:\n",
+	"            expecting = None\n",
+	"\n",
+	"        super(@@prefixParseException, self).__init__(txt)\n",
+	"\n",
+	"        self.row = row\n",
+	"        self.col = col\n",
+	"        self.expecting = expecting\n",
+	"\n",
+	"\n",
+	"class _@@prefixToken(object):\n",
+	"    \"\"\"\n",
+	"    Only used internally;\n",
+	"    Represents a token on the stack.\n",
+	"    \"\"\"\n",
+	"    state = 0\n",
+	"    line = 0\n",
+	"    column = 0\n",
+	"    node = None\n",
+	"    @@value-type-definition\n",
+	"\n",
+	"\n",
+	"class _@@prefixControlBlock(object):\n",
+	"    \"\"\"\n",
+	"    Only used internally;\n",
+	"    Represents the current parser state, and allows to\n",
+	"    run multiple parser threads within one @@prefixParser.\n",
+	"    \"\"\"\n",
+	"\n",
+	"    def __init__(self, input):\n",
+	"\n",
+	"        # Stack\n",
+	"        self.stack = []\n",
+	"        self.tos = None\n",
+	"\n",
+	"        # Values\n",
+	"        self.ret = None\n",
+	"\n",
+	"        # State\n",
+	"        self.act = 0\n",
+	"        self.idx = None\n",
+	"        self.lhs = None\n",
+	"\n",
+	"        # Lookahead\n",
+	"        self.sym = -1\n",
+	"        self.old_sym = -1\n",
+	"        self.len = 0\n",
+	"\n",
+	"        # Lexical analysis\n",
+	"        self.lexem = None\n",
+	"        self.next = None\n",
+	"        self.eof = None\n",
+	"        self.is_eof = None\n",
+	"\n",
+	"        # Input buffering\n",
+	"        self.input = input\n",
+	"        self.buf = \"\"\n",
+	"\n",
+	"        # Error handling\n",
+	"        self.error_delay = 3\n",
+	"        self.error_count = 0\n",
+	"\n",
+	"        self.line = 1\n",
+	"        self.column = 1\n",
+	"        @@pcb\n",
+	"\n",
+	"class @@prefixParser(object):\n",
+	"    \"\"\"\n",
+	"    Implements a LALR-Parser for @@name.\n",
+	"    Call @@prefixParser.parse() to start parsing a given string.\n",
+	"    \"\"\"\n",
+	"\n",
+	"    # Actions\n",
+	"    _ERROR = 0\n",
+	"    _REDUCE = 1\n",
+	"    _SHIFT = 2\n",
+	"    _SUCCESS = 4\n",
+	"\n",
+	"    # Parse tables\n",
+	"    _symbols = (\n",
+	"@@symbols\n",
+	"    )\n",
+	"    _productions = (\n",
+	"@@productions\n",
+	"    )\n",
+	"    _act = (\n",
+	"@@action-table\n",
+	"    )\n",
+	"    _go = (\n",
+	"@@goto-table\n",
+	"    )\n",
+	"\n",
+	"    _def_prod = (\n",
+	"@@default-productions\n",
+	"    )\n",
+	"\n",
+	"    # Lexical analysis\n",
+	"    _dfa_select = (\n",
+	"@@dfa-select\n",
+	"    )\n",
+	"    _dfa_index = (\n",
+	"@@dfa-index\n",
+	"    )\n",
+	"    _dfa_chars = (\n",
+	"@@dfa-char\n",
+	"    )\n",
+	"    _dfa_trans = (\n",
+	"@@dfa-trans\n",
+	"    )\n",
+	"    _dfa_accept = (\n",
+	"@@dfa-accept\n",
+	"    )\n",
+	"@@if case-folding\n",
+	"    _dfa_fold = (\n",
+	"@@dfa-fold\n",
+	"    )\n",
+	"@@endif\n",
+	"    _dfa_mask = (\n",
+	"@@dfa-mask\n",
+	"    )\n",
+	"\n",
+	"    # Parsing algorithm\n",
+	"\n",
+	"    def _get_act(self, pcb):\n",
+	"        # Get action table entry\n",
+	"\n",
+	"        # Check action table first\n",
+	"        for (sym, pcb.act, pcb.idx) in self._act[pcb.tos.state]:\n",
+	"            if sym == pcb.sym:\n",
+	"                return True if pcb.act else False  # enforced parse error\n",
+	"\n",
+	"        # Otherwise, apply default production\n",
+	"        pcb.idx = self._def_prod[pcb.tos.state]\n",
+	"        if pcb.idx &gt; -1:\n",
+	"            pcb.act = self._REDUCE\n",
+	"            return True\n",
+	"\n",
+	"        return False\n",
+	"\n",
+	"    def _get_go(self, pcb):\n",
+	"        # Get goto table entry\n",
+	"\n",
+	"        for (sym, pcb.act, pcb.idx) in self._go[pcb.tos.state]:\n",
+	"            if sym == pcb.lhs:\n",
+	"                return True\n",
+	"\n",
+	"        return False\n",
+	"\n",
+	"    def _get_char(self, pcb):\n",
+	"        # Get next character from input stream\n",
+	"\n",
+	"        if callable(pcb.input):\n",
+	"            return pcb.input()\n",
+	"\n",
+	"        if pcb.input:\n",
+	"            ch = pcb.input[0]\n",
+	"            pcb.input = pcb.input[1:]\n",
+	"        else:\n",
+	"            ch = pcb.eof\n",
+	"\n",
+	"        return ch\n",
+	"\n",
+	"    def _get_input(self, pcb, offset):\n",
+	"        # Performs input buffering\n",
+	"\n",
+	"        while offset &gt;= len(pcb.buf):\n",
+	"            if pcb.is_eof:\n",
+	"                return pcb.eof\n",
+	"\n",
+	"            ch = self._get_char(pcb)\n",
+	"            if ch == pcb.eof:\n",
+	"                pcb.is_eof = True\n",
+	"                return pcb.eof\n",
+	"\n",
+	"            pcb.buf += ch\n",
+	"\n",
+	"        # print(\"_get_input\", pcb.buf, offset, pcb.buf[offset], ord(pcb.buf[offset]))\n",
+	"\n",
+	"        return ord(pcb.buf[offset])\n",
+	"\n",
+	"    def _clear_input(self, pcb):\n",
+	"        # Purge input from buffer that is not necessary anymore\n",
+	"\n",
+	"        if pcb.buf:\n",
+	"\n",
+	"            # Perform position counting.\n",
+	"            for ch in pcb.buf[0: pcb.len]:\n",
+	"                if ch == '\\n':\n",
+	"                    pcb.line += 1\n",
+	"                    pcb.column = 0\n",
+	"                else:\n",
+	"                    pcb.column += 1\n",
+	"\n",
+	"            pcb.buf = pcb.buf[pcb.len:]\n",
+	"\n",
+	"        pcb.len = 0\n",
+	"        pcb.sym = -1\n",
+	"\n",
+	"    def _lex(self, pcb):\n",
+	"        # Lexical analysis\n",
+	"\n",
+	"        state = length = 0\n",
+	"        machine = self._dfa_select[pcb.tos.state] if not @@mode else 0\n",
+	"@@if case-folding\n",
+	"        fold = self._dfa_fold[machine]\n",
+	"@@endif\n",
+	"        mask = @@shared-lexers and self._dfa_mask[pcb.tos.state]\n",
+	"        next = self._get_input(pcb, length)\n",
+	"\n",
+	"@@if case-folding\n",
+	"        # map upper-case letters into lower-case ones on case-folding DFAs\n",
+	"        if fold and next is not None and ord(\"A\") &lt;= next &lt;= ord(\"Z\"):\n",
+	"            next += ord(\"a\") - ord(\"A\")\n",
+	"@@endif\n",
+	"\n",
+	"        if next == pcb.eof:\n",
+	"            pcb.sym = @@eof\n",
+	"            return\n",
+	"\n",
+	"        while state &gt; -1 and next != pcb.eof:\n",
+	"            idx = self._dfa_index[machine][state]\n",
+	"            state = -1\n",
+	"\n",
+	"            while self._dfa_chars[idx][0] &gt; -1:\n",
+	"                if (next &gt;= self._dfa_chars[idx][0]\n",
+	"                        and next &lt;= self._dfa_chars[idx][1]):\n",
+	"\n",
+	"                    length += 1\n",
+	"                    state = self._dfa_trans[idx]\n",
+	"\n",
+	"                    accept = self._dfa_accept[machine][state] - 1\n",
+	"\n",
+	"                    # with shared lexers, only accept terminals valid here\n",
+	"                    if accept &gt; -1 and (\n",
+	"                            not mask or mask[accept // 8] &amp; 1 &lt;&lt; accept % 8):\n",
+	"                        pcb.sym = accept\n",
+	"                        pcb.len = length\n",
+	"\n",
+	"                        # Test! (\?\?)\n",
+	"                        if pcb.sym == @@eof:\n",
+	"                            state = -1\n",
+	"                            break\n",
+	"\n",
+	"                        # Stop if matched symbol should be parsed nongreedy\n",
+	"                        if not self._symbols[pcb.sym][5]:\n",
+	"                            state = -1\n",
+	"                            break\n",
+	"\n",
+	"                    next = self._get_input(pcb, length)\n",
+	"\n",
+	"@@if case-folding\n",
+	"                    if fold and next is not None and ord(\"A\") &lt;= next &lt;= ord(\"Z\"):\n",
+	"                        next += ord(\"a\") - ord(\"A\")\n",
+	"@@endif\n",
+	"\n",
+	"                    break\n",
+	"\n",
+	"                idx += 1\n",
+	"\n",
+	"            # TODO: Semantic Terminal Selection\?\n",
+	"\n",
+	"        # print(\"_lex\", pcb.sym, pcb.len)\n",
+	"\n",
+	"    def _get_sym(self, pcb):\n",
+	"        # Get lookahead symbol\n",
+	"\n",
+	"        pcb.sym = -1\n",
+	"        pcb.len = 0\n",
+	"\n",
+	"        # insensitive mode\n",
+	"        if @@mode:\n",
+	"            while True:\n",
+	"                self._lex(pcb)\n",
+	"\n",
+	"                # check for whitespace\n",
+	"                if pcb.sym &gt; -1 and self._symbols[pcb.sym][4]:\n",
+	"                    self._clear_input(pcb)\n",
+	"                    continue\n",
+	"\n",
+	"                break\n",
+	"\n",
+	"        # sensitive mode\n",
+	"        else:\n",
+	"            while True:\n",
+	"                if self._dfa_select[pcb.tos.state] &gt; -1:\n",
+	"                    self._lex(pcb)\n",
+	"\n",
+	"                # If there is no matching DFA state machine, try to identify\n",
+	"                # the end-of-file symbol. If this also fails, a parse error\n",
+	"                # will raise.\n",
+	"                elif self._get_input(pcb, 0) == pcb.eof:\n",
+	"                    pcb.sym = @@eof\n",
+	"\n",
+	"                # check for skipped whitespace\n",
+	"                if @@skip-whitespace and pcb.sym &gt; -1 and self._symbols[pcb.sym][4]:\n",
+	"                    self._clear_input(pcb)\n",
+	"                    continue\n",
+	"\n",
+	"                break\n",
+	"\n",
+	"        return pcb.sym &gt; -1\n",
+	"\n",
+	"    def parse(self, s=None):\n",
+	"        if s is None:\n",
+	"            try:\n",
+	"                s = raw_input(\">\")\n",
+	"            except NameError:\n",
+	"                s = input(\">\")\n",
+	"\n",
+	"        pcb = _@@prefixControlBlock(s)\n",
+	"        pcb.act = self._SHIFT\n",
+	"\n",
+	"        pcb.tos = _@@prefixToken()\n",
+	"        pcb.stack.append(pcb.tos)\n",
+	"\n",
+	"        while True:\n",
+	"            # print(\"state = %d\" % pcb.tos.state)\n",
+	"\n",
+	"            # Reduce\n",
+	"            while pcb.act &amp; self._REDUCE:\n",
+	"\n",
+	"                # Set default left-hand side\n",
+	"                pcb.lhs = self._productions[pcb.idx][3]\n",
+	"\n",
+	"                # print(\"REDUCE\", pcb.idx, self._productions[pcb.idx][0])\n",
+	"                # print(\"state\", pcb.tos.state)\n",
+	"\n",
+	"                # Call reduce function\n",
+	"                # print(\"CALL\", \"_reduce_action_%d\" % pcb.idx)\n",
+	"                reduce_fn = getattr(self, \"_reduce_action_%d\" % pcb.idx, None)\n",
+	"                if reduce_fn:\n",
+	"                    reduce_fn(pcb)\n",
+	"\n",
+	"                # Drop right-hand side\n",
+	"                cnodes = None\n",
+	"                for _ in range(0, self._productions[pcb.idx][2]):\n",
+	"                    item = pcb.stack.pop()\n",
+	"\n",
+	"                    if item.node:\n",
+	"                        if cnodes is None:\n",
+	"                            cnodes = []\n",
+	"\n",
+	"                        if isinstance(item.node, list):\n",
+	"                            cnodes = item.node + cnodes\n",
+	"                        else:\n",
+	"                            cnodes.insert(0, item.node)\n",
+	"\n",
+	"                pcb.tos = pcb.stack[-1]\n",
+	"                pcb.tos.value = pcb.ret\n",
+	"\n",
+	"                # Handle AST nodes\n",
+	"                if self._productions[pcb.idx][1]:\n",
+	"                    # print(\"%s = %s\" % (self._productions[pcb.idx][0], self._productions[pcb.idx][1]))\n",
+	"                    node = @@prefixNode(self._productions[pcb.idx][1], children=cnodes)\n",
+	"                else:\n",
+	"                    node = None\n",
+	"\n",
+	"                # Error enforced by semantics\?\n",
+	"                if pcb.act == self._ERROR:\n",
+	"                    break\n",
+	"\n",
+	"                # Goal symbol reduced, and stack is empty\?\n",
+	"                if pcb.lhs == @@goal and len(pcb.stack) == 1:\n",
+	"                    pcb.tos.node = node or cnodes\n",
+	"                    self._clear_input(pcb)\n",
+	"                    pcb.act = self._SUCCESS\n",
+	"                    break\n",
+	"\n",
+	"                self._get_go(pcb)\n",
+	"\n",
+	"                pcb.tos = _@@prefixToken()\n",
+	"                pcb.stack.append(pcb.tos)\n",
+	"\n",
+	"                pcb.tos.symbol = self._symbols[pcb.lhs]\n",
+	"                pcb.tos.state = -1 if pcb.act &amp; self._REDUCE else pcb.idx\n",
+	"                pcb.tos.value = pcb.ret\n",
+	"                pcb.tos.node = node or cnodes\n",
+	"                pcb.tos.line = pcb.line\n",
+	"                pcb.tos.column = pcb.column\n",
+	"\n",
+	"            if pcb.act == self._SUCCESS or pcb.act == self._ERROR:\n",
+	"                break\n",
+	"\n",
+	"            # Get next input symbol\n",
+	"            self._get_sym(pcb)\n",
+	"\n",
+	"            # print(\"pcb.sym = %d (%s)\" % (pcb.sym, self._symbols[pcb.sym][0]))\n",
+	"            # print(\"pcb.len = %d\" % pcb.len)\n",
+	"\n",
+	"            # Get action table entry\n",
+	"            if not self._get_act(pcb):\n",
+	"                # TODO: Error Recovery\n",
+	"                raise @@prefixParseException(pcb.line, pcb.column,\n",
+	"                                     [self._symbols[sym]\n",
+	"                                      for (sym, pcb.act, pcb.idx)\n",
+	"                                         in self._act[pcb.tos.state]])\n",
+	"\n",
+	"            # print(\"pcb.act = %d\" % pcb.act)\n",
+	"\n",
+	"            # Shift\n",
+	"            if pcb.act &amp; self._SHIFT:\n",
+	"                # print(\"SHIFT\", pcb.sym, self._symbols[pcb.sym])\n",
+	"\n",
+	"                pcb.tos = _@@prefixToken()\n",
+	"                pcb.stack.append(pcb.tos)\n",
+	"\n",
+	"                # Execute scanner actions, if existing.\n",
+	"                scan_fn = getattr(self, \"_scan_action_%d\" % pcb.sym, None)\n",
+	"                if scan_fn:\n",
+	"                    scan_fn(pcb)\n",
+	"\n",
+	"                pcb.tos.state = -1 if pcb.act &amp; self._REDUCE else pcb.idx\n",
+	"                pcb.tos.symbol = self._symbols[pcb.sym]\n",
+	"\n",
+	"                pcb.tos.line = pcb.line\n",
+	"                pcb.tos.column = pcb.column\n",
+	"\n",
+	"                if @@top-value is None:\n",
+	"                    @@top-value = pcb.buf[:pcb.len]\n",
+	"\n",
+	"                if pcb.tos.symbol[1]:\n",
+	"                    pcb.tos.node = @@prefixNode(\n",
+	"                        pcb.tos.symbol[1], @@top-value\n",
+	"                    )\n",
+	"\n",
+	"                if pcb.sym != @@eof and pcb.sym != @@error:\n",
+	"                    self._clear_input(pcb)\n",
+	"                    pcb.old_sym = -1\n",
+	"\n",
+	"        if pcb.ret is None and pcb.tos.node:\n",
+	"            if isinstance(pcb.tos.node, list):\n",
+	"                if len(pcb.tos.node) &gt; 1:\n",
+	"                    node = @@prefixNode(children=pcb.tos.node)\n",
+	"                else:\n",
+	"                    node = pcb.tos.node[0]\n",
+	"            else:\n",
+	"                node = pcb.tos.node\n",
+	"        else:\n",
+	"            node = None\n",
+	"\n",
+	"        return pcb.ret or node\n",
+	"@@scan_actions\n",
+	"@@actions\n",
+	"@@epilogue\n",
+	"\n",
+	"if __name__ == \"__main__\":\n",
+	"    import sys\n",
+	"\n",
+	"    p = @@prefixParser()\n",
+	"    ret = p.parse(sys.argv[1] if len(sys.argv) &gt; 1 else None)\n",
+	"\n",
+	"    if isinstance(ret, @@prefixNode):\n",
+	"        ret.dump()\n",
+	"    else:\n",
+	"        print(ret)\n",
+	"\n",
+	"</file>\n",
+	"</generator>\n",
+	(char*)NULL
+};
+
+static struct
+{
+	char*	name;
+	char**	lines;
+} stock_targets[] =
+{
+	{ "c++.tlt", stock_target_0 },
+	{ "c.tlt", stock_target_1 },
+	{ "javascript.tlt", stock_target_2 },
+	{ "json.tlt", stock_target_3 },
+	{ "python.tlt", stock_target_4 },
+	{ (char*)NULL, (char**)NULL }
+};
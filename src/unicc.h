@@ -16,6 +16,7 @@
 
 /* Special symbol names */
 #define P_WHITESPACE			"&whitespace"
+#define P_SKIP					"&skip"
 #define P_ERROR_RESYNC			"&error"
 #define P_END_OF_FILE			"&eof"
 #define P_EMBEDDED				"&embedded_%d"
@@ -29,6 +30,7 @@
 #define P_REWRITTEN_TOKEN		"\'"
 #define P_REWRITTEN_CCL			"#"
 #define P_REWRITTEN_KW			"~"
+#define P_REWRITTEN_LEXEME		"@"
 
 /* Symbol types */
 #define SYM_UNDEFINED			-1
@@ -62,6 +64,38 @@
 /* Generator insertion wildcards */
 #define GEN_WILD_PREFIX			"@@"
 
+/* Output buffers */
+#define OUTBUF_CHUNK			1024	/* Minimal allocation step */
+#define OUTBUF_FLUSH			65536	/* Flush size of streamed buffers */
+
+/* Argument types of compiled template snippets */
+#define SNIPPET_INT				0		/* int value */
+#define SNIPPET_STR				1		/* char* value */
+#define SNIPPET_MAXARGS			16		/* Maximum number of arguments */
+
+/* Parse and lexer tables, e.g. to be packed into blobs */
+#define BLOB_ACTION_TABLE		0
+#define BLOB_GOTO_TABLE			1
+#define BLOB_DEF_PROD			2
+#define BLOB_DFA_SELECT			3
+#define BLOB_DFA_INDEX			4
+#define BLOB_DFA_CHAR			5
+#define BLOB_DFA_TRANS			6
+#define BLOB_DFA_ACCEPT			7
+#define BLOB_DFA_FOLD			8
+#define BLOB_DFA_MASK			9
+#define BLOB_COUNT				10
+#define BLOB_LINE				20		/* Bytes per line of a blob */
+
+/* Comb vectors of the action and goto tables */
+#define COMB_ACTION_BASE		0
+#define COMB_ACTION_CHECK		1
+#define COMB_ACTION_NEXT		2
+#define COMB_GOTO_BASE			3
+#define COMB_GOTO_CHECK			4
+#define COMB_GOTO_NEXT			5
+#define COMB_COUNT				6
+
 /* UniCC version number */
 #define UNICC_VER_MAJOR			1
 #define UNICC_VER_MINOR			9
@@ -104,6 +138,9 @@ typedef struct _parser				PARSER;
 typedef struct _generator			GENERATOR;
 typedef struct _generator_1d_tab	_1D_TABLE;
 typedef struct _generator_2d_tab	_2D_TABLE;
+typedef struct _outbuf				OUTBUF;
+typedef struct _snippet_seg			SNIPPET_SEG;
+typedef struct _snippet				SNIPPET;
 
 /*
  * Structure declarations
@@ -236,6 +273,8 @@ struct _state
 
     pregex_dfa*	dfa;			/* DFA machine for regex recognition
                                     in this state */
+    LIST*		accepts;		/* Terminals accepted in this state,
+                                    if the DFA is shared */
 
     int			derived_from;	/* Previous state */
 };
@@ -271,6 +310,10 @@ struct _option
 struct _parser
 {
     plist*		symbols;		/* Symbol table */
+    int			terminals;		/* Number of terminals, which are
+                                    numbered before the nonterminals */
+    plist*		ccls;			/* Character-class terminals,
+                                    keyed by their interned ccl */
     plist*		productions;	/* Productions */
     parray*		states;			/* LALR(1) states */
     LIST*		dfa;			/* List containing the DFA for
@@ -279,8 +322,10 @@ struct _parser
     SYMBOL*		goal;			/* Pointer to the goal non-terminal */
     SYMBOL*		end_of_input;	/* End of input symbol */
     SYMBOL*		error;			/* Error token */
+    SYMBOL*		skip;			/* Whitespace skipped by the lexers */
 
     LIST*		dfas;			/* Lexers */
+    LIST*		folded_dfas;	/* Lexers running on case-folded input */
     LIST*		vtypes;			/* Value stack types */
 
     short		p_mode;			/* Parser model */
@@ -293,7 +338,12 @@ struct _parser
 
     BOOLEAN		p_lexem_sep;	/* Flag, if lexem separation is switched
                                     ON or not */
+    BOOLEAN		p_ws_skip;		/* Flag, if whitespace is skipped by the
+                                    lexers instead of rewriting */
     BOOLEAN		p_cis_strings;	/* Flag, if case-insensitive strings */
+    BOOLEAN		p_shared_dfas;	/* Flag, if states share their lexers */
+    BOOLEAN		p_regular_lexemes;/* Flag, if regular lexemes are turned
+                                    into regex terminals */
     BOOLEAN		p_extern_tokens;/* Flag if parser uses external tokens */
     BOOLEAN		p_reserve_regex;/* Flag, if regex'es are reserved */
     int			p_universe;		/* Maximum of the character universe */
@@ -325,17 +375,51 @@ struct _parser
     BOOLEAN		gen_prog;
     BOOLEAN		gen_xml;
     BOOLEAN		to_stdout;
+    BOOLEAN		keep_unchanged;	/* Don't rewrite unchanged output files */
+    BOOLEAN		packed_tables;	/* Emit tables as packed byte blobs */
+    BOOLEAN		comb_tables;	/* Emit action and goto tables as
+                                    comb vectors */
+    BOOLEAN		split_units;	/* Emit several translation units */
     char*		target;			/* Target language by command-line */
+    LIST*		targets;		/* All target languages by command-line,
+                                    shared between jobs */
     int			files_count;
 
     /* Debug and maintainance */
     char*		filename;
+    LIST*		sources;		/* Grammar files read by #extends */
     int			debug_level;
 
     /* XML-root node for XML-encoded error messages */
     XML_T		err_xml;
 };
 
+/* Growing output buffer */
+struct _outbuf
+{
+    char*		buf;			/* Buffer content, zero-terminated */
+    size_t		len;			/* Length of content */
+    size_t		size;			/* Allocated size */
+    FILE*		stream;			/* Stream to flush content to, or NULL */
+};
+
+/* Segment of a compiled template snippet */
+struct _snippet_seg
+{
+    char*		text;			/* Literal text, not zero-terminated */
+    size_t		len;			/* Length of the literal text */
+    int			arg;			/* Argument following the text, or -1 */
+};
+
+/* Compiled template snippet */
+struct _snippet
+{
+    parray*		segs;			/* Segments */
+    int			types[ SNIPPET_MAXARGS ];
+                                /* Argument types */
+    int			args;			/* Number of arguments */
+};
+
 /* Generator 2D table structure */
 struct _generator_2d_tab
 {
@@ -344,6 +428,10 @@ struct _generator_2d_tab
     char*		col;
     char*		col_sep;
     char*		row_sep;
+
+    SNIPPET*	snip_row_start;	/* Compiled snippets */
+    SNIPPET*	snip_row_end;
+    SNIPPET*	snip_col;
 };
 
 /* Generator 1D table structur */
@@ -351,6 +439,8 @@ struct _generator_1d_tab
 {
     char*		col;
     char*		col_sep;
+
+    SNIPPET*	snip_col;		/* Compiled snippet */
 };
 
 /* Generator template structure */
@@ -375,6 +465,10 @@ struct _generator
     _1D_TABLE	dfa_char;					/* DFA transition characters */
     _1D_TABLE	dfa_trans;					/* DFA transitions */
     _2D_TABLE	dfa_accept;					/* DFA accepting states */
+    _1D_TABLE	dfa_fold;					/* DFA case-folding flags */
+    _2D_TABLE	dfa_mask;					/* DFA accept masks of states */
+    _1D_TABLE	comb;						/* Comb vectors of the action
+                                                and goto tables */
 
     char*		action_start;				/* Action code start */
     char*		action_end;					/* Action code end */
@@ -420,10 +514,17 @@ struct _generator
                                                 array */
     int			sequences_count;			/* Number of elements in the
                                                 above array */
+    BOOLEAN		escape_first[ 256 ];		/* Flags for characters
+                                                starting an escape
+                                                    sequence */
 
     char*		truedef;					/* Value for true */
     char*		falsedef;					/* Value for false */
 
+    char*		blob_byte;					/* Byte in a packed table */
+    char*		blob_line_sep;				/* Line break in a packed
+                                                table */
+
     XML_T		xml;						/* XML root node */
 };
 
@@ -481,7 +582,15 @@ typedef enum
     ERR_UNDEFINED_LHS,
     ERR_UNDEFINED_TERMINAL,
     ERR_NO_TARGET_TPL_SUPPLY,
-    ERR_DIRECTIVE_ALREADY_USED
+    ERR_DIRECTIVE_ALREADY_USED,
+    ERR_UNPRODUCTIVE_NONTERM,
+    ERR_UNREACHABLE_NONTERM,
+    ERR_BASENAME_MULTIPLE_FILES,
+    ERR_WATCH_FILE,
+    ERR_NO_PACKED_TABLES,
+    ERR_NO_SPLIT_UNITS,
+    ERR_NO_COMB_TABLES,
+    ERR_UNKNOWN_CONDITION
 } ERRORCODE;
 
 #include "proto.h"
@@ -968,6 +968,20 @@ XML_T xml_parse_fp( FILE* fp )
     return &root->xml;
 }
 
+/* =============================================================================
+    Wrapper for xml_parse_str() that parses the allocated string s, which is
+    freed by xml_free()
+ ============================================================================ */
+XML_T xml_parse_alloc( char* s )
+{
+    xml_root_t	root;
+
+    root = (xml_root_t)xml_parse_str( s, pstrlen( s ) );
+    root->len = -1; /* so we know to free s in xml_free() */
+
+    return &root->xml;
+}
+
 /* =============================================================================
     a wrapper for xml_parse_fd that accepts a file name
  ============================================================================ */
@@ -47,12 +47,24 @@
 #define UNICC_STACKDEBUG		0
 #endif
 
-/* Parse error macro */
+/* Line and column counting, if used by the grammar's semantic code */
+#ifndef UNICC_LINE_INFO
+#define UNICC_LINE_INFO			@@line-info
+#endif
+
+/* Parse error macro; The default one reports line and column if counted */
 #ifndef UNICC_PARSE_ERROR
+#if UNICC_LINE_INFO
 #define UNICC_PARSE_ERROR( parser ) \
     fprintf( stderr, "line %d, column %d: syntax error on symbol %d, token '" \
         UNICC_SCHAR_FORMAT "'\n", \
     parser->line, parser->column, parser->sym, parser->get_lexem() )
+#else
+#define UNICC_PARSE_ERROR( parser ) \
+    fprintf( stderr, "syntax error on symbol %d, token '" \
+        UNICC_SCHAR_FORMAT "'\n", \
+    parser->sym, parser->get_lexem() )
+#endif
 #endif
 
 /* Input buffering clean-up */
@@ -82,6 +94,21 @@
 #endif
 #define UNICC_PARSER			"@@prefix" "debug"
 
+/* Symbol ID ranges; Terminals are numbered before the nonterminals */
+#ifdef UNICC_TERMINALS
+#undef UNICC_TERMINALS
+#endif
+#define UNICC_TERMINALS			@@number-of-terminals
+
+#ifdef UNICC_NONTERMINALS
+#undef UNICC_NONTERMINALS
+#endif
+#define UNICC_NONTERMINALS		@@number-of-nonterminals
+
+#ifndef UNICC_NONTERM_IDX
+#define UNICC_NONTERM_IDX( sym )	( ( sym ) - UNICC_TERMINALS )
+#endif
+
 /* Don't change next three defines below! */
 #ifndef UNICC_ERROR
 #define UNICC_ERROR				0
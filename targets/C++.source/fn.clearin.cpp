@@ -4,6 +4,7 @@ void @@prefix_parser::clear_input( void )
     {
         if( this->len )
         {
+#if UNICC_LINE_INFO
             /* Update counters for line and column */
             for( int i = 0; i < this->len; i++ )
             {
@@ -15,6 +16,7 @@ void @@prefix_parser::clear_input( void )
                 else
                     this->column++;
             }
+#endif
 
 #if UNICC_DEBUG > 2
     fprintf( stderr, "%s: clear input: "
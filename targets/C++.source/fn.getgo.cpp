@@ -1,5 +1,16 @@
 bool @@prefix_parser::get_go( void )
 {
+@@if comb-tables
+    int i;
+
+    if( this->go_check[ i = this->go_base[ this->tos->state ]
+            + UNICC_NONTERM_IDX( this->lhs ) ] == this->tos->state )
+    {
+        this->act = this->go_next[ i ] & 3;
+        this->idx = this->go_next[ i ] >> 2;
+        return true;
+    }
+@@else
     for( int i = 1; i < this->go[ this->tos->state ][0] * 3; i += 3 )
     {
         if( this->go[ this->tos->state ][i] == this->lhs )
@@ -9,6 +20,7 @@ bool @@prefix_parser::get_go( void )
             return true;
         }
     }
+@@endif
 
     return false;
 }
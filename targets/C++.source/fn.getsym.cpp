@@ -3,11 +3,11 @@ bool @@prefix_parser::get_sym( void )
     this->sym = -1;
     this->len = 0;
 
-#if @@mode
+@@if skip-whitespace
     do
     {
-#endif
-#if !@@mode
+@@endif
+@@if !mode
 
 #if UNICC_DEBUG > 2
         fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
@@ -25,11 +25,11 @@ bool @@prefix_parser::get_sym( void )
          */
         else if( this->get_input( 0 ) == this->eof )
             this->sym = @@eof;
-#else
+@@else
         this->lex();
-#endif /* !@@mode */
+@@endif
 
-#if @@mode
+@@if skip-whitespace
 
         if( this->sym > -1 && this->symbols[ this->sym ].whitespace )
         {
@@ -40,7 +40,7 @@ bool @@prefix_parser::get_sym( void )
         break;
     }
     while( 1 );
-#endif /* @@mode */
+@@endif
 
     return this->sym > -1;
 }
@@ -13,6 +13,15 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
         fprintf( @@prefix_dbg,
                 "%s: error recovery: expecting ", UNICC_PARSER );
 
+@@if comb-tables
+        for( int i = 0; i < @@number-of-terminals; i++ )
+        {
+            if( this->act_check[ this->act_base[ this->tos->state ] + i ]
+                    == this->tos->state )
+                fprintf( @@prefix_dbg, "%d (%s), ",
+                    i, this->symbols[ i ].name );
+        }
+@@else
         for( int i = 1; i < this->actions[ this->tos->state ][0] * 3; i += 3 )
         {
             fprintf( @@prefix_dbg, "%d (%s)%s",
@@ -21,6 +30,7 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
                 ( i == this->actions[ this->tos->state ][0] * 3 - 3 ) ?
                         "\n" : ", " );
         }
+@@endif
 
         fprintf( @@prefix_dbg, "\n%s: error recovery: error_delay is %d, %s\n",
                     UNICC_PARSER, this->error_delay,
@@ -29,7 +39,7 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
 #endif
     }
 
-#if @@error < 0
+@@if !error-token
     /* No error token defined? Then exit here... */
 
 #if UNICC_DEBUG
@@ -42,7 +52,7 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
     this->error_count++;
 
     return 1;
-#else
+@@else
 
 #if UNICC_DEBUG
     fprintf( @@prefix_dbg, "%s: error recovery: "
@@ -75,7 +85,7 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
         this->dbg_stack( @@prefix_dbg, this->stack, this->tos );
 #endif
 #endif
-        if( @@prefix_get_act( this ) )
+        if( this->get_act() )
         {
             /* Shift */
             if( this->act & UNICC_SHIFT )
@@ -123,5 +133,5 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
 
     return false;
 
-#endif /* @@error >= 0 */
+@@endif
 }
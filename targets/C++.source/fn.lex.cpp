@@ -1,17 +1,21 @@
-#if @@number-of-dfa-machines
+@@if lexers
 void @@prefix_parser::lex( void )
 {
     int 		state	= 0;
     size_t		len		= 0;
     int			chr;
     UNICC_CHAR	next;
-#if !@@mode
+@@if !mode
     int			machine	= this->dfa_select[ this->tos->state ];
-#else
+@@else
     int			machine	= 0;
-#endif
+@@endif
 
     next = this->get_input( len );
+@@if case-folding
+    if( this->dfa_fold[ machine ] && next >= 'A' && next <= 'Z' )
+        next += 'a' - 'A';
+@@endif
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
@@ -28,7 +32,7 @@ fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
 
-        chr = this->dfa_idx[ machine ][ state ];
+        chr = this->dfa_idx[ machine ][ state ] * 2;
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
 #endif
@@ -53,7 +57,16 @@ fprintf( stderr, "%s: lex: next = %d this->dfa_chars[ chr ] = %d, "
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: state = %d\n", UNICC_PARSER, state );
 #endif
+@@if shared-lexers
+                /* Only accept terminals which are valid in this state */
+                if( this->dfa_accept[ machine ][ state ] > 0
+                    && ( this->dfa_mask[ this->tos->state ]
+                            [ ( this->dfa_accept[ machine ][ state ] - 1 ) / 8 ]
+                        & ( 1 << ( ( this->dfa_accept[ machine ][ state ] - 1 )
+                                    % 8 ) ) ) )
+@@else
                 if( this->dfa_accept[ machine ][ state ] > 0 )
+@@endif
                 {
                     this->len = len + 1;
                     this->sym = this->dfa_accept[ machine ][ state ] - 1;
@@ -77,6 +90,11 @@ fprintf( stderr, "%s: lex: new accepting symbol this->sym = %d greedy = %d\n",
                 }
 
                 next = this->get_input( ++len );
+@@if case-folding
+                if( this->dfa_fold[ machine ]
+                        && next >= 'A' && next <= 'Z' )
+                    next += 'a' - 'A';
+@@endif
                 break;
             }
 
@@ -87,6 +105,7 @@ fprintf( stderr, "%s: lex: new accepting symbol this->sym = %d greedy = %d\n",
 
     if( this->sym > -1 )
     {
+@@if scanner-actions
 #if UNICC_SEMANTIC_TERM_SEL
         /*
             Execute scanner actions, if existing, but with
@@ -119,6 +138,7 @@ fprintf( stderr, "%s: lex: new accepting symbol this->sym = %d greedy = %d\n",
 
         this->tos--;
 #endif /* UNICC_SEMANTIC_TERM_SEL */
+@@endif
     }
 
 #if UNICC_DEBUG	> 1
@@ -126,4 +146,4 @@ fprintf( stderr, "%s: lex: function exits, this->sym = %d, this->len = %d\n",
             UNICC_PARSER, this->sym, this->len );
 #endif
 }
-#endif
+@@endif
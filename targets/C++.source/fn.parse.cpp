@@ -1,8 +1,10 @@
 @@goal-type @@prefix_parser::parse( void )
 {
     @@goal-type			ret;
+@@if ast-construction
     @@prefix_ast*		node;
     @@prefix_ast*		lnode;
+@@endif
 
 #if UNICC_DEBUG
     @@prefix_vtype*		vptr;
@@ -41,11 +43,9 @@
             // Run reduction code
             memset( &( this->ret ), 0, sizeof( @@prefix_vtype ) );
 
-            switch( this->idx )
-            {
-@@actions
-            }
+            this->reduce();
 
+@@if ast-construction
             // Drop right-hand side, collect AST nodes
             node = NULL;
 
@@ -94,6 +94,10 @@
                     this->tos->node = node;
                 }
             }
+@@else
+            // Drop right-hand side; There is no AST construction
+            this->tos -= this->productions[ this->idx ].length;
+@@endif
 
             // Enforced error in semantic actions?
             if( this->act == UNICC_ERROR )
@@ -133,13 +137,16 @@
                         sizeof( @@prefix_vtype ) );
             this->tos->symbol = &( this->symbols[ this->lhs ] );
             this->tos->state = ( this->act & UNICC_REDUCE ) ? -1 : this->idx;
+#if UNICC_LINE_INFO
             this->tos->line = this->line;
             this->tos->column = this->column;
+#endif
         }
 
         if( this->act == UNICC_SUCCESS || this->act == UNICC_ERROR )
             break;
 
+@@if error-token
         /* If in error recovery, replace old-symbol */
         if( this->error_delay == UNICC_ERROR_DELAY
                 && ( this->sym = this->old_sym ) < 0 )
@@ -167,6 +174,9 @@
         }
         else
             this->get_sym();
+@@else
+        this->get_sym();
+@@endif
 
 #if UNICC_DEBUG
         fprintf( @@prefix_dbg, "%s: current token %d (%s)\n",
@@ -223,37 +233,31 @@
             this->tos++;
             this->tos->node = NULL;
 
-            /*
-                Execute scanner actions, if existing.
-                Here, UNICC_ON_SHIFT is set to 1, so that shifting-
-                related operations will be performed.
-            */
-#define UNICC_ON_SHIFT	1
-            switch( this->sym )
-            {
-@@scan_actions
-
-                default:
-                    @@top-value = this->get_input( 0 );
-                    break;
-            }
-#undef UNICC_ON_SHIFT
+@@if scanner-actions
+            // Execute scanner actions
+            this->scan_shift();
+@@else
+            @@top-value = this->get_input( 0 );
+@@endif
 
             this->tos->state = ( this->act & UNICC_REDUCE ) ? -1 : this->idx;
             this->tos->symbol = &( this->symbols[ this->sym ] );
+#if UNICC_LINE_INFO
             this->tos->line = this->line;
             this->tos->column = this->column;
+#endif
 
+@@if ast-construction
             if( *this->tos->symbol->emit )
                 this->tos->node = this->ast_create(
                                     this->tos->symbol->emit,
                                         this->get_lexem() );
-            else
-                this->tos->node = NULL;
+@@endif
 
             this->buf[ this->len ] = this->next;
 
             /* Perform the shift on input */
+@@if error-token
             if( this->sym != @@eof && this->sym != @@error )
             {
                 UNICC_CLEARIN( this );
@@ -262,6 +266,10 @@
 
             if( this->error_delay )
                 this->error_delay--;
+@@else
+            if( this->sym != @@eof )
+                UNICC_CLEARIN( this );
+@@endif
         }
     }
 
@@ -0,0 +1,8 @@
+// Runs the semantic action of the production this->idx to be reduced
+void @@prefix_parser::reduce( void )
+{
+    switch( this->idx )
+    {
+@@actions
+    }
+}
@@ -0,0 +1,17 @@
+/*
+    Runs the scanner action of the shifted terminal with UNICC_ON_SHIFT = 1,
+    so that shifting-related operations will be performed.
+*/
+void @@prefix_parser::scan_shift( void )
+{
+#define UNICC_ON_SHIFT	1
+    switch( this->sym )
+    {
+@@scan_actions
+
+        default:
+            @@top-value = this->get_input( 0 );
+            break;
+    }
+#undef UNICC_ON_SHIFT
+}
@@ -4,58 +4,108 @@ class @@prefix_parser
     private:
         // --- Tables ---
 
+        @@if comb-tables
+        // Action Table as comb vectors
+        const @@action-base-type act_base[ @@number-of-states ] =
+        {
+            @@action-base
+        };
+
+        const @@action-check-type act_check[ @@action-comb-size ] =
+        {
+            @@action-check
+        };
+
+        const @@action-next-type act_next[ @@action-comb-size ] =
+        {
+            @@action-next
+        };
+
+        // GoTo Table as comb vectors
+        const @@goto-base-type go_base[ @@number-of-states ] =
+        {
+            @@goto-base
+        };
+
+        const @@goto-check-type go_check[ @@goto-comb-size ] =
+        {
+            @@goto-check
+        };
+
+        const @@goto-next-type go_next[ @@goto-comb-size ] =
+        {
+            @@goto-next
+        };
+        @@else
         // Action Table
-        const int actions[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
+        const @@action-table-type actions[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
         {
 @@action-table
         };
 
         // GoTo Table
-        const int go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
+        const @@goto-table-type go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
         {
 @@goto-table
         };
+        @@endif
 
         // Default productions per state
-        const int def_prod[ @@number-of-states ] =
+        const @@default-productions-type def_prod[ @@number-of-states ] =
         {
             @@default-productions
         };
 
-        #if !@@mode
+        @@if !mode
         // DFA selection table
-        const int dfa_select[ @@number-of-states ] =
+        const @@dfa-select-type dfa_select[ @@number-of-states ] =
         {
             @@dfa-select
         };
-        #endif
+        @@endif
 
-        #if @@number-of-dfa-machines
+        @@if lexers
         // DFA index table
-        const int dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
+        const @@dfa-index-type dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
         {
 @@dfa-index
         };
 
         // DFA transition chars
-        const int dfa_chars[ @@size-of-dfa-characters * 2 ] =
+        const @@dfa-char-type dfa_chars[ @@size-of-dfa-characters * 2 ] =
         {
             @@dfa-char
         };
 
         // DFA transitions
-        const int dfa_trans[ @@size-of-dfa-characters ] =
+        const @@dfa-trans-type dfa_trans[ @@size-of-dfa-characters ] =
         {
             @@dfa-trans
         };
 
         // DFA acception states
-        const int dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
+        const @@dfa-accept-type dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
         {
 @@dfa-accept
         };
 
-        #endif
+        @@if case-folding
+        // DFA case-folding flags
+        const @@dfa-fold-type dfa_fold[ @@number-of-dfa-machines ] =
+        {
+            @@dfa-fold
+        };
+        @@endif
+
+        @@if shared-lexers
+        // Accept masks of the states using a shared DFA
+        const @@dfa-mask-type dfa_mask[ @@number-of-states ][ @@dfa-mask-width ] =
+        {
+@@dfa-mask
+        };
+        @@endif
+
+        @@endif
 
         // Symbol information table
         const @@prefix_syminfo symbols[ @@number-of-symbols ] =
@@ -138,9 +188,15 @@ class @@prefix_parser
         bool handle_error( FILE* @@prefix_dbg );
 
         //fn.lex.cpp
-        #if @@number-of-dfa-machines
+        @@if lexers
         void lex( void );
-        #endif
+        @@endif
+
+        //fn.reduce.cpp
+        void reduce( void );
+
+        //fn.scan.cpp
+        void scan_shift( void );
 
         //fn.stack.cpp
         bool alloc_stack( void );
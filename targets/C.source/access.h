@@ -0,0 +1,89 @@
+/* Symbol ID ranges; Terminals are numbered before the nonterminals */
+#define UNICC_TERMINALS				@@number-of-terminals
+#define UNICC_NONTERMINALS			@@number-of-nonterminals
+#define UNICC_NONTERM_IDX( sym )	( ( sym ) - UNICC_TERMINALS )
+
+@@if comb-tables
+/* Comb vector slots of a symbol in a state */
+#define UNICC_ACT_SLOT( st, sym )	( @@prefix_act_base[ st ] + ( sym ) )
+#define UNICC_GO_SLOT( st, sym )	\
+    ( @@prefix_go_base[ st ] + UNICC_NONTERM_IDX( sym ) )
+@@endif
+
+@@if packed-tables
+@@if !comb-tables
+#define @@prefix_act_width			@@action-table-blob-width
+#define @@prefix_go_width			@@goto-table-blob-width
+@@endif
+#define @@prefix_def_prod_width		@@default-productions-blob-width
+@@if !mode
+#define @@prefix_dfa_select_width	@@dfa-select-blob-width
+@@endif
+@@if lexers
+#define @@prefix_dfa_idx_width		@@dfa-index-blob-width
+#define @@prefix_dfa_chars_width	@@dfa-char-blob-width
+#define @@prefix_dfa_trans_width	@@dfa-trans-blob-width
+#define @@prefix_dfa_accept_width	@@dfa-accept-blob-width
+@@if case-folding
+#define @@prefix_dfa_fold_width		@@dfa-fold-blob-width
+@@endif
+@@if shared-lexers
+#define @@prefix_dfa_mask_width		@@dfa-mask-blob-width
+@@endif
+@@endif
+
+#define UNICC_UNPACK( tab, i ) \
+    ( (int)@@prefix_unpack( @@prefix_##tab, @@prefix_##tab##_width, \
+                                (long)( i ) ) )
+
+/* Table accessors; The DFA index table holds character-range indexes */
+@@if !comb-tables
+#define UNICC_ACT( st, i )		\
+    UNICC_UNPACK( act, (long)( st ) * ( @@deepest-action-row * 3 + 1 ) + ( i ) )
+#define UNICC_GO( st, i )		\
+    UNICC_UNPACK( go, (long)( st ) * ( @@deepest-goto-row * 3 + 1 ) + ( i ) )
+@@endif
+#define UNICC_DEF_PROD( st )	UNICC_UNPACK( def_prod, st )
+@@if !mode
+#define UNICC_DFA_SELECT( st )	UNICC_UNPACK( dfa_select, st )
+@@endif
+@@if lexers
+#define UNICC_DFA_IDX( m, st )	\
+    ( UNICC_UNPACK( dfa_idx, \
+        (long)( m ) * @@deepest-dfa-index-row + ( st ) ) * 2 )
+#define UNICC_DFA_CHARS( i )	UNICC_UNPACK( dfa_chars, i )
+#define UNICC_DFA_TRANS( i )	UNICC_UNPACK( dfa_trans, i )
+#define UNICC_DFA_ACCEPT( m, st )	\
+    UNICC_UNPACK( dfa_accept, \
+        (long)( m ) * @@deepest-dfa-accept-row + ( st ) )
+@@if case-folding
+#define UNICC_DFA_FOLD( m )		UNICC_UNPACK( dfa_fold, m )
+@@endif
+@@if shared-lexers
+#define UNICC_DFA_MASK( st, i )	\
+    UNICC_UNPACK( dfa_mask, (long)( st ) * @@dfa-mask-width + ( i ) )
+@@endif
+@@endif
+@@else
+/* Table accessors; The DFA index table holds character-range indexes */
+@@if !comb-tables
+#define UNICC_ACT( st, i )			@@prefix_act[ st ][ i ]
+#define UNICC_GO( st, i )			@@prefix_go[ st ][ i ]
+@@endif
+#define UNICC_DEF_PROD( st )		@@prefix_def_prod[ st ]
+@@if !mode
+#define UNICC_DFA_SELECT( st )		@@prefix_dfa_select[ st ]
+@@endif
+@@if lexers
+#define UNICC_DFA_IDX( m, st )		( @@prefix_dfa_idx[ m ][ st ] * 2 )
+#define UNICC_DFA_CHARS( i )		@@prefix_dfa_chars[ i ]
+#define UNICC_DFA_TRANS( i )		@@prefix_dfa_trans[ i ]
+#define UNICC_DFA_ACCEPT( m, st )	@@prefix_dfa_accept[ m ][ st ]
+@@if case-folding
+#define UNICC_DFA_FOLD( m )			@@prefix_dfa_fold[ m ]
+@@endif
+@@if shared-lexers
+#define UNICC_DFA_MASK( st, i )		@@prefix_dfa_mask[ st ][ i ]
+@@endif
+@@endif
+@@endif
@@ -52,12 +52,24 @@
 #define UNICC_STACKDEBUG		0
 #endif
 
-/* Parse error macro */
+/* Line and column counting, if used by the grammar's semantic code */
+#ifndef UNICC_LINE_INFO
+#define UNICC_LINE_INFO			@@line-info
+#endif
+
+/* Parse error macro; The default one reports line and column if counted */
 #ifndef UNICC_PARSE_ERROR
+#if UNICC_LINE_INFO
 #define UNICC_PARSE_ERROR( pcb ) \
     fprintf( stderr, "line %d, column %d: syntax error on symbol %d, token '" \
         UNICC_SCHAR_FORMAT "'\n", \
     ( pcb )->line, ( pcb )->column, pcb->sym, @@prefix_lexem( pcb ) )
+#else
+#define UNICC_PARSE_ERROR( pcb ) \
+    fprintf( stderr, "syntax error on symbol %d, token '" \
+        UNICC_SCHAR_FORMAT "'\n", \
+    pcb->sym, @@prefix_lexem( pcb ) )
+#endif
 #endif
 
 /* Input buffering clean-up */
@@ -1,4 +1,4 @@
-
+@@if ast-construction
 UNICC_STATIC @@prefix_ast* @@prefix_ast_create( @@prefix_pcb* pcb, char* emit,
                                                     UNICC_SCHAR* token )
 {
@@ -35,10 +35,7 @@ UNICC_STATIC @@prefix_ast* @@prefix_ast_create( @@prefix_pcb* pcb, char* emit,
 
     return node;
 }
-
-/* Don't report on unused @@prefix_ast_free or @@prefix_ast_print */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-function"
+@@endif
 
 UNICC_STATIC @@prefix_ast* @@prefix_ast_free( @@prefix_ast* node )
 {
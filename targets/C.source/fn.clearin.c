@@ -1,11 +1,14 @@
 UNICC_STATIC void @@prefix_clear_input( @@prefix_pcb* pcb )
 {
+#if UNICC_LINE_INFO
     int		i;
+#endif
 
     if( pcb->buf )
     {
         if( pcb->len )
         {
+#if UNICC_LINE_INFO
             /* Update counters for line and column */
             for( i = 0; i < pcb->len; i++ )
             {
@@ -17,6 +20,7 @@ UNICC_STATIC void @@prefix_clear_input( @@prefix_pcb* pcb )
                 else
                     pcb->column++;
             }
+#endif
 
 #if UNICC_DEBUG > 2
     fprintf( stderr, "%s: clear input: "
@@ -2,21 +2,34 @@ UNICC_STATIC int @@prefix_get_act( @@prefix_pcb* pcb )
 {
     int i;
 
-    for( i = 1; i < @@prefix_act[ pcb->tos->state ][0] * 3; i += 3 )
+@@if comb-tables
+    if( pcb->sym > -1 && @@prefix_act_check[
+            i = UNICC_ACT_SLOT( pcb->tos->state, pcb->sym ) ]
+                == pcb->tos->state )
     {
-        if( @@prefix_act[ pcb->tos->state ][i] == pcb->sym )
+        if( ( pcb->act = @@prefix_act_next[ i ] & 3 ) == UNICC_ERROR )
+            return 0; /* Force parse error! */
+
+        pcb->idx = @@prefix_act_next[ i ] >> 2;
+        return 1;
+    }
+@@else
+    for( i = 1; i < UNICC_ACT( pcb->tos->state, 0 ) * 3; i += 3 )
+    {
+        if( UNICC_ACT( pcb->tos->state, i ) == pcb->sym )
         {
-            if( ( pcb->act = @@prefix_act[ pcb->tos->state ][i+1] )
+            if( ( pcb->act = UNICC_ACT( pcb->tos->state, i + 1 ) )
                     == UNICC_ERROR )
                 return 0; /* Force parse error! */
 
-            pcb->idx = @@prefix_act[ pcb->tos->state ][i+2];
+            pcb->idx = UNICC_ACT( pcb->tos->state, i + 2 );
             return 1;
         }
     }
+@@endif
 
     /* Default production */
-    if( ( pcb->idx = @@prefix_def_prod[ pcb->tos->state ] ) > -1 )
+    if( ( pcb->idx = UNICC_DEF_PROD( pcb->tos->state ) ) > -1 )
     {
         pcb->act = 1; /* Reduce */
         return 1;
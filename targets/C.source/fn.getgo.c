@@ -2,15 +2,25 @@ UNICC_STATIC int @@prefix_get_go( @@prefix_pcb* pcb )
 {
     int i;
 
-    for( i = 1; i < @@prefix_go[ pcb->tos->state ][0] * 3; i += 3 )
+@@if comb-tables
+    if( @@prefix_go_check[ i = UNICC_GO_SLOT( pcb->tos->state, pcb->lhs ) ]
+            == pcb->tos->state )
     {
-        if( @@prefix_go[ pcb->tos->state ][i] == pcb->lhs )
+        pcb->act = @@prefix_go_next[ i ] & 3;
+        pcb->idx = @@prefix_go_next[ i ] >> 2;
+        return 1;
+    }
+@@else
+    for( i = 1; i < UNICC_GO( pcb->tos->state, 0 ) * 3; i += 3 )
+    {
+        if( UNICC_GO( pcb->tos->state, i ) == pcb->lhs )
         {
-            pcb->act = @@prefix_go[ pcb->tos->state ][ i + 1 ];
-            pcb->idx = @@prefix_go[ pcb->tos->state ][ i + 2 ];
+            pcb->act = UNICC_GO( pcb->tos->state, i + 1 );
+            pcb->idx = UNICC_GO( pcb->tos->state, i + 2 );
             return 1;
         }
     }
+@@endif
 
     return 0;
 }
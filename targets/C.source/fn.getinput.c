@@ -1,4 +1,4 @@
-UNICC_STATIC UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset )
+UNICC_INTERN UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset )
 {
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: get input: pcb->buf + offset = %p pcb->bufend = %p\n",
@@ -3,19 +3,19 @@ UNICC_STATIC int @@prefix_get_sym( @@prefix_pcb* pcb )
     pcb->sym = -1;
     pcb->len = 0;
 
-#if @@mode
+@@if skip-whitespace
     do
     {
-#endif
-#if !@@mode
+@@endif
+@@if !mode
 
 #if UNICC_DEBUG > 2
         fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
                     UNICC_PARSER, pcb->tos->state,
-                        @@prefix_dfa_select[ pcb->tos->state ] );
+                        UNICC_DFA_SELECT( pcb->tos->state ) );
 #endif
 
-        if( @@prefix_dfa_select[ pcb->tos->state ] > -1 )
+        if( UNICC_DFA_SELECT( pcb->tos->state ) > -1 )
             @@prefix_lex( pcb );
         /*
          * If there is no DFA state machine,
@@ -25,11 +25,11 @@ UNICC_STATIC int @@prefix_get_sym( @@prefix_pcb* pcb )
          */
         else if( @@prefix_get_input( pcb, 0 ) == pcb->eof )
             pcb->sym = @@eof;
-#else
+@@else
         @@prefix_lex( pcb );
-#endif /* !@@mode */
+@@endif
 
-#if @@mode
+@@if skip-whitespace
 
         if( pcb->sym > -1 && @@prefix_symbols[ pcb->sym ].whitespace )
         {
@@ -40,7 +40,7 @@ UNICC_STATIC int @@prefix_get_sym( @@prefix_pcb* pcb )
         break;
     }
     while( 1 );
-#endif /* @@mode */
+@@endif
 
     return ( pcb->sym > -1 ) ? 1 : 0;
 }
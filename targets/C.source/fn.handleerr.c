@@ -18,14 +18,24 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
         fprintf( @@prefix_dbg,
                 "%s: error recovery: expecting ", UNICC_PARSER );
 
-        for( i = 1; i < @@prefix_act[ pcb->tos->state ][0] * 3; i += 3 )
+@@if comb-tables
+        for( i = 0; i < UNICC_TERMINALS; i++ )
+        {
+            if( @@prefix_act_check[ UNICC_ACT_SLOT( pcb->tos->state, i ) ]
+                    == pcb->tos->state )
+                fprintf( @@prefix_dbg, "%d (%s), ",
+                    i, @@prefix_symbols[ i ].name );
+        }
+@@else
+        for( i = 1; i < UNICC_ACT( pcb->tos->state, 0 ) * 3; i += 3 )
         {
             fprintf( @@prefix_dbg, "%d (%s)%s",
-                @@prefix_act[ pcb->tos->state ][i],
-                @@prefix_symbols[ @@prefix_act[ pcb->tos->state ][i] ].name,
-                ( i == @@prefix_act[ pcb->tos->state ][0] * 3 - 3 ) ?
+                UNICC_ACT( pcb->tos->state, i ),
+                @@prefix_symbols[ UNICC_ACT( pcb->tos->state, i ) ].name,
+                ( i == UNICC_ACT( pcb->tos->state, 0 ) * 3 - 3 ) ?
                         "\n" : ", " );
         }
+@@endif
 %%%end
 
         fprintf( @@prefix_dbg, "\n%s: error recovery: error_delay is %d, %s\n",
@@ -36,7 +46,7 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
     }
 
 %%%ifgen STDTPL
-#if @@error < 0
+@@if !error-token
     /* No error token defined? Then exit here... */
 %%%ifgen UNICC4C
 %%%code if( error_sym < 0 )
@@ -54,7 +64,7 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
 
     return 1;
 %%%ifgen STDTPL
-#else
+@@else
 %%%ifgen UNICC4C
 %%%code }
 %%%code else
@@ -153,7 +163,7 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
     return 0;
 
 %%%ifgen STDTPL
-#endif /* @@error >= 0 */
+@@endif
 %%%ifgen UNICC4C
 %%%code }
 %%%end
@@ -1,17 +1,21 @@
-#if @@number-of-dfa-machines
+@@if lexers
 UNICC_STATIC void @@prefix_lex( @@prefix_pcb* pcb )
 {
     int 			dfa_st	= 0;
     unsigned int	len		= 0;
     int				chr;
     UNICC_CHAR		next;
-#if !@@mode
-    int				mach	= @@prefix_dfa_select[ pcb->tos->state ];
-#else
+@@if !mode
+    int				mach	= UNICC_DFA_SELECT( pcb->tos->state );
+@@else
     int				mach	= 0;
-#endif
+@@endif
 
     next = @@prefix_get_input( pcb, len );
+@@if case-folding
+    if( UNICC_DFA_FOLD( mach ) && next >= 'A' && next <= 'Z' )
+        next += 'a' - 'A';
+@@endif
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
@@ -28,7 +32,7 @@ fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
 
-        chr = @@prefix_dfa_idx[ mach ][ dfa_st ];
+        chr = UNICC_DFA_IDX( mach, dfa_st );
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
 #endif
@@ -37,26 +41,35 @@ fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: FIRST next = %d @@prefix_dfa_chars[ chr ] = %d, "
             "@@prefix_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-                @@prefix_dfa_chars[ chr ], @@prefix_dfa_chars[ chr + 1 ] );
+                UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );
 #endif
-        while( @@prefix_dfa_chars[ chr ] > -1 )
+        while( UNICC_DFA_CHARS( chr ) > -1 )
         {
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: next = %d @@prefix_dfa_chars[ chr ] = %d, "
         "@@prefix_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-            @@prefix_dfa_chars[ chr ], @@prefix_dfa_chars[ chr + 1 ] );
+            UNICC_DFA_CHARS( chr ), UNICC_DFA_CHARS( chr + 1 ) );
 #endif
-            if( next >= @@prefix_dfa_chars[ chr ] &&
-                next <= @@prefix_dfa_chars[ chr+1 ] )
+            if( next >= UNICC_DFA_CHARS( chr ) &&
+                next <= UNICC_DFA_CHARS( chr + 1 ) )
             {
-                dfa_st = *( @@prefix_dfa_trans + ( chr / 2 ) );
+                dfa_st = UNICC_DFA_TRANS( chr / 2 );
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
 #endif
-                if( @@prefix_dfa_accept[ mach ][ dfa_st ] > 0 )
+@@if shared-lexers
+                /* Only accept terminals which are valid in this state */
+                if( UNICC_DFA_ACCEPT( mach, dfa_st ) > 0
+                    && ( UNICC_DFA_MASK( pcb->tos->state,
+                            ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 ) / 8 )
+                        & ( 1 << ( ( UNICC_DFA_ACCEPT( mach, dfa_st ) - 1 )
+                                    % 8 ) ) ) )
+@@else
+                if( UNICC_DFA_ACCEPT( mach, dfa_st ) > 0 )
+@@endif
                 {
                     pcb->len = len + 1;
-                    pcb->sym = @@prefix_dfa_accept[ mach ][ dfa_st ] - 1;
+                    pcb->sym = UNICC_DFA_ACCEPT( mach, dfa_st ) - 1;
 
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
@@ -77,6 +90,11 @@ fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
                 }
 
                 next = @@prefix_get_input( pcb, ++len );
+@@if case-folding
+                if( UNICC_DFA_FOLD( mach )
+                        && next >= 'A' && next <= 'Z' )
+                    next += 'a' - 'A';
+@@endif
                 break;
             }
 
@@ -87,6 +105,7 @@ fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
 
     if( pcb->sym > -1 )
     {
+@@if scanner-actions
 #if UNICC_SEMANTIC_TERM_SEL
         /*
             Execute scanner actions, if existing, but with
@@ -105,20 +124,13 @@ fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
         next = pcb->buf[ pcb->len ];
         pcb->buf[ pcb->len ] = '\0';
 
-#define UNICC_ON_SHIFT 	0
-        switch( pcb->sym )
-        {
-@@scan_actions
-
-            default:
-                break;
-        }
-#undef UNICC_ON_SHIFT
+        @@prefix_scan_match( pcb );
 
         pcb->buf[ pcb->len ] = next;
 
         pcb->tos--;
 #endif /* UNICC_SEMANTIC_TERM_SEL */
+@@endif
     }
 
 #if UNICC_DEBUG	> 1
@@ -126,4 +138,4 @@ fprintf( stderr, "%s: lex: function exits, pcb->sym = %d, pcb->len = %d\n",
             UNICC_PARSER, pcb->sym, pcb->len );
 #endif
 }
-#endif
+@@endif
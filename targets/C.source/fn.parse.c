@@ -1,10 +1,12 @@
 @@goal-type @@prefix_parse( @@prefix_pcb* pcb )
 {
     @@goal-type			ret;
+@@if ast-construction
     int					i;
 
     @@prefix_ast*		node;
     @@prefix_ast*		lnode;
+@@endif
 
 #if UNICC_DEBUG
     @@prefix_vtype*		vptr;
@@ -62,11 +64,9 @@
             /* Run reduction code */
             memset( &( pcb->ret ), 0, sizeof( @@prefix_vtype ) );
 
-            switch( pcb->idx )
-            {
-@@actions
-            }
+            @@prefix_reduce( pcb );
 
+@@if ast-construction
             /* Drop right-hand side */
             /* TODO: Destructor callbacks? */
             for( i = 0, node = (@@prefix_ast*)NULL;
@@ -91,8 +91,6 @@
                 pcb->tos--;
             }
 
-            /* This could be done if no AST construction would be done: */
-            /* pcb->tos -= @@prefix_productions[ pcb->idx ].length; */
 
             if( node )
             {
@@ -118,6 +116,10 @@
                     pcb->tos->node = node;
                 }
             }
+@@else
+            /* Drop right-hand side; There is no AST construction */
+            pcb->tos -= @@prefix_productions[ pcb->idx ].length;
+@@endif
 
             /* Enforced error in semantic actions? */
             if( pcb->act == UNICC_ERROR )
@@ -157,13 +159,16 @@
                         sizeof( @@prefix_vtype ) );
             pcb->tos->symbol = &( @@prefix_symbols[ pcb->lhs ] );
             pcb->tos->state = ( pcb->act & UNICC_REDUCE ) ? -1 : pcb->idx;
+#if UNICC_LINE_INFO
             pcb->tos->line = pcb->line;
             pcb->tos->column = pcb->column;
+#endif
         }
 
         if( pcb->act == UNICC_SUCCESS || pcb->act == UNICC_ERROR )
             break;
 
+@@if error-token
         /* If in error recovery, replace old-symbol */
         if( pcb->error_delay == UNICC_ERROR_DELAY
                 && ( pcb->sym = pcb->old_sym ) < 0 )
@@ -201,6 +206,9 @@
             @@prefix_lex( pcb );
 %%%end
         }
+@@else
+        @@prefix_get_sym( pcb );
+@@endif
 
 #if UNICC_DEBUG
         fprintf( @@prefix_dbg, "%s: current token %d (%s)\n",
@@ -257,37 +265,31 @@
             pcb->tos++;
             pcb->tos->node = (@@prefix_ast*)NULL;
 
-            /*
-                Execute scanner actions, if existing.
-                Here, UNICC_ON_SHIFT is set to 1, so that shifting-
-                related operations will be performed.
-            */
-#define UNICC_ON_SHIFT	1
-            switch( pcb->sym )
-            {
-@@scan_actions
-
-                default:
-                    @@top-value = @@prefix_get_input( pcb, 0 );
-                    break;
-            }
-#undef UNICC_ON_SHIFT
+@@if scanner-actions
+            /* Execute scanner actions */
+            @@prefix_scan_shift( pcb );
+@@else
+            @@top-value = @@prefix_get_input( pcb, 0 );
+@@endif
 
             pcb->tos->state = ( pcb->act & UNICC_REDUCE ) ? -1 : pcb->idx;
             pcb->tos->symbol = &( @@prefix_symbols[ pcb->sym ] );
+#if UNICC_LINE_INFO
             pcb->tos->line = pcb->line;
             pcb->tos->column = pcb->column;
+#endif
 
+@@if ast-construction
             if( *pcb->tos->symbol->emit )
                 pcb->tos->node = @@prefix_ast_create( pcb,
                                     pcb->tos->symbol->emit,
                                         @@prefix_lexem( pcb ) );
-            else
-                pcb->tos->node = (@@prefix_ast*)NULL;
+@@endif
 
             pcb->buf[ pcb->len ] = pcb->next;
 
             /* Perform the shift on input */
+@@if error-token
             if( pcb->sym != @@eof && pcb->sym != @@error )
             {
                 UNICC_CLEARIN( pcb );
@@ -296,6 +298,10 @@
 
             if( pcb->error_delay )
                 pcb->error_delay--;
+@@else
+            if( pcb->sym != @@eof )
+                UNICC_CLEARIN( pcb );
+@@endif
         }
     }
 
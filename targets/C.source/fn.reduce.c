@@ -0,0 +1,8 @@
+/* Runs the semantic action of the production pcb->idx to be reduced */
+UNICC_INTERN void @@prefix_reduce( @@prefix_pcb* pcb )
+{
+    switch( pcb->idx )
+    {
+@@actions
+    }
+}
@@ -0,0 +1,38 @@
+@@if lexers
+@@if scanner-actions
+#if UNICC_SEMANTIC_TERM_SEL
+/* Runs the scanner action of a matched terminal with UNICC_ON_SHIFT = 0,
+    for semantic-code dependent terminal selections */
+UNICC_INTERN void @@prefix_scan_match( @@prefix_pcb* pcb )
+{
+#define UNICC_ON_SHIFT 	0
+    switch( pcb->sym )
+    {
+@@scan_actions
+
+        default:
+            break;
+    }
+#undef UNICC_ON_SHIFT
+}
+#endif
+@@endif
+@@endif
+
+@@if scanner-actions
+/* Runs the scanner action of the shifted terminal with UNICC_ON_SHIFT = 1,
+    so that shifting-related operations will be performed */
+UNICC_INTERN void @@prefix_scan_shift( @@prefix_pcb* pcb )
+{
+#define UNICC_ON_SHIFT	1
+    switch( pcb->sym )
+    {
+@@scan_actions
+
+        default:
+            @@top-value = @@prefix_get_input( pcb, 0 );
+            break;
+    }
+#undef UNICC_ON_SHIFT
+}
+@@endif
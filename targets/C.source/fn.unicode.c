@@ -1,4 +1,9 @@
-UNICC_STATIC UNICC_SCHAR* @@prefix_lexem( @@prefix_pcb* pcb )
+/* Don't report on unused @@prefix_lexem, @@prefix_ast_free or
+    @@prefix_ast_print */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+UNICC_INTERN UNICC_SCHAR* @@prefix_lexem( @@prefix_pcb* pcb )
 {
 #if UNICC_WCHAR || !UNICC_UTF8
     pcb->lexem = pcb->buf;
@@ -0,0 +1,19 @@
+@@if packed-tables
+/* Unpacks value //i// of a table packed as little-endian values of //width//
+    bytes each */
+UNICC_STATIC long @@prefix_unpack( const unsigned char* blob,
+                                    int width, long i )
+{
+    long	v;
+
+    blob += i * width;
+
+    if( ( v = blob[ width - 1 ] ) > 127 )
+        v -= 256;
+
+    while( --width )
+        v = v * 256 + blob[ width - 1 ];
+
+    return v;
+}
+@@endif
@@ -0,0 +1,72 @@
+/* Functions and tables shared between the translation units */
+#define UNICC_INTERN
+
+@@if comb-tables
+extern @@action-base-type @@prefix_act_base[ @@number-of-states ];
+extern @@action-check-type @@prefix_act_check[ @@action-comb-size ];
+extern @@action-next-type @@prefix_act_next[ @@action-comb-size ];
+extern @@goto-base-type @@prefix_go_base[ @@number-of-states ];
+extern @@goto-check-type @@prefix_go_check[ @@goto-comb-size ];
+extern @@goto-next-type @@prefix_go_next[ @@goto-comb-size ];
+@@endif
+@@if packed-tables
+@@if !comb-tables
+extern const unsigned char @@prefix_act[];
+extern const unsigned char @@prefix_go[];
+@@endif
+extern const unsigned char @@prefix_def_prod[];
+@@if !mode
+extern const unsigned char @@prefix_dfa_select[];
+@@endif
+@@if lexers
+extern const unsigned char @@prefix_dfa_idx[];
+extern const unsigned char @@prefix_dfa_chars[];
+extern const unsigned char @@prefix_dfa_trans[];
+extern const unsigned char @@prefix_dfa_accept[];
+@@if case-folding
+extern const unsigned char @@prefix_dfa_fold[];
+@@endif
+@@if shared-lexers
+extern const unsigned char @@prefix_dfa_mask[];
+@@endif
+@@endif
+@@else
+@@if !comb-tables
+extern @@action-table-type @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ];
+extern @@goto-table-type @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ];
+@@endif
+extern @@default-productions-type @@prefix_def_prod[ @@number-of-states ];
+@@if !mode
+extern @@dfa-select-type @@prefix_dfa_select[ @@number-of-states ];
+@@endif
+@@if lexers
+extern @@dfa-index-type @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ];
+extern @@dfa-char-type @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ];
+extern @@dfa-trans-type @@prefix_dfa_trans[ @@size-of-dfa-characters ];
+extern @@dfa-accept-type @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ];
+@@if case-folding
+extern @@dfa-fold-type @@prefix_dfa_fold[ @@number-of-dfa-machines ];
+@@endif
+@@if shared-lexers
+extern @@dfa-mask-type @@prefix_dfa_mask[ @@number-of-states ][ @@dfa-mask-width ];
+@@endif
+@@endif
+@@endif
+
+extern @@prefix_syminfo @@prefix_symbols[];
+extern @@prefix_prodinfo @@prefix_productions[];
+
+@@access-section
+extern UNICC_SCHAR* @@prefix_lexem( @@prefix_pcb* pcb );
+extern UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset );
+extern void @@prefix_reduce( @@prefix_pcb* pcb );
+@@if lexers
+@@if scanner-actions
+#if UNICC_SEMANTIC_TERM_SEL
+extern void @@prefix_scan_match( @@prefix_pcb* pcb );
+#endif
+@@endif
+@@endif
+@@if scanner-actions
+extern void @@prefix_scan_shift( @@prefix_pcb* pcb );
+@@endif
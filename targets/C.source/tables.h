@@ -1,64 +1,169 @@
+@@if comb-tables
+/* Action Table as comb vectors */
+UNICC_INTERN @@action-base-type @@prefix_act_base[ @@number-of-states ] =
+{
+@@action-base
+};
+
+UNICC_INTERN @@action-check-type @@prefix_act_check[ @@action-comb-size ] =
+{
+@@action-check
+};
+
+UNICC_INTERN @@action-next-type @@prefix_act_next[ @@action-comb-size ] =
+{
+@@action-next
+};
+
+/* GoTo Table as comb vectors */
+UNICC_INTERN @@goto-base-type @@prefix_go_base[ @@number-of-states ] =
+{
+@@goto-base
+};
+
+UNICC_INTERN @@goto-check-type @@prefix_go_check[ @@goto-comb-size ] =
+{
+@@goto-check
+};
+
+UNICC_INTERN @@goto-next-type @@prefix_go_next[ @@goto-comb-size ] =
+{
+@@goto-next
+};
+
+@@endif
+@@if packed-tables
+@@if !comb-tables
+/* Action Table */
+UNICC_INTERN const unsigned char @@prefix_act[] =
+        "@@action-table-blob";
+
+/* GoTo Table */
+UNICC_INTERN const unsigned char @@prefix_go[] =
+        "@@goto-table-blob";
+@@endif
+
+/* Default productions per state */
+UNICC_INTERN const unsigned char @@prefix_def_prod[] =
+        "@@default-productions-blob";
+
+@@if !mode
+/* DFA selection table */
+UNICC_INTERN const unsigned char @@prefix_dfa_select[] =
+        "@@dfa-select-blob";
+@@endif
+
+@@if lexers
+/* DFA index table */
+UNICC_INTERN const unsigned char @@prefix_dfa_idx[] =
+        "@@dfa-index-blob";
+
+/* DFA transition chars */
+UNICC_INTERN const unsigned char @@prefix_dfa_chars[] =
+        "@@dfa-char-blob";
+
+/* DFA transitions */
+UNICC_INTERN const unsigned char @@prefix_dfa_trans[] =
+        "@@dfa-trans-blob";
+
+/* DFA acception states */
+UNICC_INTERN const unsigned char @@prefix_dfa_accept[] =
+        "@@dfa-accept-blob";
+
+@@if case-folding
+/* DFA case-folding flags */
+UNICC_INTERN const unsigned char @@prefix_dfa_fold[] =
+        "@@dfa-fold-blob";
+@@endif
+
+@@if shared-lexers
+/* Accept masks of the states using a shared DFA */
+UNICC_INTERN const unsigned char @@prefix_dfa_mask[] =
+        "@@dfa-mask-blob";
+@@endif
+
+@@endif
+@@else
+@@if !comb-tables
 /* Action Table */
-UNICC_STATIC int @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
+UNICC_INTERN @@action-table-type @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
 {
 @@action-table
 };
 
 /* GoTo Table */
-UNICC_STATIC int @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
+UNICC_INTERN @@goto-table-type @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
 {
 @@goto-table
 };
+@@endif
 
 /* Default productions per state */
-UNICC_STATIC int @@prefix_def_prod[ @@number-of-states ] =
+UNICC_INTERN @@default-productions-type @@prefix_def_prod[ @@number-of-states ] =
 {
 @@default-productions
 };
 
-#if !@@mode
+@@if !mode
 /* DFA selection table */
-UNICC_STATIC int @@prefix_dfa_select[ @@number-of-states ] =
+UNICC_INTERN @@dfa-select-type @@prefix_dfa_select[ @@number-of-states ] =
 {
 @@dfa-select
 };
-#endif
+@@endif
 
-#if @@number-of-dfa-machines
+@@if lexers
 /* DFA index table */
-UNICC_STATIC int @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
+UNICC_INTERN @@dfa-index-type @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
 {
 @@dfa-index
 };
 
 /* DFA transition chars */
-UNICC_STATIC int @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ] =
+UNICC_INTERN @@dfa-char-type @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ] =
 {
 @@dfa-char
 };
 
 /* DFA transitions */
-UNICC_STATIC int @@prefix_dfa_trans[ @@size-of-dfa-characters ] =
+UNICC_INTERN @@dfa-trans-type @@prefix_dfa_trans[ @@size-of-dfa-characters ] =
 {
 @@dfa-trans
 };
 
 /* DFA acception states */
-UNICC_STATIC int @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
+UNICC_INTERN @@dfa-accept-type @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
 {
 @@dfa-accept
 };
 
-#endif
+@@if case-folding
+/* DFA case-folding flags */
+UNICC_INTERN @@dfa-fold-type @@prefix_dfa_fold[ @@number-of-dfa-machines ] =
+{
+@@dfa-fold
+};
+@@endif
+
+@@if shared-lexers
+/* Accept masks of the states using a shared DFA */
+UNICC_INTERN @@dfa-mask-type @@prefix_dfa_mask[ @@number-of-states ][ @@dfa-mask-width ] =
+{
+@@dfa-mask
+};
+@@endif
+
+@@endif
+@@endif
 
 /* Symbol information table */
-UNICC_STATIC @@prefix_syminfo @@prefix_symbols[] =
+UNICC_INTERN @@prefix_syminfo @@prefix_symbols[] =
 {
 @@symbols
 };
 
 /* Production information table */
-UNICC_STATIC @@prefix_prodinfo @@prefix_productions[] =
+UNICC_INTERN @@prefix_prodinfo @@prefix_productions[] =
 {
 @@productions
 };
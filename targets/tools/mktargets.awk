@@ -0,0 +1,55 @@
+# UniCC Stock Target Templates
+# ------------------------------------------------------------------------------
+# AWK-Script to compile the stock target templates (*.tlt) into a C header,
+# which is included by src/build.c to provide the templates even when no
+# target directory is installed or found.
+#
+# Usage: awk -f targets/tools/mktargets.awk targets/*.tlt >src/targets.h
+
+BEGIN		{
+				count = 0
+
+				print "/* Stock target templates. This file was generated by"
+				print "targets/tools/mktargets.awk from the target templates;"
+				print "Don't edit, regenerate it! */"
+			}
+
+FNR == 1	{
+				if( count )
+					print "\t(char*)NULL\n};"
+
+				name[ count ] = FILENAME
+				sub( /^.*\//, "", name[ count ] )
+
+				print ""
+				print "static char*	stock_target_" count "[] ="
+				print "{"
+
+				count++
+			}
+
+			{
+				gsub( /\\/, "&&" )
+				gsub( /"/, "\\\"" )
+				gsub( /\?/, "\\?" )
+				print "\t\"" $0 "\\n\","
+			}
+
+END			{
+				if( count )
+					print "\t(char*)NULL\n};"
+
+				print ""
+				print "static struct"
+				print "{"
+				print "\tchar*\tname;"
+				print "\tchar**\tlines;"
+				print "} stock_targets[] ="
+				print "{"
+
+				for( i = 0; i < count; i++ )
+					print "\t{ \"" name[ i ] "\", stock_target_" i " },"
+
+				print "\t{ (char*)NULL, (char**)NULL }"
+				print "};"
+			}